@@ -1,4 +1,5 @@
 #pragma option({"key": "ENABLE_SKIN",         "default": 0, "type": "Batch"})
+#pragma option({"key": "ENABLE_AUTO_INSTANCE", "default": 0, "type": "Batch"})
 
 #include "vertex/position_only.hlslh"
 
@@ -15,7 +16,11 @@ VSOutput VSMain(VSInput input)
 {
     VSOutput output = (VSOutput)0;
 
+#if ENABLE_AUTO_INSTANCE
+    float4 WorldPos = mul(LOCAL_WORLD(input.InstanceID), input.Pos);
+#else
     float4 WorldPos = mul(World, input.Pos);
+#endif
     output.Pos = mul(VIEW_INFO.ViewProj, float4(WorldPos.xyz, 1.0));
     return output;
 }
@@ -0,0 +1,57 @@
+#include "culling/gpu_culling.hlslh"
+
+#define CULL_GROUP_SIZE 64
+
+[[vk::binding(0, 0)]] cbuffer CullConstants : register(b0, space0)
+{
+    float4   Planes[6];
+    float4   ViewPos;
+    float4x4 ViewProj;
+    float4   HizSize; // xy: size of mip 0, z: mip count
+    uint     InstanceCount;
+    uint     CullFlags;
+}
+
+[[vk::binding(1, 0)]] StructuredBuffer<GPUInstance>   Instances : register(t0, space0);
+[[vk::binding(2, 0)]] RWStructuredBuffer<DrawCommand> Commands  : register(u0, space0);
+[[vk::binding(3, 0)]] RWStructuredBuffer<uint>        DrawCount : register(u1, space0); // GPUCullStats
+
+[[vk::binding(4, 0)]] Texture2D HizBuffer : register(t1, space0);
+[[vk::binding(5, 0)]] SamplerState HizBufferSampler : register(s0, space0);
+
+[numthreads(CULL_GROUP_SIZE, 1, 1)]
+void CSMain(uint3 dtid : SV_DispatchThreadID)
+{
+    if (dtid.x >= InstanceCount) {
+        return;
+    }
+
+    GPUInstance instance = Instances[dtid.x];
+
+    bool visible = (instance.Flags & GPU_INSTANCE_VALID) != 0;
+    if (visible && (CullFlags & GPU_CULL_FRUSTUM) != 0) {
+        visible = FrustumTest(Planes, instance.BoundCenter.xyz, instance.BoundExtent.xyz);
+        if (!visible) {
+            InterlockedAdd(DrawCount[1], 1);
+        }
+    }
+    if (visible && (CullFlags & GPU_CULL_HIZ) != 0) {
+        visible = HizTest(ViewProj, HizSize, HizBuffer, HizBufferSampler, instance.BoundCenter.xyz, instance.BoundExtent.xyz);
+        if (!visible) {
+            InterlockedAdd(DrawCount[2], 1);
+        }
+    }
+
+    // culled instances keep their command slot, the draw is issued with zero instances.
+    DrawCommand cmd;
+    cmd.IndexCount    = instance.IndexCount;
+    cmd.InstanceCount = visible ? 1 : 0;
+    cmd.FirstIndex    = instance.FirstIndex;
+    cmd.VertexOffset  = instance.VertexOffset;
+    cmd.FirstInstance = 0;
+    Commands[instance.CommandIndex] = cmd;
+
+    if (visible) {
+        InterlockedAdd(DrawCount[0], 1);
+    }
+}
@@ -0,0 +1,30 @@
+#define READBACK_GROUP_SIZE 8
+#define READBACK_HEADER     4
+
+[[vk::binding(0, 0)]] cbuffer ReadbackInfo : register(b0, space0)
+{
+    uint2 Size;
+    uint  HasCullStats;
+    uint  Padding;
+}
+
+[[vk::binding(1, 0)]] Texture2D<float>         HizSource : register(t0, space0);
+[[vk::binding(2, 0)]] StructuredBuffer<uint>   CullStats : register(t1, space0);
+[[vk::binding(3, 0)]] RWStructuredBuffer<uint> Readback  : register(u0, space0);
+
+// header: GPUCullStats of the frame, followed by the depth of one pyramid mip.
+[numthreads(READBACK_GROUP_SIZE, READBACK_GROUP_SIZE, 1)]
+void CSMain(uint3 dtid : SV_DispatchThreadID)
+{
+    if (dtid.x == 0 && dtid.y == 0) {
+        for (uint i = 0; i < READBACK_HEADER; ++i) {
+            Readback[i] = HasCullStats != 0 ? CullStats[i] : 0;
+        }
+    }
+
+    if (dtid.x >= Size.x || dtid.y >= Size.y) {
+        return;
+    }
+
+    Readback[READBACK_HEADER + dtid.y * Size.x + dtid.x] = asuint(HizSource.Load(int3(dtid.xy, 0)));
+}
@@ -3,6 +3,7 @@
 #pragma option({"key": "MESH_SHADER_DEBUG",   "default": 0, "type": "Batch"})
 
 #pragma option({"key": "ENABLE_INSTANCE",     "default": 0, "type": "Batch"})
+#pragma option({"key": "ENABLE_AUTO_INSTANCE", "default": 0, "type": "Batch"})
 #pragma option({"key": "ENABLE_NORMAL_MAP",   "default": 0, "type": "Batch"})
 #pragma option({"key": "ENABLE_EMISSIVE_MAP", "default": 0, "type": "Batch"})
 #pragma option({"key": "ENABLE_AO_MAP",       "default": 0, "type": "Batch"})
@@ -28,7 +29,11 @@ VSOutput VSMain(VSInput input)
 {
     VSOutput output = (VSOutput)0;
 
+#if ENABLE_AUTO_INSTANCE
+    float4x4 worldMatrix = LOCAL_WORLD(input.InstanceID);
+#else
     float4x4 worldMatrix = World;
+#endif
 #if ENABLE_SKIN
 	float4x4 skinMat =
 		mul(Bones[input.joints.x], input.weights.x) +
@@ -58,26 +63,10 @@ VSOutput VSMain(VSInput input)
 #if MESH_SHADER
 
 #include "common/hash.hlslh"
+#include "culling/gpu_culling.hlslh"
 
 groupshared Payload TaskPayload;
 //------------------------------------------ Task Shader------------------------------------------//
-bool ConeVisible(Meshlet m, float4x4 world, float3 viewPos, float3 offset)
-{
-    if (m.coneAxis.w >= 0.99) {
-        return true;
-    }
-
-    float3 axis = normalize(mul((float3x3)world, m.coneAxis.xyz));
-    float3 apex = mul((float3x3)world, m.coneApex.xyz + offset);
-    float3 view = normalize(viewPos - apex);
-
-    if (dot(view, -axis) >= m.coneAxis.w)
-    {
-        return false;
-    }
-    return true;
-}
-
 float CalculateMip(float ddx, float ddy)
 {
     return 0.5 * log2(max(ddx, ddy));
@@ -175,9 +164,9 @@ void TASMain(uint gtid : SV_GroupThreadID, uint2 dtid : SV_DispatchThreadID, uin
         Meshlet meshlet = Meshlets[dtid.x + FirstMeshlet];
         visible = meshlet.vertexCount > 0;
 
-//         if (visible) {
-//             visible = ConeVisible(meshlet, World, viewPos, offset.xyz);
-//         }
+        if (visible) {
+            visible = ConeTest(World, viewPos, float4(meshlet.coneApex.xyz + offset.xyz, 1.0), meshlet.coneAxis);
+        }
 
         if (visible) {
             visible = HZBSphereTest(meshlet.center.xyz + offset.xyz, meshlet.center.w, 8);
@@ -33,4 +33,18 @@ if (SKY_EDITOR OR SKY_BUILD_TOOL)
     add_compile_definitions(SKY_EDITOR)
 endif ()
 
+if (SKY_MATH_SCALAR)
+    add_compile_definitions(SKY_MATH_FORCE_SCALAR)
+elseif (SKY_MATH_AVX2 AND CMAKE_SYSTEM_PROCESSOR MATCHES "(x86_64)|(AMD64)|(amd64)")
+    if (MSVC)
+        add_compile_options(/arch:AVX2)
+    else ()
+        add_compile_options(-mavx2 -mfma)
+    endif ()
+endif ()
+
+if (SKY_USE_TLSF_ALLOCATOR)
+    add_compile_definitions(SKY_USE_TLSF_ALLOCATOR)
+endif ()
+
 add_compile_definitions("$<$<CONFIG:Debug>:_DEBUG;DEBUG>")
@@ -10,6 +10,9 @@ endif ()
 option(SKY_BUILD_GLES "build gles" OFF)
 option(SKY_BUILD_TEST "build test" OFF)
 option(SKY_USE_TRACY "use tracy profiler" OFF)
+option(SKY_MATH_SCALAR "disable simd math" OFF)
+option(SKY_MATH_AVX2 "enable avx2/fma math on x86_64" OFF)
+option(SKY_USE_TLSF_ALLOCATOR "tlsf heap behind SystemAllocator" ON)
 
 # todo: controlled by project config json.
 option(SKY_BUILD_XR "xr plugin" OFF)
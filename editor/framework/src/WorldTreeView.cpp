@@ -152,9 +152,7 @@ namespace sky::editor {
             for (auto &index : indices) {
                 std::vector<ActorPtr> actorsToDel;
                 GatherAllChildren(actorsToDel, model->itemFromIndex(index));
-                for (auto &act : actorsToDel)  {
-                    attachedWorld->DetachFromWorld(act);
-                }
+                attachedWorld->DetachFromWorld(actorsToDel);
             }
         });
 
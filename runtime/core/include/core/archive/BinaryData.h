@@ -21,14 +21,20 @@ namespace sky {
     public:
         BinaryData() = default;
         explicit BinaryData(uint32_t size);
+        // view over memory kept alive by owner, nothing is copied or freed.
+        BinaryData(uint8_t *data, uint32_t size, const CounterPtr<RefObject> &owner);
         ~BinaryData() override;
 
+        // a view is turned into an owned copy.
         void Resize(uint32_t);
         uint8_t *Data() { return rawData; }
+        const uint8_t *Data() const { return rawData; }
         size_t Size() const { return size; }
+        bool IsView() const { return static_cast<bool>(owner); }
     private:
         uint8_t* rawData = nullptr;
         uint32_t size = 0;
+        CounterPtr<RefObject> owner;
     };
     using BinaryDataPtr = CounterPtr<BinaryData>;
 
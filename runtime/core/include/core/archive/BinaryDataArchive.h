@@ -0,0 +1,41 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/archive/StreamArchive.h>
+#include <core/archive/BinaryData.h>
+#include <istream>
+#include <streambuf>
+
+namespace sky {
+
+    // input archive over bytes already in memory, e.g. a finished async read or a mapped view.
+    class IBinaryDataArchive : public IStreamArchive {
+    public:
+        explicit IBinaryDataArchive(const BinaryDataPtr &data);
+        ~IBinaryDataArchive() override = default;
+
+        using IInputArchive::LoadRaw;
+
+        bool IsOpen() const override { return static_cast<bool>(binary); }
+
+        const uint8_t *Data() const override { return binary ? binary->Data() : nullptr; }
+        size_t Size() const override { return binary ? binary->Size() : 0; }
+    private:
+        class ViewBuffer : public std::streambuf {
+        public:
+            ViewBuffer(char *begin, size_t size);
+
+        protected:
+            pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+            pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+        };
+
+        BinaryDataPtr binary;
+        ViewBuffer buffer;
+        std::istream stream;
+    };
+
+} // namespace sky
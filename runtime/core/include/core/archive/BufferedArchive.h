@@ -0,0 +1,167 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/archive/StreamArchive.h>
+#include <core/platform/Platform.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace sky {
+
+    template <typename T>
+    concept TriviallyCopyableType = std::is_trivially_copyable_v<T>;
+
+    // non virtual reader, scalars are copied out of a contiguous range with one bounds check.
+    // the range is a caller owned span, the memory behind a stream archive, or a chunk refilled from the stream.
+    class BufferedInputArchive {
+    public:
+        static constexpr size_t DEFAULT_CHUNK = 64 * 1024;
+
+        BufferedInputArchive(const uint8_t *data, size_t size);
+        explicit BufferedInputArchive(IStreamArchive &source, size_t chunkSize = DEFAULT_CHUNK);
+        ~BufferedInputArchive();
+
+        BufferedInputArchive(const BufferedInputArchive &) = delete;
+        BufferedInputArchive &operator=(const BufferedInputArchive &) = delete;
+
+        bool LoadRaw(void *dst, size_t size)
+        {
+            if LIKELY(static_cast<size_t>(end - cursor) >= size) {
+                memcpy(dst, cursor, size);
+                cursor += size;
+                return true;
+            }
+            return LoadSlow(static_cast<uint8_t *>(dst), size);
+        }
+
+        template <TriviallyCopyableType T>
+        bool Load(T &val)
+        {
+            return LoadRaw(&val, sizeof(T));
+        }
+
+        bool Load(std::string &val)
+        {
+            uint32_t length = 0;
+            if (!Load(length)) {
+                return false;
+            }
+            val.resize(length);
+            return LoadRaw(val.data(), length);
+        }
+
+        // element count followed by the elements, copied in one block.
+        template <TriviallyCopyableType T>
+        bool Load(std::vector<T> &val)
+        {
+            uint32_t count = 0;
+            if (!Load(count)) {
+                return false;
+            }
+            val.resize(count);
+            return LoadRaw(val.data(), count * sizeof(T));
+        }
+
+        template <typename T>
+        BufferedInputArchive &operator>>(T &val)
+        {
+            Load(val);
+            return *this;
+        }
+
+        // position in the source.
+        size_t Tell() const { return base + static_cast<size_t>(cursor - begin); }
+
+        // moves the source stream to the read position, unread bytes of the chunk are given back.
+        void Sync();
+
+    private:
+        bool LoadSlow(uint8_t *dst, size_t size);
+        bool Refill();
+
+        const uint8_t *begin  = nullptr;
+        const uint8_t *cursor = nullptr;
+        const uint8_t *end    = nullptr;
+        size_t base = 0;
+
+        IStreamArchive *source = nullptr;
+        std::unique_ptr<uint8_t[]> chunk;
+        size_t chunkSize = 0;
+        bool seekable = false;
+    };
+
+    // non virtual writer, appends into a chunk that is flushed to the sink when full.
+    // without a sink the chunk grows and holds the whole output.
+    class BufferedOutputArchive {
+    public:
+        static constexpr size_t DEFAULT_CHUNK = 64 * 1024;
+
+        BufferedOutputArchive();
+        explicit BufferedOutputArchive(OStreamArchive &sink, size_t chunkSize = DEFAULT_CHUNK);
+        ~BufferedOutputArchive();
+
+        BufferedOutputArchive(const BufferedOutputArchive &) = delete;
+        BufferedOutputArchive &operator=(const BufferedOutputArchive &) = delete;
+
+        bool SaveRaw(const void *src, size_t size)
+        {
+            if LIKELY(capacity - used >= size) {
+                memcpy(buffer.get() + used, src, size);
+                used += size;
+                return true;
+            }
+            return SaveSlow(static_cast<const uint8_t *>(src), size);
+        }
+
+        template <TriviallyCopyableType T>
+        bool Save(const T &val)
+        {
+            return SaveRaw(&val, sizeof(T));
+        }
+
+        bool Save(const std::string_view &val)
+        {
+            return Save(static_cast<uint32_t>(val.size())) && SaveRaw(val.data(), val.size());
+        }
+
+        bool Save(const std::string &val)
+        {
+            return Save(std::string_view(val));
+        }
+
+        template <TriviallyCopyableType T>
+        bool Save(const std::vector<T> &val)
+        {
+            return Save(static_cast<uint32_t>(val.size())) && SaveRaw(val.data(), val.size() * sizeof(T));
+        }
+
+        template <typename T>
+        BufferedOutputArchive &operator<<(const T &val)
+        {
+            Save(val);
+            return *this;
+        }
+
+        void Flush();
+
+        // memory target only.
+        const uint8_t *Data() const { return buffer.get(); }
+        size_t Size() const { return used; }
+
+    private:
+        bool SaveSlow(const uint8_t *src, size_t size);
+
+        OStreamArchive *sink = nullptr;
+        std::unique_ptr<uint8_t[]> buffer;
+        size_t capacity = 0;
+        size_t used = 0;
+    };
+
+} // namespace sky
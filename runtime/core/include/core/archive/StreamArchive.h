@@ -56,6 +56,10 @@ namespace sky {
 
         std::istream &GetStream() const { return stream; }
 
+        // the whole content when the stream reads from memory, Tell() is the offset of the read position.
+        virtual const uint8_t *Data() const { return nullptr; }
+        virtual size_t Size() const { return 0; }
+
         int Peek() override;
         int Get() override;
         size_t Tell() const override;
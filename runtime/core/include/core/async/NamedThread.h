@@ -12,6 +12,7 @@
 
 namespace sky {
 
+    // single worker thread, jobs run in dispatch order.
     class NamedThread {
     public:
         explicit NamedThread(const Name &name = {});
@@ -20,13 +21,19 @@ namespace sky {
         template <typename Func>
         void Dispatch(Func &&func)
         {
-            executor.async(std::forward<Func>(func));
+            executor.silent_async(std::forward<Func>(func));
         }
 
+        // Signal queues a marker, Sync blocks until the jobs dispatched before the last marker have run.
         void Sync();
         void Signal();
 
+        void WaitIdle();
+
+        const Name &GetName() const { return name; }
+
     private:
+        Name name;
         tf::Executor executor;
         Semaphore semaphore;
     };
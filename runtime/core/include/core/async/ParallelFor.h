@@ -0,0 +1,160 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/async/Task.h>
+#include <algorithm>
+#include <thread>
+
+namespace sky {
+
+    namespace impl {
+
+        // guided self scheduling, every claim takes a share of what is left so chunks shrink towards the end.
+        // the caller works on the range too and only waits for chunks already claimed by workers,
+        // late helpers find the range exhausted and leave without touching the caller's stack.
+        struct ParallelRange {
+            std::atomic_uint32_t cursor{0};
+            std::atomic_uint32_t finished{0};
+            uint32_t end        = 0;
+            uint32_t grain      = 1;
+            uint32_t divisor    = 1;
+
+            bool Claim(uint32_t &first, uint32_t &last)
+            {
+                uint32_t current = cursor.load(std::memory_order_relaxed);
+                while (current < end) {
+                    uint32_t size = std::max(grain, (end - current) / divisor);
+                    uint32_t next = std::min(end, current + size);
+                    if (cursor.compare_exchange_weak(current, next, std::memory_order_relaxed)) {
+                        first = current;
+                        last  = next;
+                        return true;
+                    }
+                }
+                return false;
+            }
+        };
+
+        inline uint32_t ParallelHelperCount(TaskExecutor &executor, uint32_t count, uint32_t grain)
+        {
+            uint32_t chunks = (count + grain - 1) / grain;
+            return std::min(executor.GetWorkerCount(TaskPriority::FRAME_CRITICAL), chunks - 1);
+        }
+
+        inline void ParallelJoin(const ParallelRange &range, uint32_t total)
+        {
+            while (range.finished.load(std::memory_order_acquire) != total) {
+                std::this_thread::yield();
+            }
+        }
+
+    } // namespace impl
+
+    // func(first, last) is called for sub ranges of [begin, end), grain is the smallest chunk.
+    template <typename Func>
+    void ParallelFor(TaskExecutor &executor, uint32_t begin, uint32_t end, Func &&func, uint32_t grain = 1)
+    {
+        if (begin >= end) {
+            return;
+        }
+        uint32_t count = end - begin;
+        grain = std::max(grain, 1U);
+
+        uint32_t helpers = impl::ParallelHelperCount(executor, count, grain);
+        if (helpers == 0) {
+            func(begin, end);
+            return;
+        }
+
+        auto range = std::make_shared<impl::ParallelRange>();
+        range->cursor  = begin;
+        range->end     = end;
+        range->grain   = grain;
+        range->divisor = (helpers + 1) * 2;
+
+        auto body = [range, &func]() {
+            uint32_t first = 0;
+            uint32_t last  = 0;
+            while (range->Claim(first, last)) {
+                func(first, last);
+                range->finished.fetch_add(last - first, std::memory_order_release);
+            }
+        };
+
+        for (uint32_t i = 0; i < helpers; ++i) {
+            executor.Dispatch(TaskPriority::FRAME_CRITICAL, body);
+        }
+        body();
+        impl::ParallelJoin(*range, count);
+    }
+
+    template <typename Func>
+    void ParallelFor(uint32_t begin, uint32_t end, Func &&func, uint32_t grain = 1)
+    {
+        ParallelFor(*TaskExecutor::Get(), begin, end, std::forward<Func>(func), grain);
+    }
+
+    // func(first, last, value) folds a sub range into value, combine merges the partial results.
+    template <typename T, typename Func, typename Combine>
+    T ParallelReduce(TaskExecutor &executor, uint32_t begin, uint32_t end, const T &identity, Func &&func, Combine &&combine, uint32_t grain = 1)
+    {
+        if (begin >= end) {
+            return identity;
+        }
+        uint32_t count = end - begin;
+        grain = std::max(grain, 1U);
+
+        uint32_t helpers = impl::ParallelHelperCount(executor, count, grain);
+        if (helpers == 0) {
+            return func(begin, end, identity);
+        }
+
+        auto range = std::make_shared<impl::ParallelRange>();
+        range->cursor  = begin;
+        range->end     = end;
+        range->grain   = grain;
+        range->divisor = (helpers + 1) * 2;
+
+        T result = identity;
+        std::mutex mutex;
+
+        // helpers that claim nothing leave before touching the captured references.
+        // partial results are merged before the items are reported, the caller then owns result again.
+        auto body = [range, &func, &combine, &identity, &result, &mutex]() {
+            uint32_t first = 0;
+            uint32_t last  = 0;
+            if (!range->Claim(first, last)) {
+                return;
+            }
+
+            T value = func(first, last, identity);
+            uint32_t done = last - first;
+            while (range->Claim(first, last)) {
+                value = func(first, last, value);
+                done += last - first;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                result = combine(result, value);
+            }
+            range->finished.fetch_add(done, std::memory_order_release);
+        };
+
+        for (uint32_t i = 0; i < helpers; ++i) {
+            executor.Dispatch(TaskPriority::FRAME_CRITICAL, body);
+        }
+        body();
+        impl::ParallelJoin(*range, count);
+        return result;
+    }
+
+    template <typename T, typename Func, typename Combine>
+    T ParallelReduce(uint32_t begin, uint32_t end, const T &identity, Func &&func, Combine &&combine, uint32_t grain = 1)
+    {
+        return ParallelReduce(*TaskExecutor::Get(), begin, end, identity, std::forward<Func>(func), std::forward<Combine>(combine), grain);
+    }
+
+} // namespace sky
@@ -6,12 +6,26 @@
 
 #include <core/environment/Singleton.h>
 #include <core/template/ReferenceObject.h>
+#include <core/async/NamedThread.h>
+#include <core/async/TaskLane.h>
+#include <core/name/Name.h>
 #include <taskflow/taskflow.hpp>
+#include <condition_variable>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
 
 namespace sky {
 
     struct CallBackAlive {};
 
+    enum class TaskPriority : uint8_t {
+        FRAME_CRITICAL = 0, // work the current frame waits on.
+        STREAMING,          // asset loading and io completion.
+        BACKGROUND,         // long running builds, navmesh, terrain...
+        NUM
+    };
+
     class Task;
     using TaskPtr = CounterPtr<Task>;
 
@@ -20,11 +34,26 @@ namespace sky {
         Task() = default;
         ~Task() override = default;
 
+        // dependencies are collected by PrepareWork, the task is queued once all of them have finished.
         void StartAsync();
 
+        // a task cancelled before it starts skips DoWork and completes with false.
+        // DoWork can poll IsCancelled to stop early.
+        void Cancel() { cancelled.store(true); }
+        bool IsCancelled() const { return cancelled.load(); }
+
         bool IsWorking() const;
         void ResetTask();
-        tf::AsyncTask GetTask() const { return handle; }
+
+        // blocks until the task has completed, do not call it from a task running on the same lane.
+        void Wait();
+
+        void SetPriority(TaskPriority value) { priority = value; }
+        TaskPriority GetPriority() const { return priority; }
+
+        // runs on the named thread instead of the workers of the priority lane.
+        void SetAffinity(const Name &thread) { affinity = thread; }
+        const Name &GetAffinity() const { return affinity; }
 
     protected:
         virtual bool DoWork() = 0;
@@ -33,23 +62,90 @@ namespace sky {
 
         friend class TaskExecutor;
 
-        std::atomic_bool           isDone{false};
-        tf::AsyncTask              handle;
-        std::vector<tf::AsyncTask> dependencies;
+        std::vector<TaskPtr> dependencies;
+
+    private:
+        bool AddSuccessor(const TaskPtr &task);
+        void Release();
+        void Execute();
+
+        TaskPriority priority = TaskPriority::BACKGROUND;
+        Name         affinity;
 
+        std::atomic_bool     working{false};
+        std::atomic_bool     cancelled{false};
+        std::atomic_uint32_t waitCount{0};
+
+        std::mutex              mutex;
+        std::condition_variable cond;
+        std::vector<TaskPtr>    successors;
     };
 
     class TaskExecutor : public Singleton<TaskExecutor> {
     public:
-        explicit TaskExecutor(size_t N);
-        TaskExecutor() = default;
-        ~TaskExecutor() override = default;
-
+        // N workers for the frame critical lane, the other lanes are sized from it.
+        explicit TaskExecutor(size_t N, TaskBackend backend = GetDefaultBackend());
+        TaskExecutor();
+        ~TaskExecutor() override;
+
+        static constexpr const char *RENDER_THREAD = "RenderThread";
+        static constexpr const char *IO_THREAD     = "IOThread";
+
+        // has to be selected before the first TaskExecutor::Get.
+        static void SetDefaultBackend(TaskBackend backend);
+        static TaskBackend GetDefaultBackend();
+
+        template <typename Func>
+        void Dispatch(TaskPriority priority, Func &&func)
+        {
+            Begin();
+            GetLane(priority).Async([this, fn = std::forward<Func>(func)]() mutable {
+                fn();
+                End();
+            });
+        }
+
+        template <typename Func>
+        void Dispatch(const Name &thread, Func &&func)
+        {
+            Begin();
+            GetNamedThread(thread).Dispatch([this, fn = std::forward<Func>(func)]() mutable {
+                fn();
+                End();
+            });
+        }
+
+        void Dispatch(const TaskPtr &task);
+
+        // waits for every lane and named thread, including tasks queued by finishing tasks.
         void WaitForAll();
 
-        tf::Executor &GetExecutor() { return executor; }
+        // named threads are created on first use.
+        NamedThread &GetNamedThread(const Name &name);
+
+        TaskBackend GetBackend() const { return backend; }
+        uint32_t GetWorkerCount(TaskPriority priority = TaskPriority::FRAME_CRITICAL) const
+        {
+            return lanes[static_cast<uint32_t>(priority)]->GetWorkerCount();
+        }
+
+        uint32_t GetPendingCount() const { return pending.load(); }
+
     private:
-        tf::Executor executor;
+        ITaskLane &GetLane(TaskPriority priority) { return *lanes[static_cast<uint32_t>(priority)]; }
+
+        void Begin();
+        void End();
+
+        TaskBackend backend;
+        std::unique_ptr<ITaskLane> lanes[static_cast<uint32_t>(TaskPriority::NUM)];
+
+        std::mutex threadMutex;
+        std::unordered_map<Name, std::unique_ptr<NamedThread>> namedThreads;
+
+        std::atomic_uint32_t    pending{0};
+        std::mutex              idleMutex;
+        std::condition_variable idle;
     };
 
 } // namespace sky
@@ -0,0 +1,87 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/async/Task.h>
+#include <core/platform/Platform.h>
+#include <deque>
+
+namespace sky {
+
+    // task graph rebuilt every frame, Dispatch runs it on a priority lane and Wait joins it.
+    // the graph must not be changed between Dispatch and Wait.
+    class TaskGraph {
+    public:
+        class Handle {
+        public:
+            Handle() = default;
+
+            Handle &Precede(const Handle &next);
+            Handle &Succeed(const Handle &prev);
+
+        private:
+            friend class TaskGraph;
+            Handle(TaskGraph *g, uint32_t i) : graph(g), index(i) {}
+
+            TaskGraph *graph = nullptr;
+            uint32_t   index = 0;
+        };
+
+        // executor defaults to TaskExecutor::Get().
+        explicit TaskGraph(TaskPriority priority = TaskPriority::FRAME_CRITICAL, TaskExecutor *executor = nullptr);
+        ~TaskGraph();
+
+        TaskGraph(const TaskGraph &) = delete;
+        TaskGraph &operator=(const TaskGraph &) = delete;
+
+        template <typename Func>
+        Handle Add(const char *name, Func &&func)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            SKY_ASSERT(!running);
+            auto &node = nodes.emplace_back();
+            node.name = name;
+            node.func = std::forward<Func>(func);
+            return Handle(this, static_cast<uint32_t>(nodes.size() - 1));
+        }
+
+        void Dispatch();
+        void Wait();
+
+        // tasks which have not started yet are skipped, Wait still has to be called.
+        void Cancel() { cancelled.store(true); }
+        bool IsCancelled() const { return cancelled.load(); }
+
+        // drops the tasks of the finished frame.
+        void Reset();
+
+        bool Empty() const;
+        bool IsRunning() const { return running; }
+
+    private:
+        struct Node {
+            const char *name = nullptr;
+            std::function<void()> func;
+            std::vector<uint32_t> successors;
+            uint32_t dependencyCount = 0;
+            std::atomic_uint32_t remaining{0};
+        };
+
+        void Run(uint32_t index);
+
+        TaskPriority  priority;
+        TaskExecutor *executor;
+
+        mutable std::mutex mutex;
+        std::deque<Node>   nodes;
+        std::atomic_bool   cancelled{false};
+        bool               running = false;
+
+        std::atomic_uint32_t    unfinished{0};
+        std::mutex              doneMutex;
+        std::condition_variable doneCond;
+    };
+
+} // namespace sky
@@ -0,0 +1,28 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace sky {
+
+    enum class TaskBackend : uint8_t {
+        TASKFLOW,
+        WORK_STEALING,
+    };
+
+    // worker pool behind one priority lane of the TaskExecutor.
+    class ITaskLane {
+    public:
+        ITaskLane() = default;
+        virtual ~ITaskLane() = default;
+
+        virtual void Async(std::function<void()> &&func) = 0;
+        virtual uint32_t GetWorkerCount() const = 0;
+        virtual void WaitIdle() = 0;
+    };
+
+} // namespace sky
@@ -0,0 +1,66 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/async/TaskLane.h>
+#include <core/async/WorkStealingQueue.h>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace sky {
+
+    // every worker owns a chase-lev deque, jobs spawned by a worker go to its own deque.
+    // idle workers steal from random victims, jobs from other threads go through a shared inject queue.
+    class WorkStealingExecutor : public ITaskLane {
+    public:
+        explicit WorkStealingExecutor(uint32_t workers);
+        ~WorkStealingExecutor() override;
+
+        void Async(std::function<void()> &&func) override;
+        uint32_t GetWorkerCount() const override { return static_cast<uint32_t>(workers.size()); }
+        void WaitIdle() override;
+
+        // index of the calling worker of this executor, -1 on other threads.
+        int32_t GetWorkerId() const;
+
+    private:
+        struct Job {
+            std::function<void()> func;
+        };
+
+        struct Worker {
+            WorkStealingQueue<Job *> queue;
+            std::thread thread;
+            uint32_t seed = 0;
+        };
+
+        void Loop(uint32_t index);
+        Job *FindJob(Worker &worker, uint32_t index);
+        Job *Steal(Worker &worker, uint32_t index);
+        bool HasWork() const;
+        void Execute(Job *job);
+        void Notify();
+
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        mutable std::mutex injectMutex;
+        std::deque<Job *> injectQueue;
+        std::atomic_uint32_t injectCount{0};
+
+        std::mutex sleepMutex;
+        std::condition_variable sleepCond;
+        std::atomic_uint32_t sleeping{0};
+        uint64_t epoch = 0;
+        bool stop = false;
+
+        std::atomic_uint64_t inflight{0};
+        std::mutex idleMutex;
+        std::condition_variable idleCond;
+    };
+
+} // namespace sky
@@ -0,0 +1,155 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace sky {
+
+    // chase-lev deque, Le et al. "Correct and Efficient Work-Stealing for Weak Memory Models".
+    // the owner pushes and pops at the bottom, other threads steal from the top.
+    // T has to be a trivially copyable value such as a pointer, empty slots read as T{}.
+    template <typename T>
+    class WorkStealingQueue {
+    public:
+        explicit WorkStealingQueue(int64_t capacity = 1024)
+        {
+            int64_t size = 1;
+            while (size < capacity) {
+                size <<= 1;
+            }
+            array.store(new Array(size), std::memory_order_relaxed);
+        }
+
+        ~WorkStealingQueue()
+        {
+            for (auto *old : garbage) {
+                delete old;
+            }
+            delete array.load(std::memory_order_relaxed);
+        }
+
+        WorkStealingQueue(const WorkStealingQueue &) = delete;
+        WorkStealingQueue &operator=(const WorkStealingQueue &) = delete;
+
+        bool Empty() const
+        {
+            int64_t b = bottom.load(std::memory_order_relaxed);
+            int64_t t = top.load(std::memory_order_relaxed);
+            return b <= t;
+        }
+
+        int64_t Size() const
+        {
+            int64_t b = bottom.load(std::memory_order_relaxed);
+            int64_t t = top.load(std::memory_order_relaxed);
+            return b > t ? b - t : 0;
+        }
+
+        // owner only.
+        void Push(T item)
+        {
+            int64_t b = bottom.load(std::memory_order_relaxed);
+            int64_t t = top.load(std::memory_order_acquire);
+            Array *a  = array.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity - 1) {
+                a = Grow(a, b, t);
+            }
+            a->Put(b, item);
+            bottom.store(b + 1, std::memory_order_release);
+        }
+
+        // owner only.
+        T Pop()
+        {
+            int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            Array *a  = array.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top.load(std::memory_order_relaxed);
+
+            T item{};
+            if (t <= b) {
+                item = a->Get(b);
+                if (t == b) {
+                    // last item, race against thieves.
+                    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        item = T{};
+                    }
+                    bottom.store(b + 1, std::memory_order_relaxed);
+                }
+            } else {
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        // any thread.
+        T Steal()
+        {
+            int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom.load(std::memory_order_acquire);
+
+            T item{};
+            if (t < b) {
+                Array *a = array.load(std::memory_order_acquire);
+                item = a->Get(t);
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    return T{};
+                }
+            }
+            return item;
+        }
+
+    private:
+        struct Array {
+            explicit Array(int64_t c) : capacity(c), mask(c - 1), data(new std::atomic<T>[static_cast<size_t>(c)])
+            {
+            }
+
+            ~Array()
+            {
+                delete[] data;
+            }
+
+            void Put(int64_t i, T item)
+            {
+                data[i & mask].store(item, std::memory_order_relaxed);
+            }
+
+            T Get(int64_t i) const
+            {
+                return data[i & mask].load(std::memory_order_relaxed);
+            }
+
+            int64_t capacity;
+            int64_t mask;
+            std::atomic<T> *data;
+        };
+
+        Array *Grow(Array *a, int64_t b, int64_t t)
+        {
+            auto *next = new Array(a->capacity * 2);
+            for (int64_t i = t; i != b; ++i) {
+                next->Put(i, a->Get(i));
+            }
+
+            // thieves may still read the old array, it is released with the queue.
+            garbage.emplace_back(a);
+            array.store(next, std::memory_order_release);
+            return next;
+        }
+
+        alignas(64) std::atomic<int64_t> top{0};
+        alignas(64) std::atomic<int64_t> bottom{0};
+        alignas(64) std::atomic<Array *> array{nullptr};
+        std::vector<Array *> garbage;
+    };
+
+} // namespace sky
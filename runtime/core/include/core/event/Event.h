@@ -6,16 +6,23 @@
 
 #include <core/environment/Singleton.h>
 #include <unordered_map>
-#include <set>
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 
 namespace sky {
 
     enum StorageMode : uint8_t {
         IMMEDIATE,
-        BATCHED
+        BATCHED // queued by the broadcasting thread, delivered by EventQueue::Flush.
     };
 
     struct EventTraits {
@@ -25,54 +32,465 @@ namespace sky {
         static constexpr StorageMode STORAGE = StorageMode::IMMEDIATE;
     };
 
-    template <typename Interface, class KeyType = typename Interface::KeyType>
-    class Event {
+    // one connection of a listener, a stale handle is ignored.
+    struct EventHandle {
+        static constexpr uint32_t INVALID_INDEX = ~0U;
+
+        uint32_t index      = INVALID_INDEX;
+        uint32_t generation = 0;
+
+        bool IsValid() const { return index != INVALID_INDEX; }
+        bool operator==(const EventHandle &) const = default;
+    };
+
+    class IEventQueue {
     public:
-        Event()  = default;
-        ~Event() = default;
+        IEventQueue() = default;
+        virtual ~IEventQueue() = default;
+
+        virtual void Flush() = 0;
+    };
+
+    // every batched event storage, flushed together at the frame sync point.
+    class EventQueue : public Singleton<EventQueue> {
+    public:
+        void Register(IEventQueue *queue);
+        void UnRegister(IEventQueue *queue);
+
+        // delivers the queued events on the calling thread, events raised by listeners wait for the next flush.
+        void Flush();
+
+    private:
+        friend class Singleton<EventQueue>;
+        EventQueue() = default;
+        ~EventQueue() override = default;
+
+        std::mutex mutex;
+        std::vector<IEventQueue *> queues;
+    };
+
+    namespace impl {
+        struct NullMutex {
+            void lock() {}
+            void unlock() {}
+        };
+
+        struct NoKey {
+            bool operator==(const NoKey &) const = default;
+        };
 
-        class Storage : public Singleton<Storage> {
+        template <typename Key>
+        struct EventKeyHash : std::hash<Key> {};
+
+        template <>
+        struct EventKeyHash<NoKey> {
+            size_t operator()(const NoKey &) const { return 0; }
+        };
+
+        template <typename Interface>
+        constexpr StorageMode GetStorageMode()
+        {
+            if constexpr (requires { Interface::STORAGE; }) {
+                return Interface::STORAGE;
+            } else {
+                return StorageMode::IMMEDIATE;
+            }
+        }
+
+        template <typename Interface, typename = void>
+        struct EventMutex {
+            using Type = NullMutex;
+        };
+
+        template <typename Interface>
+        struct EventMutex<Interface, std::enable_if_t<!std::is_void_v<typename Interface::MutexType>>> {
+            using Type = typename Interface::MutexType;
+        };
+
+        // the member function a batched event calls, events with the same key and method coalesce.
+        struct EventMethod {
+            std::array<uint8_t, 16> bytes = {};
+            bool valid = false;
+
+            bool operator==(const EventMethod &) const = default;
+
+            template <typename Func>
+            static EventMethod From(const Func &func)
+            {
+                EventMethod method;
+                if constexpr (std::is_member_function_pointer_v<Func> && sizeof(Func) <= sizeof(bytes)) {
+                    std::memcpy(method.bytes.data(), &func, sizeof(Func));
+                    method.valid = true;
+                }
+                return method;
+            }
+        };
+
+        inline uint64_t NextEventStorageId()
+        {
+            static std::atomic_uint64_t next{1};
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // listeners of every key packed for broadcast, a slot remembers its position in the list
+        // so removal by handle is a swap with the last listener.
+        // while a broadcast runs removal only clears the entry, the list is compacted once the outermost one returns.
+        template <typename Interface, typename Key>
+        class EventStorage : public IEventQueue {
         public:
-            void Emplace(const KeyType &key, Interface *listener)
+            static constexpr bool IS_BATCHED = GetStorageMode<Interface>() == StorageMode::BATCHED;
+
+            EventStorage()
             {
-                auto &set = this->listeners[key];
-                set.emplace_back(listener);
+                if constexpr (IS_BATCHED) {
+                    EventQueue::Get()->Register(this);
+                }
             }
 
-            void Erase(Interface *listener)
+            ~EventStorage() override
+            {
+                if constexpr (IS_BATCHED) {
+                    EventQueue::Get()->UnRegister(this);
+                    for (auto &queue : threadQueues) {
+                        for (auto *node = queue->head.exchange(nullptr); node != nullptr;) {
+                            auto *next = node->next;
+                            delete node;
+                            node = next;
+                        }
+                    }
+                }
+            }
+
+            // a unique listener connected before gets its old handle back.
+            EventHandle Emplace(const Key &key, Interface *listener, bool unique = false)
+            {
+                std::lock_guard<Mutex> lock(mutex);
+                if (unique) {
+                    auto iter = owners.find(listener);
+                    if (iter != owners.end()) {
+                        return EventHandle{iter->second, slots[iter->second].generation};
+                    }
+                }
+
+                uint32_t index = 0;
+                if (!freeSlots.empty()) {
+                    index = freeSlots.back();
+                    freeSlots.pop_back();
+                } else {
+                    index = static_cast<uint32_t>(slots.size());
+                    slots.emplace_back();
+                }
+
+                auto &list = listeners[key];
+                auto &slot = slots[index];
+                slot.list     = &list;
+                slot.position = static_cast<uint32_t>(list.listeners.size());
+                list.listeners.emplace_back(listener);
+                list.slots.emplace_back(index);
+                owners.emplace(listener, index);
+                return EventHandle{index, slot.generation};
+            }
+
+            void Erase(const EventHandle &handle)
             {
-                for (auto &pair : this->listeners) {
-                    auto iter = std::find(pair.second.begin(), pair.second.end(), listener);
-                    if (iter != pair.second.end()) {
-                        pair.second.erase(iter);
+                std::lock_guard<Mutex> lock(mutex);
+                if (handle.index >= slots.size() || slots[handle.index].generation != handle.generation ||
+                    slots[handle.index].list == nullptr) {
+                    return;
+                }
+
+                auto *listener = slots[handle.index].list->listeners[slots[handle.index].position];
+                auto range = owners.equal_range(listener);
+                for (auto iter = range.first; iter != range.second; ++iter) {
+                    if (iter->second == handle.index) {
+                        owners.erase(iter);
                         break;
                     }
                 }
+                Release(handle.index);
+            }
+
+            // drops one connection of the listener.
+            void Erase(Interface *listener)
+            {
+                std::lock_guard<Mutex> lock(mutex);
+                auto iter = owners.find(listener);
+                if (iter == owners.end()) {
+                    return;
+                }
+                auto index = iter->second;
+                owners.erase(iter);
+                Release(index);
             }
 
             template <typename T, typename... Args>
-            void BroadCast(const KeyType &key, T &&func, Args &&...args)
+            void BroadCast(const Key &key, T &&func, Args &&...args)
+            {
+                if constexpr (IS_BATCHED) {
+                    Enqueue(key, std::forward<T>(func), std::forward<Args>(args)...);
+                } else {
+                    Dispatch(key, [&](Interface *listener) { std::invoke(func, listener, args...); });
+                }
+            }
+
+            // events of one thread keep their order, a coalesced event takes the place of the first one
+            // with the arguments of the last one. a flush from a listener returns at once,
+            // a flush from another thread waits for the running one.
+            void Flush() override
             {
-                auto iter = this->listeners.find(key);
-                if (iter == this->listeners.end()) {
+                if constexpr (IS_BATCHED) {
+                    if (flushOwner.load(std::memory_order_acquire) == std::this_thread::get_id()) {
+                        return;
+                    }
+                    std::lock_guard<std::mutex> flushLock(flushMutex);
+                    flushOwner.store(std::this_thread::get_id(), std::memory_order_release);
+
+                    {
+                        std::lock_guard<std::mutex> lock(queueMutex);
+                        for (auto &queue : threadQueues) {
+                            // pushed newest first.
+                            Pending *ordered = nullptr;
+                            for (auto *node = queue->head.exchange(nullptr, std::memory_order_acquire); node != nullptr;) {
+                                auto *next = node->next;
+                                node->next = ordered;
+                                ordered    = node;
+                                node       = next;
+                            }
+                            while (ordered != nullptr) {
+                                auto *next = ordered->next;
+                                Collect(ordered);
+                                ordered = next;
+                            }
+                        }
+                    }
+
+                    for (auto *node : batch) {
+                        Dispatch(node->key, [node](Interface *listener) { node->Invoke(listener); });
+                        delete node;
+                    }
+                    batch.clear();
+                    positions.clear();
+                    flushOwner.store(std::thread::id{}, std::memory_order_release);
+                }
+            }
+
+        private:
+            using Mutex = typename EventMutex<Interface>::Type;
+
+            struct ListenerList {
+                std::vector<Interface *> listeners; // null for a listener removed during a broadcast.
+                std::vector<uint32_t> slots;
+                bool holes = false;
+            };
+
+            struct Slot {
+                ListenerList *list = nullptr;
+                uint32_t position = 0;
+                uint32_t generation = 1;
+            };
+
+            struct Pending {
+                virtual ~Pending() = default;
+                virtual void Invoke(Interface *listener) = 0;
+
+                Pending    *next = nullptr;
+                Key         key;
+                EventMethod method;
+            };
+
+            template <typename Func, typename... Args>
+            struct PendingCall : Pending {
+                template <typename F, typename... As>
+                explicit PendingCall(F &&f, As &&...as) : func(std::forward<F>(f)), args(std::forward<As>(as)...) {}
+
+                void Invoke(Interface *listener) override
+                {
+                    std::apply([this, listener](auto &...values) { std::invoke(func, listener, values...); }, args);
+                }
+
+                Func func;
+                std::tuple<Args...> args;
+            };
+
+            // written by one thread, taken as a whole by the flushing thread.
+            struct ThreadQueue {
+                std::atomic<Pending *> head{nullptr};
+            };
+
+            struct CoalesceKey {
+                Key         key;
+                EventMethod method;
+                bool operator==(const CoalesceKey &) const = default;
+            };
+
+            struct CoalesceHash {
+                size_t operator()(const CoalesceKey &value) const
+                {
+                    uint64_t words[2];
+                    std::memcpy(words, value.method.bytes.data(), sizeof(words));
+                    size_t hash = EventKeyHash<Key>{}(value.key);
+                    hash ^= std::hash<uint64_t>{}(words[0]) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+                    hash ^= std::hash<uint64_t>{}(words[1]) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+                    return hash;
+                }
+            };
+
+            void Release(uint32_t index)
+            {
+                auto &slot = slots[index];
+                auto &list = *slot.list;
+                if (dispatching != 0) {
+                    // a swap would move a listener the running broadcast has not reached yet behind it.
+                    list.listeners[slot.position] = nullptr;
+                    list.slots[slot.position]     = INVALID_SLOT;
+                    if (!list.holes) {
+                        list.holes = true;
+                        holeLists.emplace_back(&list);
+                    }
+                } else {
+                    auto last = static_cast<uint32_t>(list.listeners.size() - 1);
+                    if (slot.position != last) {
+                        list.listeners[slot.position] = list.listeners[last];
+                        list.slots[slot.position]     = list.slots[last];
+                        slots[list.slots[slot.position]].position = slot.position;
+                    }
+                    list.listeners.pop_back();
+                    list.slots.pop_back();
+                }
+
+                slot.list = nullptr;
+                ++slot.generation;
+                freeSlots.emplace_back(index);
+            }
+
+            void Compact()
+            {
+                for (auto *list : holeLists) {
+                    uint32_t count = 0;
+                    for (uint32_t i = 0; i < list->listeners.size(); ++i) {
+                        if (list->listeners[i] == nullptr) {
+                            continue;
+                        }
+                        list->listeners[count] = list->listeners[i];
+                        list->slots[count]     = list->slots[i];
+                        slots[list->slots[count]].position = count;
+                        ++count;
+                    }
+                    list->listeners.resize(count);
+                    list->slots.resize(count);
+                    list->holes = false;
+                }
+                holeLists.clear();
+            }
+
+            template <typename Invoke>
+            void Dispatch(const Key &key, Invoke &&invoke)
+            {
+                // listeners run unlocked, they may connect or disconnect any listener from inside.
+                std::unique_lock<Mutex> lock(mutex);
+                auto iter = listeners.find(key);
+                if (iter == listeners.end()) {
                     return;
                 }
 
-                for (auto &listener : iter->second) {
-                    std::invoke(func, listener, std::forward<Args>(args)...);
+                ++dispatching;
+                auto &list = iter->second.listeners;
+                for (size_t i = 0; i < list.size(); ++i) {
+                    auto *listener = list[i];
+                    if (listener == nullptr) {
+                        continue;
+                    }
+                    lock.unlock();
+                    invoke(listener);
+                    lock.lock();
+                }
+                if (--dispatching == 0) {
+                    Compact();
+                }
+            }
+
+            template <typename T, typename... Args>
+            void Enqueue(const Key &key, T &&func, Args &&...args)
+            {
+                using Call = PendingCall<std::decay_t<T>, std::decay_t<Args>...>;
+                auto *node   = new Call(std::forward<T>(func), std::forward<Args>(args)...);
+                node->key    = key;
+                node->method = EventMethod::From(node->func);
+
+                auto &head = GetThreadQueue().head;
+                node->next = head.load(std::memory_order_relaxed);
+                while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+                }
+            }
+
+            ThreadQueue &GetThreadQueue()
+            {
+                // the storage id tells a recreated storage apart from a destroyed one at the same address.
+                thread_local ThreadQueue *local = nullptr;
+                thread_local uint64_t     owner = 0;
+                if (owner != id) {
+                    std::lock_guard<std::mutex> lock(queueMutex);
+                    local = threadQueues.emplace_back(std::make_unique<ThreadQueue>()).get();
+                    owner = id;
+                }
+                return *local;
+            }
+
+            void Collect(Pending *node)
+            {
+                node->next = nullptr;
+                if (node->method.valid) {
+                    auto [iter, emplaced] = positions.try_emplace(CoalesceKey{node->key, node->method}, static_cast<uint32_t>(batch.size()));
+                    if (!emplaced) {
+                        delete batch[iter->second];
+                        batch[iter->second] = node;
+                        return;
+                    }
                 }
+                batch.emplace_back(node);
             }
 
+            static constexpr uint32_t INVALID_SLOT = ~0U;
+
+            Mutex mutex;
+            std::unordered_map<Key, ListenerList, EventKeyHash<Key>> listeners;
+            std::unordered_multimap<Interface *, uint32_t> owners;
+            std::vector<Slot> slots;
+            std::vector<uint32_t> freeSlots;
+            std::vector<ListenerList *> holeLists;
+            uint32_t dispatching = 0; // nested broadcasts, of any thread with a real mutex.
+
+            const uint64_t id = NextEventStorageId();
+            std::mutex queueMutex;
+            std::vector<std::unique_ptr<ThreadQueue>> threadQueues;
+            std::vector<Pending *> batch;
+            std::unordered_map<CoalesceKey, uint32_t, CoalesceHash> positions;
+            std::mutex flushMutex; // batch and positions belong to the flushing thread.
+            std::atomic<std::thread::id> flushOwner;
+        };
+    } // namespace impl
+
+    template <typename Interface, class KeyType = typename Interface::KeyType>
+    class Event {
+    public:
+        Event()  = default;
+        ~Event() = default;
+
+        class Storage : public impl::EventStorage<Interface, KeyType>, public Singleton<Storage> {
         private:
             friend class Singleton<Storage>;
             Storage()  = default;
-            ~Storage() = default;
-            std::unordered_map<KeyType, std::vector<Interface *>> listeners;
+            ~Storage() override = default;
         };
 
-        static void Connect(const KeyType &key, Interface *listener)
+        static EventHandle Connect(const KeyType &key, Interface *listener)
+        {
+            return Storage::Get()->Emplace(key, listener);
+        }
+
+        static void DisConnect(const EventHandle &handle)
         {
-            Storage::Get()->Emplace(key, listener);
+            Storage::Get()->Erase(handle);
         }
 
         static void DisConnect(Interface *listener)
@@ -85,6 +503,12 @@ namespace sky {
         {
             Storage::Get()->BroadCast(key, std::forward<T>(func), std::forward<Args>(args)...);
         }
+
+        // delivers the queued events of this type only, EventQueue flushes every type.
+        static void Flush()
+        {
+            Storage::Get()->Flush();
+        }
     };
 
     template <typename Interface>
@@ -93,39 +517,22 @@ namespace sky {
         Event()  = default;
         ~Event() = default;
 
-        class Storage : public Singleton<Storage> {
-        public:
-            void Emplace(Interface *listener)
-            {
-                listeners.emplace(listener);
-            }
-
-            void Erase(Interface *listener)
-            {
-                auto iter = listeners.find(listener);
-                if (iter != listeners.end()) {
-                    listeners.erase(iter);
-                }
-            }
-
-            template <typename T, typename... Args>
-            void BroadCast(T &&func, Args &&...args)
-            {
-                for (auto &listener : listeners) {
-                    std::invoke(func, listener, std::forward<Args>(args)...);
-                }
-            }
-
+        class Storage : public impl::EventStorage<Interface, impl::NoKey>, public Singleton<Storage> {
         private:
             friend class Singleton<Storage>;
             Storage()  = default;
-            ~Storage() = default;
-            std::set<Interface *> listeners;
+            ~Storage() override = default;
         };
 
-        static void Connect(Interface *listener)
+        // a listener is connected at most once.
+        static EventHandle Connect(Interface *listener)
+        {
+            return Storage::Get()->Emplace(impl::NoKey{}, listener, true);
+        }
+
+        static void DisConnect(const EventHandle &handle)
         {
-            Storage::Get()->Emplace(listener);
+            Storage::Get()->Erase(handle);
         }
 
         static void DisConnect(Interface *listener)
@@ -136,7 +543,12 @@ namespace sky {
         template <typename T, typename... Args>
         static void BroadCast(T &&func, Args &&...args)
         {
-            Storage::Get()->BroadCast(std::forward<T>(func), std::forward<Args>(args)...);
+            Storage::Get()->BroadCast(impl::NoKey{}, std::forward<T>(func), std::forward<Args>(args)...);
+        }
+
+        static void Flush()
+        {
+            Storage::Get()->Flush();
         }
     };
 
@@ -151,20 +563,20 @@ namespace sky {
 
         void Bind(T *inter, KeyType key)
         {
-            Event<T>::Connect(key, inter);
-            val = inter;
+            Reset();
+            handle = Event<T>::Connect(key, inter);
         }
 
         void Reset()
         {
-            if (val != nullptr) {
-                Event<T>::DisConnect(val);
-                val = nullptr;
+            if (handle.IsValid()) {
+                Event<T>::DisConnect(handle);
+                handle = EventHandle{};
             }
         }
 
     private:
-        T *val = nullptr;
+        EventHandle handle;
     };
 
     template <typename T>
@@ -178,19 +590,19 @@ namespace sky {
 
         void Bind(T *inter)
         {
-            Event<T>::Connect(inter);
-            val = inter;
+            Reset();
+            handle = Event<T>::Connect(inter);
         }
 
         void Reset()
         {
-            if (val != nullptr) {
-                Event<T>::DisConnect(val);
-                val = nullptr;
+            if (handle.IsValid()) {
+                Event<T>::DisConnect(handle);
+                handle = EventHandle{};
             }
         }
 
     private:
-        T *val = nullptr;
+        EventHandle handle;
     };
 } // namespace sky
@@ -0,0 +1,174 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <core/environment/Singleton.h>
+#include <core/file/FileSystem.h>
+
+namespace sky {
+
+    namespace impl {
+        class IOUring;
+    } // namespace impl
+
+    enum class IOPriority : uint8_t {
+        HIGH = 0,
+        NORMAL,
+        LOW,
+        NUM
+    };
+
+    enum class IOStatus : uint8_t {
+        PENDING,
+        SUCCESS,
+        FAILED,
+        CANCELLED
+    };
+
+    enum class IOBackend : uint8_t {
+        THREAD_POOL,
+        IO_URING
+    };
+
+    enum class IOCallbackMode : uint8_t {
+        IO_THREAD,     // called on the thread that reaped the read, has to be short.
+        TASK_EXECUTOR, // dispatched to the task executor on the streaming lane.
+    };
+
+    class AsyncRead;
+    using AsyncReadPtr = CounterPtr<AsyncRead>;
+    using AsyncReadCallback = std::function<void(AsyncRead &)>;
+
+    struct FileReadRequest {
+        FilePtr    file;
+        uint64_t   offset   = 0;
+        uint64_t   size     = 0;       // 0 reads to the end of the file.
+        uint8_t   *dst      = nullptr; // nullptr reads into a BinaryData owned by the read.
+        IOPriority priority = IOPriority::NORMAL;
+        AsyncReadCallback callback;
+    };
+
+    class AsyncRead : public RefObject {
+    public:
+        explicit AsyncRead(FileReadRequest &&req) : request(std::move(req)) {}
+        ~AsyncRead() override = default;
+
+        IOStatus GetStatus() const { return status.load(std::memory_order_acquire); }
+        bool IsDone() const { return GetStatus() != IOStatus::PENDING; }
+        void Wait() const;
+
+        // bytes read, short of the requested size only when the read failed or hit the end of the file.
+        uint64_t GetBytes() const { return bytes; }
+        const FileReadRequest &GetRequest() const { return request; }
+
+        // set when the request had no destination.
+        const BinaryDataPtr &GetData() const { return data; }
+        uint8_t *GetDestination() const { return request.dst != nullptr ? request.dst : (data ? data->Data() : nullptr); }
+
+    private:
+        friend class AsyncFileIO;
+
+        enum class Stage : uint8_t {
+            QUEUED,
+            SUBMITTED,
+            DONE
+        };
+
+        FileReadRequest request;
+        BinaryDataPtr data;
+        uint64_t size  = 0;
+        uint64_t bytes = 0;
+        int fd = -1;
+
+        std::atomic<Stage> stage{Stage::QUEUED};
+        std::atomic_bool cancelRequested{false};
+        std::atomic<IOStatus> status{IOStatus::PENDING};
+    };
+
+    struct AsyncFileIOStats {
+        uint64_t submitted     = 0;
+        uint64_t completed     = 0;
+        uint64_t failed        = 0;
+        uint64_t cancelled     = 0;
+        uint64_t bytesRead     = 0;
+        uint32_t maxQueueDepth = 0;
+        double   avgQueueDepth = 0.0; // reads in flight, sampled at every submission.
+    };
+
+    // batched file reads, native files go through io_uring where the kernel allows it and through
+    // a pread thread pool otherwise. files without a native path are read by the pool with IFile::ReadData.
+    class AsyncFileIO : public Singleton<AsyncFileIO> {
+    public:
+        struct Descriptor {
+            IOBackend      backend    = IOBackend::IO_URING;
+            uint32_t       queueDepth = 128; // reads in flight on the ring.
+            uint32_t       threadNum  = 4;   // pool workers when the ring is not available.
+            IOCallbackMode callback   = IOCallbackMode::TASK_EXECUTOR;
+        };
+
+        AsyncFileIO();
+        explicit AsyncFileIO(const Descriptor &desc);
+        ~AsyncFileIO() override;
+
+        AsyncReadPtr Read(FileReadRequest &&request);
+        std::vector<AsyncReadPtr> ReadBatch(std::vector<FileReadRequest> &&requests);
+
+        // true when the read was stopped before it reached the disk.
+        // reads already in flight on the ring are cancelled in the kernel, pool reads run to the end,
+        // both report CANCELLED.
+        bool Cancel(const AsyncReadPtr &read);
+
+        // every read submitted so far has completed, callbacks on the executor may still be running.
+        void WaitIdle();
+
+        IOBackend GetBackend() const { return ring ? IOBackend::IO_URING : IOBackend::THREAD_POOL; }
+        AsyncFileIOStats GetStats() const;
+        void ResetStats();
+
+    private:
+        using Queue = std::deque<AsyncReadPtr>[static_cast<uint32_t>(IOPriority::NUM)];
+
+        void Enqueue(const AsyncReadPtr &read);
+        bool Pop(Queue &queue, AsyncReadPtr &read);
+        bool Prepare(AsyncRead &read);
+        void Complete(const AsyncReadPtr &read, IOStatus status);
+        void SampleDepth(uint32_t depth);
+
+        void PoolLoop();
+        void RingLoop();
+        void ReadBlocking(const AsyncReadPtr &read);
+
+        Descriptor descriptor;
+
+        std::mutex mutex;
+        std::condition_variable poolCond;
+        Queue poolQueue;
+        Queue ringQueue;
+        bool stop = false;
+
+        std::unique_ptr<impl::IOUring> ring;
+        std::thread ringThread;
+        std::vector<std::thread> workers;
+        std::atomic_uint32_t poolBusy{0};
+
+        std::atomic_uint64_t outstanding{0};
+        std::mutex idleMutex;
+        std::condition_variable idleCond;
+
+        mutable std::mutex statsMutex;
+        AsyncFileIOStats stats;
+        uint64_t depthSum = 0;
+        uint64_t depthSamples = 0;
+    };
+
+} // namespace sky
@@ -0,0 +1,50 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/archive/BinaryData.h>
+#include <string>
+
+namespace sky {
+
+    class FilePath;
+
+    enum class FileAccessHint : uint8_t {
+        NORMAL,
+        SEQUENTIAL,
+        RANDOM,
+        WILL_NEED
+    };
+
+    // whole file mapped into the address space, pages come from the page cache on first touch.
+    // the mapping is copy on write, writes through a view stay private to the process.
+    class FileMapping : public RefObject {
+    public:
+        ~FileMapping() override;
+
+        // nullptr for missing or empty files.
+        static CounterPtr<FileMapping> Create(const FilePath &path);
+
+        const uint8_t *Data() const { return data; }
+        uint64_t Size() const { return size; }
+
+        void Advise(uint64_t offset, uint64_t length, FileAccessHint hint) const;
+
+        // view of [offset, offset + length) sharing the mapping, length 0 runs to the end of the file.
+        BinaryDataPtr View(uint64_t offset, uint64_t length, FileAccessHint hint = FileAccessHint::NORMAL);
+
+    private:
+        FileMapping() = default;
+
+        uint8_t *data = nullptr;
+        uint64_t size = 0;
+#ifdef SKY_PLATFORM_WINDOWS
+        void *fileHandle = nullptr;
+        void *mapHandle = nullptr;
+#endif
+    };
+    using FileMappingPtr = CounterPtr<FileMapping>;
+
+} // namespace sky
@@ -9,7 +9,9 @@
 #include <fstream>
 #include <vector>
 #include <filesystem>
+#include <mutex>
 #include <core/archive/BinaryData.h>
+#include <core/file/FileMapping.h>
 #include <core/archive/StreamArchive.h>
 #include <core/template/ReferenceObject.h>
 
@@ -72,6 +74,11 @@ namespace sky {
 
         virtual uint64_t AppendData(const char* data, uint64_t size) = 0;
         virtual std::string GetPath() const = 0;
+
+        // view of [offset, offset + size), size 0 runs to the end of the file.
+        // files without mapping support return an owned copy.
+        virtual BinaryDataPtr Map(uint64_t offset, uint64_t size, FileAccessHint hint = FileAccessHint::NORMAL);
+        virtual bool CanMap() const { return false; }
     };
 
     class NativeFile : public IFile {
@@ -91,11 +98,20 @@ namespace sky {
 
         std::string GetPath() const override;
 
+        // zero copy, views share one mapping of the whole file.
+        BinaryDataPtr Map(uint64_t offset, uint64_t size, FileAccessHint hint = FileAccessHint::NORMAL) override;
+        bool CanMap() const override { return true; }
+
 //        std::istream ReadAsStream(const FilePath &name) override;
 //        std::ostream WriteAsStream(const FilePath &name) override;
 
     private:
+        FileMappingPtr GetMapping();
+
         FilePath filePath;
+
+        std::mutex mutex;
+        FileMappingPtr mapping;
     };
 
     class MemoryFile : public IFile {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -11,6 +12,23 @@
 
 namespace sky {
 
+    namespace impl {
+        constexpr std::array<uint32_t, 256> MakeCrc32cTable()
+        {
+            std::array<uint32_t, 256> table = {};
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t crc = i;
+                for (uint32_t j = 0; j < 8; ++j) {
+                    crc = (crc & 1) != 0 ? 0x82F63B78 ^ (crc >> 1) : crc >> 1;
+                }
+                table[i] = crc;
+            }
+            return table;
+        }
+
+        inline constexpr std::array<uint32_t, 256> CRC32C_TABLE = MakeCrc32cTable();
+    } // namespace impl
+
     class Crc32 {
     public:
         static uint32_t Cal(const uint8_t *buffer, uint32_t size);
@@ -19,6 +37,23 @@ namespace sky {
 
         static uint32_t Cal(const std::string_view &str);
 
+        // continues crc over more data, Extend(Cal(a), b) == Cal(a + b).
+        static uint32_t Extend(uint32_t crc, const uint8_t *buffer, size_t size);
+
+        // table based path, the result of the sse4.2 / armv8 crc path is the same.
+        static uint32_t ExtendSoftware(uint32_t crc, const uint8_t *buffer, size_t size);
+        static bool IsHardwareAccelerated();
+
+        // same value as Cal, usable in constant expressions.
+        static constexpr uint32_t ConstCal(std::string_view str)
+        {
+            uint32_t crc = 0xFFFFFFFF;
+            for (char ch : str) {
+                crc = impl::CRC32C_TABLE[(crc ^ static_cast<uint8_t>(ch)) & 0xFF] ^ (crc >> 8);
+            }
+            return ~crc;
+        }
+
         template <typename T>
         static uint32_t Cal(const T &t)
         {
@@ -28,4 +28,18 @@ namespace sky {
     uint32_t Murmur3Hash32(const uint8_t* data, size_t length, uint32_t seed);
     uint32_t Murmur3Hash32(std::initializer_list<uint32_t> u32List, uint32_t seed);
 
+    // 64 bit hash in the layout of xxh3, meant for large blobs such as shader binaries and mesh buffers.
+    // the stripe loop runs on the widest vector unit found at run time, every level gives the same value.
+    uint64_t Hash64(const void *data, size_t length, uint64_t seed = 0);
+
+    enum class HashSimdLevel : uint8_t {
+        SCALAR,
+        SSE2,
+        AVX2
+    };
+
+    // for tests and benchmarks, a level the cpu does not support falls back to the best supported one.
+    void SetHash64SimdLevel(HashSimdLevel level);
+    HashSimdLevel GetHash64SimdLevel();
+
 } // namespace sky
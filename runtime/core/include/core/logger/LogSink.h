@@ -0,0 +1,91 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/logger/Logger.h>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sky {
+
+    struct LogRecord {
+        LogLevel         level    = LogLevel::INFO;
+        uint32_t         threadId = 0;
+        uint64_t         time     = 0; // ns since epoch.
+        std::string_view tag;
+        std::string_view message;
+    };
+
+    // called from the logger thread, or from the logging thread in synchronous mode, never concurrently.
+    class ILogSink {
+    public:
+        ILogSink() = default;
+        virtual ~ILogSink() = default;
+
+        virtual void Write(const LogRecord &record) = 0;
+        virtual void Flush() {}
+
+        // the process is going down, anything kept in memory should be written out now.
+        virtual void OnCrash() {}
+    };
+
+    class StdoutLogSink : public ILogSink {
+    public:
+        StdoutLogSink() = default;
+        ~StdoutLogSink() override = default;
+
+        void Write(const LogRecord &record) override;
+        void Flush() override;
+    };
+
+    // starts a new file once the current one exceeds maxSize, keeps maxFiles old files as path.1 .. path.N.
+    class RotatingFileLogSink : public ILogSink {
+    public:
+        RotatingFileLogSink(const std::string &path, uint64_t maxSize = 8 * 1024 * 1024, uint32_t maxFiles = 3);
+        ~RotatingFileLogSink() override;
+
+        void Write(const LogRecord &record) override;
+        void Flush() override;
+        void OnCrash() override;
+
+    private:
+        void Open();
+        void Rotate();
+
+        std::string path;
+        uint64_t maxSize;
+        uint32_t maxFiles;
+        uint64_t written = 0;
+        FILE *file = nullptr;
+    };
+
+    // the last lines in fixed slots, dumped to stderr or a file when the process crashes.
+    class MemoryLogSink : public ILogSink {
+    public:
+        static constexpr uint32_t LINE_SIZE = 256;
+
+        explicit MemoryLogSink(uint32_t lineNum = 256, const std::string &dumpPath = {});
+        ~MemoryLogSink() override = default;
+
+        void Write(const LogRecord &record) override;
+        void OnCrash() override;
+
+        // oldest first.
+        std::vector<std::string> GetLines() const;
+        void Dump(FILE *out) const;
+
+    private:
+        uint32_t lineNum;
+        std::string dumpPath;
+        std::unique_ptr<char[]> lines;
+        uint64_t count = 0;
+        mutable std::mutex mutex;
+    };
+
+} // namespace sky
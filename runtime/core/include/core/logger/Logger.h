@@ -3,7 +3,11 @@
 //
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
 #if __ANDROID__
 #include <android/log.h>
 #endif
@@ -12,10 +16,164 @@
 
 namespace sky {
 
+    enum class LogLevel : uint8_t {
+        INFO,
+        WARN,
+        ERR,
+        NONE
+    };
+
+    class ILogSink;
+
+    namespace impl {
+        using LogFormatFn = int (*)(const char *fmt, const uint8_t *args, char *out, size_t size);
+
+        // one call in a thread's ring, the copied tag and the raw arguments follow.
+        struct LogEntry {
+            uint32_t    size;
+            LogLevel    level;
+            uint16_t    tagLength;
+            uint64_t    time;
+            const char *fmt;
+            LogFormatFn format;
+        };
+
+        // reserves room in the calling thread's ring, LogEnd hands the entry to the logger thread.
+        uint8_t *LogBegin(size_t size);
+        void LogEnd(uint8_t *entry);
+
+        bool LogTagEnabled(LogLevel level, const char *tag);
+        int LogPrintf(char *out, size_t size, const char *fmt, ...);
+
+        // arguments are stored raw and formatted later, strings are copied since the caller's buffer may be gone.
+        template <typename T>
+        struct LogArg {
+            static_assert(std::is_trivially_copyable_v<T>, "log arguments have to be printf compatible");
+
+            static size_t Size(const T &) { return sizeof(T); }
+
+            static uint8_t *Write(uint8_t *ptr, const T &val)
+            {
+                memcpy(ptr, &val, sizeof(T));
+                return ptr + sizeof(T);
+            }
+
+            static T Read(const uint8_t *&ptr)
+            {
+                T val;
+                memcpy(&val, ptr, sizeof(T));
+                ptr += sizeof(T);
+                return val;
+            }
+        };
+
+        template <>
+        struct LogArg<const char *> {
+            static constexpr uint32_t NULL_STRING = ~0U;
+
+            static size_t Size(const char *val) { return sizeof(uint32_t) + (val != nullptr ? strlen(val) + 1 : 0); }
+
+            static uint8_t *Write(uint8_t *ptr, const char *val)
+            {
+                uint32_t length = val != nullptr ? static_cast<uint32_t>(strlen(val)) : NULL_STRING;
+                memcpy(ptr, &length, sizeof(uint32_t));
+                ptr += sizeof(uint32_t);
+                if (val != nullptr) {
+                    memcpy(ptr, val, length + 1);
+                    ptr += length + 1;
+                }
+                return ptr;
+            }
+
+            static const char *Read(const uint8_t *&ptr)
+            {
+                uint32_t length = 0;
+                memcpy(&length, ptr, sizeof(uint32_t));
+                ptr += sizeof(uint32_t);
+                if (length == NULL_STRING) {
+                    return "(null)";
+                }
+                const auto *val = reinterpret_cast<const char *>(ptr);
+                ptr += length + 1;
+                return val;
+            }
+        };
+
+        template <typename T>
+        using LogArgType = std::conditional_t<std::is_same_v<std::decay_t<T>, char *>, const char *, std::decay_t<T>>;
+
+        template <typename... Args>
+        int FormatLog(const char *fmt, const uint8_t *args, char *out, size_t size)
+        {
+            // braced initialization reads the arguments in order.
+            std::tuple<Args...> values{LogArg<Args>::Read(args)...};
+            return std::apply([&](const auto &...val) { return LogPrintf(out, size, fmt, val...); }, values);
+        }
+    } // namespace impl
+
+    // calls are filtered by level and tag before anything is captured, arguments are copied into a
+    // per thread ring and formatted by the logger thread, which hands the lines to the sinks.
     class Logger {
     public:
-        static void Print(const char *tag, const char *type, const char *fmt, ...);
+        static bool IsEnabled(LogLevel level, const char *tag)
+        {
+            if (tagLevelNum.load(std::memory_order_relaxed) == 0) {
+                return level >= minLevel.load(std::memory_order_relaxed);
+            }
+            return impl::LogTagEnabled(level, tag);
+        }
+
+        template <typename... Args>
+        static void Log(LogLevel level, const char *tag, const char *fmt, const Args &...args)
+        {
+            size_t tagLength = strlen(tag);
+            size_t size = sizeof(impl::LogEntry) + tagLength + 1 + (impl::LogArg<impl::LogArgType<Args>>::Size(args) + ... + 0);
+
+            uint8_t *ptr = impl::LogBegin(size);
+            auto *entry = reinterpret_cast<impl::LogEntry *>(ptr);
+            entry->level     = level;
+            entry->tagLength = static_cast<uint16_t>(tagLength);
+            entry->fmt       = fmt;
+            entry->format    = &impl::FormatLog<impl::LogArgType<Args>...>;
+
+            uint8_t *cursor = ptr + sizeof(impl::LogEntry);
+            memcpy(cursor, tag, tagLength + 1);
+            cursor += tagLength + 1;
+            ((cursor = impl::LogArg<impl::LogArgType<Args>>::Write(cursor, args)), ...);
+
+            impl::LogEnd(ptr);
+        }
+
+        static void Print(LogLevel level, const char *tag, const char *fmt, ...);
         static void PrintW(const wchar_t *tag, const wchar_t *type, const wchar_t *fmt, ...);
+
+        static void SetLevel(LogLevel level);
+        static LogLevel GetLevel() { return minLevel.load(std::memory_order_relaxed); }
+
+        // overrides the global level for one tag, NONE mutes the tag.
+        static void SetTagLevel(const char *tag, LogLevel level);
+        static void ClearTagLevels();
+
+        // the logger owns the sinks, stdout is registered by default.
+        static void AddSink(ILogSink *sink);
+        static void RemoveSink(ILogSink *sink);
+        static void ClearSinks();
+
+        // when disabled every call is formatted and written on the calling thread.
+        static void SetAsync(bool enable);
+
+        // blocks until everything logged so far reached the sinks.
+        static void Flush();
+
+        // drains pending entries into the sinks and lets them dump their state, safe to call from a crash handler.
+        static void FlushOnCrash();
+        static void InstallCrashHandler();
+
+        static const char *GetLevelName(LogLevel level);
+
+    private:
+        static inline std::atomic<LogLevel> minLevel{LogLevel::INFO};
+        static inline std::atomic_uint32_t tagLevelNum{0};
     };
 
 } // namespace sky
@@ -31,12 +189,20 @@ namespace sky {
 #define LOGW_I(tag, fmt, ...)
 
 #else
-#define LOG_E(tag, fmt, ...) Logger::Print(tag, "ERROR", fmt, ##__VA_ARGS__)
-#define LOG_W(tag, fmt, ...) Logger::Print(tag, "WARNING", fmt, ##__VA_ARGS__)
-#define LOG_I(tag, fmt, ...) Logger::Print(tag, "INFO", fmt, ##__VA_ARGS__)
+// formatting is deferred, the format has to be a literal that outlives the call.
+#define SKY_LOG(level, tag, fmt, ...)                                              \
+    do {                                                                           \
+        if (::sky::Logger::IsEnabled(level, tag)) {                                \
+            ::sky::Logger::Log(level, tag, "" fmt, ##__VA_ARGS__);                 \
+        }                                                                          \
+    } while (false)
 
-#define LOGW_E(tag, fmt, ...) Logger::PrintW(tag, L"ERROR", fmt, ##__VA_ARGS__)
-#define LOGW_W(tag, fmt, ...) Logger::PrintW(tag, L"WARNING", fmt, ##__VA_ARGS__)
-#define LOGW_I(tag, fmt, ...) Logger::PrintW(tag, L"INFO", fmt, ##__VA_ARGS__)
+#define LOG_E(tag, fmt, ...) SKY_LOG(::sky::LogLevel::ERR, tag, fmt, ##__VA_ARGS__)
+#define LOG_W(tag, fmt, ...) SKY_LOG(::sky::LogLevel::WARN, tag, fmt, ##__VA_ARGS__)
+#define LOG_I(tag, fmt, ...) SKY_LOG(::sky::LogLevel::INFO, tag, fmt, ##__VA_ARGS__)
 
-#endif
\ No newline at end of file
+#define LOGW_E(tag, fmt, ...) ::sky::Logger::PrintW(tag, L"ERROR", fmt, ##__VA_ARGS__)
+#define LOGW_W(tag, fmt, ...) ::sky::Logger::PrintW(tag, L"WARNING", fmt, ##__VA_ARGS__)
+#define LOGW_I(tag, fmt, ...) ::sky::Logger::PrintW(tag, L"INFO", fmt, ##__VA_ARGS__)
+
+#endif
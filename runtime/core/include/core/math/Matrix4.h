@@ -43,10 +43,19 @@ namespace sky {
         inline Matrix4& operator/=(float divisor);
 
         inline Vector4 operator*(const Vector4& rhs) const;
+        inline Vector3 TransformPoint(const Vector3& rhs) const;
 
         inline Vector4 &operator[](uint32_t i);
         inline Vector4 operator[](uint32_t i) const;
     };
+
+    // reference implementations, used when SIMD is unavailable and by tests to validate the SIMD path.
+    namespace scalar {
+        inline Matrix4 Mul(const Matrix4 &lhs, const Matrix4 &rhs);
+        inline Vector4 Mul(const Matrix4 &lhs, const Vector4 &rhs);
+        inline Vector3 TransformPoint(const Matrix4 &lhs, const Vector3 &rhs);
+        inline Matrix4 Inverse(const Matrix4 &mat);
+    } // namespace scalar
 }
 
 #include "core/math/Matrix4.inl"
\ No newline at end of file
@@ -32,13 +32,25 @@ namespace sky {
 
     inline Matrix4 Matrix4::operator*(const Matrix4& rhs) const
     {
-        const auto& rw = rhs.m;
+#if SKY_MATH_SIMD
+        const simd::Float4 c0 = simd::Load(m[0].v);
+        const simd::Float4 c1 = simd::Load(m[1].v);
+        const simd::Float4 c2 = simd::Load(m[2].v);
+        const simd::Float4 c3 = simd::Load(m[3].v);
+
         Matrix4 ret;
-        ret[0] = m[0] * rw[0][0] + m[1] * rw[0][1] + m[2] * rw[0][2] + m[3] * rw[0][3];
-        ret[1] = m[0] * rw[1][0] + m[1] * rw[1][1] + m[2] * rw[1][2] + m[3] * rw[1][3];
-        ret[2] = m[0] * rw[2][0] + m[1] * rw[2][1] + m[2] * rw[2][2] + m[3] * rw[2][3];
-        ret[3] = m[0] * rw[3][0] + m[1] * rw[3][1] + m[2] * rw[3][2] + m[3] * rw[3][3];
+        for (uint32_t i = 0; i < 4; ++i) {
+            const simd::Float4 col = simd::Load(rhs.m[i].v);
+            simd::Float4 res = simd::Mul(c0, simd::SplatLane<0>(col));
+            res = simd::MulAdd(c1, simd::SplatLane<1>(col), res);
+            res = simd::MulAdd(c2, simd::SplatLane<2>(col), res);
+            res = simd::MulAdd(c3, simd::SplatLane<3>(col), res);
+            simd::Store(ret.m[i].v, res);
+        }
         return ret;
+#else
+        return scalar::Mul(*this, rhs);
+#endif
     }
 
     inline Matrix4 Matrix4::operator*(float multiplier) const
@@ -95,11 +107,34 @@ namespace sky {
 
     inline Vector4 Matrix4::operator*(const Vector4& rhs) const
     {
-        Vector4 v0 = m[0] * rhs[0];
-        Vector4 v1 = m[1] * rhs[1];
-        Vector4 v2 = m[2] * rhs[2];
-        Vector4 v3 = m[3] * rhs[3];
-        return (v0 + v1) + (v2 + v3);
+#if SKY_MATH_SIMD
+        const simd::Float4 vec = simd::Load(rhs.v);
+        simd::Float4 v01 = simd::Mul(simd::Load(m[0].v), simd::SplatLane<0>(vec));
+        simd::Float4 v23 = simd::Mul(simd::Load(m[2].v), simd::SplatLane<2>(vec));
+        v01 = simd::MulAdd(simd::Load(m[1].v), simd::SplatLane<1>(vec), v01);
+        v23 = simd::MulAdd(simd::Load(m[3].v), simd::SplatLane<3>(vec), v23);
+
+        Vector4 ret;
+        simd::Store(ret.v, simd::Add(v01, v23));
+        return ret;
+#else
+        return scalar::Mul(*this, rhs);
+#endif
+    }
+
+    inline Vector3 Matrix4::TransformPoint(const Vector3& rhs) const
+    {
+#if SKY_MATH_SIMD
+        simd::Float4 v01 = simd::Mul(simd::Load(m[0].v), simd::Splat(rhs.x));
+        simd::Float4 v23 = simd::MulAdd(simd::Load(m[2].v), simd::Splat(rhs.z), simd::Load(m[3].v));
+        v01 = simd::MulAdd(simd::Load(m[1].v), simd::Splat(rhs.y), v01);
+
+        Vector4 ret;
+        simd::Store(ret.v, simd::Add(v01, v23));
+        return Vector3(ret.x, ret.y, ret.z);
+#else
+        return scalar::TransformPoint(*this, rhs);
+#endif
     }
 
     inline Vector4 &Matrix4::operator[](uint32_t i)
@@ -137,60 +172,78 @@ namespace sky {
             m[0][2] * DetCof[2] + m[0][3] * DetCof[3];
     }
 
-    inline Matrix4 Matrix4::Inverse() const
-    {
-        float c00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
-        float c02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
-        float c03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
-
-        float c04 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-        float c06 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
-        float c07 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
-
-        float c08 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
-        float c10 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
-        float c11 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
-
-        float c12 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
-        float c14 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
-        float c15 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
-
-        float c16 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
-        float c18 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
-        float c19 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
-
-        float c20 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
-        float c22 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
-        float c23 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
-
-        Vector4 fac0(c00, c00, c02, c03);
-        Vector4 fac1(c04, c04, c06, c07);
-        Vector4 fac2(c08, c08, c10, c11);
-        Vector4 fac3(c12, c12, c14, c15);
-        Vector4 fac4(c16, c16, c18, c19);
-        Vector4 fac5(c20, c20, c22, c23);
-
-        Vector4 vec0(m[1][0], m[0][0], m[0][0], m[0][0]);
-        Vector4 vec1(m[1][1], m[0][1], m[0][1], m[0][1]);
-        Vector4 vec2(m[1][2], m[0][2], m[0][2], m[0][2]);
-        Vector4 vec3(m[1][3], m[0][3], m[0][3], m[0][3]);
-
-        Vector4 inv0(vec1 * fac0 - vec2 * fac1 + vec3 * fac2);
-        Vector4 inv1(vec0 * fac0 - vec2 * fac3 + vec3 * fac4);
-        Vector4 inv2(vec0 * fac1 - vec1 * fac3 + vec3 * fac5);
-        Vector4 inv3(vec0 * fac2 - vec1 * fac4 + vec2 * fac5);
-
-        Vector4 signA(+1, -1, +1, -1);
-        Vector4 signB(-1, +1, -1, +1);
-        Matrix4 inverse(inv0 * signA, inv1 * signB, inv2 * signA, inv3 * signB);
+#if SKY_MATH_SIMD
+    namespace simd {
+        // {m[2][a], m[2][a], m[1][a], m[1][a]} * {m[3][b], m[3][b], m[3][b], m[2][b]} - (a <-> b)
+        // matches the cofactor pairs (c00, c00, c02, c03) ... of the scalar inverse.
+        template <int a, int b>
+        FORCEINLINE Float4 InverseFactor(Float4 c1, Float4 c2, Float4 c3)
+        {
+            const Float4 xa = Shuffle<a, a, a, a>(c2, c1);
+            const Float4 xb = Shuffle<b, b, b, b>(c2, c1);
+            Float4 ya = Shuffle<a, a, a, a>(c3, c2);
+            Float4 yb = Shuffle<b, b, b, b>(c3, c2);
+            ya = Shuffle<0, 0, 0, 2>(ya, ya);
+            yb = Shuffle<0, 0, 0, 2>(yb, yb);
+            return Sub(Mul(xa, yb), Mul(ya, xb));
+        }
 
-        Vector4 row0(inverse[0][0], inverse[1][0], inverse[2][0], inverse[3][0]);
+        // {m[1][i], m[0][i], m[0][i], m[0][i]}
+        template <int i>
+        FORCEINLINE Float4 InverseSplat(Float4 c0, Float4 c1)
+        {
+            const Float4 tmp = Shuffle<i, i, i, i>(c1, c0);
+            return Shuffle<0, 2, 2, 2>(tmp, tmp);
+        }
+    } // namespace simd
+#endif
 
-        Vector4 dot0(m[0] * row0);
-        float dot1 = (dot0.x + dot0.y) + (dot0.z + dot0.w);
+    inline Matrix4 Matrix4::Inverse() const
+    {
+#if SKY_MATH_SIMD
+        const simd::Float4 c0 = simd::Load(m[0].v);
+        const simd::Float4 c1 = simd::Load(m[1].v);
+        const simd::Float4 c2 = simd::Load(m[2].v);
+        const simd::Float4 c3 = simd::Load(m[3].v);
+
+        const simd::Float4 fac0 = simd::InverseFactor<2, 3>(c1, c2, c3);
+        const simd::Float4 fac1 = simd::InverseFactor<1, 3>(c1, c2, c3);
+        const simd::Float4 fac2 = simd::InverseFactor<1, 2>(c1, c2, c3);
+        const simd::Float4 fac3 = simd::InverseFactor<0, 3>(c1, c2, c3);
+        const simd::Float4 fac4 = simd::InverseFactor<0, 2>(c1, c2, c3);
+        const simd::Float4 fac5 = simd::InverseFactor<0, 1>(c1, c2, c3);
+
+        const simd::Float4 vec0 = simd::InverseSplat<0>(c0, c1);
+        const simd::Float4 vec1 = simd::InverseSplat<1>(c0, c1);
+        const simd::Float4 vec2 = simd::InverseSplat<2>(c0, c1);
+        const simd::Float4 vec3 = simd::InverseSplat<3>(c0, c1);
+
+        const simd::Float4 signA = simd::Set(+1, -1, +1, -1);
+        const simd::Float4 signB = simd::Set(-1, +1, -1, +1);
+
+        simd::Float4 inv0 = simd::Add(simd::Sub(simd::Mul(vec1, fac0), simd::Mul(vec2, fac1)), simd::Mul(vec3, fac2));
+        simd::Float4 inv1 = simd::Add(simd::Sub(simd::Mul(vec0, fac0), simd::Mul(vec2, fac3)), simd::Mul(vec3, fac4));
+        simd::Float4 inv2 = simd::Add(simd::Sub(simd::Mul(vec0, fac1), simd::Mul(vec1, fac3)), simd::Mul(vec3, fac5));
+        simd::Float4 inv3 = simd::Add(simd::Sub(simd::Mul(vec0, fac2), simd::Mul(vec1, fac4)), simd::Mul(vec2, fac5));
+        inv0 = simd::Mul(inv0, signA);
+        inv1 = simd::Mul(inv1, signB);
+        inv2 = simd::Mul(inv2, signA);
+        inv3 = simd::Mul(inv3, signB);
+
+        // row0 = {inv[0][0], inv[1][0], inv[2][0], inv[3][0]}
+        const simd::Float4 row0 = simd::Shuffle<0, 2, 0, 2>(simd::Shuffle<0, 0, 0, 0>(inv0, inv1), simd::Shuffle<0, 0, 0, 0>(inv2, inv3));
+        const simd::Float4 det = simd::HorizontalSum(simd::Mul(c0, row0));
+        const simd::Float4 inverseDet = simd::Splat(1.f / simd::GetX(det));
 
-        float inverseDet = 1.f / dot1;
-        return inverse * inverseDet;
+        Matrix4 ret;
+        simd::Store(ret.m[0].v, simd::Mul(inv0, inverseDet));
+        simd::Store(ret.m[1].v, simd::Mul(inv1, inverseDet));
+        simd::Store(ret.m[2].v, simd::Mul(inv2, inverseDet));
+        simd::Store(ret.m[3].v, simd::Mul(inv3, inverseDet));
+        return ret;
+#else
+        return scalar::Inverse(*this);
+#endif
     }
 
     inline Matrix4 Matrix4::InverseTranspose() const
@@ -246,4 +299,89 @@ namespace sky {
 
         return ret;
     }
-}
\ No newline at end of file
+
+    inline Matrix4 scalar::Mul(const Matrix4 &lhs, const Matrix4 &rhs)
+    {
+        const auto& m = lhs.m;
+        const auto& rw = rhs.m;
+        Matrix4 ret;
+        ret[0] = m[0] * rw[0][0] + m[1] * rw[0][1] + m[2] * rw[0][2] + m[3] * rw[0][3];
+        ret[1] = m[0] * rw[1][0] + m[1] * rw[1][1] + m[2] * rw[1][2] + m[3] * rw[1][3];
+        ret[2] = m[0] * rw[2][0] + m[1] * rw[2][1] + m[2] * rw[2][2] + m[3] * rw[2][3];
+        ret[3] = m[0] * rw[3][0] + m[1] * rw[3][1] + m[2] * rw[3][2] + m[3] * rw[3][3];
+        return ret;
+    }
+
+    inline Vector4 scalar::Mul(const Matrix4 &lhs, const Vector4 &rhs)
+    {
+        const auto& m = lhs.m;
+        Vector4 v0 = m[0] * rhs[0];
+        Vector4 v1 = m[1] * rhs[1];
+        Vector4 v2 = m[2] * rhs[2];
+        Vector4 v3 = m[3] * rhs[3];
+        return (v0 + v1) + (v2 + v3);
+    }
+
+    inline Vector3 scalar::TransformPoint(const Matrix4 &lhs, const Vector3 &rhs)
+    {
+        const auto& m = lhs.m;
+        Vector4 ret = (m[0] * rhs.x + m[1] * rhs.y) + (m[2] * rhs.z + m[3]);
+        return Vector3(ret.x, ret.y, ret.z);
+    }
+
+    inline Matrix4 scalar::Inverse(const Matrix4 &mat)
+    {
+        float c00 = mat.m[2][2] * mat.m[3][3] - mat.m[3][2] * mat.m[2][3];
+        float c02 = mat.m[1][2] * mat.m[3][3] - mat.m[3][2] * mat.m[1][3];
+        float c03 = mat.m[1][2] * mat.m[2][3] - mat.m[2][2] * mat.m[1][3];
+
+        float c04 = mat.m[2][1] * mat.m[3][3] - mat.m[3][1] * mat.m[2][3];
+        float c06 = mat.m[1][1] * mat.m[3][3] - mat.m[3][1] * mat.m[1][3];
+        float c07 = mat.m[1][1] * mat.m[2][3] - mat.m[2][1] * mat.m[1][3];
+
+        float c08 = mat.m[2][1] * mat.m[3][2] - mat.m[3][1] * mat.m[2][2];
+        float c10 = mat.m[1][1] * mat.m[3][2] - mat.m[3][1] * mat.m[1][2];
+        float c11 = mat.m[1][1] * mat.m[2][2] - mat.m[2][1] * mat.m[1][2];
+
+        float c12 = mat.m[2][0] * mat.m[3][3] - mat.m[3][0] * mat.m[2][3];
+        float c14 = mat.m[1][0] * mat.m[3][3] - mat.m[3][0] * mat.m[1][3];
+        float c15 = mat.m[1][0] * mat.m[2][3] - mat.m[2][0] * mat.m[1][3];
+
+        float c16 = mat.m[2][0] * mat.m[3][2] - mat.m[3][0] * mat.m[2][2];
+        float c18 = mat.m[1][0] * mat.m[3][2] - mat.m[3][0] * mat.m[1][2];
+        float c19 = mat.m[1][0] * mat.m[2][2] - mat.m[2][0] * mat.m[1][2];
+
+        float c20 = mat.m[2][0] * mat.m[3][1] - mat.m[3][0] * mat.m[2][1];
+        float c22 = mat.m[1][0] * mat.m[3][1] - mat.m[3][0] * mat.m[1][1];
+        float c23 = mat.m[1][0] * mat.m[2][1] - mat.m[2][0] * mat.m[1][1];
+
+        Vector4 fac0(c00, c00, c02, c03);
+        Vector4 fac1(c04, c04, c06, c07);
+        Vector4 fac2(c08, c08, c10, c11);
+        Vector4 fac3(c12, c12, c14, c15);
+        Vector4 fac4(c16, c16, c18, c19);
+        Vector4 fac5(c20, c20, c22, c23);
+
+        Vector4 vec0(mat.m[1][0], mat.m[0][0], mat.m[0][0], mat.m[0][0]);
+        Vector4 vec1(mat.m[1][1], mat.m[0][1], mat.m[0][1], mat.m[0][1]);
+        Vector4 vec2(mat.m[1][2], mat.m[0][2], mat.m[0][2], mat.m[0][2]);
+        Vector4 vec3(mat.m[1][3], mat.m[0][3], mat.m[0][3], mat.m[0][3]);
+
+        Vector4 inv0(vec1 * fac0 - vec2 * fac1 + vec3 * fac2);
+        Vector4 inv1(vec0 * fac0 - vec2 * fac3 + vec3 * fac4);
+        Vector4 inv2(vec0 * fac1 - vec1 * fac3 + vec3 * fac5);
+        Vector4 inv3(vec0 * fac2 - vec1 * fac4 + vec2 * fac5);
+
+        Vector4 signA(+1, -1, +1, -1);
+        Vector4 signB(-1, +1, -1, +1);
+        Matrix4 inverse(inv0 * signA, inv1 * signB, inv2 * signA, inv3 * signB);
+
+        Vector4 row0(inverse[0][0], inverse[1][0], inverse[2][0], inverse[3][0]);
+
+        Vector4 dot0(mat.m[0] * row0);
+        float dot1 = (dot0.x + dot0.y) + (dot0.z + dot0.w);
+
+        float inverseDet = 1.f / dot1;
+        return inverse * inverseDet;
+    }
+}
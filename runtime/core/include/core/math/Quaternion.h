@@ -50,6 +50,10 @@ namespace sky {
 
         static BaseType Visit(const Quaternion& inVal, size_t index) { return inVal.v[index]; }
     };
+
+    namespace scalar {
+        inline Quaternion Mul(const Quaternion &lhs, const Quaternion &rhs);
+    } // namespace scalar
 } // namespace sky
 
 #include "core/math/Quaternion.inl"
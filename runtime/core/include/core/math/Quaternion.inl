@@ -52,12 +52,30 @@ namespace sky {
 
     inline Quaternion Quaternion::operator*(const Quaternion &rhs) const
     {
-        Quaternion res;
-        res.w = w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z;
-        res.x = w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y;
-        res.y = w * rhs.y + y * rhs.w + z * rhs.x - x * rhs.z;
-        res.z = w * rhs.z + z * rhs.w + x * rhs.y - y * rhs.x;
-        return res;
+#if SKY_MATH_SIMD
+        const simd::Float4 lv = simd::Load(v);
+        const simd::Float4 rv = simd::Load(rhs.v);
+
+        // t0 = w * {rx, ry, rz, rw}
+        // t1 = {x, y, z, x} * {rw, rw, rw, rx} * {+, +, +, -}
+        // t2 = {y, z, x, y} * {rz, rx, ry, ry} * {+, +, +, -}
+        // t3 = {z, x, y, z} * {ry, rz, rx, rz}
+        const simd::Float4 t0 = simd::Mul(simd::SplatLane<3>(lv), rv);
+        const simd::Float4 t1 = simd::Mul(simd::Shuffle<0, 1, 2, 0>(lv, lv), simd::Shuffle<3, 3, 3, 0>(rv, rv));
+        const simd::Float4 t2 = simd::Mul(simd::Shuffle<1, 2, 0, 1>(lv, lv), simd::Shuffle<2, 0, 1, 1>(rv, rv));
+        const simd::Float4 t3 = simd::Mul(simd::Shuffle<2, 0, 1, 2>(lv, lv), simd::Shuffle<1, 2, 0, 2>(rv, rv));
+
+        const simd::Float4 sign = simd::Set(1.f, 1.f, 1.f, -1.f);
+        simd::Float4 res = simd::Add(t0, simd::Mul(t1, sign));
+        res = simd::Add(res, simd::Mul(t2, sign));
+        res = simd::Sub(res, t3);
+
+        Quaternion ret;
+        simd::Store(ret.v, res);
+        return ret;
+#else
+        return scalar::Mul(*this, rhs);
+#endif
     }
 
     inline Vector3 Quaternion::operator*(const Vector3 &rhs) const
@@ -166,4 +184,14 @@ namespace sky {
 
         return res;
     }
+
+    inline Quaternion scalar::Mul(const Quaternion &lhs, const Quaternion &rhs)
+    {
+        Quaternion res;
+        res.w = lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z;
+        res.x = lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y;
+        res.y = lhs.w * rhs.y + lhs.y * rhs.w + lhs.z * rhs.x - lhs.x * rhs.z;
+        res.z = lhs.w * rhs.z + lhs.z * rhs.w + lhs.x * rhs.y - lhs.y * rhs.x;
+        return res;
+    }
 }
@@ -0,0 +1,177 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/platform/Platform.h>
+
+// compile time selection of the math backend.
+// SKY_MATH_FORCE_SCALAR disables every intrinsic path.
+#if !defined(SKY_MATH_FORCE_SCALAR)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define SKY_MATH_SSE 1
+    #elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+        #define SKY_MATH_NEON 1
+    #endif
+#endif
+
+#if SKY_MATH_SSE
+    #include <emmintrin.h>
+    #if defined(__FMA__) || defined(__AVX2__)
+        #include <immintrin.h>
+        #define SKY_MATH_FMA 1
+    #endif
+#elif SKY_MATH_NEON
+    #include <arm_neon.h>
+#endif
+
+#if SKY_MATH_SSE || SKY_MATH_NEON
+    #define SKY_MATH_SIMD 1
+#else
+    #define SKY_MATH_SIMD 0
+#endif
+
+namespace sky::simd {
+
+#if SKY_MATH_SSE
+    using Float4 = __m128;
+
+    FORCEINLINE Float4 Load(const float *p) { return _mm_loadu_ps(p); }
+    FORCEINLINE void Store(float *p, Float4 v) { _mm_storeu_ps(p, v); }
+    FORCEINLINE Float4 Splat(float v) { return _mm_set1_ps(v); }
+    FORCEINLINE Float4 Set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+    FORCEINLINE Float4 Zero() { return _mm_setzero_ps(); }
+
+    FORCEINLINE Float4 Add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+    FORCEINLINE Float4 Sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+    FORCEINLINE Float4 Mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+    FORCEINLINE Float4 Div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+    FORCEINLINE Float4 Min(Float4 a, Float4 b) { return _mm_min_ps(a, b); }
+    FORCEINLINE Float4 Max(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+
+    // a * b + c
+    FORCEINLINE Float4 MulAdd(Float4 a, Float4 b, Float4 c)
+    {
+#if SKY_MATH_FMA
+        return _mm_fmadd_ps(a, b, c);
+#else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+    // c - a * b
+    FORCEINLINE Float4 NegMulAdd(Float4 a, Float4 b, Float4 c)
+    {
+#if SKY_MATH_FMA
+        return _mm_fnmadd_ps(a, b, c);
+#else
+        return _mm_sub_ps(c, _mm_mul_ps(a, b));
+#endif
+    }
+
+    // result = {a[i0], a[i1], b[i2], b[i3]}
+    template <int i0, int i1, int i2, int i3>
+    FORCEINLINE Float4 Shuffle(Float4 a, Float4 b)
+    {
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(i3, i2, i1, i0));
+    }
+
+    template <int i>
+    FORCEINLINE Float4 SplatLane(Float4 a)
+    {
+        return _mm_shuffle_ps(a, a, _MM_SHUFFLE(i, i, i, i));
+    }
+
+    FORCEINLINE float GetX(Float4 a) { return _mm_cvtss_f32(a); }
+
+    FORCEINLINE Float4 Abs(Float4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+    FORCEINLINE Float4 CmpGt(Float4 a, Float4 b) { return _mm_cmpgt_ps(a, b); }
+    FORCEINLINE Float4 Or(Float4 a, Float4 b) { return _mm_or_ps(a, b); }
+
+    // one bit per lane, taken from the lane sign bit.
+    FORCEINLINE uint32_t MoveMask(Float4 a) { return static_cast<uint32_t>(_mm_movemask_ps(a)); }
+
+    FORCEINLINE Float4 HorizontalSum(Float4 a)
+    {
+        Float4 t = _mm_add_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_add_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+    FORCEINLINE void Transpose(Float4 &r0, Float4 &r1, Float4 &r2, Float4 &r3)
+    {
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    }
+
+#elif SKY_MATH_NEON
+    using Float4 = float32x4_t;
+
+    FORCEINLINE Float4 Load(const float *p) { return vld1q_f32(p); }
+    FORCEINLINE void Store(float *p, Float4 v) { vst1q_f32(p, v); }
+    FORCEINLINE Float4 Splat(float v) { return vdupq_n_f32(v); }
+    FORCEINLINE Float4 Set(float x, float y, float z, float w)
+    {
+        const float tmp[4] = {x, y, z, w};
+        return vld1q_f32(tmp);
+    }
+    FORCEINLINE Float4 Zero() { return vdupq_n_f32(0.f); }
+
+    FORCEINLINE Float4 Add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+    FORCEINLINE Float4 Sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+    FORCEINLINE Float4 Mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+    FORCEINLINE Float4 Div(Float4 a, Float4 b) { return vdivq_f32(a, b); }
+    FORCEINLINE Float4 Min(Float4 a, Float4 b) { return vminq_f32(a, b); }
+    FORCEINLINE Float4 Max(Float4 a, Float4 b) { return vmaxq_f32(a, b); }
+
+    FORCEINLINE Float4 MulAdd(Float4 a, Float4 b, Float4 c) { return vfmaq_f32(c, a, b); }
+    FORCEINLINE Float4 NegMulAdd(Float4 a, Float4 b, Float4 c) { return vfmsq_f32(c, a, b); }
+
+    template <int i0, int i1, int i2, int i3>
+    FORCEINLINE Float4 Shuffle(Float4 a, Float4 b)
+    {
+        Float4 res = vmovq_n_f32(vgetq_lane_f32(a, i0));
+        res = vsetq_lane_f32(vgetq_lane_f32(a, i1), res, 1);
+        res = vsetq_lane_f32(vgetq_lane_f32(b, i2), res, 2);
+        res = vsetq_lane_f32(vgetq_lane_f32(b, i3), res, 3);
+        return res;
+    }
+
+    template <int i>
+    FORCEINLINE Float4 SplatLane(Float4 a)
+    {
+        return vdupq_laneq_f32(a, i);
+    }
+
+    FORCEINLINE float GetX(Float4 a) { return vgetq_lane_f32(a, 0); }
+
+    FORCEINLINE Float4 Abs(Float4 a) { return vabsq_f32(a); }
+    FORCEINLINE Float4 CmpGt(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+    FORCEINLINE Float4 Or(Float4 a, Float4 b)
+    {
+        return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+    }
+
+    FORCEINLINE uint32_t MoveMask(Float4 a)
+    {
+        static const int32_t SHIFT[4] = {0, 1, 2, 3};
+        uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(a), 31);
+        return vaddvq_u32(vshlq_u32(bits, vld1q_s32(SHIFT)));
+    }
+
+    FORCEINLINE Float4 HorizontalSum(Float4 a)
+    {
+        return vdupq_n_f32(vaddvq_f32(a));
+    }
+
+    FORCEINLINE void Transpose(Float4 &r0, Float4 &r1, Float4 &r2, Float4 &r3)
+    {
+        float32x4x2_t t0 = vtrnq_f32(r0, r1);
+        float32x4x2_t t1 = vtrnq_f32(r2, r3);
+        r0 = vcombine_f32(vget_low_f32(t0.val[0]), vget_low_f32(t1.val[0]));
+        r1 = vcombine_f32(vget_low_f32(t0.val[1]), vget_low_f32(t1.val[1]));
+        r2 = vcombine_f32(vget_high_f32(t0.val[0]), vget_high_f32(t1.val[0]));
+        r3 = vcombine_f32(vget_high_f32(t0.val[1]), vget_high_f32(t1.val[1]));
+    }
+#endif
+
+} // namespace sky::simd
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "core/math/Math.h"
+#include "core/math/Simd.h"
 
 namespace sky {
 
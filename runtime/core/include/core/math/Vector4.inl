@@ -53,55 +53,79 @@ namespace sky {
 
     inline Vector4& Vector4::operator+=(const Vector4& rhs)
     {
+#if SKY_MATH_SIMD
+        simd::Store(v, simd::Add(simd::Load(v), simd::Load(rhs.v)));
+#else
         x += rhs.x;
         y += rhs.y;
         z += rhs.z;
         w += rhs.w;
+#endif
         return *this;
     }
 
     inline Vector4& Vector4::operator-=(const Vector4& rhs)
     {
+#if SKY_MATH_SIMD
+        simd::Store(v, simd::Sub(simd::Load(v), simd::Load(rhs.v)));
+#else
         x -= rhs.x;
         y -= rhs.y;
         z -= rhs.z;
         w -= rhs.w;
+#endif
         return *this;
     }
 
     inline Vector4& Vector4::operator*=(const Vector4& rhs)
     {
+#if SKY_MATH_SIMD
+        simd::Store(v, simd::Mul(simd::Load(v), simd::Load(rhs.v)));
+#else
         x *= rhs.x;
         y *= rhs.y;
         z *= rhs.z;
         w *= rhs.w;
+#endif
         return *this;
     }
 
     inline Vector4& Vector4::operator/=(const Vector4& rhs)
     {
+#if SKY_MATH_SIMD
+        simd::Store(v, simd::Div(simd::Load(v), simd::Load(rhs.v)));
+#else
         x /= rhs.x;
         y /= rhs.y;
         z /= rhs.z;
         w /= rhs.w;
+#endif
         return *this;
     }
 
     inline Vector4& Vector4::operator*=(float m)
     {
+#if SKY_MATH_SIMD
+        simd::Store(v, simd::Mul(simd::Load(v), simd::Splat(m)));
+#else
         x *= m;
         y *= m;
         z *= m;
         w *= m;
+#endif
         return *this;
     }
 
     inline Vector4& Vector4::operator/=(float d)
     {
+#if SKY_MATH_SIMD
+        simd::Store(v, simd::Div(simd::Load(v), simd::Splat(d)));
+#else
         x /= d;
         y /= d;
         z /= d;
         w /= d;
+#endif
         return *this;
     }
 
@@ -117,8 +141,12 @@ namespace sky {
 
     inline float Vector4::Dot(const Vector4 &rhs) const
     {
+#if SKY_MATH_SIMD
+        return simd::GetX(simd::HorizontalSum(simd::Mul(simd::Load(v), simd::Load(rhs.v))));
+#else
         Vector4 ret = (*this) * rhs;
         return (ret.x + ret.y) + (ret.z + ret.w);
+#endif
     }
 
     inline void Vector4::Normalize()
@@ -7,11 +7,36 @@
 #include <core/memory/LinkedStorage.h>
 #include <core/memory/LinearStorage.h>
 #include <core/environment/Singleton.h>
+#include <core/std/Container.h>
 #include <memory>
 
 namespace sky {
     static constexpr size_t DEFAULT_ALLOC_ALIGNMENT = 8;
 
+    enum class MemoryTag : uint8_t {
+        DEFAULT = 0,
+        CONTAINER,
+        RENDER,
+        SCENE,
+        ASSET,
+        FRAME,
+        NUM
+    };
+
+    struct MemoryTagStats {
+        uint64_t liveBytes = 0;
+        uint64_t peakBytes = 0; // high-water mark
+        uint64_t allocations = 0;
+    };
+
+    struct MemoryStats {
+        MemoryTagStats tags[static_cast<uint32_t>(MemoryTag::NUM)];
+        uint64_t reservedBytes = 0; // taken from the os
+        uint64_t usedBytes     = 0; // blocks handed out, headers and thread caches included
+        uint64_t cachedBytes   = 0; // sitting in thread caches
+        float    fragmentation = 0.f; // 1 - largest free block / free bytes
+    };
+
     class IAllocator {
     public:
         IAllocator() = default;
@@ -19,23 +44,64 @@ namespace sky {
 
         virtual void *Allocate(size_t size, size_t alignment) = 0;
         virtual void Deallocate(void *ptr) = 0;
+
+        virtual void *AllocateTagged(size_t size, size_t alignment, MemoryTag tag) { return Allocate(size, alignment); }
+        virtual MemoryStats GetStats() const { return {}; }
     };
 
     class SystemAllocator : public Singleton<SystemAllocator> {
     public:
         SystemAllocator();
-        ~SystemAllocator() override = default;
+        ~SystemAllocator() override;
 
         void *Allocate(size_t size, size_t alignment);
+        void *Allocate(size_t size, size_t alignment, MemoryTag tag);
         void Deallocate(void *ptr);
 
+        MemoryStats GetStats() const { return impl->GetStats(); }
+        IAllocator *GetAllocator() const { return impl.get(); }
+
+        // upstream for the pmr pools of the engine, allocations are counted under tag.
+        PmrResource *GetMemoryResource(MemoryTag tag = MemoryTag::CONTAINER) const { return resources[static_cast<uint32_t>(tag)].get(); }
+
     private:
         std::unique_ptr<IAllocator> impl;
+        std::unique_ptr<PmrResource> resources[static_cast<uint32_t>(MemoryTag::NUM)];
+    };
+
+    // aligned malloc, the allocator behind SystemAllocator when SKY_USE_TLSF_ALLOCATOR is off.
+    class MallocAllocator : public IAllocator {
+    public:
+        MallocAllocator() = default;
+        ~MallocAllocator() override = default;
+
+        void *Allocate(size_t size, size_t alignment) override;
+        void Deallocate(void *ptr) override;
+    };
+
+    // pmr adaptor over an IAllocator.
+    class AllocatorResource : public PmrResource {
+    public:
+        explicit AllocatorResource(IAllocator *allocator, MemoryTag tag = MemoryTag::CONTAINER) : allocator(allocator), tag(tag) {}
+        ~AllocatorResource() override = default;
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const PmrResource &other) const noexcept override;
+
+    private:
+        IAllocator *allocator;
+        MemoryTag tag;
     };
 
     void* AlignMalloc(size_t size, size_t alignment);
     void AlignFree(void* ptr);
 
+    // whole pages from the os, size is rounded up to the page size by the os.
+    void* AllocatePages(size_t size);
+    void FreePages(void* ptr, size_t size);
+
 #define SAFE_DELETE(ptr) if (ptr) { delete ptr; ptr = nullptr; }
 
 #define SKY_ALLOCATOR(Name, Allocator)                           \
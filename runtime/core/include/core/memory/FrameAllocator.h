@@ -0,0 +1,102 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/std/Container.h>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace sky {
+
+    struct FrameAllocatorStats {
+        uint64_t allocatedBytes  = 0; // handed out during the frame.
+        uint64_t reservedBytes   = 0; // blocks held by the arenas of every frame.
+        uint32_t allocations     = 0;
+        uint32_t heapAllocations = 0; // blocks taken from the heap during the frame, 0 once the arenas are warm.
+    };
+
+    // linear arenas for transient data, nothing is freed before the arenas of a frame are reset.
+    // every thread bumps its own sub arena. after NextFrame the memory of the last frameCount - 1 frames stays valid.
+    class FrameAllocator : public PmrResource {
+    public:
+        struct Descriptor {
+            uint32_t frameCount = 2;
+            uint32_t blockSize  = 256 * 1024;
+        };
+
+        FrameAllocator() : FrameAllocator(Descriptor{}) {}
+        explicit FrameAllocator(const Descriptor &desc);
+        ~FrameAllocator() override;
+
+        FrameAllocator(const FrameAllocator &) = delete;
+        FrameAllocator &operator=(const FrameAllocator &) = delete;
+
+        void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        // must not run concurrently with Allocate.
+        void NextFrame();
+
+        uint32_t GetFrameCount() const { return static_cast<uint32_t>(frames.size()); }
+        const FrameAllocatorStats &GetLastFrameStats() const { return lastFrameStats; }
+
+        // threads beyond the limit share one locked arena, a thread keeps its arena for every allocator.
+        static constexpr uint32_t MAX_THREAD_ARENA = 64;
+
+        struct Arena;
+
+    private:
+        void *do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void *p, size_t bytes, size_t alignment) override {}
+        bool do_is_equal(const PmrResource &other) const noexcept override { return this == &other; }
+
+        struct Frame {
+            std::unique_ptr<Arena> arenas[MAX_THREAD_ARENA + 1];
+        };
+
+        uint32_t blockSize;
+        uint32_t current = 0;
+        std::vector<Frame> frames;
+
+        std::mutex sharedMutex;
+
+        FrameAllocatorStats lastFrameStats;
+    };
+
+    // stl allocator over a FrameAllocator, deallocate does nothing.
+    template <typename T>
+    class FrameStlAllocator {
+    public:
+        using value_type = T;
+
+        explicit FrameStlAllocator(FrameAllocator *alloc) noexcept : allocator(alloc) {}
+
+        template <typename U>
+        FrameStlAllocator(const FrameStlAllocator<U> &other) noexcept : allocator(other.GetAllocator()) {} // NOLINT
+
+        T *allocate(size_t n)
+        {
+            return static_cast<T *>(allocator->Allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T *, size_t) noexcept {}
+
+        FrameAllocator *GetAllocator() const noexcept { return allocator; }
+
+        template <typename U>
+        bool operator==(const FrameStlAllocator<U> &rhs) const noexcept { return allocator == rhs.GetAllocator(); }
+
+        template <typename U>
+        bool operator!=(const FrameStlAllocator<U> &rhs) const noexcept { return allocator != rhs.GetAllocator(); }
+
+    private:
+        FrameAllocator *allocator;
+    };
+
+    template <typename T>
+    using FrameVector = std::vector<T, FrameStlAllocator<T>>;
+
+} // namespace sky
@@ -10,6 +10,10 @@
 #include <vector>
 #include <core/util/Memory.h>
 #include <core/template/ObjectPool.h>
+#include <core/memory/Allocator.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace sky {
 
@@ -73,6 +77,8 @@ namespace sky {
         Block   *SearchDefault(uint64_t size, uint64_t alignment, uint64_t &alignOffset);
         Block   *SearchFreeBlock(uint64_t size, uint32_t &fl, uint32_t &sl);
 
+        uint64_t GetLargestFreeSize() const;
+
     private:
         bool TryBlock(const Block &block, uint64_t size, uint64_t alignment, uint64_t &alignOffset);
         void AllocateFromBlock(Block &block, uint64_t size, uint64_t alignOffset);
@@ -92,14 +98,70 @@ namespace sky {
         ObjectPool<Block> blocks{DEFAULT_BLOCK_POOL_NUM};
     };
 
-    class TLSFAllocator {
+    // general purpose heap, TLSFPools over 4M chunks of os pages.
+    // small requests go through thread local caches first, huge requests map their own pages.
+    class TLSFAllocator : public IAllocator {
     public:
-        TLSFAllocator()  = default;
-        ~TLSFAllocator() = default;
-
         struct Descriptor {
-            uint64_t chunkSize;
+            bool threadCache = true;
         };
+
+        TLSFAllocator() : TLSFAllocator(Descriptor{}) {}
+        explicit TLSFAllocator(const Descriptor &desc);
+        ~TLSFAllocator() override;
+
+        void *Allocate(size_t size, size_t alignment) override;
+        void *AllocateTagged(size_t size, size_t alignment, MemoryTag tag) override;
+        void Deallocate(void *ptr) override;
+
+        // requested size of a live allocation.
+        static size_t GetAllocationSize(const void *ptr);
+
+        // returns the blocks cached by the calling thread.
+        void FlushThreadCache();
+
+        MemoryStats GetStats() const override;
+
+        static constexpr size_t   CHUNK_SIZE        = TLSFPool::DEFAULT_POOL_SIZE;
+        static constexpr size_t   LARGE_SIZE        = CHUNK_SIZE / 4; // mapped on its own above this.
+        static constexpr size_t   HEADER_SIZE       = 32;
+        static constexpr size_t   SMALL_STEP        = 16;
+        static constexpr size_t   SMALL_MAX_SIZE    = 256;
+        static constexpr uint32_t SMALL_CLASS_COUNT = SMALL_MAX_SIZE / SMALL_STEP;
+        static constexpr uint32_t CACHE_LIMIT       = 128; // blocks per class and thread.
+
+        struct Chunk;
+        struct ThreadCache;
+
+    private:
+        friend struct TLSFThreadCaches;
+
+        void *AllocateFromChunks(size_t size, size_t alignment, size_t headerRegion, uint8_t sizeClass, MemoryTag tag);
+        void *AllocatePages(size_t size, size_t alignment, MemoryTag tag);
+        void FreeToChunks(void *ptr);
+        void FreeBatch(void **ptrs, uint32_t count);
+
+        void OnAllocate(MemoryTag tag, size_t size);
+        void OnDeallocate(MemoryTag tag, size_t size);
+
+        ThreadCache *GetThreadCache();
+
+        uint64_t id;
+        Descriptor descriptor;
+
+        mutable std::mutex mutex;
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        Chunk *current = nullptr;
+
+        struct TagCounter {
+            std::atomic_uint64_t live{0};
+            std::atomic_uint64_t peak{0};
+            std::atomic_uint64_t count{0};
+        };
+        TagCounter tags[static_cast<uint32_t>(MemoryTag::NUM)];
+
+        std::atomic_uint64_t pageBytes{0};
+        std::atomic_uint64_t cachedBytes{0};
     };
 
-}
+} // namespace sky
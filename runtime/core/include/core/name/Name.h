@@ -5,17 +5,28 @@
 #pragma once
 
 #include <core/name/NameTypes.h>
+#include <core/hash/Crc32.h>
 #include <functional>
 
 namespace sky {
 
+    // string with its name hash computed at compile time.
+    struct NameLiteral {
+        consteval explicit NameLiteral(std::string_view str) : view(str), hash(Crc32::ConstCal(str)) {}
+
+        std::string_view view;
+        uint32_t hash;
+    };
+
     class Name {
     public:
         Name();
         explicit Name(const char* ch);
+        Name(const NameLiteral &literal); // NOLINT
         ~Name() noexcept = default;
 
         static uint32_t Hash(const char* ch, uint32_t length) noexcept;
+        static constexpr uint32_t Hash(std::string_view str) noexcept { return Crc32::ConstCal(str); }
 
         std::string_view GetStr() const noexcept;
 
@@ -78,6 +89,14 @@ namespace sky {
 #endif
     };
 
+    inline namespace literals {
+        // "Local"_name, only the registry lookup is left for run time.
+        consteval NameLiteral operator""_name(const char *str, size_t len)
+        {
+            return NameLiteral(std::string_view(str, len));
+        }
+    } // namespace literals
+
 } // namespace sky
 
 namespace std {
@@ -0,0 +1,46 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/shapes/AABB.h>
+#include <core/shapes/Frustum.h>
+#include <vector>
+
+namespace sky {
+
+    // structure-of-arrays storage of boxes as center / extent.
+    // storage is padded to a multiple of ALIGN so the kernels never need a scalar tail.
+    struct AABBSoA {
+        static constexpr uint32_t ALIGN = 8;
+
+        void Resize(uint32_t num);
+        void Set(uint32_t index, const AABB &box);
+
+        uint32_t Size() const { return count; }
+
+        uint32_t count = 0;
+        std::vector<float> centerX;
+        std::vector<float> centerY;
+        std::vector<float> centerZ;
+        std::vector<float> extentX;
+        std::vector<float> extentY;
+        std::vector<float> extentZ;
+    };
+
+    inline constexpr uint32_t GetVisibilityWordCount(uint32_t count)
+    {
+        return (count + 63) / 64;
+    }
+
+    inline bool TestVisibility(const uint64_t *visibility, uint32_t index)
+    {
+        return (visibility[index >> 6] & (1ULL << (index & 63))) != 0;
+    }
+
+    // boxes intersecting the frustum get their bit or-ed into visibility.
+    // visibility must hold GetVisibilityWordCount(boxes.Size()) words.
+    void FrustumCulling(const Frustum &frustum, const AABBSoA &boxes, uint64_t *visibility);
+
+} // namespace sky
@@ -0,0 +1,22 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace sky {
+
+    struct RadixSortItem {
+        uint64_t key;
+        uint32_t value;
+    };
+
+    // stable LSD radix sort on 64 bit keys, 8 bits per pass.
+    // passes where every key shares the same digit are skipped.
+    // returns the buffer that holds the sorted result, either items or scratch.
+    RadixSortItem *RadixSort(RadixSortItem *items, RadixSortItem *scratch, size_t count);
+
+} // namespace sky
@@ -4,6 +4,8 @@
 
 #include <core/archive/BinaryData.h>
 #include <core/memory/Allocator.h>
+#include <algorithm>
+#include <cstring>
 namespace sky {
 
     BinaryData::BinaryData(uint32_t inSize) : size(inSize)
@@ -13,21 +15,32 @@ namespace sky {
         }
     }
 
+    BinaryData::BinaryData(uint8_t *data, uint32_t inSize, const CounterPtr<RefObject> &inOwner)
+        : rawData(data)
+        , size(inSize)
+        , owner(inOwner)
+    {
+    }
+
     BinaryData::~BinaryData()
     {
-        if (rawData != nullptr) {
+        if (rawData != nullptr && !owner) {
             AlignFree(rawData);
         }
     }
 
     void BinaryData::Resize(uint32_t newSize)
     {
-        if (size != newSize) {
+        if (size != newSize || owner) {
             void* ptr = AlignMalloc(newSize, 16);
             if (rawData != nullptr) {
-                memcpy(ptr, rawData, size);
+                memcpy(ptr, rawData, std::min(size, newSize));
+                if (!owner) {
+                    AlignFree(rawData);
+                }
             }
             rawData = static_cast<uint8_t*>(ptr);
+            owner.Reset(nullptr);
         }
 
         size = newSize;
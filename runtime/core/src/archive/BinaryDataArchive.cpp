@@ -0,0 +1,48 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/archive/BinaryDataArchive.h>
+
+namespace sky {
+
+    IBinaryDataArchive::ViewBuffer::ViewBuffer(char *begin, size_t size)
+    {
+        setg(begin, begin, begin + size);
+    }
+
+    IBinaryDataArchive::ViewBuffer::pos_type IBinaryDataArchive::ViewBuffer::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+    {
+        if ((which & std::ios_base::in) == 0) {
+            return pos_type(off_type(-1));
+        }
+
+        off_type base = 0;
+        if (dir == std::ios_base::cur) {
+            base = gptr() - eback();
+        } else if (dir == std::ios_base::end) {
+            base = egptr() - eback();
+        }
+
+        off_type target = base + off;
+        if (target < 0 || target > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + target, egptr());
+        return pos_type(target);
+    }
+
+    IBinaryDataArchive::ViewBuffer::pos_type IBinaryDataArchive::ViewBuffer::seekpos(pos_type pos, std::ios_base::openmode which)
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    IBinaryDataArchive::IBinaryDataArchive(const BinaryDataPtr &data)
+        : IStreamArchive(stream)
+        , binary(data)
+        , buffer(data ? reinterpret_cast<char *>(data->Data()) : nullptr, data ? data->Size() : 0)
+        , stream(&buffer)
+    {
+    }
+
+} // namespace sky
@@ -0,0 +1,144 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/archive/BufferedArchive.h>
+#include <algorithm>
+
+namespace sky {
+
+    BufferedInputArchive::BufferedInputArchive(const uint8_t *data, size_t size)
+        : begin(data)
+        , cursor(data)
+        , end(data + size)
+    {
+    }
+
+    BufferedInputArchive::BufferedInputArchive(IStreamArchive &src, size_t size)
+        : source(&src)
+    {
+        size_t pos = src.Tell();
+        seekable = pos != static_cast<size_t>(-1);
+        base = seekable ? pos : 0;
+
+        // memory backed archives are read in place.
+        if (const auto *data = src.Data(); data != nullptr && seekable) {
+            begin = cursor = data + base;
+            end = data + src.Size();
+            return;
+        }
+
+        chunkSize = size;
+        chunk = std::make_unique<uint8_t[]>(chunkSize);
+        begin = cursor = end = chunk.get();
+    }
+
+    BufferedInputArchive::~BufferedInputArchive()
+    {
+        Sync();
+    }
+
+    void BufferedInputArchive::Sync()
+    {
+        if (source == nullptr || !seekable) {
+            return;
+        }
+
+        size_t pos = Tell();
+        source->GetStream().rdbuf()->pubseekpos(static_cast<std::streamoff>(pos), std::ios_base::in);
+        if (chunk) {
+            base = pos;
+            begin = cursor = end = chunk.get();
+        }
+    }
+
+    bool BufferedInputArchive::Refill()
+    {
+        base = Tell();
+        auto num = source->GetStream().rdbuf()->sgetn(reinterpret_cast<char *>(chunk.get()), static_cast<std::streamsize>(chunkSize));
+        begin = cursor = chunk.get();
+        end = begin + std::max(num, std::streamsize(0));
+        return num > 0;
+    }
+
+    bool BufferedInputArchive::LoadSlow(uint8_t *dst, size_t size)
+    {
+        auto avail = static_cast<size_t>(end - cursor);
+        if (avail != 0) {
+            memcpy(dst, cursor, avail);
+            cursor = end;
+            dst += avail;
+            size -= avail;
+        }
+
+        // spans and memory backed archives end here.
+        if (!chunk) {
+            return false;
+        }
+
+        // large blocks skip the chunk, unseekable streams never read ahead.
+        if (size >= chunkSize || !seekable) {
+            base = Tell();
+            auto num = source->GetStream().rdbuf()->sgetn(reinterpret_cast<char *>(dst), static_cast<std::streamsize>(size));
+            base += static_cast<size_t>(std::max(num, std::streamsize(0)));
+            begin = cursor = end = chunk.get();
+            return static_cast<size_t>(num) == size;
+        }
+
+        if (!Refill()) {
+            return false;
+        }
+        avail = std::min(size, static_cast<size_t>(end - cursor));
+        memcpy(dst, cursor, avail);
+        cursor += avail;
+        return avail == size;
+    }
+
+    BufferedOutputArchive::BufferedOutputArchive()
+        : buffer(std::make_unique<uint8_t[]>(DEFAULT_CHUNK))
+        , capacity(DEFAULT_CHUNK)
+    {
+    }
+
+    BufferedOutputArchive::BufferedOutputArchive(OStreamArchive &dst, size_t chunkSize)
+        : sink(&dst)
+        , buffer(std::make_unique<uint8_t[]>(chunkSize))
+        , capacity(chunkSize)
+    {
+    }
+
+    BufferedOutputArchive::~BufferedOutputArchive()
+    {
+        Flush();
+    }
+
+    void BufferedOutputArchive::Flush()
+    {
+        if (sink == nullptr || used == 0) {
+            return;
+        }
+        sink->SaveRaw(reinterpret_cast<const char *>(buffer.get()), used);
+        used = 0;
+    }
+
+    bool BufferedOutputArchive::SaveSlow(const uint8_t *src, size_t size)
+    {
+        if (sink != nullptr) {
+            Flush();
+            if (size >= capacity) {
+                return sink->SaveRaw(reinterpret_cast<const char *>(src), size);
+            }
+        } else {
+            size_t next = std::max(capacity * 2, used + size);
+            auto grown = std::make_unique<uint8_t[]>(next);
+            memcpy(grown.get(), buffer.get(), used);
+            buffer.swap(grown);
+            capacity = next;
+        }
+
+        memcpy(buffer.get() + used, src, size);
+        used += size;
+        return true;
+    }
+
+} // namespace sky
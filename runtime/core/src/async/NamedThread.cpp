@@ -10,13 +10,19 @@ namespace sky {
     }
 
     NamedThread::NamedThread(const Name& name)
-        : executor(1)
+        : name(name)
+        , executor(1)
         , semaphore(1)
     {
-//        Dispatch([name]() { impl::SetCurrentThreadName(name.GetStr()); });
+        if (!name.Empty()) {
+            Dispatch([name]() { impl::SetCurrentThreadName(name.GetStr()); });
+        }
     }
 
-    NamedThread::~NamedThread() = default;
+    NamedThread::~NamedThread()
+    {
+        WaitIdle();
+    }
 
     void NamedThread::Sync()
     {
@@ -25,7 +31,12 @@ namespace sky {
 
     void NamedThread::Signal()
     {
-//        Dispatch([this]() { semaphore.Signal(); });
+        Dispatch([this]() { semaphore.Signal(); });
+    }
+
+    void NamedThread::WaitIdle()
+    {
+        executor.wait_for_all();
     }
 
 } // namespace sky
\ No newline at end of file
@@ -3,37 +3,183 @@
 //
 
 #include <core/async/Task.h>
+#include <core/async/WorkStealingExecutor.h>
+#include <algorithm>
+#include <thread>
 
 namespace sky {
     void Task::StartAsync()
     {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            working = true;
+        }
         PrepareWork();
 
-        CounterPtr<Task> thisTask = this;
+        // one extra count keeps the task from being queued before every dependency is registered.
+        waitCount = 1;
+        TaskPtr thisTask = this;
+        for (auto &dep : dependencies) {
+            if (dep && dep->AddSuccessor(thisTask)) {
+                ++waitCount;
+            }
+        }
+        Release();
+    }
 
-//        handle = TaskExecutor::Get()->GetExecutor().dependent_async([thisTask]() {
-//            bool result = thisTask->DoWork();
-//            thisTask->OnComplete(result);
-//            thisTask->ResetTask();
-//        }, dependencies.begin(), dependencies.end()).first;
+    bool Task::AddSuccessor(const TaskPtr &task)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!working) {
+            return false;
+        }
+        successors.emplace_back(task);
+        return true;
+    }
+
+    void Task::Release()
+    {
+        if (--waitCount == 0) {
+            TaskExecutor::Get()->Dispatch(TaskPtr(this));
+        }
+    }
+
+    void Task::Execute()
+    {
+        bool result = false;
+        if (!cancelled) {
+            result = DoWork();
+        }
+        OnComplete(result && !cancelled);
+
+        std::vector<TaskPtr> next;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            working = false;
+            next.swap(successors);
+        }
+        cond.notify_all();
+
+        for (auto &task : next) {
+            task->Release();
+        }
     }
 
     bool Task::IsWorking() const
     {
-        return !handle.empty();
+        return working.load();
     }
 
     void Task::ResetTask()
     {
-        handle.reset();
+        cancelled = false;
+        dependencies.clear();
+    }
+
+    void Task::Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [this]() { return !working.load(); });
+    }
+
+    class TaskflowLane : public ITaskLane {
+    public:
+        explicit TaskflowLane(size_t workers) : executor(workers) {}
+        ~TaskflowLane() override = default;
+
+        void Async(std::function<void()> &&func) override { executor.silent_async(std::move(func)); }
+        uint32_t GetWorkerCount() const override { return static_cast<uint32_t>(executor.num_workers()); }
+        void WaitIdle() override { executor.wait_for_all(); }
+
+    private:
+        tf::Executor executor;
+    };
+
+    static std::atomic<TaskBackend> DEFAULT_BACKEND{TaskBackend::TASKFLOW};
+
+    void TaskExecutor::SetDefaultBackend(TaskBackend value)
+    {
+        DEFAULT_BACKEND.store(value);
+    }
+
+    TaskBackend TaskExecutor::GetDefaultBackend()
+    {
+        return DEFAULT_BACKEND.load();
+    }
+
+    static size_t DefaultWorkerCount()
+    {
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    static std::unique_ptr<ITaskLane> CreateLane(TaskBackend backend, size_t workers)
+    {
+        if (backend == TaskBackend::WORK_STEALING) {
+            return std::make_unique<WorkStealingExecutor>(static_cast<uint32_t>(workers));
+        }
+        return std::make_unique<TaskflowLane>(workers);
+    }
+
+    TaskExecutor::TaskExecutor() : TaskExecutor(DefaultWorkerCount())
+    {
+    }
+
+    TaskExecutor::TaskExecutor(size_t N, TaskBackend backend) : backend(backend)
+    {
+        N = std::max(N, static_cast<size_t>(1));
+
+        // streaming mostly waits on io, background builds share what the frame leaves idle.
+        lanes[static_cast<uint32_t>(TaskPriority::FRAME_CRITICAL)] = CreateLane(backend, N);
+        lanes[static_cast<uint32_t>(TaskPriority::STREAMING)]      = CreateLane(backend, std::clamp(N / 4, static_cast<size_t>(1), static_cast<size_t>(4)));
+        lanes[static_cast<uint32_t>(TaskPriority::BACKGROUND)]     = CreateLane(backend, std::max(N / 2, static_cast<size_t>(1)));
+    }
+
+    TaskExecutor::~TaskExecutor()
+    {
+        WaitForAll();
+
+        // named threads first, their jobs may still dispatch to the lanes.
+        namedThreads.clear();
+        for (auto &lane : lanes) {
+            lane.reset();
+        }
+    }
+
+    void TaskExecutor::Dispatch(const TaskPtr &task)
+    {
+        if (!task->GetAffinity().Empty()) {
+            Dispatch(task->GetAffinity(), [task]() { task->Execute(); });
+        } else {
+            Dispatch(task->GetPriority(), [task]() { task->Execute(); });
+        }
+    }
+
+    NamedThread &TaskExecutor::GetNamedThread(const Name &name)
+    {
+        std::lock_guard<std::mutex> lock(threadMutex);
+        auto &thread = namedThreads[name];
+        if (!thread) {
+            thread = std::make_unique<NamedThread>(name);
+        }
+        return *thread;
+    }
+
+    void TaskExecutor::Begin()
+    {
+        ++pending;
     }
 
-    TaskExecutor::TaskExecutor(size_t N) : executor(N)
+    void TaskExecutor::End()
     {
+        if (--pending == 0) {
+            std::lock_guard<std::mutex> lock(idleMutex);
+            idle.notify_all();
+        }
     }
 
     void TaskExecutor::WaitForAll()
     {
-        executor.wait_for_all();
+        std::unique_lock<std::mutex> lock(idleMutex);
+        idle.wait(lock, [this]() { return pending.load() == 0; });
     }
-} // namespace sky
\ No newline at end of file
+} // namespace sky
@@ -0,0 +1,124 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/async/TaskGraph.h>
+
+namespace sky {
+
+    TaskGraph::Handle &TaskGraph::Handle::Precede(const Handle &next)
+    {
+        SKY_ASSERT(graph == next.graph);
+        graph->nodes[index].successors.emplace_back(next.index);
+        graph->nodes[next.index].dependencyCount++;
+        return *this;
+    }
+
+    TaskGraph::Handle &TaskGraph::Handle::Succeed(const Handle &prev)
+    {
+        Handle(prev).Precede(*this);
+        return *this;
+    }
+
+    TaskGraph::TaskGraph(TaskPriority priority, TaskExecutor *executor)
+        : priority(priority)
+        , executor(executor != nullptr ? executor : TaskExecutor::Get())
+    {
+    }
+
+    TaskGraph::~TaskGraph()
+    {
+        Wait();
+    }
+
+    void TaskGraph::Run(uint32_t index)
+    {
+        // one ready successor continues on this thread, the others are dispatched.
+        while (true) {
+            auto &node = nodes[index];
+            if (!cancelled.load(std::memory_order_relaxed)) {
+                node.func();
+            }
+
+            uint32_t next = ~0U;
+            for (auto successor : node.successors) {
+                if (nodes[successor].remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    continue;
+                }
+                if (next != ~0U) {
+                    executor->Dispatch(priority, [this, next]() { Run(next); });
+                }
+                next = successor;
+            }
+
+            // the last node counts down under the lock, Wait can not return while it still touches the graph.
+            uint32_t count = unfinished.load(std::memory_order_relaxed);
+            while (count != 1 && !unfinished.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel)) {
+            }
+            if (count == 1) {
+                std::lock_guard<std::mutex> lock(doneMutex);
+                unfinished.store(0, std::memory_order_release);
+                doneCond.notify_all();
+            }
+
+            if (next == ~0U) {
+                break;
+            }
+            index = next;
+        }
+    }
+
+    void TaskGraph::Dispatch()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (running || nodes.empty()) {
+            return;
+        }
+        running = true;
+
+        unfinished.store(static_cast<uint32_t>(nodes.size()));
+        for (auto &node : nodes) {
+            node.remaining.store(node.dependencyCount, std::memory_order_relaxed);
+        }
+
+        // roots are collected first, a fast root may release other nodes while the loop still runs.
+        std::vector<uint32_t> roots;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(nodes.size()); ++i) {
+            if (nodes[i].dependencyCount == 0) {
+                roots.emplace_back(i);
+            }
+        }
+        SKY_ASSERT(!roots.empty());
+        for (auto root : roots) {
+            executor->Dispatch(priority, [this, root]() { Run(root); });
+        }
+    }
+
+    void TaskGraph::Wait()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!running) {
+            return;
+        }
+
+        std::unique_lock<std::mutex> doneLock(doneMutex);
+        doneCond.wait(doneLock, [this]() { return unfinished.load(std::memory_order_acquire) == 0; });
+        running = false;
+    }
+
+    void TaskGraph::Reset()
+    {
+        Wait();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        nodes.clear();
+        cancelled.store(false);
+    }
+
+    bool TaskGraph::Empty() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return nodes.empty();
+    }
+
+} // namespace sky
@@ -0,0 +1,191 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/async/WorkStealingExecutor.h>
+
+namespace sky {
+    namespace impl {
+        void SetCurrentThreadName(const std::string_view &name);
+    }
+
+    static constexpr uint32_t SPIN_COUNT = 64;
+
+    static thread_local WorkStealingExecutor *tlsExecutor = nullptr;
+    static thread_local int32_t tlsWorker = -1;
+
+    static uint32_t XorShift(uint32_t &state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    WorkStealingExecutor::WorkStealingExecutor(uint32_t count)
+    {
+        count = std::max(count, 1U);
+        workers.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            workers.emplace_back(std::make_unique<Worker>());
+            workers.back()->seed = 0x9E3779B9U * (i + 1);
+        }
+
+        // threads start after every deque exists, thieves index the whole array.
+        for (uint32_t i = 0; i < count; ++i) {
+            workers[i]->thread = std::thread([this, i]() { Loop(i); });
+        }
+    }
+
+    WorkStealingExecutor::~WorkStealingExecutor()
+    {
+        WaitIdle();
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stop = true;
+        }
+        sleepCond.notify_all();
+        for (auto &worker : workers) {
+            worker->thread.join();
+        }
+    }
+
+    int32_t WorkStealingExecutor::GetWorkerId() const
+    {
+        return tlsExecutor == this ? tlsWorker : -1;
+    }
+
+    void WorkStealingExecutor::Async(std::function<void()> &&func)
+    {
+        auto *job = new Job{std::move(func)};
+        inflight.fetch_add(1, std::memory_order_relaxed);
+
+        int32_t id = GetWorkerId();
+        if (id >= 0) {
+            workers[static_cast<uint32_t>(id)]->queue.Push(job);
+        } else {
+            std::lock_guard<std::mutex> lock(injectMutex);
+            injectQueue.emplace_back(job);
+            injectCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        Notify();
+    }
+
+    void WorkStealingExecutor::Notify()
+    {
+        // pairs with the increment in Loop, either the sleeper sees the job or we see the sleeper.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            ++epoch;
+        }
+        sleepCond.notify_one();
+    }
+
+    bool WorkStealingExecutor::HasWork() const
+    {
+        if (injectCount.load(std::memory_order_relaxed) != 0) {
+            return true;
+        }
+        for (const auto &worker : workers) {
+            if (!worker->queue.Empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    WorkStealingExecutor::Job *WorkStealingExecutor::Steal(Worker &worker, uint32_t index)
+    {
+        if (injectCount.load(std::memory_order_relaxed) != 0) {
+            std::lock_guard<std::mutex> lock(injectMutex);
+            if (!injectQueue.empty()) {
+                auto *job = injectQueue.front();
+                injectQueue.pop_front();
+                injectCount.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        auto count = static_cast<uint32_t>(workers.size());
+        if (count == 1) {
+            return nullptr;
+        }
+
+        // random start, then sweep every other worker once.
+        uint32_t start = XorShift(worker.seed) % count;
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t victim = (start + i) % count;
+            if (victim == index) {
+                continue;
+            }
+            if (auto *job = workers[victim]->queue.Steal(); job != nullptr) {
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    WorkStealingExecutor::Job *WorkStealingExecutor::FindJob(Worker &worker, uint32_t index)
+    {
+        if (auto *job = worker.queue.Pop(); job != nullptr) {
+            return job;
+        }
+        for (uint32_t i = 0; i < SPIN_COUNT; ++i) {
+            if (auto *job = Steal(worker, index); job != nullptr) {
+                return job;
+            }
+            std::this_thread::yield();
+        }
+        return nullptr;
+    }
+
+    void WorkStealingExecutor::Execute(Job *job)
+    {
+        job->func();
+        delete job;
+
+        if (inflight.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lock(idleMutex);
+            idleCond.notify_all();
+        }
+    }
+
+    void WorkStealingExecutor::Loop(uint32_t index)
+    {
+        tlsExecutor = this;
+        tlsWorker   = static_cast<int32_t>(index);
+        impl::SetCurrentThreadName("WorkStealingWorker");
+
+        auto &worker = *workers[index];
+        while (true) {
+            if (auto *job = FindJob(worker, index); job != nullptr) {
+                Execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleeping.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (stop) {
+                sleeping.fetch_sub(1, std::memory_order_relaxed);
+                break;
+            }
+            if (!HasWork()) {
+                uint64_t current = epoch;
+                sleepCond.wait(lock, [this, current]() { return stop || epoch != current; });
+            }
+            sleeping.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    void WorkStealingExecutor::WaitIdle()
+    {
+        std::unique_lock<std::mutex> lock(idleMutex);
+        idleCond.wait(lock, [this]() { return inflight.load(std::memory_order_acquire) == 0; });
+    }
+
+} // namespace sky
@@ -0,0 +1,34 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/event/Event.h>
+
+namespace sky {
+
+    void EventQueue::Register(IEventQueue *queue)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queues.emplace_back(queue);
+    }
+
+    void EventQueue::UnRegister(IEventQueue *queue)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queues.erase(std::remove(queues.begin(), queues.end(), queue), queues.end());
+    }
+
+    void EventQueue::Flush()
+    {
+        // copied, a listener may touch an event type for the first time and register it.
+        std::vector<IEventQueue *> current;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current = queues;
+        }
+        for (auto *queue : current) {
+            queue->Flush();
+        }
+    }
+
+} // namespace sky
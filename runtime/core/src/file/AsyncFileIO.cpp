@@ -0,0 +1,491 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/file/AsyncFileIO.h>
+#include <core/async/Task.h>
+#include <core/logger/Logger.h>
+#include "IOUring.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#ifndef SKY_PLATFORM_WINDOWS
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+static const char *TAG = "AsyncFileIO";
+
+namespace sky {
+    namespace impl {
+        void SetCurrentThreadName(const std::string_view &name);
+    }
+
+    namespace {
+
+        constexpr uint64_t CANCEL_TAG = 1ULL << 63;
+        constexpr uint64_t MAX_READ_CHUNK = 1ULL << 30;
+
+        // native files are read by path with the os, everything else through IFile::ReadData.
+        bool IsNative(const AsyncRead &read)
+        {
+#ifdef SKY_PLATFORM_WINDOWS
+            return false;
+#else
+            return read.GetRequest().file->CanMap();
+#endif
+        }
+
+    } // namespace
+
+    void AsyncRead::Wait() const
+    {
+        while (status.load(std::memory_order_acquire) == IOStatus::PENDING) {
+            status.wait(IOStatus::PENDING, std::memory_order_acquire);
+        }
+    }
+
+    AsyncFileIO::AsyncFileIO() : AsyncFileIO(Descriptor{})
+    {
+    }
+
+    AsyncFileIO::AsyncFileIO(const Descriptor &desc) : descriptor(desc)
+    {
+        descriptor.queueDepth = std::max(descriptor.queueDepth, 1U);
+        descriptor.threadNum  = std::max(descriptor.threadNum, 1U);
+
+        if (descriptor.backend == IOBackend::IO_URING) {
+            ring = impl::IOUring::Create(descriptor.queueDepth);
+            if (!ring) {
+                LOG_W(TAG, "io_uring is not available, falling back to the thread pool");
+            }
+        }
+
+        // with a ring the pool only serves files without a native path.
+        uint32_t workerNum = ring ? 1 : descriptor.threadNum;
+        for (uint32_t i = 0; i < workerNum; ++i) {
+            workers.emplace_back([this]() { PoolLoop(); });
+        }
+        if (ring) {
+            ringThread = std::thread([this]() { RingLoop(); });
+        }
+    }
+
+    AsyncFileIO::~AsyncFileIO()
+    {
+        std::vector<AsyncReadPtr> dropped;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+            for (auto *queue : {&poolQueue, &ringQueue}) {
+                for (auto &lane : *queue) {
+                    dropped.insert(dropped.end(), lane.begin(), lane.end());
+                    lane.clear();
+                }
+            }
+        }
+        for (auto &read : dropped) {
+            auto expected = AsyncRead::Stage::QUEUED;
+            if (read->stage.compare_exchange_strong(expected, AsyncRead::Stage::DONE)) {
+                Complete(read, IOStatus::CANCELLED);
+            }
+        }
+
+        poolCond.notify_all();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        if (ring) {
+            ring->WakeUp();
+            ringThread.join();
+        }
+    }
+
+    AsyncReadPtr AsyncFileIO::Read(FileReadRequest &&request)
+    {
+        AsyncReadPtr read = new AsyncRead(std::move(request));
+        Enqueue(read);
+        return read;
+    }
+
+    std::vector<AsyncReadPtr> AsyncFileIO::ReadBatch(std::vector<FileReadRequest> &&requests)
+    {
+        std::vector<AsyncReadPtr> reads;
+        reads.reserve(requests.size());
+
+        bool toRing = false;
+        uint32_t toPool = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto &request : requests) {
+                AsyncReadPtr read = new AsyncRead(std::move(request));
+                auto lane = static_cast<uint32_t>(read->request.priority);
+                if (ring && IsNative(*read)) {
+                    ringQueue[lane].emplace_back(read);
+                    toRing = true;
+                } else {
+                    poolQueue[lane].emplace_back(read);
+                    ++toPool;
+                }
+                reads.emplace_back(read);
+            }
+            outstanding.fetch_add(reads.size(), std::memory_order_relaxed);
+        }
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            stats.submitted += reads.size();
+        }
+
+        // one wake up for the whole batch.
+        if (toRing) {
+            ring->WakeUp();
+        }
+        if (toPool == 1) {
+            poolCond.notify_one();
+        } else if (toPool > 1) {
+            poolCond.notify_all();
+        }
+        return reads;
+    }
+
+    void AsyncFileIO::Enqueue(const AsyncReadPtr &read)
+    {
+        auto lane = static_cast<uint32_t>(read->request.priority);
+        bool toRing = ring && IsNative(*read);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            (toRing ? ringQueue : poolQueue)[lane].emplace_back(read);
+            outstanding.fetch_add(1, std::memory_order_relaxed);
+        }
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            ++stats.submitted;
+        }
+
+        if (toRing) {
+            ring->WakeUp();
+        } else {
+            poolCond.notify_one();
+        }
+    }
+
+    bool AsyncFileIO::Cancel(const AsyncReadPtr &read)
+    {
+        if (!read) {
+            return false;
+        }
+
+        // still queued, the queue entry is skipped when it is popped.
+        auto expected = AsyncRead::Stage::QUEUED;
+        if (read->stage.compare_exchange_strong(expected, AsyncRead::Stage::DONE)) {
+            Complete(read, IOStatus::CANCELLED);
+            return true;
+        }
+
+        read->cancelRequested.store(true, std::memory_order_release);
+        if (ring) {
+            ring->WakeUp();
+        }
+        return false;
+    }
+
+    bool AsyncFileIO::Pop(Queue &queue, AsyncReadPtr &read)
+    {
+        for (auto &lane : queue) {
+            while (!lane.empty()) {
+                read = std::move(lane.front());
+                lane.pop_front();
+
+                auto expected = AsyncRead::Stage::QUEUED;
+                if (read->stage.compare_exchange_strong(expected, AsyncRead::Stage::SUBMITTED)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool AsyncFileIO::Prepare(AsyncRead &read)
+    {
+        const auto &request = read.request;
+        read.size = request.size;
+
+#ifndef SKY_PLATFORM_WINDOWS
+        if (IsNative(read)) {
+            read.fd = open(request.file->GetPath().c_str(), O_RDONLY | O_CLOEXEC);
+            if (read.fd < 0) {
+                return false;
+            }
+            if (read.size == 0) {
+                struct stat st = {};
+                if (fstat(read.fd, &st) != 0) {
+                    return false;
+                }
+                auto fileSize = static_cast<uint64_t>(st.st_size);
+                read.size = fileSize > request.offset ? fileSize - request.offset : 0;
+            }
+        }
+#endif
+
+        if (request.dst == nullptr && read.size != 0) {
+            if (read.size > std::numeric_limits<uint32_t>::max()) {
+                return false;
+            }
+            read.data = new BinaryData(static_cast<uint32_t>(read.size));
+        }
+        return true;
+    }
+
+    void AsyncFileIO::Complete(const AsyncReadPtr &read, IOStatus status)
+    {
+#ifndef SKY_PLATFORM_WINDOWS
+        if (read->fd >= 0) {
+            close(read->fd);
+            read->fd = -1;
+        }
+#endif
+        if (read->cancelRequested.load(std::memory_order_acquire)) {
+            status = IOStatus::CANCELLED;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            ++stats.completed;
+            stats.failed    += status == IOStatus::FAILED ? 1 : 0;
+            stats.cancelled += status == IOStatus::CANCELLED ? 1 : 0;
+            stats.bytesRead += read->bytes;
+        }
+
+        read->stage.store(AsyncRead::Stage::DONE, std::memory_order_relaxed);
+        read->status.store(status, std::memory_order_release);
+        read->status.notify_all();
+
+        if (read->request.callback) {
+            if (descriptor.callback == IOCallbackMode::TASK_EXECUTOR) {
+                TaskExecutor::Get()->Dispatch(TaskPriority::STREAMING, [read]() {
+                    read->request.callback(*read);
+                });
+            } else {
+                read->request.callback(*read);
+            }
+        }
+
+        if (outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lock(idleMutex);
+            idleCond.notify_all();
+        }
+    }
+
+    void AsyncFileIO::ReadBlocking(const AsyncReadPtr &read)
+    {
+        if (!Prepare(*read)) {
+            Complete(read, IOStatus::FAILED);
+            return;
+        }
+
+        const auto &request = read->request;
+        uint8_t *dst = read->GetDestination();
+
+#ifndef SKY_PLATFORM_WINDOWS
+        if (read->fd >= 0) {
+            while (read->bytes < read->size && !read->cancelRequested.load(std::memory_order_relaxed)) {
+                auto chunk = static_cast<size_t>(std::min(read->size - read->bytes, MAX_READ_CHUNK));
+                auto res = pread(read->fd, dst + read->bytes, chunk, static_cast<off_t>(request.offset + read->bytes));
+                if (res < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (res <= 0) {
+                    break;
+                }
+                read->bytes += static_cast<uint64_t>(res);
+            }
+            Complete(read, read->bytes == read->size ? IOStatus::SUCCESS : IOStatus::FAILED);
+            return;
+        }
+#endif
+
+        if (read->size == 0) {
+            // no size known up front, let the file hand out everything from offset on.
+            read->data = request.file->Map(request.offset, 0);
+            if (!read->data) {
+                Complete(read, IOStatus::FAILED);
+                return;
+            }
+            if (request.dst != nullptr) {
+                memcpy(request.dst, read->data->Data(), read->data->Size());
+                read->data = nullptr;
+            }
+            read->size = read->bytes = read->data ? read->data->Size() : 0;
+            Complete(read, IOStatus::SUCCESS);
+            return;
+        }
+
+        request.file->ReadData(request.offset, read->size, dst);
+        read->bytes = read->size;
+        Complete(read, IOStatus::SUCCESS);
+    }
+
+    void AsyncFileIO::PoolLoop()
+    {
+        impl::SetCurrentThreadName("AsyncFileIOWorker");
+
+        while (true) {
+            AsyncReadPtr read;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                poolCond.wait(lock, [this, &read]() { return stop || Pop(poolQueue, read); });
+                if (!read) {
+                    break;
+                }
+            }
+            SampleDepth(poolBusy.fetch_add(1, std::memory_order_relaxed) + 1);
+            ReadBlocking(read);
+            poolBusy.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    void AsyncFileIO::RingLoop()
+    {
+        impl::SetCurrentThreadName("AsyncFileIO");
+
+        uint32_t depth = ring->GetDepth();
+        std::vector<AsyncReadPtr> slots(depth);
+        std::vector<uint8_t> cancelIssued(depth, 0);
+        std::vector<uint32_t> freeSlots;
+        for (uint32_t i = depth; i > 0; --i) {
+            freeSlots.emplace_back(i - 1);
+        }
+        uint32_t inflight = 0;
+
+        // slots the submission queue had no room for, they stay in flight and are prepared again after Submit.
+        std::vector<uint32_t> retrySlots;
+        auto submitRead = [this, &slots, &retrySlots](uint32_t slot) {
+            auto &read = *slots[slot];
+            auto chunk = static_cast<uint32_t>(std::min(read.size - read.bytes, MAX_READ_CHUNK));
+            if (!ring->PrepareRead(read.fd, read.GetDestination() + read.bytes, chunk, read.request.offset + read.bytes, slot + 1)) {
+                retrySlots.emplace_back(slot);
+            }
+        };
+
+        auto release = [&](uint32_t slot, IOStatus status) {
+            auto read = std::move(slots[slot]);
+            cancelIssued[slot] = 0;
+            freeSlots.emplace_back(slot);
+            --inflight;
+            Complete(read, status);
+        };
+
+        std::vector<AsyncReadPtr> reads;
+        std::vector<uint32_t> retries;
+        while (true) {
+            retries.swap(retrySlots);
+            for (auto slot : retries) {
+                submitRead(slot);
+            }
+            retries.clear();
+
+            bool stopping = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = stop;
+
+                AsyncReadPtr read;
+                while (reads.size() < freeSlots.size() && Pop(ringQueue, read)) {
+                    reads.emplace_back(std::move(read));
+                }
+            }
+
+            // opening files and failing reads happen outside the lock, callbacks may queue more reads.
+            for (auto &read : reads) {
+                if (!Prepare(*read)) {
+                    Complete(read, IOStatus::FAILED);
+                    continue;
+                }
+                if (read->size == 0) {
+                    Complete(read, IOStatus::SUCCESS);
+                    continue;
+                }
+
+                uint32_t slot = freeSlots.back();
+                freeSlots.pop_back();
+                slots[slot] = std::move(read);
+                submitRead(slot);
+                ++inflight;
+                SampleDepth(inflight);
+            }
+            reads.clear();
+
+            for (uint32_t slot = 0; slot < depth; ++slot) {
+                if (slots[slot] && cancelIssued[slot] == 0 && slots[slot]->cancelRequested.load(std::memory_order_acquire)) {
+                    cancelIssued[slot] = ring->PrepareCancel(slot + 1, CANCEL_TAG) ? 1 : 0;
+                }
+            }
+
+            if (stopping && inflight == 0) {
+                break;
+            }
+            // no blocking while reads wait for room, nothing may be left to complete.
+            if (ring->Submit(retrySlots.empty() ? 1 : 0) < 0) {
+                LOG_E(TAG, "io_uring_enter failed %d", errno);
+            }
+
+            ring->Reap([&](uint64_t userData, int32_t result) {
+                if ((userData & CANCEL_TAG) != 0) {
+                    return;
+                }
+                auto slot = static_cast<uint32_t>(userData - 1);
+                auto &read = *slots[slot];
+
+                if (result == -EINTR || result == -EAGAIN) {
+                    submitRead(slot);
+                } else if (result < 0) {
+                    release(slot, result == -ECANCELED ? IOStatus::CANCELLED : IOStatus::FAILED);
+                } else {
+                    read.bytes += static_cast<uint64_t>(result);
+                    if (read.bytes >= read.size) {
+                        release(slot, IOStatus::SUCCESS);
+                    } else if (result == 0) {
+                        release(slot, IOStatus::FAILED);
+                    } else {
+                        submitRead(slot);
+                    }
+                }
+            });
+        }
+    }
+
+    void AsyncFileIO::SampleDepth(uint32_t depth)
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.maxQueueDepth = std::max(stats.maxQueueDepth, depth);
+        depthSum += depth;
+        ++depthSamples;
+    }
+
+    void AsyncFileIO::WaitIdle()
+    {
+        std::unique_lock<std::mutex> lock(idleMutex);
+        idleCond.wait(lock, [this]() { return outstanding.load(std::memory_order_acquire) == 0; });
+    }
+
+    AsyncFileIOStats AsyncFileIO::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        AsyncFileIOStats result = stats;
+        result.avgQueueDepth = depthSamples != 0 ? static_cast<double>(depthSum) / static_cast<double>(depthSamples) : 0.0;
+        return result;
+    }
+
+    void AsyncFileIO::ResetStats()
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats = AsyncFileIOStats{};
+        depthSum = 0;
+        depthSamples = 0;
+    }
+
+} // namespace sky
@@ -0,0 +1,138 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/file/FileMapping.h>
+#include <core/file/FileSystem.h>
+#include <core/logger/Logger.h>
+#include <algorithm>
+#include <limits>
+
+#ifdef SKY_PLATFORM_WINDOWS
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+static const char *TAG = "FileMapping";
+
+namespace sky {
+
+    FileMappingPtr FileMapping::Create(const FilePath &path)
+    {
+        auto str = path.GetStr();
+        FileMappingPtr mapping = new FileMapping();
+
+#ifdef SKY_PLATFORM_WINDOWS
+        HANDLE file = CreateFileA(str.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+        mapping->fileHandle = file;
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            return nullptr;
+        }
+
+        HANDLE map = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (map == nullptr) {
+            LOG_E(TAG, "create file mapping failed %s", str.c_str());
+            return nullptr;
+        }
+        mapping->mapHandle = map;
+
+        void *ptr = MapViewOfFile(map, FILE_MAP_COPY, 0, 0, 0);
+        if (ptr == nullptr) {
+            LOG_E(TAG, "map view of file failed %s", str.c_str());
+            return nullptr;
+        }
+        mapping->data = static_cast<uint8_t *>(ptr);
+        mapping->size = static_cast<uint64_t>(fileSize.QuadPart);
+#else
+        int fd = open(str.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        struct stat st = {};
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            return nullptr;
+        }
+
+        // the mapping keeps its own reference to the file, the descriptor is not needed afterwards.
+        void *ptr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (ptr == MAP_FAILED) {
+            LOG_E(TAG, "mmap failed %s", str.c_str());
+            return nullptr;
+        }
+        mapping->data = static_cast<uint8_t *>(ptr);
+        mapping->size = static_cast<uint64_t>(st.st_size);
+#endif
+        return mapping;
+    }
+
+    FileMapping::~FileMapping()
+    {
+#ifdef SKY_PLATFORM_WINDOWS
+        if (data != nullptr) {
+            UnmapViewOfFile(data);
+        }
+        if (mapHandle != nullptr) {
+            CloseHandle(mapHandle);
+        }
+        if (fileHandle != nullptr) {
+            CloseHandle(fileHandle);
+        }
+#else
+        if (data != nullptr) {
+            munmap(data, static_cast<size_t>(size));
+        }
+#endif
+    }
+
+    void FileMapping::Advise(uint64_t offset, uint64_t length, FileAccessHint hint) const
+    {
+        if (hint == FileAccessHint::NORMAL || offset >= size) {
+            return;
+        }
+        length = std::min(length, size - offset);
+
+#ifndef SKY_PLATFORM_WINDOWS
+        // madvise wants a page aligned start.
+        static const auto pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        uint64_t begin = offset & ~(pageSize - 1);
+
+        int advice = MADV_NORMAL;
+        switch (hint) {
+            case FileAccessHint::SEQUENTIAL: advice = MADV_SEQUENTIAL; break;
+            case FileAccessHint::RANDOM:     advice = MADV_RANDOM; break;
+            case FileAccessHint::WILL_NEED:  advice = MADV_WILLNEED; break;
+            default: break;
+        }
+        madvise(data + begin, static_cast<size_t>(offset + length - begin), advice);
+#endif
+    }
+
+    BinaryDataPtr FileMapping::View(uint64_t offset, uint64_t length, FileAccessHint hint)
+    {
+        if (offset > size) {
+            return nullptr;
+        }
+        if (length == 0) {
+            length = size - offset;
+        }
+        if (length > size - offset || length > std::numeric_limits<uint32_t>::max()) {
+            return nullptr;
+        }
+
+        Advise(offset, length, hint);
+        return new BinaryData(data + offset, static_cast<uint32_t>(length), this);
+    }
+
+} // namespace sky
@@ -7,6 +7,7 @@
 #include <core/archive/FileArchive.h>
 #include <core/util/String.h>
 #include <filesystem>
+#include <cstring>
 
 namespace sky {
 
@@ -121,19 +122,73 @@ namespace sky {
         return sky::ReadString(filePath, out);
     }
 
+    BinaryDataPtr IFile::Map(uint64_t offset, uint64_t size, FileAccessHint hint)
+    {
+        if (size != 0) {
+            BinaryDataPtr data = new BinaryData(static_cast<uint32_t>(size));
+            ReadData(offset, size, data->Data());
+            return data;
+        }
+
+        auto data = ReadBin();
+        if (!data || offset == 0 || offset > data->Size()) {
+            return offset == 0 ? data : nullptr;
+        }
+        auto remain = static_cast<uint32_t>(data->Size() - offset);
+        BinaryDataPtr tail = new BinaryData(remain);
+        memcpy(tail->Data(), data->Data() + offset, remain);
+        return tail;
+    }
+
+    FileMappingPtr NativeFile::GetMapping()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!mapping) {
+            mapping = FileMapping::Create(filePath);
+        }
+        return mapping;
+    }
+
+    BinaryDataPtr NativeFile::Map(uint64_t offset, uint64_t size, FileAccessHint hint)
+    {
+        auto fileMapping = GetMapping();
+        if (!fileMapping) {
+            return IFile::Map(offset, size, hint);
+        }
+        return fileMapping->View(offset, size, hint);
+    }
+
     void NativeFile::ReadData(uint64_t offset, uint64_t size, uint8_t *out)
     {
+        FileMappingPtr fileMapping;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            fileMapping = mapping;
+        }
+
+        // reuse a mapping somebody else created, page cache to out without a stream.
+        if (fileMapping && offset + size <= fileMapping->Size()) {
+            memcpy(out, fileMapping->Data() + offset, size);
+            return;
+        }
+
         std::fstream stream = filePath.OpenFStream(std::ios::in | std::ios::binary);
         if (!stream.is_open()) {
             return;
         }
 
-        stream.seekg(static_cast<int>(offset), std::ios::beg);
+        stream.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
         stream.read(reinterpret_cast<char *>(out), static_cast<int64_t>(size));
     }
 
     uint64_t NativeFile::AppendData(const char* data, uint64_t size)
     {
+        {
+            // views taken before keep the old mapping alive.
+            std::lock_guard<std::mutex> lock(mutex);
+            mapping.Reset(nullptr);
+        }
+
         std::fstream file = filePath.OpenFStream(std::ios::out | std::ios::binary | std::ios::app);
         file.write(reinterpret_cast<const char *>(data), size);
         auto offset = file.tellp();
@@ -0,0 +1,277 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include "IOUring.h"
+#include <core/platform/Platform.h>
+
+#if SKY_PLATFORM_LINUX
+    #include <linux/io_uring.h>
+    #include <sys/eventfd.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <poll.h>
+    #include <algorithm>
+    #include <cerrno>
+    #include <cstring>
+    #include <vector>
+#endif
+
+namespace sky::impl {
+
+#if SKY_PLATFORM_LINUX
+
+    namespace {
+
+        int SysSetup(uint32_t entries, io_uring_params *params)
+        {
+            return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        int SysRegister(int fd, uint32_t opcode, void *arg, uint32_t argNum)
+        {
+            return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, argNum));
+        }
+
+        // IORING_OP_READ needs 5.6, older kernels do not know the probe either.
+        bool SupportsRead(int fd)
+        {
+            constexpr uint32_t OP_NUM = 64;
+            std::vector<uint8_t> storage(sizeof(io_uring_probe) + OP_NUM * sizeof(io_uring_probe_op), 0);
+            auto *probe = reinterpret_cast<io_uring_probe *>(storage.data());
+            if (SysRegister(fd, IORING_REGISTER_PROBE, probe, OP_NUM) < 0) {
+                return false;
+            }
+            return probe->last_op >= IORING_OP_READ && (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) != 0;
+        }
+
+        int SysEnter(int fd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+        {
+            return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        uint32_t LoadAcquire(const uint32_t *ptr)
+        {
+            return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+        }
+
+        void StoreRelease(uint32_t *ptr, uint32_t value)
+        {
+            __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+        }
+
+        template <typename T>
+        T *Offset(void *base, uint32_t offset)
+        {
+            return reinterpret_cast<T *>(static_cast<uint8_t *>(base) + offset);
+        }
+
+    } // namespace
+
+    std::unique_ptr<IOUring> IOUring::Create(uint32_t depth)
+    {
+        std::unique_ptr<IOUring> ring(new IOUring());
+
+        // room for the wake up poll and cancellations next to a full set of reads.
+        io_uring_params params = {};
+        ring->ringFd = SysSetup(depth * 2, &params);
+        if (ring->ringFd < 0 || !SupportsRead(ring->ringFd)) {
+            return nullptr;
+        }
+        ring->depth     = depth;
+        ring->sqEntries = params.sq_entries;
+
+        ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single) {
+            ring->sqRingSize = ring->cqRingSize = std::max(ring->sqRingSize, ring->cqRingSize);
+        }
+
+        void *sq = mmap(nullptr, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQ_RING);
+        if (sq == MAP_FAILED) {
+            return nullptr;
+        }
+        ring->sqRing = sq;
+
+        if (single) {
+            ring->cqRing = sq;
+        } else {
+            void *cq = mmap(nullptr, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_CQ_RING);
+            if (cq == MAP_FAILED) {
+                return nullptr;
+            }
+            ring->cqRing = cq;
+        }
+
+        ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void *entries = mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQES);
+        if (entries == MAP_FAILED) {
+            return nullptr;
+        }
+        ring->sqes = entries;
+
+        ring->sqHead  = Offset<uint32_t>(ring->sqRing, params.sq_off.head);
+        ring->sqTail  = Offset<uint32_t>(ring->sqRing, params.sq_off.tail);
+        ring->sqMask  = Offset<uint32_t>(ring->sqRing, params.sq_off.ring_mask);
+        ring->sqArray = Offset<uint32_t>(ring->sqRing, params.sq_off.array);
+        ring->cqHead  = Offset<uint32_t>(ring->cqRing, params.cq_off.head);
+        ring->cqTail  = Offset<uint32_t>(ring->cqRing, params.cq_off.tail);
+        ring->cqMask  = Offset<uint32_t>(ring->cqRing, params.cq_off.ring_mask);
+        ring->cqes    = Offset<void>(ring->cqRing, params.cq_off.cqes);
+
+        ring->eventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (ring->eventFd < 0 || !ring->ArmWakeUp() || ring->Submit(0) < 0) {
+            return nullptr;
+        }
+        return ring;
+    }
+
+    IOUring::~IOUring()
+    {
+        if (sqes != nullptr) {
+            munmap(sqes, sqesSize);
+        }
+        if (cqRing != nullptr && cqRing != sqRing) {
+            munmap(cqRing, cqRingSize);
+        }
+        if (sqRing != nullptr) {
+            munmap(sqRing, sqRingSize);
+        }
+        if (eventFd >= 0) {
+            close(eventFd);
+        }
+        if (ringFd >= 0) {
+            close(ringFd);
+        }
+    }
+
+    void *IOUring::NextSqe()
+    {
+        uint32_t tail = *sqTail;
+        if (tail - LoadAcquire(sqHead) >= sqEntries) {
+            return nullptr;
+        }
+        auto *sqe = static_cast<io_uring_sqe *>(sqes) + (tail & *sqMask);
+        memset(sqe, 0, sizeof(io_uring_sqe));
+        return sqe;
+    }
+
+    void IOUring::PushSqe()
+    {
+        // the entry is filled, only now the kernel may see it.
+        uint32_t tail = *sqTail;
+        uint32_t index = tail & *sqMask;
+        sqArray[index] = index;
+        StoreRelease(sqTail, tail + 1);
+        ++prepared;
+    }
+
+    bool IOUring::PrepareRead(int fd, uint8_t *dst, uint32_t size, uint64_t offset, uint64_t userData)
+    {
+        auto *sqe = static_cast<io_uring_sqe *>(NextSqe());
+        if (sqe == nullptr) {
+            return false;
+        }
+        sqe->opcode    = IORING_OP_READ;
+        sqe->fd        = fd;
+        sqe->addr      = reinterpret_cast<uint64_t>(dst);
+        sqe->len       = size;
+        sqe->off       = offset;
+        sqe->user_data = userData;
+        PushSqe();
+        return true;
+    }
+
+    bool IOUring::PrepareCancel(uint64_t target, uint64_t userData)
+    {
+        auto *sqe = static_cast<io_uring_sqe *>(NextSqe());
+        if (sqe == nullptr) {
+            return false;
+        }
+        sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+        sqe->fd        = -1;
+        sqe->addr      = target;
+        sqe->user_data = userData;
+        PushSqe();
+        return true;
+    }
+
+    bool IOUring::ArmWakeUp()
+    {
+        auto *sqe = static_cast<io_uring_sqe *>(NextSqe());
+        if (sqe == nullptr) {
+            return false;
+        }
+        sqe->opcode       = IORING_OP_POLL_ADD;
+        sqe->fd           = eventFd;
+        sqe->poll32_events = POLLIN;
+        sqe->user_data    = 0;
+        PushSqe();
+        return true;
+    }
+
+    int IOUring::Submit(uint32_t waitNum)
+    {
+        uint32_t toSubmit = prepared;
+        uint32_t flags = waitNum != 0 ? IORING_ENTER_GETEVENTS : 0;
+        int result = 0;
+        do {
+            result = SysEnter(ringFd, toSubmit, waitNum, flags);
+        } while (result < 0 && errno == EINTR);
+
+        if (result >= 0) {
+            prepared -= std::min(prepared, static_cast<uint32_t>(result));
+        }
+        return result;
+    }
+
+    bool IOUring::PeekCompletion(uint64_t &userData, int32_t &result)
+    {
+        uint32_t head = *cqHead;
+        if (head == LoadAcquire(cqTail)) {
+            return false;
+        }
+        const auto *cqe = static_cast<const io_uring_cqe *>(cqes) + (head & *cqMask);
+        userData = cqe->user_data;
+        result   = cqe->res;
+        StoreRelease(cqHead, head + 1);
+        return true;
+    }
+
+    void IOUring::DrainWakeUp()
+    {
+        uint64_t value = 0;
+        [[maybe_unused]] auto res = read(eventFd, &value, sizeof(value));
+        ArmWakeUp();
+    }
+
+    void IOUring::WakeUp()
+    {
+        uint64_t value = 1;
+        [[maybe_unused]] auto res = write(eventFd, &value, sizeof(value));
+    }
+
+#else
+
+    std::unique_ptr<IOUring> IOUring::Create(uint32_t)
+    {
+        return nullptr;
+    }
+
+    IOUring::~IOUring() = default;
+
+    bool IOUring::PrepareRead(int, uint8_t *, uint32_t, uint64_t, uint64_t) { return false; }
+    bool IOUring::PrepareCancel(uint64_t, uint64_t) { return false; }
+    int IOUring::Submit(uint32_t) { return -1; }
+    bool IOUring::PeekCompletion(uint64_t &, int32_t &) { return false; }
+    void IOUring::DrainWakeUp() {}
+    bool IOUring::ArmWakeUp() { return false; }
+    void *IOUring::NextSqe() { return nullptr; }
+    void IOUring::PushSqe() {}
+    void IOUring::WakeUp() {}
+
+#endif
+
+} // namespace sky::impl
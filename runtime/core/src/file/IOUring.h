@@ -0,0 +1,85 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace sky::impl {
+
+    // minimal io_uring over the raw syscalls, owned by a single thread.
+    // user data 0 is reserved for the wake up poll on the event fd.
+    class IOUring {
+    public:
+        ~IOUring();
+
+        // nullptr when the kernel or the sandbox does not allow io_uring.
+        static std::unique_ptr<IOUring> Create(uint32_t depth);
+
+        uint32_t GetDepth() const { return depth; }
+
+        // false when the submission queue is full, retry after Submit.
+        bool PrepareRead(int fd, uint8_t *dst, uint32_t size, uint64_t offset, uint64_t userData);
+        bool PrepareCancel(uint64_t target, uint64_t userData);
+
+        // submits everything prepared and blocks until at least waitNum completions are ready.
+        int Submit(uint32_t waitNum);
+
+        // func(userData, result) for every ready completion.
+        template <typename Func>
+        uint32_t Reap(Func &&func)
+        {
+            uint32_t count = 0;
+            uint64_t userData = 0;
+            int32_t result = 0;
+            while (PeekCompletion(userData, result)) {
+                if (userData == 0) {
+                    DrainWakeUp();
+                } else {
+                    func(userData, result);
+                }
+                ++count;
+            }
+            return count;
+        }
+
+        // any thread, breaks a blocking Submit.
+        void WakeUp();
+
+    private:
+        IOUring() = default;
+
+        bool PeekCompletion(uint64_t &userData, int32_t &result);
+        void DrainWakeUp();
+        bool ArmWakeUp();
+        // cleared entry at the tail, nullptr when the queue is full. PushSqe publishes it once filled.
+        void *NextSqe();
+        void PushSqe();
+
+        uint32_t depth = 0;
+        int ringFd = -1;
+        int eventFd = -1;
+        uint32_t prepared = 0;
+
+        void *sqRing = nullptr;
+        void *cqRing = nullptr;
+        void *sqes = nullptr;
+        size_t sqRingSize = 0;
+        size_t cqRingSize = 0;
+        size_t sqesSize = 0;
+
+        uint32_t *sqHead = nullptr;
+        uint32_t *sqTail = nullptr;
+        uint32_t *sqMask = nullptr;
+        uint32_t *sqArray = nullptr;
+        uint32_t sqEntries = 0;
+
+        uint32_t *cqHead = nullptr;
+        uint32_t *cqTail = nullptr;
+        uint32_t *cqMask = nullptr;
+        void *cqes = nullptr;
+    };
+
+} // namespace sky::impl
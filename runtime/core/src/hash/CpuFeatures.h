@@ -0,0 +1,83 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/platform/Platform.h>
+
+#if SKY_PLATFORM_ARCH_X64
+    #if SKY_PLATFORM_COMPILER_MSVC
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#elif SKY_PLATFORM_ARCH_ARM64 && (SKY_PLATFORM_LINUX || SKY_PLATFORM_ANDROID)
+    #include <sys/auxv.h>
+    #include <asm/hwcap.h>
+#endif
+
+#if SKY_PLATFORM_COMPILER_MSVC
+    #define SKY_TARGET_SSE42
+    #define SKY_TARGET_AVX2
+    #define SKY_TARGET_ARM_CRC
+#else
+    #define SKY_TARGET_SSE42   __attribute__((target("sse4.2")))
+    #define SKY_TARGET_AVX2    __attribute__((target("avx2")))
+    #define SKY_TARGET_ARM_CRC __attribute__((target("+crc")))
+#endif
+
+namespace sky::impl {
+
+    // instruction sets the hash kernels can dispatch to, probed once.
+    struct CpuFeatures {
+        bool sse42  = false;
+        bool avx2   = false;
+        bool armCrc = false;
+    };
+
+    inline CpuFeatures ProbeCpuFeatures()
+    {
+        CpuFeatures features = {};
+#if SKY_PLATFORM_ARCH_X64
+        uint32_t regs[4] = {};
+    #if SKY_PLATFORM_COMPILER_MSVC
+        __cpuid(reinterpret_cast<int *>(regs), 1);
+    #else
+        __cpuid(1, regs[0], regs[1], regs[2], regs[3]);
+    #endif
+        features.sse42 = (regs[2] & (1U << 20)) != 0;
+
+        // avx2 also needs the os to save the ymm registers.
+        bool osxsave = (regs[2] & (1U << 27)) != 0;
+        bool avx     = (regs[2] & (1U << 28)) != 0;
+        if (osxsave && avx) {
+    #if SKY_PLATFORM_COMPILER_MSVC
+            uint64_t xcr0 = _xgetbv(0);
+            __cpuidex(reinterpret_cast<int *>(regs), 7, 0);
+    #else
+            uint32_t lo = 0;
+            uint32_t hi = 0;
+            __asm__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            uint64_t xcr0 = (static_cast<uint64_t>(hi) << 32) | lo;
+            __cpuid_count(7, 0, regs[0], regs[1], regs[2], regs[3]);
+    #endif
+            features.avx2 = (xcr0 & 0x6) == 0x6 && (regs[1] & (1U << 5)) != 0;
+        }
+#elif SKY_PLATFORM_ARCH_ARM64
+    #if SKY_PLATFORM_LINUX || SKY_PLATFORM_ANDROID
+        features.armCrc = (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+    #elif defined(__ARM_FEATURE_CRC32) || SKY_PLATFORM_MACOS || SKY_PLATFORM_IOS
+        features.armCrc = true;
+    #endif
+#endif
+        return features;
+    }
+
+    inline const CpuFeatures &GetCpuFeatures()
+    {
+        static const CpuFeatures FEATURES = ProbeCpuFeatures();
+        return FEATURES;
+    }
+
+} // namespace sky::impl
@@ -3,23 +3,262 @@
 //
 
 #include <core/hash/Crc32.h>
-#include <crc32c/crc32c.h>
+#include "CpuFeatures.h"
+#include <atomic>
+#include <cstring>
+
+#if SKY_PLATFORM_ARCH_X64
+    #include <nmmintrin.h>
+#elif SKY_PLATFORM_ARCH_ARM64
+    #include <arm_acle.h>
+#endif
 
 namespace sky {
 
+    namespace {
+
+        constexpr uint32_t CRC32C_POLY = 0x82F63B78;
+
+        uint64_t ReadU64(const uint8_t *data)
+        {
+            uint64_t value = 0;
+            memcpy(&value, data, sizeof(uint64_t));
+            return value;
+        }
+
+        // slicing by 8, table[k][n] is the crc of byte n followed by k zero bytes.
+        struct SoftwareTable {
+            SoftwareTable()
+            {
+                for (uint32_t n = 0; n < 256; ++n) {
+                    table[0][n] = impl::CRC32C_TABLE[n];
+                }
+                for (uint32_t n = 0; n < 256; ++n) {
+                    for (uint32_t k = 1; k < 8; ++k) {
+                        uint32_t prev = table[k - 1][n];
+                        table[k][n] = table[0][prev & 0xFF] ^ (prev >> 8);
+                    }
+                }
+            }
+
+            uint32_t table[8][256];
+        };
+
+        uint32_t ExtendSoftware(uint32_t crc, const uint8_t *data, size_t size)
+        {
+            static const SoftwareTable SW;
+            const auto &t = SW.table;
+
+            crc = ~crc;
+            while (size >= 8) {
+                uint64_t word = ReadU64(data) ^ crc;
+                crc = t[7][word & 0xFF] ^ t[6][(word >> 8) & 0xFF] ^ t[5][(word >> 16) & 0xFF] ^ t[4][(word >> 24) & 0xFF] ^
+                    t[3][(word >> 32) & 0xFF] ^ t[2][(word >> 40) & 0xFF] ^ t[1][(word >> 48) & 0xFF] ^ t[0][word >> 56];
+                data += 8;
+                size -= 8;
+            }
+            while (size-- != 0) {
+                crc = t[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+            }
+            return ~crc;
+        }
+
+        // crc of a block followed by len zero bytes, lets independent streams be combined.
+        // gf(2) matrix method from Mark Adler's crc32c.c.
+        struct ShiftTable {
+            explicit ShiftTable(size_t len)
+            {
+                uint32_t op[32];
+                ZerosOperator(op, len);
+                for (uint32_t n = 0; n < 256; ++n) {
+                    table[0][n] = MatrixTimes(op, n);
+                    table[1][n] = MatrixTimes(op, n << 8);
+                    table[2][n] = MatrixTimes(op, n << 16);
+                    table[3][n] = MatrixTimes(op, n << 24);
+                }
+            }
+
+            uint32_t Shift(uint32_t crc) const
+            {
+                return table[0][crc & 0xFF] ^ table[1][(crc >> 8) & 0xFF] ^ table[2][(crc >> 16) & 0xFF] ^ table[3][crc >> 24];
+            }
+
+            static uint32_t MatrixTimes(const uint32_t *mat, uint32_t vec)
+            {
+                uint32_t sum = 0;
+                for (; vec != 0; vec >>= 1, ++mat) {
+                    if ((vec & 1) != 0) {
+                        sum ^= *mat;
+                    }
+                }
+                return sum;
+            }
+
+            static void MatrixSquare(uint32_t *square, const uint32_t *mat)
+            {
+                for (uint32_t n = 0; n < 32; ++n) {
+                    square[n] = MatrixTimes(mat, mat[n]);
+                }
+            }
+
+            static void ZerosOperator(uint32_t *even, size_t len)
+            {
+                uint32_t odd[32];
+                odd[0] = CRC32C_POLY;
+                uint32_t row = 1;
+                for (uint32_t n = 1; n < 32; ++n) {
+                    odd[n] = row;
+                    row <<= 1;
+                }
+
+                MatrixSquare(even, odd); // two zero bits
+                MatrixSquare(odd, even); // four zero bits
+
+                // odd ends up as the operator for the last power of two, even for one before it.
+                do {
+                    MatrixSquare(even, odd);
+                    len >>= 1;
+                    if (len == 0) {
+                        return;
+                    }
+                    MatrixSquare(odd, even);
+                    len >>= 1;
+                } while (len != 0);
+
+                for (uint32_t n = 0; n < 32; ++n) {
+                    even[n] = odd[n];
+                }
+            }
+
+            uint32_t table[4][256];
+        };
+
+        constexpr size_t LONG_BLOCK  = 8192;
+        constexpr size_t SHORT_BLOCK = 256;
+
+#if SKY_PLATFORM_ARCH_X64
+        // three independent streams hide the latency of the crc instruction.
+        SKY_TARGET_SSE42 void InterleaveSse42(uint64_t &crc0, const uint8_t *&data, size_t &size, size_t block, const ShiftTable &shift)
+        {
+            while (size >= block * 3) {
+                uint64_t crc1 = 0;
+                uint64_t crc2 = 0;
+                const uint8_t *end = data + block;
+                do {
+                    crc0 = _mm_crc32_u64(crc0, ReadU64(data));
+                    crc1 = _mm_crc32_u64(crc1, ReadU64(data + block));
+                    crc2 = _mm_crc32_u64(crc2, ReadU64(data + 2 * block));
+                    data += 8;
+                } while (data < end);
+                crc0 = shift.Shift(static_cast<uint32_t>(crc0)) ^ crc1;
+                crc0 = shift.Shift(static_cast<uint32_t>(crc0)) ^ crc2;
+                data += 2 * block;
+                size -= 3 * block;
+            }
+        }
+
+        SKY_TARGET_SSE42 uint32_t ExtendSse42(uint32_t crc, const uint8_t *data, size_t size)
+        {
+            uint64_t crc0 = ~crc;
+
+            // short keys never reach the shift tables, skip their init guards.
+            if (size >= SHORT_BLOCK * 3) {
+                static const ShiftTable LONG_SHIFT(LONG_BLOCK);
+                static const ShiftTable SHORT_SHIFT(SHORT_BLOCK);
+                InterleaveSse42(crc0, data, size, LONG_BLOCK, LONG_SHIFT);
+                InterleaveSse42(crc0, data, size, SHORT_BLOCK, SHORT_SHIFT);
+            }
+
+            while (size >= 8) {
+                crc0 = _mm_crc32_u64(crc0, ReadU64(data));
+                data += 8;
+                size -= 8;
+            }
+            while (size-- != 0) {
+                crc0 = _mm_crc32_u8(static_cast<uint32_t>(crc0), *data++);
+            }
+            return ~static_cast<uint32_t>(crc0);
+        }
+#elif SKY_PLATFORM_ARCH_ARM64
+        SKY_TARGET_ARM_CRC uint32_t ExtendArm(uint32_t crc, const uint8_t *data, size_t size)
+        {
+            crc = ~crc;
+            while (size >= 8) {
+                crc = __crc32cd(crc, ReadU64(data));
+                data += 8;
+                size -= 8;
+            }
+            while (size-- != 0) {
+                crc = __crc32cb(crc, *data++);
+            }
+            return ~crc;
+        }
+#endif
+
+        using ExtendFunc = uint32_t (*)(uint32_t, const uint8_t *, size_t);
+
+        uint32_t ExtendResolve(uint32_t crc, const uint8_t *data, size_t size);
+
+        // constant initialized, names hashed during static init of other units resolve the kernel on first use.
+        std::atomic<ExtendFunc> EXTEND{ExtendResolve};
+
+        uint32_t ExtendResolve(uint32_t crc, const uint8_t *data, size_t size)
+        {
+            ExtendFunc func = ExtendSoftware;
+#if SKY_PLATFORM_ARCH_X64
+            if (impl::GetCpuFeatures().sse42) {
+                func = ExtendSse42;
+            }
+#elif SKY_PLATFORM_ARCH_ARM64
+            if (impl::GetCpuFeatures().armCrc) {
+                func = ExtendArm;
+            }
+#endif
+            EXTEND.store(func, std::memory_order_relaxed);
+            return func(crc, data, size);
+        }
+
+        uint32_t Extend(uint32_t crc, const uint8_t *data, size_t size)
+        {
+            return EXTEND.load(std::memory_order_relaxed)(crc, data, size);
+        }
+
+    } // namespace
+
     uint32_t Crc32::Cal(const uint8_t *buffer, uint32_t size)
     {
-        return crc32c::Crc32c(buffer, size);
+        return sky::Extend(0, buffer, size);
     }
 
     uint32_t Crc32::Cal(const std::string &str)
     {
-        return crc32c::Crc32c(str);
+        return sky::Extend(0, reinterpret_cast<const uint8_t *>(str.data()), str.length());
     }
 
     uint32_t Crc32::Cal(const std::string_view &str)
     {
-        return crc32c::Crc32c(str.data(), str.length());
+        return sky::Extend(0, reinterpret_cast<const uint8_t *>(str.data()), str.length());
+    }
+
+    uint32_t Crc32::Extend(uint32_t crc, const uint8_t *buffer, size_t size)
+    {
+        return sky::Extend(crc, buffer, size);
+    }
+
+    uint32_t Crc32::ExtendSoftware(uint32_t crc, const uint8_t *buffer, size_t size)
+    {
+        return sky::ExtendSoftware(crc, buffer, size);
+    }
+
+    bool Crc32::IsHardwareAccelerated()
+    {
+#if SKY_PLATFORM_ARCH_X64
+        return impl::GetCpuFeatures().sse42;
+#elif SKY_PLATFORM_ARCH_ARM64
+        return impl::GetCpuFeatures().armCrc;
+#else
+        return false;
+#endif
     }
 
-} // namespace sky
\ No newline at end of file
+} // namespace sky
@@ -0,0 +1,405 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/hash/Hash.h>
+#include "CpuFeatures.h"
+#include <atomic>
+#include <cstring>
+
+#if SKY_PLATFORM_ARCH_X64
+    #include <immintrin.h>
+#endif
+
+#if SKY_PLATFORM_COMPILER_MSVC
+    #include <intrin.h>
+#endif
+
+namespace sky {
+
+    namespace {
+
+        constexpr uint32_t PRIME32_1 = 0x9E3779B1U;
+        constexpr uint32_t PRIME32_2 = 0x85EBCA77U;
+        constexpr uint32_t PRIME32_3 = 0xC2B2AE3DU;
+
+        constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+        constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+        constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+        constexpr uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+        constexpr uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+        constexpr uint64_t PRIME_MX1 = 0x165667919E3779F9ULL;
+        constexpr uint64_t PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+        constexpr size_t SECRET_SIZE     = 192;
+        constexpr size_t STRIPE_LEN      = 64;
+        constexpr size_t SECRET_CONSUME  = 8;
+        constexpr size_t ACC_NUM         = STRIPE_LEN / sizeof(uint64_t);
+        constexpr size_t MID_SIZE_MAX    = 240;
+        constexpr size_t SECRET_SIZE_MIN = 136;
+
+        alignas(64) constexpr uint8_t SECRET[SECRET_SIZE] = {
+            0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+            0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+            0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+            0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+            0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+            0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+            0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+            0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+            0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+            0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+            0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+            0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+        };
+
+        uint32_t Read32(const uint8_t *p)
+        {
+            uint32_t v = 0;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        uint64_t Read64(const uint8_t *p)
+        {
+            uint64_t v = 0;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        void Write64(uint8_t *p, uint64_t v)
+        {
+            memcpy(p, &v, sizeof(v));
+        }
+
+        uint64_t Rotl64(uint64_t v, uint32_t r)
+        {
+            return (v << r) | (v >> (64 - r));
+        }
+
+        uint32_t Swap32(uint32_t v)
+        {
+            return ((v << 24) & 0xff000000) | ((v << 8) & 0x00ff0000) | ((v >> 8) & 0x0000ff00) | ((v >> 24) & 0x000000ff);
+        }
+
+        uint64_t Swap64(uint64_t v)
+        {
+            return (static_cast<uint64_t>(Swap32(static_cast<uint32_t>(v))) << 32) | Swap32(static_cast<uint32_t>(v >> 32));
+        }
+
+        uint64_t Mul128Fold64(uint64_t lhs, uint64_t rhs)
+        {
+#if SKY_PLATFORM_COMPILER_MSVC && SKY_PLATFORM_ARCH_X64
+            uint64_t hi = 0;
+            uint64_t lo = _umul128(lhs, rhs, &hi);
+            return lo ^ hi;
+#elif SKY_PLATFORM_COMPILER_MSVC && SKY_PLATFORM_ARCH_ARM64
+            return (lhs * rhs) ^ __umulh(lhs, rhs);
+#else
+            auto product = static_cast<unsigned __int128>(lhs) * rhs;
+            return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#endif
+        }
+
+        uint64_t Avalanche64(uint64_t h)
+        {
+            h ^= h >> 33;
+            h *= PRIME64_2;
+            h ^= h >> 29;
+            h *= PRIME64_3;
+            h ^= h >> 32;
+            return h;
+        }
+
+        uint64_t Avalanche(uint64_t h)
+        {
+            h ^= h >> 37;
+            h *= PRIME_MX1;
+            h ^= h >> 32;
+            return h;
+        }
+
+        uint64_t Rrmxmx(uint64_t h, uint64_t len)
+        {
+            h ^= Rotl64(h, 49) ^ Rotl64(h, 24);
+            h *= PRIME_MX2;
+            h ^= (h >> 35) + len;
+            h *= PRIME_MX2;
+            return h ^ (h >> 28);
+        }
+
+        uint64_t Mix16(const uint8_t *input, const uint8_t *secret, uint64_t seed)
+        {
+            uint64_t lo = Read64(input);
+            uint64_t hi = Read64(input + 8);
+            return Mul128Fold64(lo ^ (Read64(secret) + seed), hi ^ (Read64(secret + 8) - seed));
+        }
+
+        uint64_t Hash0To16(const uint8_t *input, size_t len, const uint8_t *secret, uint64_t seed)
+        {
+            if (len > 8) {
+                uint64_t flip1 = (Read64(secret + 24) ^ Read64(secret + 32)) + seed;
+                uint64_t flip2 = (Read64(secret + 40) ^ Read64(secret + 48)) - seed;
+                uint64_t lo = Read64(input) ^ flip1;
+                uint64_t hi = Read64(input + len - 8) ^ flip2;
+                uint64_t acc = len + Swap64(lo) + hi + Mul128Fold64(lo, hi);
+                return Avalanche(acc);
+            }
+            if (len >= 4) {
+                seed ^= static_cast<uint64_t>(Swap32(static_cast<uint32_t>(seed))) << 32;
+                uint32_t in1 = Read32(input);
+                uint32_t in2 = Read32(input + len - 4);
+                uint64_t flip = (Read64(secret + 8) ^ Read64(secret + 16)) - seed;
+                uint64_t in64 = in2 + (static_cast<uint64_t>(in1) << 32);
+                return Rrmxmx(in64 ^ flip, len);
+            }
+            if (len > 0) {
+                uint32_t c1 = input[0];
+                uint32_t c2 = input[len >> 1];
+                uint32_t c3 = input[len - 1];
+                uint32_t combined = (c1 << 16) | (c2 << 24) | c3 | (static_cast<uint32_t>(len) << 8);
+                uint64_t flip = (Read32(secret) ^ Read32(secret + 4)) + seed;
+                return Avalanche64(static_cast<uint64_t>(combined) ^ flip);
+            }
+            return Avalanche64(seed ^ (Read64(secret + 56) ^ Read64(secret + 64)));
+        }
+
+        uint64_t Hash17To128(const uint8_t *input, size_t len, const uint8_t *secret, uint64_t seed)
+        {
+            uint64_t acc = len * PRIME64_1;
+            if (len > 32) {
+                if (len > 64) {
+                    if (len > 96) {
+                        acc += Mix16(input + 48, secret + 96, seed);
+                        acc += Mix16(input + len - 64, secret + 112, seed);
+                    }
+                    acc += Mix16(input + 32, secret + 64, seed);
+                    acc += Mix16(input + len - 48, secret + 80, seed);
+                }
+                acc += Mix16(input + 16, secret + 32, seed);
+                acc += Mix16(input + len - 32, secret + 48, seed);
+            }
+            acc += Mix16(input, secret, seed);
+            acc += Mix16(input + len - 16, secret + 16, seed);
+            return Avalanche(acc);
+        }
+
+        uint64_t Hash129To240(const uint8_t *input, size_t len, const uint8_t *secret, uint64_t seed)
+        {
+            constexpr size_t START_OFFSET = 3;
+            constexpr size_t LAST_OFFSET  = 17;
+
+            uint64_t acc = len * PRIME64_1;
+            auto rounds = static_cast<uint32_t>(len / 16);
+            for (uint32_t i = 0; i < 8; ++i) {
+                acc += Mix16(input + 16 * i, secret + 16 * i, seed);
+            }
+            acc = Avalanche(acc);
+            for (uint32_t i = 8; i < rounds; ++i) {
+                acc += Mix16(input + 16 * i, secret + 16 * (i - 8) + START_OFFSET, seed);
+            }
+            acc += Mix16(input + len - 16, secret + SECRET_SIZE_MIN - LAST_OFFSET, seed);
+            return Avalanche(acc);
+        }
+
+        // long input kernels, one stripe of 64 bytes folds into 8 lanes.
+        void AccumulateScalar(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes)
+        {
+            for (size_t n = 0; n < stripes; ++n) {
+                const uint8_t *in  = input + n * STRIPE_LEN;
+                const uint8_t *key = secret + n * SECRET_CONSUME;
+                for (size_t i = 0; i < ACC_NUM; ++i) {
+                    uint64_t data    = Read64(in + 8 * i);
+                    uint64_t dataKey = data ^ Read64(key + 8 * i);
+                    acc[i ^ 1] += data;
+                    acc[i] += (dataKey & 0xFFFFFFFF) * (dataKey >> 32);
+                }
+            }
+        }
+
+        void ScrambleScalar(uint64_t *acc, const uint8_t *secret)
+        {
+            for (size_t i = 0; i < ACC_NUM; ++i) {
+                uint64_t v = acc[i];
+                v ^= v >> 47;
+                v ^= Read64(secret + 8 * i);
+                v *= PRIME32_1;
+                acc[i] = v;
+            }
+        }
+
+#if SKY_PLATFORM_ARCH_X64
+        void AccumulateSse2(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes)
+        {
+            auto *xacc = reinterpret_cast<__m128i *>(acc);
+            for (size_t n = 0; n < stripes; ++n) {
+                const auto *in  = reinterpret_cast<const __m128i *>(input + n * STRIPE_LEN);
+                const auto *key = reinterpret_cast<const __m128i *>(secret + n * SECRET_CONSUME);
+                for (size_t i = 0; i < STRIPE_LEN / sizeof(__m128i); ++i) {
+                    __m128i data    = _mm_loadu_si128(in + i);
+                    __m128i dataKey = _mm_xor_si128(data, _mm_loadu_si128(key + i));
+                    __m128i product = _mm_mul_epu32(dataKey, _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)));
+                    __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                    __m128i sum     = _mm_add_epi64(_mm_loadu_si128(xacc + i), swapped);
+                    _mm_storeu_si128(xacc + i, _mm_add_epi64(product, sum));
+                }
+            }
+        }
+
+        void ScrambleSse2(uint64_t *acc, const uint8_t *secret)
+        {
+            auto *xacc = reinterpret_cast<__m128i *>(acc);
+            const auto *key = reinterpret_cast<const __m128i *>(secret);
+            const __m128i prime = _mm_set1_epi32(static_cast<int>(PRIME32_1));
+            for (size_t i = 0; i < STRIPE_LEN / sizeof(__m128i); ++i) {
+                __m128i v = _mm_loadu_si128(xacc + i);
+                v = _mm_xor_si128(v, _mm_srli_epi64(v, 47));
+                v = _mm_xor_si128(v, _mm_loadu_si128(key + i));
+                __m128i hi = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 3, 0, 1));
+                __m128i productLo = _mm_mul_epu32(v, prime);
+                __m128i productHi = _mm_mul_epu32(hi, prime);
+                _mm_storeu_si128(xacc + i, _mm_add_epi64(productLo, _mm_slli_epi64(productHi, 32)));
+            }
+        }
+
+        SKY_TARGET_AVX2 void AccumulateAvx2(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes)
+        {
+            auto *xacc = reinterpret_cast<__m256i *>(acc);
+            __m256i acc0 = _mm256_loadu_si256(xacc);
+            __m256i acc1 = _mm256_loadu_si256(xacc + 1);
+            for (size_t n = 0; n < stripes; ++n) {
+                const auto *in  = reinterpret_cast<const __m256i *>(input + n * STRIPE_LEN);
+                const auto *key = reinterpret_cast<const __m256i *>(secret + n * SECRET_CONSUME);
+
+                __m256i data0    = _mm256_loadu_si256(in);
+                __m256i data1    = _mm256_loadu_si256(in + 1);
+                __m256i dataKey0 = _mm256_xor_si256(data0, _mm256_loadu_si256(key));
+                __m256i dataKey1 = _mm256_xor_si256(data1, _mm256_loadu_si256(key + 1));
+                __m256i product0 = _mm256_mul_epu32(dataKey0, _mm256_srli_epi64(dataKey0, 32));
+                __m256i product1 = _mm256_mul_epu32(dataKey1, _mm256_srli_epi64(dataKey1, 32));
+                acc0 = _mm256_add_epi64(acc0, _mm256_shuffle_epi32(data0, _MM_SHUFFLE(1, 0, 3, 2)));
+                acc1 = _mm256_add_epi64(acc1, _mm256_shuffle_epi32(data1, _MM_SHUFFLE(1, 0, 3, 2)));
+                acc0 = _mm256_add_epi64(acc0, product0);
+                acc1 = _mm256_add_epi64(acc1, product1);
+            }
+            _mm256_storeu_si256(xacc, acc0);
+            _mm256_storeu_si256(xacc + 1, acc1);
+        }
+
+        SKY_TARGET_AVX2 void ScrambleAvx2(uint64_t *acc, const uint8_t *secret)
+        {
+            auto *xacc = reinterpret_cast<__m256i *>(acc);
+            const auto *key = reinterpret_cast<const __m256i *>(secret);
+            const __m256i prime = _mm256_set1_epi32(static_cast<int>(PRIME32_1));
+            for (size_t i = 0; i < STRIPE_LEN / sizeof(__m256i); ++i) {
+                __m256i v = _mm256_loadu_si256(xacc + i);
+                v = _mm256_xor_si256(v, _mm256_srli_epi64(v, 47));
+                v = _mm256_xor_si256(v, _mm256_loadu_si256(key + i));
+                __m256i productLo = _mm256_mul_epu32(v, prime);
+                __m256i productHi = _mm256_mul_epu32(_mm256_srli_epi64(v, 32), prime);
+                _mm256_storeu_si256(xacc + i, _mm256_add_epi64(productLo, _mm256_slli_epi64(productHi, 32)));
+            }
+        }
+#endif
+
+        struct LongKernel {
+            void (*accumulate)(uint64_t *, const uint8_t *, const uint8_t *, size_t);
+            void (*scramble)(uint64_t *, const uint8_t *);
+            HashSimdLevel level;
+        };
+
+        LongKernel SelectKernel(HashSimdLevel level)
+        {
+#if SKY_PLATFORM_ARCH_X64
+            if (level >= HashSimdLevel::AVX2 && impl::GetCpuFeatures().avx2) {
+                return {AccumulateAvx2, ScrambleAvx2, HashSimdLevel::AVX2};
+            }
+            if (level >= HashSimdLevel::SSE2) {
+                return {AccumulateSse2, ScrambleSse2, HashSimdLevel::SSE2};
+            }
+#endif
+            return {AccumulateScalar, ScrambleScalar, HashSimdLevel::SCALAR};
+        }
+
+        // same lazy resolve as the crc kernel, Hash64 may run during static init.
+        std::atomic<int> KERNEL_LEVEL{-1};
+
+        LongKernel GetKernel()
+        {
+            int level = KERNEL_LEVEL.load(std::memory_order_relaxed);
+            if (level < 0) {
+                auto kernel = SelectKernel(HashSimdLevel::AVX2);
+                KERNEL_LEVEL.store(static_cast<int>(kernel.level), std::memory_order_relaxed);
+                return kernel;
+            }
+            return SelectKernel(static_cast<HashSimdLevel>(level));
+        }
+
+        uint64_t HashLong(const uint8_t *input, size_t len, const uint8_t *secret, size_t secretSize)
+        {
+            constexpr size_t LAST_ACC_START   = 7;
+            constexpr size_t MERGE_ACCS_START = 11;
+
+            alignas(32) uint64_t acc[ACC_NUM] = {PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3, PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1};
+
+            auto kernel = GetKernel();
+            size_t stripesPerBlock = (secretSize - STRIPE_LEN) / SECRET_CONSUME;
+            size_t blockLen = STRIPE_LEN * stripesPerBlock;
+            size_t blocks = (len - 1) / blockLen;
+
+            for (size_t n = 0; n < blocks; ++n) {
+                kernel.accumulate(acc, input + n * blockLen, secret, stripesPerBlock);
+                kernel.scramble(acc, secret + secretSize - STRIPE_LEN);
+            }
+
+            size_t stripes = ((len - 1) - blockLen * blocks) / STRIPE_LEN;
+            kernel.accumulate(acc, input + blocks * blockLen, secret, stripes);
+            kernel.accumulate(acc, input + len - STRIPE_LEN, secret + secretSize - STRIPE_LEN - LAST_ACC_START, 1);
+
+            uint64_t result = len * PRIME64_1;
+            for (size_t i = 0; i < 4; ++i) {
+                const uint8_t *key = secret + MERGE_ACCS_START + 16 * i;
+                result += Mul128Fold64(acc[2 * i] ^ Read64(key), acc[2 * i + 1] ^ Read64(key + 8));
+            }
+            return Avalanche(result);
+        }
+
+    } // namespace
+
+    uint64_t Hash64(const void *data, size_t length, uint64_t seed)
+    {
+        const auto *input = static_cast<const uint8_t *>(data);
+        if (length <= 16) {
+            return Hash0To16(input, length, SECRET, seed);
+        }
+        if (length <= 128) {
+            return Hash17To128(input, length, SECRET, seed);
+        }
+        if (length <= MID_SIZE_MAX) {
+            return Hash129To240(input, length, SECRET, seed);
+        }
+        if (seed == 0) {
+            return HashLong(input, length, SECRET, SECRET_SIZE);
+        }
+
+        // seeded long inputs run on a secret derived from the seed.
+        alignas(64) uint8_t secret[SECRET_SIZE];
+        for (size_t i = 0; i < SECRET_SIZE / 16; ++i) {
+            Write64(secret + 16 * i, Read64(SECRET + 16 * i) + seed);
+            Write64(secret + 16 * i + 8, Read64(SECRET + 16 * i + 8) - seed);
+        }
+        return HashLong(input, length, secret, SECRET_SIZE);
+    }
+
+    void SetHash64SimdLevel(HashSimdLevel level)
+    {
+        KERNEL_LEVEL.store(static_cast<int>(SelectKernel(level).level), std::memory_order_relaxed);
+    }
+
+    HashSimdLevel GetHash64SimdLevel()
+    {
+        return GetKernel().level;
+    }
+
+} // namespace sky
@@ -0,0 +1,167 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/logger/LogSink.h>
+#include <algorithm>
+#include <cinttypes>
+#include <ctime>
+
+namespace sky {
+
+    namespace {
+
+        // "2026-10-16 12:00:00.000 [3] [Tag] [INFO] : message", cut at size.
+        size_t FormatLine(const LogRecord &record, char *out, size_t size)
+        {
+            auto seconds = static_cast<time_t>(record.time / 1000000000ULL);
+            auto millis  = static_cast<uint32_t>((record.time / 1000000ULL) % 1000ULL);
+
+            std::tm local = {};
+#ifdef _WIN32
+            localtime_s(&local, &seconds);
+#else
+            localtime_r(&seconds, &local);
+#endif
+            size_t num = strftime(out, size, "%Y-%m-%d %H:%M:%S", &local);
+            int res = snprintf(out + num, size - num, ".%03u [%u] [%.*s] [%s] : %.*s\n", millis, record.threadId,
+                static_cast<int>(record.tag.size()), record.tag.data(), Logger::GetLevelName(record.level),
+                static_cast<int>(record.message.size()), record.message.data());
+            return std::min(num + static_cast<size_t>(std::max(res, 0)), size - 1);
+        }
+
+    } // namespace
+
+    void StdoutLogSink::Write(const LogRecord &record)
+    {
+        printf("[%.*s] [%s] : %.*s\n", static_cast<int>(record.tag.size()), record.tag.data(), Logger::GetLevelName(record.level),
+            static_cast<int>(record.message.size()), record.message.data());
+    }
+
+    void StdoutLogSink::Flush()
+    {
+        fflush(stdout);
+    }
+
+    RotatingFileLogSink::RotatingFileLogSink(const std::string &p, uint64_t size, uint32_t num)
+        : path(p)
+        , maxSize(size)
+        , maxFiles(num)
+    {
+        Open();
+    }
+
+    RotatingFileLogSink::~RotatingFileLogSink()
+    {
+        if (file != nullptr) {
+            fclose(file);
+        }
+    }
+
+    void RotatingFileLogSink::Open()
+    {
+        file = fopen(path.c_str(), "ab");
+        written = 0;
+        if (file != nullptr) {
+            fseek(file, 0, SEEK_END);
+            written = static_cast<uint64_t>(std::max(ftell(file), 0L));
+        }
+    }
+
+    void RotatingFileLogSink::Rotate()
+    {
+        if (file != nullptr) {
+            fclose(file);
+            file = nullptr;
+        }
+
+        // path.N-1 -> path.N ... path -> path.1, the oldest one is dropped.
+        if (maxFiles != 0) {
+            std::remove((path + "." + std::to_string(maxFiles)).c_str());
+            for (uint32_t i = maxFiles - 1; i > 0; --i) {
+                std::rename((path + "." + std::to_string(i)).c_str(), (path + "." + std::to_string(i + 1)).c_str());
+            }
+            std::rename(path.c_str(), (path + ".1").c_str());
+        } else {
+            std::remove(path.c_str());
+        }
+        Open();
+    }
+
+    void RotatingFileLogSink::Write(const LogRecord &record)
+    {
+        if (file == nullptr) {
+            return;
+        }
+
+        char line[1024];
+        size_t num = FormatLine(record, line, sizeof(line));
+        if (num != 0 && line[num - 1] != '\n') {
+            line[num - 1] = '\n';
+        }
+
+        fwrite(line, 1, num, file);
+        written += num;
+        if (written >= maxSize) {
+            Rotate();
+        }
+    }
+
+    void RotatingFileLogSink::Flush()
+    {
+        if (file != nullptr) {
+            fflush(file);
+        }
+    }
+
+    void RotatingFileLogSink::OnCrash()
+    {
+        Flush();
+    }
+
+    MemoryLogSink::MemoryLogSink(uint32_t num, const std::string &path)
+        : lineNum(std::max(num, 1U))
+        , dumpPath(path)
+        , lines(std::make_unique<char[]>(static_cast<size_t>(lineNum) * LINE_SIZE))
+    {
+    }
+
+    void MemoryLogSink::Write(const LogRecord &record)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        char *slot = lines.get() + (count % lineNum) * LINE_SIZE;
+        FormatLine(record, slot, LINE_SIZE);
+        ++count;
+    }
+
+    std::vector<std::string> MemoryLogSink::GetLines() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::string> res;
+        uint64_t first = count > lineNum ? count - lineNum : 0;
+        for (uint64_t i = first; i < count; ++i) {
+            res.emplace_back(lines.get() + (i % lineNum) * LINE_SIZE);
+        }
+        return res;
+    }
+
+    void MemoryLogSink::Dump(FILE *out) const
+    {
+        uint64_t first = count > lineNum ? count - lineNum : 0;
+        for (uint64_t i = first; i < count; ++i) {
+            fputs(lines.get() + (i % lineNum) * LINE_SIZE, out);
+        }
+        fflush(out);
+    }
+
+    void MemoryLogSink::OnCrash()
+    {
+        // no lock, the crashed thread may hold it.
+        FILE *out = dumpPath.empty() ? nullptr : fopen(dumpPath.c_str(), "wb");
+        Dump(out != nullptr ? out : stderr);
+        if (out != nullptr) {
+            fclose(out);
+        }
+    }
+
+} // namespace sky
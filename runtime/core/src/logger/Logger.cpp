@@ -3,14 +3,539 @@
 //
 
 #include "core/logger/Logger.h"
+#include "core/logger/LogSink.h"
+#include <core/platform/Platform.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <map>
+#include <memory>
+#include <shared_mutex>
 #include <stdarg.h>
 #include <string>
+#include <thread>
+#include <vector>
 #include <wchar.h>
 
+#ifdef SKY_PLATFORM_WINDOWS
+    #include <windows.h>
+#endif
+
 namespace sky {
+    namespace impl {
+        void SetCurrentThreadName(const std::string_view &name);
+    } // namespace impl
+
+    namespace {
+
+        constexpr size_t RING_SIZE    = 256 * 1024;
+        constexpr size_t RING_MASK    = RING_SIZE - 1;
+        constexpr size_t MAX_ENTRY    = RING_SIZE / 4;
+        constexpr size_t MESSAGE_SIZE = 256;
+        constexpr auto   WAKE_PERIOD  = std::chrono::milliseconds(2);
+
+        size_t AlignEntry(size_t size)
+        {
+            return (size + alignof(impl::LogEntry) - 1) & ~(alignof(impl::LogEntry) - 1);
+        }
+
+        // monotonic, lines are ordered by it. wall clock steps would reorder them.
+        uint64_t Now()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        uint64_t WallNow()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+        }
+
+        // single producer single consumer, positions only grow and are masked on access.
+        // an entry never wraps, the tail of the ring is skipped instead.
+        struct LogRing {
+            explicit LogRing(uint32_t id) : data(std::make_unique<uint8_t[]>(RING_SIZE)), threadId(id) {}
+
+            alignas(64) std::atomic_uint64_t head{0};
+            alignas(64) std::atomic_uint64_t tail{0};
+            uint64_t reserved = 0;
+
+            std::unique_ptr<uint8_t[]> data;
+            uint32_t threadId;
+            std::atomic_bool retired{false};
+        };
+
+        struct PendingLine {
+            uint64_t time;
+            uint32_t threadId;
+            LogLevel level;
+            size_t   tagOffset;
+            size_t   tagLength;
+            size_t   msgOffset;
+            size_t   msgLength;
+        };
+
+        class LoggerContext {
+        public:
+            static LoggerContext *Get()
+            {
+                // never destroyed, static destructors may still log.
+                static auto *context = new LoggerContext();
+                return context;
+            }
+
+            LogRing *CreateRing(uint32_t threadId)
+            {
+                auto *ring = new LogRing(threadId);
+                std::lock_guard<std::mutex> lock(ringMutex);
+                rings.emplace_back(ring);
+                return ring;
+            }
+
+            void Wake()
+            {
+                wakeCond.notify_one();
+            }
+
+            void Drain()
+            {
+                std::lock_guard<std::mutex> lock(drainMutex);
+                DrainLocked();
+            }
+
+            // the crash path only takes locks that are free, the crashed thread may hold one.
+            void DrainLocked(bool crashing = false);
+
+            void WriteLine(const LogRecord &record)
+            {
+                std::lock_guard<std::mutex> lock(sinkMutex);
+                for (auto &sink : sinks) {
+                    sink->Write(record);
+                }
+            }
+
+            void FlushSinks()
+            {
+                std::lock_guard<std::mutex> lock(sinkMutex);
+                for (auto &sink : sinks) {
+                    sink->Flush();
+                }
+            }
+
+            void Start();
+            void Stop();
+            void Flush();
+
+            bool IsRunning() const { return running.load(std::memory_order_relaxed); }
+
+            // sinks show wall time, taken once so the converted times keep the order.
+            uint64_t ToWallTime(uint64_t time) const { return time + wallOffset; }
+
+            std::atomic_bool async{true};
+            std::atomic_uint32_t nextThreadId{0};
+
+            std::mutex sinkMutex;
+            std::vector<std::unique_ptr<ILogSink>> sinks;
+
+            std::shared_mutex tagMutex;
+            std::map<std::string, LogLevel, std::less<>> tagLevels;
+
+            std::mutex drainMutex;
+
+        private:
+            LoggerContext() : wallOffset(WallNow() - Now())
+            {
+                sinks.emplace_back(new StdoutLogSink());
+                Start();
+                std::atexit([]() { LoggerContext::Get()->Stop(); });
+            }
+
+            void Run();
+
+            uint64_t wallOffset;
+
+            std::mutex ringMutex;
+            std::vector<LogRing *> rings;
+
+            // drain scratch, only touched under the drain mutex.
+            std::vector<LogRing *> snapshot;
+            std::vector<PendingLine> pending;
+            std::string arena;
+
+            std::thread thread;
+            std::mutex wakeMutex;
+            std::condition_variable wakeCond;
+            std::atomic_bool running{false};
+            bool stop = false;
+
+            std::atomic_uint64_t flushRequest{0};
+            uint64_t flushDone = 0;
+            std::condition_variable flushCond;
+        };
+
+        thread_local bool exited = false;
+        thread_local uint32_t threadId = ~0U;
+        thread_local bool scratchEntry = false;
+        thread_local uint8_t *heapEntry = nullptr;
+
+        // the ring outlives the thread until the logger drained it.
+        struct ThreadLog {
+            ~ThreadLog()
+            {
+                if (ring != nullptr) {
+                    ring->retired.store(true, std::memory_order_release);
+                }
+                exited = true;
+            }
+
+            LogRing *ring = nullptr;
+            std::vector<uint8_t> scratch;
+        };
+
+        thread_local ThreadLog tlsLog;
+
+        uint32_t GetThreadId()
+        {
+            if (threadId == ~0U) {
+                threadId = LoggerContext::Get()->nextThreadId.fetch_add(1, std::memory_order_relaxed);
+            }
+            return threadId;
+        }
+
+        size_t FormatEntry(const impl::LogEntry &entry, std::string &out)
+        {
+            const auto *tag  = reinterpret_cast<const uint8_t *>(&entry) + sizeof(impl::LogEntry);
+            const auto *args = tag + entry.tagLength + 1;
+
+            size_t start = out.size();
+            out.resize(start + MESSAGE_SIZE);
+            int num = entry.format(entry.fmt, args, out.data() + start, MESSAGE_SIZE);
+            if (num < 0) {
+                num = 0;
+            } else if (static_cast<size_t>(num) >= MESSAGE_SIZE) {
+                out.resize(start + num + 1);
+                entry.format(entry.fmt, args, out.data() + start, num + 1);
+            }
+            out.resize(start + num);
+            return static_cast<size_t>(num);
+        }
+
+        void WriteEntry(const impl::LogEntry &entry, uint32_t thread)
+        {
+            std::string message;
+            FormatEntry(entry, message);
+
+            LogRecord record = {};
+            record.level    = entry.level;
+            record.threadId = thread;
+            record.time     = LoggerContext::Get()->ToWallTime(entry.time);
+            record.tag      = std::string_view(reinterpret_cast<const char *>(&entry) + sizeof(impl::LogEntry), entry.tagLength);
+            record.message  = message;
+            LoggerContext::Get()->WriteLine(record);
+        }
+
+        void LoggerContext::DrainLocked(bool crashing)
+        {
+            // lines stay in their rings when the sinks can not take them.
+            std::unique_lock<std::mutex> sinkLock(sinkMutex, std::defer_lock);
+            if (crashing && !sinkLock.try_lock()) {
+                return;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(ringMutex, std::try_to_lock);
+                if (!lock.owns_lock()) {
+                    if (crashing) {
+                        return;
+                    }
+                    lock.lock();
+                }
+                snapshot = rings;
+            }
+
+            pending.clear();
+            arena.clear();
+            for (auto *ring : snapshot) {
+                uint64_t head = ring->head.load(std::memory_order_relaxed);
+                uint64_t tail = ring->tail.load(std::memory_order_acquire);
+                while (head < tail) {
+                    uint64_t offset = head & RING_MASK;
+                    if (RING_SIZE - offset < sizeof(impl::LogEntry)) {
+                        head += RING_SIZE - offset;
+                        continue;
+                    }
+
+                    const auto &entry = *reinterpret_cast<const impl::LogEntry *>(ring->data.get() + offset);
+                    if (entry.format != nullptr) {
+                        PendingLine line = {};
+                        line.time      = entry.time;
+                        line.threadId  = ring->threadId;
+                        line.level     = entry.level;
+                        line.tagOffset = arena.size();
+                        line.tagLength = entry.tagLength;
+                        arena.append(reinterpret_cast<const char *>(&entry) + sizeof(impl::LogEntry), entry.tagLength);
+                        line.msgOffset = arena.size();
+                        line.msgLength = FormatEntry(entry, arena);
+                        pending.emplace_back(line);
+                    }
+                    head += entry.size;
+                }
+                ring->head.store(head, std::memory_order_release);
+            }
+
+            // threads are drained one after another, restore the global order.
+            std::stable_sort(pending.begin(), pending.end(), [](const PendingLine &lhs, const PendingLine &rhs) {
+                return lhs.time < rhs.time;
+            });
+
+            if (!pending.empty()) {
+                if (!sinkLock.owns_lock()) {
+                    sinkLock.lock();
+                }
+                for (const auto &line : pending) {
+                    LogRecord record = {};
+                    record.level    = line.level;
+                    record.threadId = line.threadId;
+                    record.time     = ToWallTime(line.time);
+                    record.tag      = std::string_view(arena.data() + line.tagOffset, line.tagLength);
+                    record.message  = std::string_view(arena.data() + line.msgOffset, line.msgLength);
+                    for (auto &sink : sinks) {
+                        sink->Write(record);
+                    }
+                }
+                for (auto &sink : sinks) {
+                    sink->Flush();
+                }
+            }
+            if (sinkLock.owns_lock()) {
+                sinkLock.unlock();
+            }
+
+            // rings of finished threads go away once they are empty, left alone while crashing.
+            if (crashing) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(ringMutex);
+            rings.erase(std::remove_if(rings.begin(), rings.end(), [](LogRing *ring) {
+                if (ring->retired.load(std::memory_order_acquire) &&
+                    ring->head.load(std::memory_order_relaxed) == ring->tail.load(std::memory_order_acquire)) {
+                    delete ring;
+                    return true;
+                }
+                return false;
+            }), rings.end());
+        }
+
+        void LoggerContext::Start()
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            if (running) {
+                return;
+            }
+            stop = false;
+            running = true;
+            async.store(true, std::memory_order_relaxed);
+            thread = std::thread([this]() { Run(); });
+        }
+
+        void LoggerContext::Stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                if (!running) {
+                    return;
+                }
+                stop = true;
+            }
+            async.store(false, std::memory_order_relaxed);
+            wakeCond.notify_one();
+            thread.join();
+
+            Drain();
+            FlushSinks();
+
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            running = false;
+            flushCond.notify_all();
+        }
+
+        void LoggerContext::Flush()
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            if (!running) {
+                lock.unlock();
+                Drain();
+                FlushSinks();
+                return;
+            }
+
+            uint64_t request = flushRequest.fetch_add(1, std::memory_order_relaxed) + 1;
+            wakeCond.notify_one();
+            flushCond.wait(lock, [this, request]() { return flushDone >= request || !running; });
+        }
+
+        void LoggerContext::Run()
+        {
+            impl::SetCurrentThreadName("Logger");
+
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            while (!stop) {
+                wakeCond.wait_for(lock, WAKE_PERIOD);
+
+                uint64_t request = flushRequest.load(std::memory_order_relaxed);
+                lock.unlock();
+                Drain();
+                if (request != flushDone) {
+                    FlushSinks();
+                }
+                lock.lock();
+
+                flushDone = request;
+                flushCond.notify_all();
+            }
+        }
+
+        void CrashSignal(int sig)
+        {
+            Logger::FlushOnCrash();
+            std::signal(sig, SIG_DFL);
+            std::raise(sig);
+        }
+
+        std::terminate_handler previousTerminate = nullptr;
 
-    void Logger::Print(const char *tag, const char *type, const char *fmt, ...)
+        void CrashTerminate()
+        {
+            Logger::FlushOnCrash();
+            if (previousTerminate != nullptr) {
+                previousTerminate();
+            }
+            std::abort();
+        }
+
+#ifdef SKY_PLATFORM_WINDOWS
+        LONG WINAPI CrashException(EXCEPTION_POINTERS *)
+        {
+            Logger::FlushOnCrash();
+            return EXCEPTION_CONTINUE_SEARCH;
+        }
+#endif
+
+    } // namespace
+
+    namespace impl {
+
+        uint8_t *LogBegin(size_t size)
+        {
+            auto *context = LoggerContext::Get();
+            size = AlignEntry(size);
+
+            // synchronous mode, huge entries and threads already tearing down format on the spot.
+            if (!context->async.load(std::memory_order_relaxed) || size > MAX_ENTRY || exited) {
+                uint8_t *ptr = nullptr;
+                if (exited) {
+                    ptr = heapEntry = new uint8_t[size];
+                } else {
+                    tlsLog.scratch.resize(size);
+                    ptr = tlsLog.scratch.data();
+                }
+                scratchEntry = true;
+
+                auto *entry = reinterpret_cast<LogEntry *>(ptr);
+                entry->size = static_cast<uint32_t>(size);
+                entry->time = Now();
+                return ptr;
+            }
+
+            auto *ring = tlsLog.ring;
+            if (ring == nullptr) {
+                ring = tlsLog.ring = context->CreateRing(GetThreadId());
+            }
+
+            uint64_t pos     = ring->tail.load(std::memory_order_relaxed);
+            uint64_t offset  = pos & RING_MASK;
+            uint64_t padding = offset + size > RING_SIZE ? RING_SIZE - offset : 0;
+            uint64_t total   = padding + size;
+
+            // full, the logger thread is behind, wait for it instead of dropping.
+            while (RING_SIZE - (pos - ring->head.load(std::memory_order_acquire)) < total) {
+                if (context->IsRunning()) {
+                    context->Wake();
+                    std::this_thread::yield();
+                } else {
+                    context->Drain();
+                }
+            }
+
+            if (padding >= sizeof(LogEntry)) {
+                auto *skip = reinterpret_cast<LogEntry *>(ring->data.get() + offset);
+                skip->size   = static_cast<uint32_t>(padding);
+                skip->format = nullptr;
+            }
+
+            ring->reserved = total;
+            scratchEntry = false;
+
+            auto *ptr = ring->data.get() + ((pos + padding) & RING_MASK);
+            auto *entry = reinterpret_cast<LogEntry *>(ptr);
+            entry->size = static_cast<uint32_t>(size);
+            entry->time = Now();
+            return ptr;
+        }
+
+        void LogEnd(uint8_t *ptr)
+        {
+            const auto &entry = *reinterpret_cast<const LogEntry *>(ptr);
+            if (scratchEntry) {
+                // earlier lines of this thread may still sit in its ring or in a running drain.
+                if (exited || tlsLog.ring != nullptr) {
+                    LoggerContext::Get()->Drain();
+                }
+                WriteEntry(entry, GetThreadId());
+                delete[] heapEntry;
+                heapEntry = nullptr;
+                return;
+            }
+
+            auto *ring = tlsLog.ring;
+            uint64_t tail = ring->tail.load(std::memory_order_relaxed) + ring->reserved;
+            ring->tail.store(tail, std::memory_order_release);
+
+            // errors and filling rings go out right away, the rest waits for the next period.
+            if (entry.level >= LogLevel::ERR || tail - ring->head.load(std::memory_order_relaxed) > RING_SIZE / 2) {
+                LoggerContext::Get()->Wake();
+            }
+        }
+
+        bool LogTagEnabled(LogLevel level, const char *tag)
+        {
+            auto *context = LoggerContext::Get();
+            std::shared_lock<std::shared_mutex> lock(context->tagMutex);
+            auto iter = context->tagLevels.find(std::string_view(tag));
+            return level >= (iter != context->tagLevels.end() ? iter->second : Logger::GetLevel());
+        }
+
+        int LogPrintf(char *out, size_t size, const char *fmt, ...)
+        {
+            va_list params;
+            va_start(params, fmt);
+            int res = vsnprintf(out, size, fmt, params);
+            va_end(params);
+            return res;
+        }
+
+    } // namespace impl
+
+    void Logger::Print(LogLevel level, const char *tag, const char *fmt, ...)
     {
+        if (!IsEnabled(level, tag)) {
+            return;
+        }
+
         const uint32_t MAX_SIZE = 1024;
         char           buffer[MAX_SIZE];
         va_list        params;
@@ -19,7 +544,7 @@ namespace sky {
         va_end(params);
         buffer[MAX_SIZE - 1] = '\0';
 
-        printf("[%s] [%s] : %s\n", tag, type, buffer);
+        Log(level, tag, "%s", static_cast<const char *>(buffer));
     }
 
     void Logger::PrintW(const wchar_t *tag, const wchar_t *type, const wchar_t *fmt, ...)
@@ -33,4 +558,116 @@ namespace sky {
         buffer[MAX_SIZE - 1] = '\0';
         wprintf(L"[%ls] [%ls] : %ls\n", tag, type, buffer);
     }
+
+    void Logger::SetLevel(LogLevel level)
+    {
+        minLevel.store(level, std::memory_order_relaxed);
+    }
+
+    void Logger::SetTagLevel(const char *tag, LogLevel level)
+    {
+        auto *context = LoggerContext::Get();
+        std::unique_lock<std::shared_mutex> lock(context->tagMutex);
+        context->tagLevels[tag] = level;
+        tagLevelNum.store(static_cast<uint32_t>(context->tagLevels.size()), std::memory_order_relaxed);
+    }
+
+    void Logger::ClearTagLevels()
+    {
+        auto *context = LoggerContext::Get();
+        std::unique_lock<std::shared_mutex> lock(context->tagMutex);
+        context->tagLevels.clear();
+        tagLevelNum.store(0, std::memory_order_relaxed);
+    }
+
+    void Logger::AddSink(ILogSink *sink)
+    {
+        auto *context = LoggerContext::Get();
+        std::lock_guard<std::mutex> lock(context->sinkMutex);
+        context->sinks.emplace_back(sink);
+    }
+
+    void Logger::RemoveSink(ILogSink *sink)
+    {
+        auto *context = LoggerContext::Get();
+        context->Flush();
+
+        std::lock_guard<std::mutex> lock(context->sinkMutex);
+        context->sinks.erase(std::remove_if(context->sinks.begin(), context->sinks.end(),
+            [sink](const auto &val) { return val.get() == sink; }), context->sinks.end());
+    }
+
+    void Logger::ClearSinks()
+    {
+        auto *context = LoggerContext::Get();
+        context->Flush();
+
+        std::lock_guard<std::mutex> lock(context->sinkMutex);
+        context->sinks.clear();
+    }
+
+    void Logger::SetAsync(bool enable)
+    {
+        auto *context = LoggerContext::Get();
+        context->async.store(enable, std::memory_order_relaxed);
+        if (enable) {
+            context->Start();
+        } else {
+            context->Flush();
+        }
+    }
+
+    void Logger::Flush()
+    {
+        LoggerContext::Get()->Flush();
+    }
+
+    void Logger::FlushOnCrash()
+    {
+        static std::atomic_bool crashing{false};
+        if (crashing.exchange(true)) {
+            return;
+        }
+
+        // best effort, locks held by the crashed thread are skipped instead of waited on.
+        auto *context = LoggerContext::Get();
+        if (context->drainMutex.try_lock()) {
+            context->DrainLocked(true);
+            context->drainMutex.unlock();
+        }
+
+        if (context->sinkMutex.try_lock()) {
+            for (auto &sink : context->sinks) {
+                sink->Flush();
+                sink->OnCrash();
+            }
+            context->sinkMutex.unlock();
+        }
+    }
+
+    void Logger::InstallCrashHandler()
+    {
+        LoggerContext::Get();
+
+        for (int sig : {SIGSEGV, SIGFPE, SIGILL, SIGABRT}) {
+            std::signal(sig, CrashSignal);
+        }
+#ifdef SKY_PLATFORM_WINDOWS
+        SetUnhandledExceptionFilter(CrashException);
+#else
+        std::signal(SIGBUS, CrashSignal);
+#endif
+        previousTerminate = std::set_terminate(CrashTerminate);
+    }
+
+    const char *Logger::GetLevelName(LogLevel level)
+    {
+        switch (level) {
+            case LogLevel::INFO: return "INFO";
+            case LogLevel::WARN: return "WARNING";
+            case LogLevel::ERR: return "ERROR";
+            default: return "NONE";
+        }
+    }
+
 } // namespace sky
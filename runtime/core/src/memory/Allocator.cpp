@@ -3,11 +3,18 @@
 //
 
 #include <core/memory/Allocator.h>
+#include <core/memory/TLSFAllocator.h>
 // #include <mimalloc/mimalloc.h>
 #include "core/platform/Platform.h"
 
 #include <algorithm>
 
+#ifdef SKY_PLATFORM_WINDOWS
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+#endif
+
 namespace sky {
 
 //    class MiMallocAllocator : public IAllocator {
@@ -28,9 +35,50 @@ namespace sky {
 //
 //    };
 
+    void *MallocAllocator::Allocate(size_t size, size_t alignment)
+    {
+        return AlignMalloc(size, std::max(DEFAULT_ALLOC_ALIGNMENT, alignment));
+    }
+
+    void MallocAllocator::Deallocate(void *ptr)
+    {
+        AlignFree(ptr);
+    }
+
+    void *AllocatorResource::do_allocate(size_t bytes, size_t alignment)
+    {
+        return allocator->AllocateTagged(bytes, alignment, tag);
+    }
+
+    void AllocatorResource::do_deallocate(void *p, size_t bytes, size_t alignment)
+    {
+        allocator->Deallocate(p);
+    }
+
+    bool AllocatorResource::do_is_equal(const PmrResource &other) const noexcept
+    {
+        const auto *res = dynamic_cast<const AllocatorResource *>(&other);
+        return res != nullptr && res->allocator == allocator;
+    }
+
     SystemAllocator::SystemAllocator()
-//        : impl(std::make_unique<MiMallocAllocator>())
+#ifdef SKY_USE_TLSF_ALLOCATOR
+        : impl(std::make_unique<TLSFAllocator>())
+#else
+        : impl(std::make_unique<MallocAllocator>())
+#endif
     {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(MemoryTag::NUM); ++i) {
+            resources[i] = std::make_unique<AllocatorResource>(impl.get(), static_cast<MemoryTag>(i));
+        }
+    }
+
+    SystemAllocator::~SystemAllocator()
+    {
+        for (auto &res : resources) {
+            res = nullptr;
+        }
+        impl = nullptr;
     }
 
     void *SystemAllocator::Allocate(size_t size, size_t alignment)
@@ -38,6 +86,11 @@ namespace sky {
         return impl->Allocate(size, alignment);
     }
 
+    void *SystemAllocator::Allocate(size_t size, size_t alignment, MemoryTag tag)
+    {
+        return impl->AllocateTagged(size, alignment, tag);
+    }
+
     void SystemAllocator::Deallocate(void *ptr)
     {
         impl->Deallocate(ptr);
@@ -71,4 +124,23 @@ namespace sky {
         free(ptr);
 #endif
     }
-} // namespace sky
\ No newline at end of file
+
+    void* AllocatePages(size_t size)
+    {
+#ifdef SKY_PLATFORM_WINDOWS
+        return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+        void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+#endif
+    }
+
+    void FreePages(void* ptr, size_t size)
+    {
+#ifdef SKY_PLATFORM_WINDOWS
+        VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+        munmap(ptr, size);
+#endif
+    }
+} // namespace sky
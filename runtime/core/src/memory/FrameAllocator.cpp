@@ -0,0 +1,205 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/memory/FrameAllocator.h>
+#include <core/memory/Allocator.h>
+#include <core/platform/Platform.h>
+#include <algorithm>
+
+namespace sky {
+
+    namespace {
+
+        constexpr size_t BLOCK_ALIGNMENT = 64;
+
+        // one index per live thread, shared by every allocator. a finished thread hands its index
+        // and the arenas behind it over to the next thread.
+        class ThreadIndexPool {
+        public:
+            static ThreadIndexPool &Get()
+            {
+                // never destroyed, threads may finish after static destructors ran.
+                static auto *pool = new ThreadIndexPool();
+                return *pool;
+            }
+
+            uint32_t Acquire()
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (freeList.empty()) {
+                    return next++;
+                }
+                auto iter = std::min_element(freeList.begin(), freeList.end());
+                auto index = *iter;
+                *iter = freeList.back();
+                freeList.pop_back();
+                return index;
+            }
+
+            void Release(uint32_t index)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                freeList.emplace_back(index);
+            }
+
+        private:
+            std::mutex mutex;
+            std::vector<uint32_t> freeList;
+            uint32_t next = 0;
+        };
+
+        struct ThreadIndex {
+            ThreadIndex() : value(ThreadIndexPool::Get().Acquire()) {}
+            ~ThreadIndex() { ThreadIndexPool::Get().Release(value); }
+
+            uint32_t value;
+        };
+
+        thread_local ThreadIndex TLS_INDEX;
+
+        uint32_t GetThreadSlot()
+        {
+            return std::min(TLS_INDEX.value, FrameAllocator::MAX_THREAD_ARENA);
+        }
+
+    } // namespace
+
+    struct FrameAllocator::Arena {
+        struct Block {
+            uint8_t *data;
+            size_t size;
+        };
+
+        explicit Arena(size_t blockSize) : defaultSize(blockSize) {}
+
+        ~Arena()
+        {
+            for (auto &block : blocks) {
+                SystemAllocator::Get()->Deallocate(block.data);
+            }
+        }
+
+        void *Allocate(size_t size, size_t alignment)
+        {
+            while (current < blocks.size()) {
+                auto &block = blocks[current];
+                auto base = reinterpret_cast<uintptr_t>(block.data);
+                uintptr_t ptr = (base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+                if (ptr + size <= base + block.size) {
+                    offset = ptr + size - base;
+                    allocatedBytes += size;
+                    ++allocations;
+                    return reinterpret_cast<void *>(ptr);
+                }
+                ++current;
+                offset = 0;
+            }
+
+            // oversized requests get a block of their own, it is released on reset.
+            size_t blockSize = std::max(defaultSize, size + alignment);
+            auto *data = static_cast<uint8_t *>(SystemAllocator::Get()->Allocate(blockSize, BLOCK_ALIGNMENT, MemoryTag::FRAME));
+            if (data == nullptr) {
+                return nullptr;
+            }
+            blocks.emplace_back(Block{data, blockSize});
+            reservedBytes += blockSize;
+            ++heapAllocations;
+            return Allocate(size, alignment);
+        }
+
+        void Reset()
+        {
+            auto iter = std::remove_if(blocks.begin(), blocks.end(), [this](const Block &block) {
+                if (block.size > defaultSize) {
+                    SystemAllocator::Get()->Deallocate(block.data);
+                    reservedBytes -= block.size;
+                    return true;
+                }
+                return false;
+            });
+            blocks.erase(iter, blocks.end());
+
+            current         = 0;
+            offset          = 0;
+            allocatedBytes  = 0;
+            allocations     = 0;
+            heapAllocations = 0;
+        }
+
+        size_t defaultSize;
+        std::vector<Block> blocks;
+        uint32_t current = 0;
+        size_t offset = 0;
+
+        uint64_t allocatedBytes  = 0;
+        uint64_t reservedBytes   = 0;
+        uint32_t allocations     = 0;
+        uint32_t heapAllocations = 0;
+    };
+
+    FrameAllocator::FrameAllocator(const Descriptor &desc)
+        : blockSize(desc.blockSize)
+        , frames(std::max(desc.frameCount, 1U))
+    {
+    }
+
+    FrameAllocator::~FrameAllocator() = default;
+
+    void *FrameAllocator::Allocate(size_t size, size_t alignment)
+    {
+        alignment = std::max(alignment, static_cast<size_t>(1));
+        SKY_ASSERT((alignment & (alignment - 1)) == 0);
+
+        uint32_t slot = GetThreadSlot();
+        auto &arena = frames[current].arenas[slot];
+
+        if (slot == MAX_THREAD_ARENA) {
+            std::lock_guard<std::mutex> lock(sharedMutex);
+            if (!arena) {
+                arena = std::make_unique<Arena>(blockSize);
+            }
+            return arena->Allocate(size, alignment);
+        }
+
+        // only the owning thread creates and bumps its arena.
+        if (!arena) {
+            arena = std::make_unique<Arena>(blockSize);
+        }
+        return arena->Allocate(size, alignment);
+    }
+
+    void *FrameAllocator::do_allocate(size_t bytes, size_t alignment)
+    {
+        return Allocate(bytes, alignment);
+    }
+
+    void FrameAllocator::NextFrame()
+    {
+        FrameAllocatorStats stats = {};
+        for (auto &arena : frames[current].arenas) {
+            if (arena) {
+                stats.allocatedBytes  += arena->allocatedBytes;
+                stats.allocations     += arena->allocations;
+                stats.heapAllocations += arena->heapAllocations;
+            }
+        }
+
+        current = (current + 1) % static_cast<uint32_t>(frames.size());
+        for (auto &arena : frames[current].arenas) {
+            if (arena) {
+                arena->Reset();
+            }
+        }
+
+        for (auto &frame : frames) {
+            for (auto &arena : frame.arenas) {
+                if (arena) {
+                    stats.reservedBytes += arena->reservedBytes;
+                }
+            }
+        }
+        lastFrameStats = stats;
+    }
+
+} // namespace sky
@@ -4,6 +4,9 @@
 
 #include <core/memory/TLSFAllocator.h>
 #include <core/util/Memory.h>
+#include <core/platform/Platform.h>
+#include <algorithm>
+#include <unordered_map>
 
 namespace sky {
 
@@ -328,3 +331,422 @@ namespace sky {
         --freeListCount;
     }
 }
+
+namespace sky {
+
+    uint64_t TLSFPool::GetLargestFreeSize() const
+    {
+        uint64_t largest = nullBlock->size;
+        if (flBitmap != 0) {
+            uint32_t fl = BitScanReverse(flBitmap);
+            uint32_t sl = BitScanReverse(slBitmaps[fl]);
+            for (auto *block = blockFreeList[fl][sl]; block != nullptr; block = block->nextFree) {
+                largest = std::max(largest, block->size);
+            }
+        }
+        return largest;
+    }
+
+    struct TLSFAllocator::Chunk {
+        uint8_t *base = nullptr;
+        uint64_t used = 0;
+        TLSFPool pool;
+    };
+
+    struct TLSFAllocator::ThreadCache {
+        void    *heads[SMALL_CLASS_COUNT]  = {}; // linked through the first word of the free blocks
+        uint32_t counts[SMALL_CLASS_COUNT] = {};
+    };
+
+    namespace {
+
+        struct AllocHeader {
+            TLSFAllocator::Chunk *chunk;  // nullptr for page allocations
+            TLSFPool::Block      *block;
+            uint64_t              size;   // requested size
+            uint32_t              offset; // from the start of the block to the user pointer
+            uint8_t               tag;
+            uint8_t               sizeClass; // small class + 1, 0 when the block is not cached
+            uint16_t              reserved;
+        };
+        static_assert(sizeof(AllocHeader) == TLSFAllocator::HEADER_SIZE);
+
+        AllocHeader *GetHeader(const void *ptr)
+        {
+            return reinterpret_cast<AllocHeader *>(const_cast<uint8_t *>(static_cast<const uint8_t *>(ptr)) - sizeof(AllocHeader));
+        }
+
+        void *&NextFree(void *ptr)
+        {
+            return *static_cast<void **>(ptr);
+        }
+
+        constexpr size_t   MAX_ALIGNMENT = 4096;
+        constexpr uint32_t REFILL_COUNT  = 16;
+        constexpr uint32_t CACHE_SLOTS   = 4;
+
+        std::atomic_uint64_t ALLOCATOR_ID{1};
+
+        // live allocators, thread caches only touch an allocator found here.
+        std::mutex &RegistryMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        std::unordered_map<uint64_t, TLSFAllocator *> &Registry()
+        {
+            static std::unordered_map<uint64_t, TLSFAllocator *> registry;
+            return registry;
+        }
+
+    } // namespace
+
+    // ids are never reused, caches of a destroyed allocator are dropped without touching their blocks.
+    struct TLSFThreadCaches {
+        struct Slot {
+            uint64_t id = 0;
+            TLSFAllocator::ThreadCache cache;
+        };
+
+        ~TLSFThreadCaches()
+        {
+            for (auto &slot : slots) {
+                Release(slot);
+            }
+        }
+
+        static void Flush(TLSFAllocator &allocator, TLSFAllocator::ThreadCache &cache)
+        {
+            void *batch[TLSFAllocator::CACHE_LIMIT];
+            for (uint32_t i = 0; i < TLSFAllocator::SMALL_CLASS_COUNT; ++i) {
+                uint32_t count = 0;
+                for (void *ptr = cache.heads[i]; ptr != nullptr; ptr = NextFree(ptr)) {
+                    batch[count++] = ptr;
+                }
+                allocator.FreeBatch(batch, count);
+                allocator.cachedBytes -= count * (i + 1) * TLSFAllocator::SMALL_STEP;
+                cache.heads[i]  = nullptr;
+                cache.counts[i] = 0;
+            }
+        }
+
+        static void Release(Slot &slot)
+        {
+            if (slot.id != 0) {
+                std::lock_guard<std::mutex> lock(RegistryMutex());
+                auto iter = Registry().find(slot.id);
+                if (iter != Registry().end()) {
+                    Flush(*iter->second, slot.cache);
+                }
+            }
+            slot = Slot{};
+        }
+
+        Slot slots[CACHE_SLOTS];
+        uint32_t victim = 0;
+    };
+
+    static thread_local TLSFThreadCaches TLS_CACHES;
+
+    TLSFAllocator::TLSFAllocator(const Descriptor &desc) : id(ALLOCATOR_ID.fetch_add(1)), descriptor(desc)
+    {
+        std::lock_guard<std::mutex> lock(RegistryMutex());
+        Registry().emplace(id, this);
+    }
+
+    TLSFAllocator::~TLSFAllocator()
+    {
+        {
+            std::lock_guard<std::mutex> lock(RegistryMutex());
+            Registry().erase(id);
+        }
+        for (auto &slot : TLS_CACHES.slots) {
+            if (slot.id == id) {
+                slot = TLSFThreadCaches::Slot{};
+            }
+        }
+
+        for (auto &chunk : chunks) {
+            FreePages(chunk->base, CHUNK_SIZE);
+        }
+    }
+
+    TLSFAllocator::ThreadCache *TLSFAllocator::GetThreadCache()
+    {
+        if (!descriptor.threadCache) {
+            return nullptr;
+        }
+
+        auto &caches = TLS_CACHES;
+        for (auto &slot : caches.slots) {
+            if (slot.id == id) {
+                return &slot.cache;
+            }
+        }
+        for (auto &slot : caches.slots) {
+            if (slot.id == 0) {
+                slot.id = id;
+                return &slot.cache;
+            }
+        }
+
+        // more live allocators than slots on this thread, evict round robin.
+        auto &slot = caches.slots[caches.victim];
+        caches.victim = (caches.victim + 1) % CACHE_SLOTS;
+        TLSFThreadCaches::Release(slot);
+        slot.id = id;
+        return &slot.cache;
+    }
+
+    void TLSFAllocator::FlushThreadCache()
+    {
+        for (auto &slot : TLS_CACHES.slots) {
+            if (slot.id == id) {
+                TLSFThreadCaches::Flush(*this, slot.cache);
+            }
+        }
+    }
+
+    void TLSFAllocator::OnAllocate(MemoryTag tag, size_t size)
+    {
+        auto &counter = tags[static_cast<uint32_t>(tag)];
+        uint64_t live = counter.live.fetch_add(size, std::memory_order_relaxed) + size;
+        counter.count.fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t peak = counter.peak.load(std::memory_order_relaxed);
+        while (live > peak && !counter.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    void TLSFAllocator::OnDeallocate(MemoryTag tag, size_t size)
+    {
+        tags[static_cast<uint32_t>(tag)].live.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    void *TLSFAllocator::Allocate(size_t size, size_t alignment)
+    {
+        return AllocateTagged(size, alignment, MemoryTag::DEFAULT);
+    }
+
+    void *TLSFAllocator::AllocateTagged(size_t size, size_t alignment, MemoryTag tag)
+    {
+        alignment = std::max(alignment, SMALL_STEP);
+        if ((alignment & (alignment - 1)) != 0 || alignment > MAX_ALIGNMENT) {
+            SKY_ASSERT(false && "invalid alignment");
+            return nullptr;
+        }
+
+        void *ptr = nullptr;
+        if (size <= SMALL_MAX_SIZE && alignment == SMALL_STEP) {
+            uint32_t cls = static_cast<uint32_t>(std::max(size, static_cast<size_t>(1)) + SMALL_STEP - 1) / SMALL_STEP - 1;
+            size_t classSize = (cls + 1) * SMALL_STEP;
+
+            auto *cache = GetThreadCache();
+            if (cache != nullptr && cache->heads[cls] == nullptr) {
+                // refill a batch under one lock.
+                std::lock_guard<std::mutex> lock(mutex);
+                for (uint32_t i = 0; i < REFILL_COUNT; ++i) {
+                    void *block = AllocateFromChunks(classSize, SMALL_STEP, HEADER_SIZE, static_cast<uint8_t>(cls + 1), tag);
+                    if (block == nullptr) {
+                        break;
+                    }
+                    NextFree(block) = cache->heads[cls];
+                    cache->heads[cls] = block;
+                    cache->counts[cls]++;
+                }
+                cachedBytes += cache->counts[cls] * classSize;
+            }
+
+            if (cache != nullptr && cache->heads[cls] != nullptr) {
+                ptr = cache->heads[cls];
+                cache->heads[cls] = NextFree(ptr);
+                cache->counts[cls]--;
+                cachedBytes -= classSize;
+            } else {
+                std::lock_guard<std::mutex> lock(mutex);
+                ptr = AllocateFromChunks(classSize, SMALL_STEP, HEADER_SIZE, static_cast<uint8_t>(cls + 1), tag);
+            }
+        } else if (size + std::max(alignment, HEADER_SIZE) > LARGE_SIZE) {
+            ptr = AllocatePages(size, alignment, tag);
+        } else {
+            std::lock_guard<std::mutex> lock(mutex);
+            ptr = AllocateFromChunks(size, alignment, std::max(alignment, HEADER_SIZE), 0, tag);
+        }
+
+        if (ptr != nullptr) {
+            auto *header = GetHeader(ptr);
+            header->size = size;
+            header->tag  = static_cast<uint8_t>(tag);
+            OnAllocate(tag, size);
+        }
+        return ptr;
+    }
+
+    void *TLSFAllocator::AllocateFromChunks(size_t size, size_t alignment, size_t headerRegion, uint8_t sizeClass, MemoryTag tag)
+    {
+        uint64_t total = size + headerRegion;
+
+        TLSFPool::Block *block = nullptr;
+        if (current != nullptr) {
+            block = current->pool.Allocate(total, alignment);
+        }
+        for (uint32_t i = 0; block == nullptr && i < chunks.size(); ++i) {
+            if (chunks[i].get() != current) {
+                block = chunks[i]->pool.Allocate(total, alignment);
+                if (block != nullptr) {
+                    current = chunks[i].get();
+                }
+            }
+        }
+
+        if (block == nullptr) {
+            auto *base = static_cast<uint8_t *>(sky::AllocatePages(CHUNK_SIZE));
+            if (base == nullptr) {
+                return nullptr;
+            }
+            auto &chunk = chunks.emplace_back(std::make_unique<Chunk>());
+            chunk->base = base;
+            chunk->pool.Init();
+            current = chunk.get();
+            block = current->pool.Allocate(total, alignment);
+            if (block == nullptr) {
+                return nullptr;
+            }
+        }
+        current->used += block->size;
+
+        auto *ptr    = current->base + block->offset + headerRegion;
+        auto *header = GetHeader(ptr);
+        header->chunk     = current;
+        header->block     = block;
+        header->size      = size;
+        header->offset    = static_cast<uint32_t>(headerRegion);
+        header->tag       = static_cast<uint8_t>(tag);
+        header->sizeClass = sizeClass;
+        header->reserved  = 0;
+        return ptr;
+    }
+
+    void *TLSFAllocator::AllocatePages(size_t size, size_t alignment, MemoryTag tag)
+    {
+        size_t headerRegion = std::max(alignment, HEADER_SIZE);
+        auto *base = static_cast<uint8_t *>(sky::AllocatePages(size + headerRegion));
+        if (base == nullptr) {
+            return nullptr;
+        }
+        pageBytes += size + headerRegion;
+
+        auto *ptr    = base + headerRegion;
+        auto *header = GetHeader(ptr);
+        header->chunk     = nullptr;
+        header->block     = nullptr;
+        header->size      = size;
+        header->offset    = static_cast<uint32_t>(headerRegion);
+        header->tag       = static_cast<uint8_t>(tag);
+        header->sizeClass = 0;
+        header->reserved  = 0;
+        return ptr;
+    }
+
+    size_t TLSFAllocator::GetAllocationSize(const void *ptr)
+    {
+        return ptr != nullptr ? GetHeader(ptr)->size : 0;
+    }
+
+    void TLSFAllocator::Deallocate(void *ptr)
+    {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        auto *header = GetHeader(ptr);
+        OnDeallocate(static_cast<MemoryTag>(header->tag), header->size);
+
+        if (header->chunk == nullptr) {
+            size_t total = header->size + header->offset;
+            pageBytes -= total;
+            FreePages(static_cast<uint8_t *>(ptr) - header->offset, total);
+            return;
+        }
+
+        if (header->sizeClass != 0) {
+            auto *cache = GetThreadCache();
+            if (cache != nullptr) {
+                uint32_t cls = header->sizeClass - 1u;
+                size_t classSize = (cls + 1) * SMALL_STEP;
+                if (cache->counts[cls] >= CACHE_LIMIT) {
+                    // give half of the list back, keeps a thread that only frees from growing without bound.
+                    void *batch[CACHE_LIMIT];
+                    uint32_t count = 0;
+                    while (count < CACHE_LIMIT / 2) {
+                        batch[count++] = cache->heads[cls];
+                        cache->heads[cls] = NextFree(cache->heads[cls]);
+                    }
+                    cache->counts[cls] -= count;
+                    cachedBytes -= count * classSize;
+                    FreeBatch(batch, count);
+                }
+                NextFree(ptr) = cache->heads[cls];
+                cache->heads[cls] = ptr;
+                cache->counts[cls]++;
+                cachedBytes += classSize;
+                return;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        FreeToChunks(ptr);
+    }
+
+    void TLSFAllocator::FreeBatch(void **ptrs, uint32_t count)
+    {
+        if (count == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        for (uint32_t i = 0; i < count; ++i) {
+            FreeToChunks(ptrs[i]);
+        }
+    }
+
+    void TLSFAllocator::FreeToChunks(void *ptr)
+    {
+        auto *header = GetHeader(ptr);
+        auto *chunk  = header->chunk;
+        chunk->used -= header->block->size;
+        chunk->pool.Free(header->block);
+
+        // keep the current chunk around, empty chunks elsewhere go back to the os.
+        if (chunk->used == 0 && chunk != current) {
+            FreePages(chunk->base, CHUNK_SIZE);
+            chunks.erase(std::find_if(chunks.begin(), chunks.end(), [chunk](const auto &val) { return val.get() == chunk; }));
+        }
+    }
+
+    MemoryStats TLSFAllocator::GetStats() const
+    {
+        MemoryStats stats = {};
+        for (uint32_t i = 0; i < static_cast<uint32_t>(MemoryTag::NUM); ++i) {
+            stats.tags[i].liveBytes   = tags[i].live.load(std::memory_order_relaxed);
+            stats.tags[i].peakBytes   = tags[i].peak.load(std::memory_order_relaxed);
+            stats.tags[i].allocations = tags[i].count.load(std::memory_order_relaxed);
+        }
+        stats.cachedBytes = cachedBytes.load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        uint64_t freeBytes = 0;
+        uint64_t largest   = 0;
+        for (const auto &chunk : chunks) {
+            freeBytes += CHUNK_SIZE - chunk->used;
+            largest = std::max(largest, chunk->pool.GetLargestFreeSize());
+            stats.usedBytes += chunk->used;
+        }
+        uint64_t pages = pageBytes.load(std::memory_order_relaxed);
+        stats.reservedBytes = chunks.size() * CHUNK_SIZE + pages;
+        stats.usedBytes += pages;
+        stats.fragmentation = freeBytes != 0 ? 1.f - static_cast<float>(largest) / static_cast<float>(freeBytes) : 0.f;
+        return stats;
+    }
+
+} // namespace sky
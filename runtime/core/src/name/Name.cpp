@@ -25,6 +25,14 @@ namespace sky {
 #endif
     }
 
+    Name::Name(const NameLiteral &literal)
+        : handle(NameDataBase::Get()->FetchOrRegister(literal.view, literal.hash))
+    {
+#ifdef _DEBUG
+        view = NameDataBase::Get()->GetStr(handle);
+#endif
+    }
+
     std::string_view Name::GetStr() const noexcept
     {
 #ifdef _DEBUG
@@ -34,14 +42,15 @@ namespace sky {
 #endif
     }
 
+    // handles are the name hashes, comparing does not need to register the string.
     bool Name::Equals(Name A, std::string_view B) noexcept
     {
-        return Equals(A, Name(B.data()));
+        return A.handle == Hash(B.data(), static_cast<uint32_t>(B.length()));
     }
 
     bool Name::Equals(Name A, const char* B) noexcept
     {
-        return Equals(A, Name(B));
+        return Equals(A, std::string_view(B));
     }
 
     bool Name::Equals(Name A, Name B) noexcept
@@ -12,52 +12,120 @@
 #include <cstring>
 
 namespace sky {
-    NameDataBase::NameDataBase() : allocator(new NameAllocator(), [](NameAllocator *ptr) { delete ptr; })
+
+    static uint32_t ShardIndex(uint32_t hash)
+    {
+        return hash & (NameDataBase::SHARD_COUNT - 1);
+    }
+
+    static uint32_t ProbeStart(uint32_t hash, uint32_t capacity)
+    {
+        return (hash >> NameDataBase::SHARD_BITS) & (capacity - 1);
+    }
+
+    NameDataBase::Shard::Shard() : allocator(new NameAllocator(), [](NameAllocator *ptr) { delete ptr; })
+    {
+        tables.emplace_back(std::make_unique<Table>(SHARD_CAPACITY));
+        table.store(tables.back().get(), std::memory_order_relaxed);
+    }
+
+    NameDataBase::NameDataBase() : shards(new Shard[SHARD_COUNT])
+    {
+    }
+
+    NameDataBase::~NameDataBase() = default;
+
+    const NameDataBase::Slot *NameDataBase::Find(const Table &table, uint32_t hash)
     {
+        uint32_t mask = table.capacity - 1;
+        for (uint32_t i = ProbeStart(hash, table.capacity);; i = (i + 1) & mask) {
+            const auto &slot = table.slots[i];
+            uint32_t current = slot.hash.load(std::memory_order_acquire);
+            if (current == hash) {
+                return &slot;
+            }
+            if (current == 0) {
+                return nullptr;
+            }
+        }
+    }
+
+    void NameDataBase::Insert(Table &table, uint32_t hash, uint16_t length, const char *str)
+    {
+        uint32_t mask = table.capacity - 1;
+        uint32_t i = ProbeStart(hash, table.capacity);
+        while (table.slots[i].hash.load(std::memory_order_relaxed) != 0) {
+            i = (i + 1) & mask;
+        }
+
+        auto &slot = table.slots[i];
+        slot.length = length;
+        slot.str    = str;
+        slot.hash.store(hash, std::memory_order_release);
     }
 
     NameEntryHandle NameDataBase::FetchOrRegister(const char* ch)
     {
         auto length = strlen(ch);
-        SKY_ASSERT(length + 1 <= NameAllocator::MAX_NAME_LEN);
-        NameEntryHandle handle = Name::Hash(ch, static_cast<uint32_t>(length));
+        return FetchOrRegister(std::string_view(ch, length), Name::Hash(ch, static_cast<uint32_t>(length)));
+    }
+
+    NameEntryHandle NameDataBase::FetchOrRegister(std::string_view str, uint32_t hash)
+    {
+        SKY_ASSERT(str.length() + 1 <= NameAllocator::MAX_NAME_LEN);
 
-        std::lock_guard<std::mutex> lock(mutex);
-        auto iter = nameHashMap.find(handle);
-        if (iter != nameHashMap.end()) {
+        // empty strings hash to 0, the handle of an empty name.
+        if (hash == 0) {
+            return 0;
+        }
+
+        auto &shard = shards[ShardIndex(hash)];
+        if (const auto *slot = Find(*shard.table.load(std::memory_order_acquire), hash); slot != nullptr) {
 #if NAME_COLLISION_DETECT
-            SKY_ASSERT(Visit(iter->second) == std::string_view(ch))
+            SKY_ASSERT(std::string_view(slot->str, slot->length) == str);
 #endif
-            return handle;
+            return hash;
+        }
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto *table = shard.table.load(std::memory_order_relaxed);
+        if (Find(*table, hash) != nullptr) {
+            return hash;
         }
 
-        auto index = static_cast<NameEntryHandle>(entries.size());
+        auto length = static_cast<uint16_t>(str.length());
+        char *dst = shard.allocator->Visit(shard.allocator->Allocate(length + 1)); // add terminator
+        memcpy(dst, str.data(), length);
 
-        entries.emplace_back();
-        auto &entry = entries.back();
-        entry.length = static_cast<uint16_t>(length);
-        entry.handle = allocator->Allocate(entry.length + 1); // add terminator
-        memcpy(allocator->Visit(entry.handle), ch, length);
+        // keep the load under one half, probes stay short and always end on an empty slot.
+        if ((shard.count + 1) * 2 > table->capacity) {
+            auto next = std::make_unique<Table>(table->capacity * 2);
+            for (uint32_t i = 0; i < table->capacity; ++i) {
+                const auto &slot = table->slots[i];
+                uint32_t current = slot.hash.load(std::memory_order_relaxed);
+                if (current != 0) {
+                    Insert(*next, current, slot.length, slot.str);
+                }
+            }
+            table = next.get();
+            shard.tables.emplace_back(std::move(next));
+            shard.table.store(table, std::memory_order_release);
+        }
 
-        nameHashMap.emplace(handle, index);
-        return handle;
+        Insert(*table, hash, length, dst);
+        ++shard.count;
+        return hash;
     }
 
     std::string_view NameDataBase::GetStr(NameEntryHandle handle) const
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        auto iter = nameHashMap.find(handle);
-        if (iter != nameHashMap.end()) {
-            return Visit(iter->second);
+        if (handle == 0) {
+            return std::string_view("");
         }
 
-        return {};
-    }
-
-    std::string_view NameDataBase::Visit(uint32_t index) const
-    {
-        const auto &entry = entries[index];
-        return std::string_view { allocator->Visit(entry.handle), entry.length };
+        const auto &shard = shards[ShardIndex(handle)];
+        const auto *slot = Find(*shard.table.load(std::memory_order_acquire), handle);
+        return slot != nullptr ? std::string_view(slot->str, slot->length) : std::string_view{};
     }
 
-} // namespace sky
\ No newline at end of file
+} // namespace sky
@@ -7,7 +7,7 @@
 #include <core/environment/Singleton.h>
 #include <core/name/NameTypes.h>
 
-#include <unordered_map>
+#include <atomic>
 #include <mutex>
 #include <vector>
 #include <memory>
@@ -19,22 +19,51 @@
 namespace sky {
     class NameAllocator;
 
+    // names are spread over shards by hash. lookups only read atomics and never block,
+    // registration takes the lock of one shard.
     class NameDataBase : public Singleton<NameDataBase> {
     public:
         NameDataBase();
-        ~NameDataBase() override = default;
+        ~NameDataBase() override;
 
         NameEntryHandle FetchOrRegister(const char* ch);
+        NameEntryHandle FetchOrRegister(std::string_view str, uint32_t hash);
 
         std::string_view GetStr(NameEntryHandle handle) const;
+
+        static constexpr uint32_t SHARD_BITS     = 5;
+        static constexpr uint32_t SHARD_COUNT    = 1 << SHARD_BITS;
+        static constexpr uint32_t SHARD_CAPACITY = 128; // initial slots per shard.
+
     private:
-        std::string_view Visit(uint32_t index) const;
+        // hash is published last, the other fields are valid once it reads non zero.
+        struct Slot {
+            std::atomic<uint32_t> hash{0};
+            uint16_t length = 0;
+            const char *str = nullptr;
+        };
+
+        struct Table {
+            explicit Table(uint32_t cap) : capacity(cap), slots(new Slot[cap]) {}
+
+            uint32_t capacity;
+            std::unique_ptr<Slot[]> slots;
+        };
+
+        struct Shard {
+            std::atomic<Table *> table{nullptr};
+            std::mutex mutex;
+            uint32_t count = 0;
+            std::vector<std::unique_ptr<Table>> tables; // outgrown tables stay alive for readers still probing them.
+            std::unique_ptr<NameAllocator, void(*)(NameAllocator*)> allocator;
+
+            Shard();
+        };
 
-        mutable std::mutex mutex;
-        std::unique_ptr<NameAllocator, void(*)(NameAllocator*)> allocator;
+        static const Slot *Find(const Table &table, uint32_t hash);
+        static void Insert(Table &table, uint32_t hash, uint16_t length, const char *str);
 
-        std::vector<NameEntry> entries;
-        std::unordered_map<uint32_t, uint32_t> nameHashMap;
+        std::unique_ptr<Shard[]> shards;
     };
 
 } // namespace sky
@@ -0,0 +1,139 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/shapes/FrustumCulling.h>
+#include <core/math/Simd.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace sky {
+
+    void AABBSoA::Resize(uint32_t num)
+    {
+        count = num;
+        const uint32_t capacity = (num + ALIGN - 1) / ALIGN * ALIGN;
+        centerX.resize(capacity, 0.f);
+        centerY.resize(capacity, 0.f);
+        centerZ.resize(capacity, 0.f);
+        extentX.resize(capacity, 0.f);
+        extentY.resize(capacity, 0.f);
+        extentZ.resize(capacity, 0.f);
+    }
+
+    void AABBSoA::Set(uint32_t index, const AABB &box)
+    {
+        // same center / extent as Intersection(AABB, Plane)
+        Vector3 center = (box.min + box.max) * 0.5f;
+        Vector3 ext = box.max - center;
+        centerX[index] = center.x;
+        centerY[index] = center.y;
+        centerZ[index] = center.z;
+        extentX[index] = ext.x;
+        extentY[index] = ext.y;
+        extentZ[index] = ext.z;
+    }
+
+    static void WriteGroupBits(uint64_t *visibility, uint32_t base, uint32_t count, uint32_t bits)
+    {
+        const uint32_t valid = count - base;
+        if (valid < AABBSoA::ALIGN) {
+            bits &= (1U << valid) - 1;
+        }
+        visibility[base >> 6] |= static_cast<uint64_t>(bits) << (base & 63);
+    }
+
+    void FrustumCulling(const Frustum &frustum, const AABBSoA &boxes, uint64_t *visibility)
+    {
+        const uint32_t count = boxes.Size();
+
+#if defined(__AVX__)
+        for (uint32_t i = 0; i < count; i += AABBSoA::ALIGN) {
+            const __m256 cx = _mm256_loadu_ps(&boxes.centerX[i]);
+            const __m256 cy = _mm256_loadu_ps(&boxes.centerY[i]);
+            const __m256 cz = _mm256_loadu_ps(&boxes.centerZ[i]);
+            const __m256 ex = _mm256_loadu_ps(&boxes.extentX[i]);
+            const __m256 ey = _mm256_loadu_ps(&boxes.extentY[i]);
+            const __m256 ez = _mm256_loadu_ps(&boxes.extentZ[i]);
+
+            __m256 outside = _mm256_setzero_ps();
+            for (const auto &plane : frustum.planes) {
+                const __m256 nx = _mm256_set1_ps(plane.normal.x);
+                const __m256 ny = _mm256_set1_ps(plane.normal.y);
+                const __m256 nz = _mm256_set1_ps(plane.normal.z);
+
+                __m256 s = _mm256_add_ps(_mm256_mul_ps(nx, cx), _mm256_mul_ps(ny, cy));
+                s = _mm256_sub_ps(_mm256_add_ps(s, _mm256_mul_ps(nz, cz)), _mm256_set1_ps(plane.distance));
+
+                __m256 r = _mm256_add_ps(_mm256_mul_ps(ex, _mm256_set1_ps(std::abs(plane.normal.x))),
+                                         _mm256_mul_ps(ey, _mm256_set1_ps(std::abs(plane.normal.y))));
+                r = _mm256_add_ps(r, _mm256_mul_ps(ez, _mm256_set1_ps(std::abs(plane.normal.z))));
+
+                outside = _mm256_or_ps(outside, _mm256_cmp_ps(s, r, _CMP_GT_OQ));
+            }
+            WriteGroupBits(visibility, i, count, ~static_cast<uint32_t>(_mm256_movemask_ps(outside)) & 0xFF);
+        }
+#elif SKY_MATH_SIMD
+        struct PlaneSplat {
+            simd::Float4 nx, ny, nz, ax, ay, az, d;
+        };
+        PlaneSplat planes[6];
+        for (uint32_t p = 0; p < 6; ++p) {
+            const auto &plane = frustum.planes[p];
+            planes[p].nx = simd::Splat(plane.normal.x);
+            planes[p].ny = simd::Splat(plane.normal.y);
+            planes[p].nz = simd::Splat(plane.normal.z);
+            planes[p].ax = simd::Splat(std::abs(plane.normal.x));
+            planes[p].ay = simd::Splat(std::abs(plane.normal.y));
+            planes[p].az = simd::Splat(std::abs(plane.normal.z));
+            planes[p].d  = simd::Splat(plane.distance);
+        }
+
+        for (uint32_t i = 0; i < count; i += AABBSoA::ALIGN) {
+            uint32_t bits = 0;
+            for (uint32_t j = 0; j < AABBSoA::ALIGN; j += 4) {
+                const simd::Float4 cx = simd::Load(&boxes.centerX[i + j]);
+                const simd::Float4 cy = simd::Load(&boxes.centerY[i + j]);
+                const simd::Float4 cz = simd::Load(&boxes.centerZ[i + j]);
+                const simd::Float4 ex = simd::Load(&boxes.extentX[i + j]);
+                const simd::Float4 ey = simd::Load(&boxes.extentY[i + j]);
+                const simd::Float4 ez = simd::Load(&boxes.extentZ[i + j]);
+
+                simd::Float4 outside = simd::Zero();
+                for (const auto &plane : planes) {
+                    simd::Float4 s = simd::Add(simd::Mul(plane.nx, cx), simd::Mul(plane.ny, cy));
+                    s = simd::Sub(simd::Add(s, simd::Mul(plane.nz, cz)), plane.d);
+
+                    simd::Float4 r = simd::Add(simd::Mul(ex, plane.ax), simd::Mul(ey, plane.ay));
+                    r = simd::Add(r, simd::Mul(ez, plane.az));
+
+                    outside = simd::Or(outside, simd::CmpGt(s, r));
+                }
+                bits |= (~simd::MoveMask(outside) & 0xF) << j;
+            }
+            WriteGroupBits(visibility, i, count, bits);
+        }
+#else
+        for (uint32_t i = 0; i < count; i += AABBSoA::ALIGN) {
+            uint32_t bits = 0;
+            for (uint32_t j = 0; j < AABBSoA::ALIGN; ++j) {
+                const uint32_t k = i + j;
+                bool inside = true;
+                for (const auto &plane : frustum.planes) {
+                    float s = plane.normal.x * boxes.centerX[k] + plane.normal.y * boxes.centerY[k] + plane.normal.z * boxes.centerZ[k] - plane.distance;
+                    float r = boxes.extentX[k] * std::abs(plane.normal.x) + boxes.extentY[k] * std::abs(plane.normal.y) + boxes.extentZ[k] * std::abs(plane.normal.z);
+                    if (s > r) {
+                        inside = false;
+                        break;
+                    }
+                }
+                bits |= inside ? (1U << j) : 0;
+            }
+            WriteGroupBits(visibility, i, count, bits);
+        }
+#endif
+    }
+
+} // namespace sky
@@ -3,6 +3,7 @@
 //
 
 #include <core/util/DynamicModule.h>
+#include <core/logger/Logger.h>
 #include <vector>
 #ifdef _WIN32
     #include <windows.h>
@@ -46,6 +47,8 @@ namespace sky {
     void DynamicModule::Unload()
     {
         if (handle != nullptr) {
+            // pending entries may point at format strings inside the module.
+            Logger::Flush();
 #ifdef _WIN32
             ::FreeLibrary((HMODULE)handle);
 #else
@@ -0,0 +1,56 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/util/RadixSort.h>
+
+namespace sky {
+
+    static constexpr uint32_t RADIX_BITS   = 8;
+    static constexpr uint32_t RADIX_SIZE   = 1U << RADIX_BITS;
+    static constexpr uint32_t RADIX_PASSES = 64 / RADIX_BITS;
+
+    RadixSortItem *RadixSort(RadixSortItem *items, RadixSortItem *scratch, size_t count)
+    {
+        if (count < 2) {
+            return items;
+        }
+
+        // build all histograms in a single sweep.
+        size_t histogram[RADIX_PASSES][RADIX_SIZE] = {};
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t key = items[i].key;
+            for (uint32_t pass = 0; pass < RADIX_PASSES; ++pass) {
+                ++histogram[pass][(key >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1)];
+            }
+        }
+
+        RadixSortItem *src = items;
+        RadixSortItem *dst = scratch;
+        for (uint32_t pass = 0; pass < RADIX_PASSES; ++pass) {
+            auto &hist = histogram[pass];
+            uint32_t shift = pass * RADIX_BITS;
+
+            if (hist[(src[0].key >> shift) & (RADIX_SIZE - 1)] == count) {
+                continue;
+            }
+
+            size_t offset = 0;
+            for (auto &bucket : hist) {
+                size_t tmp = bucket;
+                bucket = offset;
+                offset += tmp;
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                dst[hist[(src[i].key >> shift) & (RADIX_SIZE - 1)]++] = src[i];
+            }
+
+            RadixSortItem *tmp = src;
+            src = dst;
+            dst = tmp;
+        }
+        return src;
+    }
+
+} // namespace sky
@@ -8,6 +8,7 @@
 #include <framework/interface/Interface.h>
 #include <framework/application/SettingRegistry.h>
 #include <framework/application/ModuleManager.h>
+#include <core/async/TaskGraph.h>
 #include <memory>
 #include <functional>
 #include <vector>
@@ -45,11 +46,13 @@ namespace sky {
         void SaveArgs(int argc, char **argv);
 
         ModuleManager* GetModuleManager() const override { return moduleManager.get(); }
+        TaskGraph* GetFrameGraph() override { return &frameGraph; }
 
         Environment                    *env;
         std::unique_ptr<ModuleManager>  moduleManager;
         StartArguments                  arguments;
         std::function<void(float)>      tickFn;
+        TaskGraph                       frameGraph;
         bool                            exit = false;
 
         virtual void ParseStartArgs() {}
@@ -19,6 +19,9 @@ namespace sky {
         using KeyType = Uuid;
         using MutexType = std::mutex;
 
+        // raised by loader and builder threads, listeners are called at the frame sync point.
+        static constexpr StorageMode STORAGE = StorageMode::BATCHED;
+
         virtual void OnAssetBuildFinished(const AssetBuildResult &result) {}
         virtual void OnAssetLoaded() {}
         virtual void OnAssetReload() {}
@@ -12,9 +12,12 @@
 #include <framework/asset/AssetExecutor.h>
 
 #include <unordered_map>
+#include <functional>
 
 namespace sky {
 
+    using AssetLoadCallback = std::function<void(const AssetPtr&)>;
+
     class AssetManager : public Singleton<AssetManager> {
     public:
         AssetManager() = default;
@@ -27,6 +30,8 @@ namespace sky {
         AssetPtr FindOrCreateAsset(const Uuid &uuid, const Name &type);
 
         AssetPtr LoadAsset(const Uuid &uuid);
+        // reads the asset file on the async io service, the callback runs on the io completion lane.
+        void LoadAssetAsync(const Uuid &uuid, AssetLoadCallback &&callback = {});
         void SaveAsset(const AssetPtr &asset, const ProductBundleKey &bundleKey);
 
         AssetPtr LoadAssetFromPath(const std::string &path);
@@ -68,6 +73,7 @@ namespace sky {
     private:
         FileSystemPtr workSpace;
         AssetPtr CreateAssetByHeader(const Uuid &uuid, const IStreamArchivePtr &archive);
+        AssetPtr LoadAssetFromArchive(const Uuid &uuid, const IStreamArchivePtr &archive);
         AssetProductBundle *GetBundle(const ProductBundleKey &key) const;
 
         std::unordered_map<Name, std::unique_ptr<AssetHandlerBase>> assetHandlers;
@@ -9,6 +9,7 @@
 namespace sky {
     class NativeWindow;
     class ModuleManager;
+    class TaskGraph;
 
 
     class ISystemNotify {
@@ -18,6 +19,9 @@ namespace sky {
         virtual void SetExit() = 0;
 
         virtual ModuleManager* GetModuleManager() const { return nullptr; }
+
+        // jobs of the current frame, joined at the end of the application loop.
+        virtual TaskGraph* GetFrameGraph() { return nullptr; }
     };
 
     class ISystemEvent : public EventTraits {
@@ -5,9 +5,12 @@
 #pragma once
 
 #include <core/event/Event.h>
+#include <vector>
 
 namespace sky {
     class Actor;
+    class World;
+    class TransformComponent;
     struct Transform;
 
     struct ITransformEvent : public EventTraits {
@@ -18,4 +21,14 @@ namespace sky {
     };
     using TransformEvent = Event<ITransformEvent>;
 
+    // one notification per world update, changed nodes are in depth order.
+    // lone roots publish from their setters and are not part of the batch.
+    struct ITransformBatchEvent : public EventTraits {
+        using KeyType   = World*;
+        using MutexType = void;
+
+        virtual void OnTransformsChanged(const std::vector<TransformComponent*> &changed) = 0;
+    };
+    using TransformBatchEvent = Event<ITransformBatchEvent>;
+
 } // namespace sky
@@ -7,14 +7,16 @@
 #include <iostream>
 #include <core/util/Uuid.h>
 #include <core/archive/StreamArchive.h>
+#include <core/archive/BufferedArchive.h>
 #include <core/platform/Platform.h>
 #include <core/concept/Concept.h>
 
 namespace sky {
 
+    // values are read through a buffered archive, the stream is only touched when the buffer runs dry.
     class BinaryInputArchive {
     public:
-        explicit BinaryInputArchive(IStreamArchive &arc) : archive(arc)
+        explicit BinaryInputArchive(IStreamArchive &arc) : archive(arc), buffer(arc)
         {
         }
 
@@ -22,64 +24,89 @@ namespace sky {
 
         void LoadValue(char* data, size_t size)
         {
-            archive.LoadRaw(data, size);
+            buffer.LoadRaw(data, size);
         }
 
-        template <typename T, typename = std::enable_if<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+        template <TriviallyCopyableType T>
         void LoadValue(T &v)
         {
-            LoadValue(reinterpret_cast<char*>(std::addressof(v)), sizeof(T));
+            buffer.Load(v);
         }
 
         void LoadValue(std::string &v)
         {
-            uint32_t length = 0;
-            LoadValue(length);
-            v.resize(length, 0);
-            LoadValue(v.data(), length);
+            buffer.Load(v);
+        }
+
+        // element count followed by the elements in one block.
+        template <TriviallyCopyableType T>
+        void LoadValue(std::vector<T> &v)
+        {
+            buffer.Load(v);
         }
 
         void LoadObject(void *ptr, const Uuid &id);
 
-        const IStreamArchive &GetStream() const { return archive; }
+        size_t Tell() const { return buffer.Tell(); }
+
+        // the stream positioned right after the last value read.
+        IStreamArchive &GetStream()
+        {
+            buffer.Sync();
+            return archive;
+        }
     protected:
         IStreamArchive &archive;
+        BufferedInputArchive buffer;
     };
 
+    // values are collected in a buffered archive and written to the stream in chunks, flushed on destruction.
     class BinaryOutputArchive {
     public:
-        explicit BinaryOutputArchive(OStreamArchive &arc) : archive(arc)
+        explicit BinaryOutputArchive(OStreamArchive &arc) : archive(arc), buffer(arc)
         {
         }
         ~BinaryOutputArchive() = default;
 
         void SaveValue(const char* data, size_t size)
         {
-            archive.SaveRaw(data, size);
+            buffer.SaveRaw(data, size);
         }
 
-        template <typename T, typename = std::enable_if<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+        template <TriviallyCopyableType T>
         void SaveValue(const T &v)
         {
-            SaveValue(reinterpret_cast<const char*>(std::addressof(v)), sizeof(T));
+            buffer.Save(v);
         }
 
         void SaveValue(const std::string &v)
         {
-            SaveValue(static_cast<uint32_t>(v.length()));
-            SaveValue(v.data(), static_cast<uint32_t>(v.length()));
+            buffer.Save(v);
         }
 
         void SaveValue(const std::string_view &v)
         {
-            SaveValue(static_cast<uint32_t>(v.length()));
-            SaveValue(v.data(), static_cast<uint32_t>(v.length()));
+            buffer.Save(v);
+        }
+
+        template <TriviallyCopyableType T>
+        void SaveValue(const std::vector<T> &v)
+        {
+            buffer.Save(v);
         }
 
         void SaveObject(const void* data, const Uuid &id);
 
-        const OStreamArchive &GetStream() const { return archive; }
+        void Flush() { buffer.Flush(); }
+
+        // the stream with every value saved so far.
+        OStreamArchive &GetStream()
+        {
+            buffer.Flush();
+            return archive;
+        }
     protected:
         OStreamArchive &archive;
+        BufferedOutputArchive buffer;
     };
 }
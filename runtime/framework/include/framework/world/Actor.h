@@ -9,10 +9,12 @@
 
 #include <framework/serialization/SerializationContext.h>
 #include <framework/world/Component.h>
+#include <framework/world/ComponentStorage.h>
 
 #include <list>
-#include <unordered_map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace sky {
 
@@ -22,6 +24,17 @@ namespace sky {
     using ActorPtr = std::shared_ptr<Actor>;
     using ActorWeakPtr = std::weak_ptr<Actor>;
 
+    // slot and generation in a world, a handle goes stale once its actor leaves the world.
+    struct ActorHandle {
+        static constexpr uint32_t INVALID_INDEX = ~0U;
+
+        uint32_t index      = INVALID_INDEX;
+        uint32_t generation = 0;
+
+        bool IsValid() const { return index != INVALID_INDEX; }
+        bool operator==(const ActorHandle &rhs) const = default;
+    };
+
     class IActorEvent {
     public:
         IActorEvent() = default;
@@ -42,7 +55,9 @@ namespace sky {
         explicit Actor(Uuid id) : uuid(id), name("Actor") {}
         ~Actor();
 
-        using ComponentPtr = std::unique_ptr<ComponentBase>;
+        // components live in per type pools, the actor only keeps the handles.
+        using ComponentPtr = std::unique_ptr<ComponentBase, ComponentDeleter>;
+        using ComponentList = std::vector<std::pair<Uuid, ComponentPtr>>;
 
         template <typename T, typename ...Args>
         T* AddComponent(Args &&...args)
@@ -51,11 +66,13 @@ namespace sky {
             const auto &id = TypeInfoObj<T>::Get()->RtInfo()->registeredId;
             SKY_ASSERT(static_cast<bool>(id));
 
-            auto *component = new T(std::forward<Args>(args)...);
-            if (!EmplaceComponent(id, component)) {
-                delete component;
-                component = nullptr;
+            if (GetComponent(id) != nullptr) {
+                return nullptr;
             }
+
+            auto typeIndex = ComponentType<T>::Index();
+            auto *component = new (ComponentTypeRegistry::Get()->Allocate(typeIndex)) T(std::forward<Args>(args)...);
+            EmplaceComponent(id, typeIndex, component);
             return component;
         }
 
@@ -79,7 +96,17 @@ namespace sky {
             RemoveComponent(id);
         }
 
-        ComponentBase *GetComponent(const Uuid &typeId);
+        ComponentBase *GetComponent(const Uuid &typeId)
+        {
+            // a handful of components per actor, a linear scan beats hashing.
+            for (auto &[id, component] : storage) {
+                if (id == typeId) {
+                    return component.get();
+                }
+            }
+            return nullptr;
+        }
+
         ComponentBase *AddComponent(const Uuid &typeId);
         void RemoveComponent(const Uuid &typeId);
 
@@ -94,21 +121,31 @@ namespace sky {
         const std::string &GetName() const { return name; }
         void SetName(const std::string &name_) { name = name_; }
         World *GetWorld() const { return world; }
+        const ActorHandle &GetHandle() const { return handle; }
 
-        const std::unordered_map<Uuid, ComponentPtr> &GetComponents() const { return storage; }
+        const ComponentList &GetComponents() const { return storage; }
 
         void AttachToWorld(World *world);
         void DetachFromWorld();
     private:
         friend class World;
-        bool EmplaceComponent(const Uuid &typeId, ComponentBase* component);
+        ComponentBase *CreateComponent(const Uuid &typeId, uint32_t &typeIndex);
+        void EmplaceComponent(const Uuid &typeId, uint32_t typeIndex, ComponentBase* component);
 
-        std::unordered_map<Uuid, ComponentPtr> storage;
+        ComponentList storage;
 
         Uuid uuid;
         std::string name;
 
         World *world = nullptr;
+        ActorHandle handle;
+        uint32_t worldIndex = ActorHandle::INVALID_INDEX; // slot in the world's actor list.
     };
 
+    template <typename T>
+    T *ComponentStorage::FindComponent(Actor *actor)
+    {
+        return actor->GetComponent<T>();
+    }
+
 } // namespace sky
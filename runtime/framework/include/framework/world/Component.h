@@ -17,6 +17,8 @@ namespace sky {
 
     class ComponentBase {
     public:
+        static constexpr uint32_t INVALID_INDEX = ~0U;
+
         ComponentBase()          = default;
         virtual ~ComponentBase() = default;
 
@@ -38,7 +40,13 @@ namespace sky {
         Actor* GetActor() const { return actor; }
     protected:
         friend class Actor;
+        friend class ComponentStorage;
+        friend struct ComponentDeleter;
         Actor *actor = nullptr;
+
+    private:
+        uint32_t typeIndex    = INVALID_INDEX; // pool the component lives in.
+        uint32_t storageIndex = INVALID_INDEX; // slot in the world's component set.
     };
 
     template <typename Data>
@@ -7,6 +7,7 @@
 #include <core/environment/Singleton.h>
 #include <core/util/Uuid.h>
 #include <framework/world/Component.h>
+#include <framework/world/ComponentStorage.h>
 #include <vector>
 
 namespace sky {
@@ -26,6 +27,7 @@ namespace sky {
             static_assert(std::is_base_of_v<ComponentBase, T>);
 
             const auto *info = TypeInfoObj<T>::Get()->RtInfo();
+            ComponentType<T>::Index();
 
             RegisterComponent(info->registeredId, info->name, group);
         }
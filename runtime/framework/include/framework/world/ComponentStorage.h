@@ -0,0 +1,242 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/environment/Singleton.h>
+#include <core/util/Uuid.h>
+#include <framework/world/Component.h>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace sky {
+
+    // components of one type packed into fixed size blocks, a component never moves while it is alive.
+    class ComponentPool {
+    public:
+        explicit ComponentPool(size_t size, uint32_t numPerBlock = 256);
+        ~ComponentPool() = default;
+
+        ComponentPool(const ComponentPool &) = delete;
+        ComponentPool &operator=(const ComponentPool &) = delete;
+
+        void *Allocate();
+        void Free(void *ptr);
+
+    private:
+        size_t stride;
+        uint32_t numPerBlock;
+        uint32_t blockUsed;
+        std::vector<std::unique_ptr<uint8_t[]>> blocks;
+        std::vector<void *> freeList;
+        std::mutex mutex;
+    };
+
+    template <typename T>
+    struct ComponentType;
+
+    // world tick phases, the transform hierarchy is updated between two phases.
+    enum class TickPhase : uint8_t {
+        PRE_PHYSICS = 0,
+        PHYSICS,
+        POST_PHYSICS,
+        PRE_RENDER,
+        NUM
+    };
+
+    // component types a tick touches, an undeclared tick is exclusive and never overlaps another one.
+    struct TickAccess {
+        template <typename T>
+        TickAccess &Read()
+        {
+            reads.emplace_back(ComponentType<T>::Index());
+            exclusive = false;
+            return *this;
+        }
+
+        template <typename T>
+        TickAccess &Write()
+        {
+            writes.emplace_back(ComponentType<T>::Index());
+            exclusive = false;
+            return *this;
+        }
+
+        // touches no component at all.
+        TickAccess &Nothing()
+        {
+            exclusive = false;
+            return *this;
+        }
+
+        bool Conflicts(const TickAccess &rhs) const;
+
+        std::vector<uint32_t> reads;
+        std::vector<uint32_t> writes;
+        bool exclusive = true;
+    };
+
+    // parallel component ticks are split into chunks, they must only touch their own actor
+    // and must not add or remove components while ticking. reading world transforms is fine,
+    // a node under a parent moved by another chunk sees the parent before or after the move.
+    struct TickDesc {
+        TickPhase  phase    = TickPhase::PRE_PHYSICS;
+        TickAccess access;
+        bool       parallel = false;
+    };
+
+    // components without a Tick override are skipped by the world tick, a private override counts as one.
+    template <typename T>
+    static constexpr bool COMPONENT_HAS_TICK = []() {
+        if constexpr (requires { &T::Tick; }) {
+            return !std::is_same_v<decltype(&T::Tick), void (ComponentBase::*)(float)>;
+        } else {
+            return true;
+        }
+    }();
+
+    // dense index and pool for every component type, the index addresses per world component sets.
+    class ComponentTypeRegistry : public Singleton<ComponentTypeRegistry> {
+    public:
+        ComponentTypeRegistry() = default;
+        ~ComponentTypeRegistry() override = default;
+
+        static constexpr uint32_t INVALID_INDEX = ~0U;
+
+        struct Entry {
+            Uuid typeId;
+            bool hasTick = true;
+            TickDesc tick;
+            std::unique_ptr<ComponentPool> pool;
+        };
+
+        template <typename T>
+        uint32_t Register()
+        {
+            static_assert(std::is_base_of_v<ComponentBase, T>);
+            // DeclareTick must not name T itself, its index is still being registered.
+            TickDesc desc;
+            if constexpr (requires(TickDesc &d) { T::DeclareTick(d); }) {
+                T::DeclareTick(desc);
+            }
+            return Register(TypeInfoObj<T>::Get()->RtInfo()->registeredId, sizeof(T), COMPONENT_HAS_TICK<T>, desc);
+        }
+
+        // types only known by id are sized through reflection and assumed to tick exclusively.
+        uint32_t Register(const Uuid &typeId);
+        uint32_t Register(const Uuid &typeId, size_t size, bool hasTick, const TickDesc &desc = {});
+
+        uint32_t FindIndex(const Uuid &typeId) const;
+        const Entry &GetEntry(uint32_t index) const;
+
+        void *Allocate(uint32_t index);
+        void Free(uint32_t index, void *ptr);
+
+    private:
+        mutable std::shared_mutex mutex;
+        std::unordered_map<Uuid, uint32_t> indices;
+        std::vector<std::unique_ptr<Entry>> types;
+    };
+
+    template <typename T>
+    struct ComponentType {
+        static uint32_t Index()
+        {
+            static const uint32_t INDEX = ComponentTypeRegistry::Get()->Register<T>();
+            return INDEX;
+        }
+    };
+
+    // returns pooled components to their pool.
+    struct ComponentDeleter {
+        void operator()(ComponentBase *component) const;
+    };
+
+    template <typename T>
+    class ComponentView {
+    public:
+        using Container = std::vector<ComponentBase *>;
+
+        class Iterator {
+        public:
+            explicit Iterator(Container::const_iterator it) : iter(it) {}
+
+            T *operator*() const { return static_cast<T *>(*iter); }
+            Iterator &operator++() { ++iter; return *this; }
+            bool operator!=(const Iterator &rhs) const { return iter != rhs.iter; }
+            bool operator==(const Iterator &rhs) const { return iter == rhs.iter; }
+
+        private:
+            Container::const_iterator iter;
+        };
+
+        explicit ComponentView(const Container &c) : components(c) {}
+
+        Iterator begin() const { return Iterator(components.begin()); }
+        Iterator end() const { return Iterator(components.end()); }
+
+        size_t Size() const { return components.size(); }
+        bool Empty() const { return components.empty(); }
+        T *operator[](size_t index) const { return static_cast<T *>(components[index]); }
+
+    private:
+        const Container &components;
+    };
+
+    // per world sparse sets, one dense array of live components per type.
+    // components keep their slot in the array so removal is a swap with the last one.
+    class ComponentStorage {
+    public:
+        ComponentStorage() = default;
+        ~ComponentStorage() = default;
+
+        void Add(ComponentBase *component);
+        void Remove(ComponentBase *component);
+        void Clear();
+
+        uint32_t GetTypeNum() const { return static_cast<uint32_t>(sets.size()); }
+        const std::vector<ComponentBase *> &GetComponents(uint32_t typeIndex) const;
+
+        template <typename T>
+        ComponentView<T> View() const
+        {
+            return ComponentView<T>(GetComponents(ComponentType<T>::Index()));
+        }
+
+        // visits every actor holding all the types, walks the smallest set.
+        template <typename T, typename ...Ts, typename Func>
+        void ForEach(Func &&func) const
+        {
+            const uint32_t typeIndices[] = {ComponentType<T>::Index(), ComponentType<Ts>::Index()...};
+
+            const std::vector<ComponentBase *> *driver = nullptr;
+            for (auto index : typeIndices) {
+                const auto &components = GetComponents(index);
+                if (driver == nullptr || components.size() < driver->size()) {
+                    driver = &components;
+                }
+            }
+
+            for (size_t i = 0; i < driver->size(); ++i) {
+                auto *actor = (*driver)[i]->GetActor();
+                std::tuple<T *, Ts *...> values{FindComponent<T>(actor), FindComponent<Ts>(actor)...};
+                if (std::apply([](auto *...ptr) { return ((ptr != nullptr) && ...); }, values)) {
+                    std::apply([&func](auto *...ptr) { func(*ptr...); }, values);
+                }
+            }
+        }
+
+    private:
+        template <typename T>
+        static T *FindComponent(Actor *actor);
+
+        std::vector<std::vector<ComponentBase *>> sets;
+    };
+
+} // namespace sky
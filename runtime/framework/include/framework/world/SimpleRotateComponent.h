@@ -7,6 +7,7 @@
 #include <core/math/Transform.h>
 #include <core/event/Event.h>
 #include <framework/world/Component.h>
+#include <framework/world/ComponentStorage.h>
 #include <framework/interface/ITransformEvent.h>
 
 namespace sky {
@@ -24,6 +25,8 @@ namespace sky {
 
         COMPONENT_RUNTIME_INFO(SimpleRotateComponent)
 
+        static void DeclareTick(TickDesc &desc);
+
         void SetSpeed(float speed) { data.speed = speed; }
         float GetSpeed() const { return data.speed; }
 
@@ -8,6 +8,7 @@
 #include <core/event/Event.h>
 #include <framework/world/Component.h>
 #include <framework/interface/ITransformEvent.h>
+#include <framework/world/TransformSystem.h>
 
 namespace sky {
 
@@ -30,8 +31,13 @@ namespace sky {
         TransformComponent *GetParent() const { return parent; }
         void OnTransformChanged();
 
+        // in a world, setters only mark the node dirty, the world transform is recomputed on world tick
+        // or lazily by the world getters.
+        bool IsDirty() const { return dirty; }
+
+        // by value, a node read before the world update is composed from its ancestors on the fly.
         Matrix4 GetWorldMatrix() const;
-        const Transform &GetWorldTransform() const;
+        Transform GetWorldTransform() const;
 
         void SetWorldTransform(const Transform &trans);
         void SetWorldTranslation(const Vector3 &translation);
@@ -51,13 +57,27 @@ namespace sky {
         const Vector3 &GetLocalTranslation() const;
         const Vector3 &GetLocalScale() const;
 
+        void OnAttachToWorld() override;
+        void OnDetachFromWorld() override;
+
     private:
+        friend class TransformSystem;
+
         void UpdateLocal();
         void UpdateGlobal();
+        Transform ResolveGlobal() const;
+        std::unique_lock<std::recursive_mutex> LockHierarchy() const;
+        void OnLocalChanged();
         void OnSerialized() override;
 
         TransformComponent* parent = nullptr;
         std::vector<TransformComponent*> children;
+
+        TransformSystem *system = nullptr;
+        uint32_t nodeIndex = TransformSystem::INVALID_INDEX; // registration slot in the system.
+        uint32_t slot = TransformSystem::INVALID_INDEX;      // depth sorted slot in the system.
+        uint32_t pendingIndex = TransformSystem::INVALID_INDEX;
+        bool dirty = false;
     };
 
 } // namespace sky
@@ -0,0 +1,79 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/math/Transform.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace sky {
+    class World;
+    class Actor;
+    class TransformComponent;
+
+    // per world transform hierarchy, setters only mark nodes dirty and Update recomputes
+    // world transforms once per frame, level by level over depth sorted arrays.
+    class TransformSystem {
+    public:
+        explicit TransformSystem(World &world);
+        ~TransformSystem() = default;
+
+        TransformSystem(const TransformSystem &) = delete;
+        TransformSystem &operator=(const TransformSystem &) = delete;
+
+        static constexpr uint32_t INVALID_INDEX = ~0U;
+
+        void Register(TransformComponent *component);
+        void Unregister(TransformComponent *component);
+
+        void MarkDirty(TransformComponent *component);
+        void MarkHierarchyDirty() { hierarchyDirty = true; }
+
+        // world transform of one node before Update, composed from its dirty ancestors without writing them
+        // so parallel ticks may read any node.
+        Transform Resolve(const TransformComponent *component) const;
+
+        // held by setters of a node with a parent or children, a lone root has nobody reading it.
+        std::unique_lock<std::recursive_mutex> LockHierarchy(const TransformComponent *component) const;
+
+        // recomputes dirty subtrees and publishes one batched change notification.
+        void Update();
+
+        size_t GetNodeNum() const { return nodes.size(); }
+        uint32_t GetLevelNum() const { return levels.empty() ? 0 : static_cast<uint32_t>(levels.size() - 1); }
+
+    private:
+        void Rebuild();
+        void AddPending(TransformComponent *component);
+        void RemovePending(TransformComponent *component);
+        Transform Compose(const TransformComponent *node, const TransformComponent *top) const;
+
+        World &world;
+
+        std::vector<TransformComponent *> nodes;
+        std::vector<TransformComponent *> pending; // marked while the layout is being rebuilt.
+        std::mutex mutex;
+        mutable std::recursive_mutex hierarchyMutex;
+        bool hierarchyDirty = false;
+        // set by parallel ticks, a flag byte per slot needs no lock.
+        std::atomic_bool flagged{false};
+        std::atomic_bool stale{false};
+
+        // depth sorted, a parent's slot is always before its children's.
+        // children read their parent's world from the packed array instead of the component.
+        std::vector<TransformComponent *> sorted;
+        std::vector<Actor *> actors;
+        std::vector<uint32_t> parents;
+        std::vector<uint32_t> levels;
+        std::vector<Transform> worlds;
+        std::vector<uint8_t> flags;
+        std::vector<uint8_t> standalone;
+
+        std::vector<uint32_t> changedSlots;
+        std::vector<TransformComponent *> changed;
+    };
+
+} // namespace sky
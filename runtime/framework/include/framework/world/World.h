@@ -11,6 +11,9 @@
 #include <core/name/Name.h>
 #include <framework/world/Entity.h>
 #include <framework/world/Actor.h>
+#include <framework/world/ComponentStorage.h>
+#include <framework/world/TransformSystem.h>
+#include <framework/world/WorldScheduler.h>
 #include <framework/serialization/JsonArchive.h>
 #include <framework/serialization/BinaryArchive.h>
 
@@ -34,6 +37,21 @@ namespace sky {
 
         virtual void OnActorAttached(const ActorPtr &actor) = 0;
         virtual void OnActorDetached(const ActorPtr &actor) = 0;
+
+        // bulk attach and detach raise one event, listeners that care can override these.
+        virtual void OnActorsAttached(const std::vector<ActorPtr> &actors)
+        {
+            for (const auto &actor : actors) {
+                OnActorAttached(actor);
+            }
+        }
+
+        virtual void OnActorsDetached(const std::vector<ActorPtr> &actors)
+        {
+            for (const auto &actor : actors) {
+                OnActorDetached(actor);
+            }
+        }
     };
     using WorldEvent = Event<IWorldEvent>;
 
@@ -49,6 +67,9 @@ namespace sky {
         virtual void StopSimulation() {}
 
         virtual void Tick(float time) {}
+
+        // subsystems tick after physics and alone unless they declare what they touch.
+        virtual void DeclareTick(TickDesc &desc) const { desc.phase = TickPhase::POST_PHYSICS; }
     };
 
     class World : public RefObject {
@@ -72,11 +93,29 @@ namespace sky {
         ActorPtr CreateActor(const char *name, bool withTrans = true);
         ActorPtr CreateActor(const std::string &name, bool withTrans = true);
         ActorPtr CreateActor(const Uuid &id, bool withTrans = true);
-        ActorPtr GetActorByUuid(const Uuid &id);
+        ActorPtr GetActorByUuid(const Uuid &id) const;
+        ActorPtr GetActorByHandle(const ActorHandle &handle) const;
+        bool IsValid(const ActorHandle &handle) const;
+
+        // removal swaps the last actor into the hole, the order is not stable.
         const std::vector<ActorPtr> &GetActors() const { return actors; }
 
+        // linear walk over every component of a type in this world.
+        template <typename T>
+        ComponentView<T> View() const { return components.View<T>(); }
+
+        // func(T&, Ts&...) for every actor holding all the types.
+        template <typename T, typename ...Ts, typename Func>
+        void ForEach(Func &&func) const { components.ForEach<T, Ts...>(std::forward<Func>(func)); }
+
+        ComponentStorage &GetComponentStorage() { return components; }
+        TransformSystem &GetTransformSystem() { return transforms; }
+        WorldScheduler &GetScheduler() { return scheduler; }
+
         void AttachToWorld(const ActorPtr &);
         void DetachFromWorld(const ActorPtr &);
+        void AttachToWorld(const std::vector<ActorPtr> &);
+        void DetachFromWorld(const std::vector<ActorPtr> &);
         void Reset();
 
         void AddSubSystem(const Name &name, IWorldSubSystem*);
@@ -88,7 +127,21 @@ namespace sky {
     private:
         World() = default;
 
+        struct HandleSlot {
+            uint32_t actorIndex = ActorHandle::INVALID_INDEX;
+            uint32_t generation = 1;
+        };
+
+        bool AddActor(const ActorPtr &actor);
+        void RemoveActor(Actor *actor);
+
         std::vector<ActorPtr> actors;
+        std::unordered_map<Uuid, uint32_t> actorIndices;
+        std::vector<HandleSlot> handleSlots;
+        std::vector<uint32_t> freeHandles;
+        ComponentStorage components;
+        TransformSystem transforms{*this};
+        WorldScheduler scheduler{*this};
         std::unordered_map<Name, std::unique_ptr<IWorldSubSystem>> subSystems;
 
         std::unordered_map<Name, Any> worldConfigs;
@@ -0,0 +1,94 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <framework/world/ComponentStorage.h>
+#include <core/async/TaskGraph.h>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sky {
+    class World;
+    class IWorldSubSystem;
+
+    // ticks every phase as a task graph built from the declared access of component types and subsystems.
+    // two systems are only ordered when their access conflicts, conflicting systems keep the serial order:
+    // component types by index, then subsystems by registration.
+    // exclusive systems split a phase and run on the calling thread.
+    class WorldScheduler {
+    public:
+        explicit WorldScheduler(World &world);
+        ~WorldScheduler() = default;
+
+        WorldScheduler(const WorldScheduler &) = delete;
+        WorldScheduler &operator=(const WorldScheduler &) = delete;
+
+        static constexpr uint32_t CHUNK_SIZE = 512;
+
+        void AddSubSystem(const std::string_view &name, IWorldSubSystem *system);
+
+        void Tick(float time);
+
+        // every system runs on the calling thread in schedule order, for debugging.
+        void SetDeterministic(bool enable) { deterministic = enable; }
+        bool IsDeterministic() const { return deterministic; }
+
+        // records the schedule of every tick while enabled, only the last frame is kept.
+        void SetTraceEnable(bool enable) { traceEnable = enable; }
+        bool IsTraceEnabled() const { return traceEnable; }
+
+        struct TraceEvent {
+            std::string name;
+            TickPhase   phase  = TickPhase::PRE_PHYSICS;
+            uint32_t    thread = 0;
+            uint64_t    begin  = 0; // ns since the frame started.
+            uint64_t    end    = 0;
+            std::vector<std::string> dependencies;
+        };
+        const std::vector<TraceEvent> &GetTrace() const { return trace; }
+
+        // chrome://tracing json of the last traced frame.
+        std::string DumpTrace() const;
+
+    private:
+        struct Node {
+            uint32_t system = 0;
+            std::function<void()> func; // empty for the join node of a chunked system.
+            std::vector<uint32_t> dependencies;
+        };
+
+        struct System {
+            std::string name;
+            TickAccess  access;
+            uint32_t    first = 0; // chunk nodes, a dependency has to precede all of them.
+            uint32_t    last  = 0;
+            uint32_t    exit  = 0; // node the successors wait on.
+        };
+
+        void Build(TickPhase phase, float time);
+        void AddSystem(std::string name, TickAccess access, std::vector<std::function<void()>> &&funcs);
+        void Run(TickPhase phase);
+        void RunGraph(TickPhase phase, uint32_t first, uint32_t last);
+        void Execute(TickPhase phase, uint32_t index);
+
+        World &world;
+        std::vector<std::pair<std::string, IWorldSubSystem *>> subSystems; // in registration order.
+
+        std::vector<System> systems;
+        std::vector<Node>   nodes;
+        uint32_t segment = 0; // first system the next one may run beside.
+        TaskGraph graph;
+
+        bool deterministic = false;
+        bool traceEnable   = false;
+
+        uint64_t frameBegin = 0;
+        std::vector<TraceEvent> trace;
+        std::mutex traceMutex;
+    };
+
+} // namespace sky
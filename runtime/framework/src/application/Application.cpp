@@ -12,6 +12,9 @@
 #include <core/environment/Environment.h>
 #include <core/logger/Logger.h>
 #include <core/file/FileIO.h>
+#include <core/async/Task.h>
+#include <core/event/Event.h>
+#include <cxxopts.hpp>
 
 #include <framework/asset/AssetManager.h>
 //#include <framework/database/DBManager.h>
@@ -29,6 +32,8 @@ namespace sky {
 
     Application::~Application()
     {
+        frameGraph.Reset();
+
         if (moduleManager) {
             moduleManager->UnLoadModules();
         }
@@ -49,8 +54,29 @@ namespace sky {
         }
     }
 
+    static void SelectTaskBackend(const StartArguments &arguments)
+    {
+        cxxopts::Options options("Application", "SkyEngine Application");
+        options.allow_unrecognised_options();
+        options.add_options()("task-backend", "taskflow | work_stealing", cxxopts::value<std::string>());
+
+        auto result = options.parse(static_cast<int32_t>(arguments.args.size()), arguments.args.data());
+        if (result.count("task-backend") == 0u) {
+            return;
+        }
+
+        auto backend = result["task-backend"].as<std::string>();
+        if (backend == "work_stealing") {
+            TaskExecutor::SetDefaultBackend(TaskBackend::WORK_STEALING);
+        } else if (backend != "taskflow") {
+            LOG_W(TAG, "unknown task backend %s", backend.c_str());
+        }
+        LOG_I(TAG, "task backend %s", backend.c_str());
+    }
+
     bool Application::Init(int argc, char **argv)
     {
+        Logger::InstallCrashHandler();
         LOG_I(TAG, "Application Init Start...");
         env = Environment::Get();
         if (env == nullptr) {
@@ -61,6 +87,9 @@ namespace sky {
         // save args
         SaveArgs(argc, argv);
 
+        // has to run before anything creates the task executor.
+        SelectTaskBackend(arguments);
+
         // module manager
         moduleManager = std::make_unique<ModuleManager>();
 
@@ -108,6 +137,11 @@ namespace sky {
             PreTick();
         }
 
+        {
+            SKY_PROFILE_NAME("Event Flush")
+            EventQueue::Get()->Flush();
+        }
+
 
         uint64_t        frequency      = Platform::Get()->GetPerformanceFrequency();
         uint64_t        currentCounter = Platform::Get()->GetPerformanceCounter();
@@ -124,6 +158,13 @@ namespace sky {
             SKY_PROFILE_NAME("Module Tick")
             moduleManager->Tick(delta);
         }
+
+        {
+            SKY_PROFILE_NAME("Frame Tasks")
+            frameGraph.Dispatch();
+            frameGraph.Wait();
+            frameGraph.Reset();
+        }
     }
 
     void Application::Mainloop()
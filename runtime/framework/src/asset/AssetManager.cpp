@@ -8,6 +8,9 @@
 #include <framework/platform/PlatformBase.h>
 #include <core/logger/Logger.h>
 #include <core/archive/FileArchive.h>
+#include <core/archive/BinaryDataArchive.h>
+#include <core/archive/BufferedArchive.h>
+#include <core/file/AsyncFileIO.h>
 #include <core/profile/Profiler.h>
 
 static const char* TAG = "AssetManager";
@@ -60,22 +63,17 @@ namespace sky {
 
     AssetPtr AssetManager::CreateAssetByHeader(const Uuid &uuid, const IStreamArchivePtr &archive)
     {
+        // the stream is handed back right behind the header when the buffer goes out of scope.
+        BufferedInputArchive header(*archive);
+
         // get asset type
         std::string type;
-        archive->Load(type);
+        header.Load(type);
 
         // try to find again
         auto asset = FindOrCreateAsset(uuid, Name(type.c_str()));
         if (asset) {
-            uint32_t depCount = 0;
-            archive->Load(depCount);
-
-            asset->dependencies.resize(depCount);
-            for (uint32_t i = 0; i < depCount; ++i) {
-                auto &dep = asset->dependencies[i];
-                archive->Load(dep.word[0]);
-                archive->Load(dep.word[1]);
-            }
+            header.Load(asset->dependencies);
         }
         return asset;
     }
@@ -95,8 +93,48 @@ namespace sky {
             return {};
         }
 
-        auto archive = file->ReadAsArchive();
-        asset = CreateAssetByHeader(uuid, archive);
+        return LoadAssetFromArchive(uuid, file->ReadAsArchive());
+    }
+
+    void AssetManager::LoadAssetAsync(const Uuid &uuid, AssetLoadCallback &&callback)
+    {
+        auto asset = FindAsset(uuid);
+        if (asset && asset->IsLoaded()) {
+            if (callback) {
+                callback(asset);
+            }
+            return;
+        }
+
+        auto file = OpenFile(uuid);
+        if (!file) {
+            LOG_E(TAG, "Asset file missing %s", uuid.ToString().c_str());
+            if (callback) {
+                callback({});
+            }
+            return;
+        }
+
+        // the header and the payload come in with one read, dependencies are resolved on the io callback.
+        FileReadRequest request = {};
+        request.file = file;
+        request.callback = [this, uuid, callback = std::move(callback)](AsyncRead &read) {
+            AssetPtr result;
+            if (read.GetStatus() == IOStatus::SUCCESS) {
+                result = LoadAssetFromArchive(uuid, new IBinaryDataArchive(read.GetData()));
+            } else {
+                LOG_E(TAG, "Asset file read failed %s", uuid.ToString().c_str());
+            }
+            if (callback) {
+                callback(result);
+            }
+        };
+        AsyncFileIO::Get()->Read(std::move(request));
+    }
+
+    AssetPtr AssetManager::LoadAssetFromArchive(const Uuid &uuid, const IStreamArchivePtr &archive) // NOLINT
+    {
+        auto asset = CreateAssetByHeader(uuid, archive);
         if (!asset) {
             return {};
         }
@@ -186,14 +224,10 @@ namespace sky {
         }
 
         auto archive = file->WriteAsArchive();
-
-        auto type = asset->type.GetStr();
-        archive->Save(static_cast<uint32_t>(type.size()));
-        archive->SaveRaw(type.data(), type.size());
-        archive->Save(static_cast<uint32_t>(asset->dependencies.size()));
-        for (auto &dep : asset->dependencies) {
-            archive->Save(dep.word[0]);
-            archive->Save(dep.word[1]);
+        {
+            BufferedOutputArchive header(*archive);
+            header.Save(asset->type.GetStr());
+            header.Save(asset->dependencies);
         }
 
         asset->status.store(AssetBase::Status::LOADED);
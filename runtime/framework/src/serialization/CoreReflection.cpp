@@ -60,13 +60,11 @@ namespace sky {
 
     void BinarySaveUuid(const Uuid &uuid, BinaryOutputArchive &ar)
     {
-        ar.SaveValue(uuid.word[0]);
-        ar.SaveValue(uuid.word[1]);
+        ar.SaveValue(uuid);
     }
     void BinaryLoadUuid(Uuid &uuid, BinaryInputArchive &ar)
     {
-        ar.LoadValue(uuid.word[0]);
-        ar.LoadValue(uuid.word[1]);
+        ar.LoadValue(uuid);
     }
 
     void CoreReflection(SerializationContext *context)
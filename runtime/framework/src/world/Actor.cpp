@@ -5,43 +5,70 @@
 #include <framework/world/Actor.h>
 #include <framework/world/World.h>
 #include <framework/world/TransformComponent.h>
+#include <algorithm>
 
 namespace sky {
 
     Actor::~Actor()
     {
+        if (world != nullptr) {
+            auto &components = world->GetComponentStorage();
+            for (auto &[id, component] : storage) {
+                components.Remove(component.get());
+            }
+        }
         storage.clear();
     }
 
-    ComponentBase *Actor::GetComponent(const Uuid &typeId)
+    ComponentBase *Actor::CreateComponent(const Uuid &typeId, uint32_t &typeIndex)
     {
-        auto iter = storage.find(typeId);
-        return iter != storage.end() ? iter->second.get() : nullptr;
+        const auto *type = SerializationContext::Get()->FindTypeById(typeId);
+        if (type == nullptr || type->info->placeFunc == nullptr) {
+            return nullptr;
+        }
+
+        typeIndex = ComponentTypeRegistry::Get()->Register(typeId);
+        void *ptr = ComponentTypeRegistry::Get()->Allocate(typeIndex);
+        type->info->placeFunc(ptr);
+        return static_cast<ComponentBase*>(ptr);
     }
 
-    bool Actor::EmplaceComponent(const Uuid &typeId, ComponentBase* component)
+    void Actor::EmplaceComponent(const Uuid &typeId, uint32_t typeIndex, ComponentBase* component)
     {
         component->actor = this;
-        auto res = storage.emplace(typeId, component);
+        component->typeIndex = typeIndex;
+        storage.emplace_back(typeId, ComponentPtr(component));
         if (world != nullptr) {
+            world->GetComponentStorage().Add(component);
             component->OnAttachToWorld();
         }
-        return res.second;
     }
 
     ComponentBase *Actor::AddComponent(const Uuid &typeId)
     {
-        auto *component = static_cast<ComponentBase*>(SerializationContext::Get()->FindTypeById(typeId)->info->newFunc());
-        if (!EmplaceComponent(typeId, component)) {
-            delete component;
-            component = nullptr;
+        if (GetComponent(typeId) != nullptr) {
+            return nullptr;
+        }
+
+        uint32_t typeIndex = ComponentTypeRegistry::INVALID_INDEX;
+        auto *component = CreateComponent(typeId, typeIndex);
+        if (component != nullptr) {
+            EmplaceComponent(typeId, typeIndex, component);
         }
         return component;
     }
 
     void Actor::RemoveComponent(const Uuid &typeId)
     {
-        storage.erase(typeId);
+        auto iter = std::find_if(storage.begin(), storage.end(), [&typeId](const auto &val) { return val.first == typeId; });
+        if (iter == storage.end()) {
+            return;
+        }
+
+        if (world != nullptr) {
+            world->GetComponentStorage().Remove(iter->second.get());
+        }
+        storage.erase(iter);
     }
 
     void Actor::SaveJson(JsonOutputArchive &archive)
@@ -78,8 +105,6 @@ namespace sky {
 
         auto componentCount = archive.StartArray("components");
 
-        auto *context = SerializationContext::Get();
-
         for (uint32_t i = 0; i < componentCount; ++i) {
 
             archive.Start("type");
@@ -87,13 +112,13 @@ namespace sky {
             archive.End();
 
             archive.Start("data");
-            auto* iter = context->FindTypeById(typeId);
-            if (iter->info->newFunc != nullptr) {
-                auto *tmp = static_cast<ComponentBase*>(context->FindTypeById(typeId)->info->newFunc());
+            uint32_t typeIndex = ComponentTypeRegistry::INVALID_INDEX;
+            auto *tmp = GetComponent(typeId) == nullptr ? CreateComponent(typeId, typeIndex) : nullptr;
+            if (tmp != nullptr) {
                 tmp->LoadJson(archive);
                 tmp->actor = this;
                 tmp->OnSerialized();
-                EmplaceComponent(typeId, tmp);
+                EmplaceComponent(typeId, typeIndex, tmp);
             }
             archive.End();
 
@@ -126,6 +151,10 @@ namespace sky {
     void Actor::AttachToWorld(World *world_)
     {
         world = world_;
+        auto &components = world->GetComponentStorage();
+        for (auto &[id, component] : storage) {
+            components.Add(component.get());
+        }
         for (auto &[id, component] : storage) {
             component->OnAttachToWorld();
         }
@@ -137,8 +166,10 @@ namespace sky {
     {
         ActorEvent::BroadCast(this, &IActorEvent::OnDetachFromWorld, world);
 
+        auto &components = world->GetComponentStorage();
         for (auto &[id, component] : storage) {
             component->OnDetachFromWorld();
+            components.Remove(component.get());
         }
         world = nullptr;
     }
@@ -0,0 +1,164 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <framework/world/ComponentStorage.h>
+#include <framework/serialization/SerializationContext.h>
+#include <core/platform/Platform.h>
+#include <algorithm>
+
+namespace sky {
+
+    namespace {
+        constexpr size_t POOL_ALIGNMENT = alignof(std::max_align_t);
+    } // namespace
+
+    ComponentPool::ComponentPool(size_t size, uint32_t num)
+        : stride((size + POOL_ALIGNMENT - 1) & ~(POOL_ALIGNMENT - 1))
+        , numPerBlock(num)
+        , blockUsed(num)
+    {
+    }
+
+    void *ComponentPool::Allocate()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!freeList.empty()) {
+            void *back = freeList.back();
+            freeList.pop_back();
+            return back;
+        }
+
+        if (blockUsed == numPerBlock) {
+            blocks.emplace_back(new uint8_t[stride * numPerBlock]);
+            blockUsed = 0;
+        }
+        return blocks.back().get() + stride * (blockUsed++);
+    }
+
+    void ComponentPool::Free(void *ptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        freeList.emplace_back(ptr);
+    }
+
+    bool TickAccess::Conflicts(const TickAccess &rhs) const
+    {
+        if (exclusive || rhs.exclusive) {
+            return true;
+        }
+
+        auto overlaps = [](const std::vector<uint32_t> &lhs, const std::vector<uint32_t> &rhs) {
+            return std::find_first_of(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()) != lhs.end();
+        };
+        return overlaps(writes, rhs.writes) || overlaps(writes, rhs.reads) || overlaps(reads, rhs.writes);
+    }
+
+    uint32_t ComponentTypeRegistry::Register(const Uuid &typeId)
+    {
+        auto index = FindIndex(typeId);
+        if (index != INVALID_INDEX) {
+            return index;
+        }
+
+        const auto *type = SerializationContext::Get()->FindTypeById(typeId);
+        SKY_ASSERT(type != nullptr && type->info->staticInfo != nullptr);
+        return Register(typeId, type->info->staticInfo->size, true);
+    }
+
+    uint32_t ComponentTypeRegistry::Register(const Uuid &typeId, size_t size, bool hasTick, const TickDesc &desc)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto iter = indices.find(typeId);
+        if (iter != indices.end()) {
+            // the typed registration knows better than the reflected one.
+            types[iter->second]->hasTick = hasTick;
+            types[iter->second]->tick    = desc;
+            return iter->second;
+        }
+
+        auto index = static_cast<uint32_t>(types.size());
+        auto &entry = types.emplace_back(new Entry());
+        entry->typeId  = typeId;
+        entry->hasTick = hasTick;
+        entry->tick    = desc;
+        entry->pool    = std::make_unique<ComponentPool>(size);
+        indices.emplace(typeId, index);
+        return index;
+    }
+
+    uint32_t ComponentTypeRegistry::FindIndex(const Uuid &typeId) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto iter = indices.find(typeId);
+        return iter != indices.end() ? iter->second : INVALID_INDEX;
+    }
+
+    const ComponentTypeRegistry::Entry &ComponentTypeRegistry::GetEntry(uint32_t index) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return *types[index];
+    }
+
+    void *ComponentTypeRegistry::Allocate(uint32_t index)
+    {
+        return GetEntry(index).pool->Allocate();
+    }
+
+    void ComponentTypeRegistry::Free(uint32_t index, void *ptr)
+    {
+        GetEntry(index).pool->Free(ptr);
+    }
+
+    void ComponentDeleter::operator()(ComponentBase *component) const
+    {
+        // components are single inheritance roots, the base address is the allocation.
+        auto index = component->typeIndex;
+        component->~ComponentBase();
+        ComponentTypeRegistry::Get()->Free(index, component);
+    }
+
+    void ComponentStorage::Add(ComponentBase *component)
+    {
+        SKY_ASSERT(component->storageIndex == ComponentBase::INVALID_INDEX);
+        auto typeIndex = component->typeIndex;
+        if (typeIndex >= sets.size()) {
+            sets.resize(typeIndex + 1);
+        }
+
+        auto &components = sets[typeIndex];
+        component->storageIndex = static_cast<uint32_t>(components.size());
+        components.emplace_back(component);
+    }
+
+    void ComponentStorage::Remove(ComponentBase *component)
+    {
+        if (component->storageIndex == ComponentBase::INVALID_INDEX) {
+            return;
+        }
+
+        auto &components = sets[component->typeIndex];
+        auto *back = components.back();
+        components[component->storageIndex] = back;
+        back->storageIndex = component->storageIndex;
+        components.pop_back();
+        component->storageIndex = ComponentBase::INVALID_INDEX;
+    }
+
+    void ComponentStorage::Clear()
+    {
+        for (auto &components : sets) {
+            for (auto *component : components) {
+                component->storageIndex = ComponentBase::INVALID_INDEX;
+            }
+            components.clear();
+        }
+    }
+
+    const std::vector<ComponentBase *> &ComponentStorage::GetComponents(uint32_t typeIndex) const
+    {
+        static const std::vector<ComponentBase *> EMPTY;
+        return typeIndex < sets.size() ? sets[typeIndex] : EMPTY;
+    }
+
+} // namespace sky
@@ -21,6 +21,14 @@ namespace sky {
         ComponentFactory::Get()->RegisterComponent<SimpleRotateComponent>("Base");
     }
 
+    void SimpleRotateComponent::DeclareTick(TickDesc &desc)
+    {
+        // only rotates its own actor.
+        desc.phase = TickPhase::PRE_PHYSICS;
+        desc.access.Write<TransformComponent>();
+        desc.parallel = true;
+    }
+
     void SimpleRotateComponent::Tick(float time)
     {
         angle += time * data.speed;
@@ -5,6 +5,7 @@
 #include <framework/world/TransformComponent.h>
 #include <framework/world/ComponentFactory.h>
 #include <framework/world/Actor.h>
+#include <framework/world/World.h>
 #include <framework/serialization/SerializationContext.h>
 
 namespace sky {
@@ -27,20 +28,32 @@ namespace sky {
 
     TransformComponent::~TransformComponent()
     {
+        for (auto &child : children) {
+            child->data.global = child->ResolveGlobal();
+        }
+        if (system != nullptr) {
+            system->Unregister(this);
+        }
         SetParent(nullptr);
+
+        // orphans keep where they are in the world.
         for (auto &child : children) {
             child->parent = nullptr;
+            child->data.local = child->data.global;
+            if (child->system != nullptr) {
+                child->system->MarkHierarchyDirty();
+            }
         }
     }
 
     Matrix4 TransformComponent::GetWorldMatrix() const
     {
-        return data.global.ToMatrix();
+        return ResolveGlobal().ToMatrix();
     }
 
-    const Transform &TransformComponent::GetWorldTransform() const
+    Transform TransformComponent::GetWorldTransform() const
     {
-        return data.global;
+        return ResolveGlobal();
     }
 
     void TransformComponent::SetParent(TransformComponent *parent_)
@@ -49,6 +62,8 @@ namespace sky {
             return;
         }
 
+        data.global = ResolveGlobal();
+
         if (parent != nullptr) {
             parent->children.erase(std::remove(parent->children.begin(), parent->children.end(), this), parent->children.end());
         }
@@ -60,70 +75,102 @@ namespace sky {
         if (parent != nullptr) {
             parent->children.emplace_back(this);
         }
+
+        if (system != nullptr) {
+            system->MarkHierarchyDirty();
+            system->MarkDirty(this);
+        }
     }
 
     void TransformComponent::OnTransformChanged() // NOLINT
     {
         TransformEvent::BroadCast(actor, &ITransformEvent::OnTransformChanged, data.global, data.local);
         for (auto *child : children) {
+            child->UpdateGlobal();
             child->OnTransformChanged();
         }
     }
 
+    void TransformComponent::OnLocalChanged()
+    {
+        if (system != nullptr && parent == nullptr && children.empty()) {
+            // a lone root has nothing to propagate, the batch would only add a pass over it.
+            data.global = data.local;
+            OnTransformChanged();
+        } else if (system != nullptr) {
+            // a root is cheap to resolve while it is still in cache.
+            if (parent == nullptr) {
+                data.global = data.local;
+            }
+            system->MarkDirty(this);
+        } else {
+            // outside a world there is no frame to batch into.
+            UpdateGlobal();
+            OnTransformChanged();
+        }
+    }
+
     void TransformComponent::SetWorldTransform(const Transform &trans)
     {
+        auto lock = LockHierarchy();
         data.global = trans;
         UpdateLocal();
-        OnTransformChanged();
+        OnLocalChanged();
     }
 
     void TransformComponent::SetWorldTranslation(const Vector3 &translation)
     {
+        auto lock = LockHierarchy();
+        data.global = ResolveGlobal();
         data.global.translation = translation;
         UpdateLocal();
-        OnTransformChanged();
+        OnLocalChanged();
     }
     void TransformComponent::SetWorldRotation(const Quaternion &rotation)
     {
+        auto lock = LockHierarchy();
+        data.global = ResolveGlobal();
         data.global.rotation = rotation;
         UpdateLocal();
-        OnTransformChanged();
+        OnLocalChanged();
     }
     void TransformComponent::SetWorldScale(const Vector3 &scale)
     {
+        auto lock = LockHierarchy();
+        data.global = ResolveGlobal();
         data.global.scale = scale;
         UpdateLocal();
-        OnTransformChanged();
+        OnLocalChanged();
     }
     void TransformComponent::SetLocalTransform(const Transform &trans)
     {
+        auto lock = LockHierarchy();
         data.local = trans;
-        UpdateGlobal();
-        OnTransformChanged();
+        OnLocalChanged();
     }
     void TransformComponent::SetLocalTranslation(const Vector3 &translation)
     {
+        auto lock = LockHierarchy();
         data.local.translation = translation;
-        UpdateGlobal();
-        OnTransformChanged();
+        OnLocalChanged();
     }
     void TransformComponent::SetLocalRotationEuler(const Vector3 &euler)
     {
+        auto lock = LockHierarchy();
         data.local.rotation.FromEulerYZX(euler);
-        UpdateGlobal();
-        OnTransformChanged();
+        OnLocalChanged();
     }
     void TransformComponent::SetLocalRotation(const Quaternion &rotation)
     {
+        auto lock = LockHierarchy();
         data.local.rotation = rotation;
-        UpdateGlobal();
-        OnTransformChanged();
+        OnLocalChanged();
     }
     void TransformComponent::SetLocalScale(const Vector3 &scale)
     {
+        auto lock = LockHierarchy();
         data.local.scale = scale;
-        UpdateGlobal();
-        OnTransformChanged();
+        OnLocalChanged();
     }
 
     Vector3 TransformComponent::GetLocalRotationEuler() const
@@ -146,16 +193,41 @@ namespace sky {
 
     void TransformComponent::UpdateLocal()
     {
-        data.local = parent != nullptr ? parent->data.global.GetInverse() * data.global : data.global;
+        data.local = parent != nullptr ? parent->ResolveGlobal().GetInverse() * data.global : data.global;
     }
 
     void TransformComponent::UpdateGlobal()
     {
-        data.global = parent != nullptr ? parent->data.global * data.local * data.global : data.local;
+        data.global = parent != nullptr ? parent->data.global * data.local : data.local;
+    }
+
+    Transform TransformComponent::ResolveGlobal() const
+    {
+        return system != nullptr ? system->Resolve(this) : data.global;
+    }
+
+    std::unique_lock<std::recursive_mutex> TransformComponent::LockHierarchy() const
+    {
+        return system != nullptr ? system->LockHierarchy(this) : std::unique_lock<std::recursive_mutex>{};
     }
 
     void TransformComponent::OnSerialized()
     {
         UpdateGlobal();
+        if (system != nullptr) {
+            system->MarkDirty(this);
+        }
+    }
+
+    void TransformComponent::OnAttachToWorld()
+    {
+        actor->GetWorld()->GetTransformSystem().Register(this);
+    }
+
+    void TransformComponent::OnDetachFromWorld()
+    {
+        if (system != nullptr) {
+            system->Unregister(this);
+        }
     }
 } // namespace sky
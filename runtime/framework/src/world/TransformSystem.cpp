@@ -0,0 +1,272 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <framework/world/TransformSystem.h>
+#include <framework/world/TransformComponent.h>
+#include <framework/world/Actor.h>
+#include <core/async/ParallelFor.h>
+#include <core/profile/Profiler.h>
+
+namespace sky {
+
+    namespace {
+        constexpr uint32_t PARALLEL_GRAIN = 256;
+    } // namespace
+
+    TransformSystem::TransformSystem(World &w) : world(w)
+    {
+    }
+
+    void TransformSystem::Register(TransformComponent *component)
+    {
+        SKY_ASSERT(component->nodeIndex == INVALID_INDEX);
+        component->system    = this;
+        component->nodeIndex = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back(component);
+        hierarchyDirty = true;
+
+        // the parent may have moved while the node was outside the world.
+        MarkDirty(component);
+    }
+
+    void TransformSystem::Unregister(TransformComponent *component)
+    {
+        if (component->nodeIndex == INVALID_INDEX) {
+            return;
+        }
+
+        auto *back = nodes.back();
+        nodes[component->nodeIndex] = back;
+        back->nodeIndex = component->nodeIndex;
+        nodes.pop_back();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            RemovePending(component);
+            // the slot still addresses the last layout until the next rebuild.
+            if (component->slot < flags.size()) {
+                flags[component->slot] = 0;
+            }
+        }
+
+        component->system    = nullptr;
+        component->nodeIndex = INVALID_INDEX;
+        component->slot      = INVALID_INDEX;
+        component->dirty     = false;
+        hierarchyDirty = true;
+    }
+
+    void TransformSystem::MarkDirty(TransformComponent *component)
+    {
+        if (component->dirty) {
+            return;
+        }
+
+        bool layout = !hierarchyDirty && component->slot != INVALID_INDEX;
+        if (layout && flags[component->slot] != 0) {
+            return;
+        }
+
+        if (layout) {
+            // a lone root already holds its world transform.
+            if (component->parent != nullptr || !component->children.empty()) {
+                component->dirty = true;
+                stale.store(true, std::memory_order_relaxed);
+            }
+            flags[component->slot] = 1;
+            flagged.store(true, std::memory_order_relaxed);
+            return;
+        }
+
+        // marked to dedup the pending list.
+        std::lock_guard<std::mutex> lock(mutex);
+        component->dirty = true;
+        stale.store(true, std::memory_order_relaxed);
+        AddPending(component);
+        flagged.store(true, std::memory_order_relaxed);
+    }
+
+    void TransformSystem::AddPending(TransformComponent *component)
+    {
+        if (component->pendingIndex == INVALID_INDEX) {
+            component->pendingIndex = static_cast<uint32_t>(pending.size());
+            pending.emplace_back(component);
+        }
+    }
+
+    void TransformSystem::RemovePending(TransformComponent *component)
+    {
+        if (component->pendingIndex == INVALID_INDEX) {
+            return;
+        }
+        auto *back = pending.back();
+        pending[component->pendingIndex] = back;
+        back->pendingIndex = component->pendingIndex;
+        pending.pop_back();
+        component->pendingIndex = INVALID_INDEX;
+    }
+
+    std::unique_lock<std::recursive_mutex> TransformSystem::LockHierarchy(const TransformComponent *component) const
+    {
+        if (component->parent == nullptr && component->children.empty()) {
+            return {};
+        }
+        return std::unique_lock<std::recursive_mutex>(hierarchyMutex);
+    }
+
+    Transform TransformSystem::Resolve(const TransformComponent *component) const
+    {
+        // a lone root already holds its world transform.
+        if (!stale.load(std::memory_order_relaxed) || (component->parent == nullptr && component->children.empty())) {
+            return component->data.global;
+        }
+
+        std::lock_guard<std::recursive_mutex> lock(hierarchyMutex);
+
+        // the topmost dirty ancestor is where stale values start.
+        const TransformComponent *top = nullptr;
+        for (const auto *node = component; node != nullptr; node = node->parent) {
+            if (node->dirty) {
+                top = node;
+            }
+        }
+        return top != nullptr ? Compose(component, top) : component->data.global;
+    }
+
+    Transform TransformSystem::Compose(const TransformComponent *node, const TransformComponent *top) const // NOLINT
+    {
+        if (node == top) {
+            return top->parent != nullptr ? top->parent->data.global * top->data.local : top->data.local;
+        }
+        return Compose(node->parent, top) * node->data.local;
+    }
+
+    void TransformSystem::Rebuild()
+    {
+        SKY_PROFILE_NAME("Transform Rebuild")
+
+        // flags of the old layout move over to the new one.
+        for (uint32_t i = 0; i < flags.size(); ++i) {
+            if (flags[i] != 0) {
+                AddPending(sorted[i]);
+            }
+        }
+
+        sorted.clear();
+        actors.clear();
+        parents.clear();
+        levels.clear();
+        standalone.clear();
+
+        // nodes whose parent lives outside this world are roots too.
+        for (auto *node : nodes) {
+            if (node->parent == nullptr || node->parent->system != this) {
+                node->slot = static_cast<uint32_t>(sorted.size());
+                sorted.emplace_back(node);
+                parents.emplace_back(INVALID_INDEX);
+                bool lone = node->parent == nullptr && node->children.empty();
+                standalone.emplace_back(lone ? 1 : 0);
+                // orphans may still carry the mark from their old parent.
+                node->dirty = node->dirty && !lone;
+            }
+        }
+
+        uint32_t begin = 0;
+        while (begin < sorted.size()) {
+            auto end = static_cast<uint32_t>(sorted.size());
+            levels.emplace_back(begin);
+            for (uint32_t i = begin; i < end; ++i) {
+                for (auto *child : sorted[i]->children) {
+                    if (child->system == this) {
+                        child->slot = static_cast<uint32_t>(sorted.size());
+                        sorted.emplace_back(child);
+                        parents.emplace_back(i);
+                        standalone.emplace_back(0);
+                    }
+                }
+            }
+            begin = end;
+        }
+        levels.emplace_back(static_cast<uint32_t>(sorted.size()));
+
+        actors.resize(sorted.size());
+        worlds.resize(sorted.size());
+        for (uint32_t i = 0; i < sorted.size(); ++i) {
+            actors[i] = sorted[i]->actor;
+            worlds[i] = sorted[i]->data.global;
+        }
+
+        flags.assign(sorted.size(), 0);
+        for (auto *node : pending) {
+            flags[node->slot] = 1;
+            node->pendingIndex = INVALID_INDEX;
+        }
+        pending.clear();
+        hierarchyDirty = false;
+    }
+
+    void TransformSystem::Update()
+    {
+        SKY_PROFILE_NAME("Transform Update")
+        if (hierarchyDirty) {
+            Rebuild();
+        }
+        if (!flagged.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        // a dirty parent dirties the whole subtree, one level at a time.
+        auto levelNum = GetLevelNum();
+        for (uint32_t level = 1; level < levelNum; ++level) {
+            ParallelFor(levels[level], levels[level + 1], [this](uint32_t first, uint32_t last) {
+                for (uint32_t i = first; i < last; ++i) {
+                    flags[i] |= flags[parents[i]];
+                }
+            }, PARALLEL_GRAIN);
+        }
+
+        // a level only reads the one above it, every slot inside a level is independent.
+        for (uint32_t level = 0; level < levelNum; ++level) {
+            ParallelFor(levels[level], levels[level + 1], [this](uint32_t first, uint32_t last) {
+                for (uint32_t i = first; i < last; ++i) {
+                    // lone roots are resolved by their setters and nobody reads them here.
+                    if (flags[i] == 0 || standalone[i] != 0) {
+                        continue;
+                    }
+                    auto *node = sorted[i];
+                    if (parents[i] != INVALID_INDEX) {
+                        worlds[i] = worlds[parents[i]] * node->data.local;
+                        node->data.global = worlds[i];
+                    } else if (node->parent != nullptr) {
+                        worlds[i] = node->parent->data.global * node->data.local;
+                        node->data.global = worlds[i];
+                    } else {
+                        worlds[i] = node->data.global;
+                    }
+                    node->dirty = false;
+                }
+            }, PARALLEL_GRAIN);
+        }
+
+        changedSlots.clear();
+        changed.clear();
+        for (uint32_t i = 0; i < sorted.size(); ++i) {
+            if (flags[i] != 0) {
+                flags[i] = 0;
+                changedSlots.emplace_back(i);
+                changed.emplace_back(sorted[i]);
+            }
+        }
+        flagged.store(false, std::memory_order_relaxed);
+        stale.store(false, std::memory_order_relaxed);
+
+        // listeners may move nodes again, those are flagged for the next update.
+        for (auto slot : changedSlots) {
+            const auto &data = sorted[slot]->data;
+            TransformEvent::BroadCast(actors[slot], &ITransformEvent::OnTransformChanged, data.global, data.local);
+        }
+        TransformBatchEvent::BroadCast(&world, &ITransformBatchEvent::OnTransformsChanged, changed);
+    }
+
+} // namespace sky
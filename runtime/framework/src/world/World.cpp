@@ -8,7 +8,7 @@
 #include <framework/serialization/SerializationContext.h>
 #include <framework/serialization/JsonArchive.h>
 
-#include <core/profile/Profiler.h>
+#include <core/logger/Logger.h>
 
 #include <atomic>
 #include <deque>
@@ -16,10 +16,14 @@
 
 namespace sky {
 
+    static const char *TAG = "World";
+
     World::~World()
     {
         for (auto &actor : actors) {
             actor->DetachFromWorld();
+            actor->handle     = ActorHandle{};
+            actor->worldIndex = ActorHandle::INVALID_INDEX;
         }
         actors.clear();
 
@@ -46,19 +50,7 @@ namespace sky {
 
     void World::Tick(float time)
     {
-        {
-            SKY_PROFILE_NAME("Actors Tick")
-            for (auto &actor : actors) {
-                actor->Tick(time);
-            }
-        }
-
-        {
-            SKY_PROFILE_NAME("SubSystem Tick")
-            for (auto &sys : subSystems) {
-                sys.second->Tick(time);
-            }
-        }
+        scheduler.Tick(time);
     }
 
     void World::SaveJson(JsonOutputArchive &archive)
@@ -80,14 +72,20 @@ namespace sky {
     void World::LoadJson(JsonInputArchive &archive)
     {
         auto num = archive.StartArray("actors");
+        std::vector<ActorPtr> loaded;
+        loaded.reserve(num);
         for (uint32_t i = 0; i < num; ++i) {
             auto actor = std::make_shared<Actor>();
             actor->LoadJson(archive);
-            AttachToWorld(actor);
+            loaded.emplace_back(std::move(actor));
             archive.NextArrayElement();
         }
         archive.End();
 
+        actors.reserve(actors.size() + loaded.size());
+        actorIndices.reserve(actors.size() + loaded.size());
+        AttachToWorld(loaded);
+
         // resolve hierarchy
         for (auto &actor : actors) {
             auto *trans = actor->GetComponent<TransformComponent>();
@@ -124,53 +122,195 @@ namespace sky {
 
     ActorPtr World::CreateActor(const Uuid &id, bool withTrans)
     {
-        AttachToWorld(std::make_shared<Actor>(id));
-        if (withTrans) {
-            actors.back()->AddComponent<TransformComponent>();
+        auto actor = std::make_shared<Actor>(id);
+        AttachToWorld(actor);
+        if (withTrans && actor->GetWorld() == this) {
+            actor->AddComponent<TransformComponent>();
         }
-        return actors.back();
+        return actor;
+    }
+
+    ActorPtr World::GetActorByUuid(const Uuid &id) const
+    {
+        auto iter = actorIndices.find(id);
+        return iter != actorIndices.end() ? actors[iter->second] : ActorPtr{};
+    }
+
+    ActorPtr World::GetActorByHandle(const ActorHandle &handle) const
+    {
+        return IsValid(handle) ? actors[handleSlots[handle.index].actorIndex] : ActorPtr{};
+    }
+
+    bool World::IsValid(const ActorHandle &handle) const
+    {
+        return handle.index < handleSlots.size() &&
+            handleSlots[handle.index].generation == handle.generation &&
+            handleSlots[handle.index].actorIndex != ActorHandle::INVALID_INDEX;
     }
 
-    ActorPtr World::GetActorByUuid(const Uuid &id)
+    bool World::AddActor(const ActorPtr &actor)
     {
-        auto iter = std::find_if(actors.begin(), actors.end(), [&id](const auto &v) {
-            return id == v->GetUuid();
-        });
-        return iter != actors.end() ? *iter : ActorPtr{};
+        auto index = static_cast<uint32_t>(actors.size());
+        if (!actorIndices.emplace(actor->GetUuid(), index).second) {
+            LOG_E(TAG, "actor %s already in world", actor->GetUuid().ToString().c_str());
+            return false;
+        }
+
+        uint32_t handleIndex = 0;
+        if (!freeHandles.empty()) {
+            handleIndex = freeHandles.back();
+            freeHandles.pop_back();
+        } else {
+            handleIndex = static_cast<uint32_t>(handleSlots.size());
+            handleSlots.emplace_back();
+        }
+
+        auto &slot = handleSlots[handleIndex];
+        slot.actorIndex = index;
+
+        actor->handle     = ActorHandle{handleIndex, slot.generation};
+        actor->worldIndex = index;
+        actors.emplace_back(actor);
+        return true;
+    }
+
+    void World::RemoveActor(Actor *actor)
+    {
+        auto index = actor->worldIndex;
+        if (index == ActorHandle::INVALID_INDEX) {
+            return;
+        }
+
+        actorIndices.erase(actor->GetUuid());
+
+        // a bumped generation turns every copy of the handle stale.
+        auto &slot = handleSlots[actor->handle.index];
+        slot.actorIndex = ActorHandle::INVALID_INDEX;
+        ++slot.generation;
+        freeHandles.emplace_back(actor->handle.index);
+
+        actor->handle     = ActorHandle{};
+        actor->worldIndex = ActorHandle::INVALID_INDEX;
+
+        auto last = static_cast<uint32_t>(actors.size() - 1);
+        if (index != last) {
+            auto &moved = actors[index];
+            moved = std::move(actors[last]);
+            moved->worldIndex = index;
+            actorIndices[moved->GetUuid()] = index;
+            handleSlots[moved->handle.index].actorIndex = index;
+        }
+        actors.pop_back();
     }
 
     void World::AttachToWorld(const ActorPtr &actor)
     {
-        if (actor->world != nullptr && actor->world != this) {
+        if (actor->world == this) {
+            return;
+        }
+        if (actor->world != nullptr) {
             actor->world->DetachFromWorld(actor);
         }
-        actors.emplace_back(actor);
+        if (!AddActor(actor)) {
+            return;
+        }
         actor->AttachToWorld(this);
 
         WorldEvent::BroadCast(this, &IWorldEvent::OnActorAttached, actor);
     }
 
-    void World::DetachFromWorld(const ActorPtr &actor)
+    void World::DetachFromWorld(const ActorPtr &actor_)
     {
+        // the reference may point into the actor list.
+        ActorPtr actor = actor_;
+        if (actor->world != this) {
+            return;
+        }
         WorldEvent::BroadCast(this, &IWorldEvent::OnActorDetached, actor);
 
+        // a listener may have detached it already.
+        if (actor->world != this) {
+            return;
+        }
         actor->DetachFromWorld();
-        auto iter = std::find_if(actors.begin(), actors.end(),
-            [&actor](const auto &v) { return actor == v; });
+        RemoveActor(actor.get());
+    }
 
-        if (iter != actors.end()) {
-            actors.erase(iter);
+    void World::AttachToWorld(const std::vector<ActorPtr> &list)
+    {
+        std::vector<ActorPtr> attached;
+        attached.reserve(list.size());
+        for (const auto &actor : list) {
+            if (actor->world == this) {
+                continue;
+            }
+            if (actor->world != nullptr) {
+                actor->world->DetachFromWorld(actor);
+            }
+            if (AddActor(actor)) {
+                actor->AttachToWorld(this);
+                attached.emplace_back(actor);
+            }
+        }
+
+        if (!attached.empty()) {
+            WorldEvent::BroadCast(this, &IWorldEvent::OnActorsAttached, attached);
+        }
+    }
+
+    void World::DetachFromWorld(const std::vector<ActorPtr> &list)
+    {
+        // copied, the list may be the actor list itself. an actor listed twice is detached once.
+        std::vector<ActorPtr> detached;
+        std::vector<uint8_t> listed(actors.size(), 0);
+        detached.reserve(list.size());
+        for (const auto &actor : list) {
+            if (actor->world == this && listed[actor->worldIndex] == 0) {
+                listed[actor->worldIndex] = 1;
+                detached.emplace_back(actor);
+            }
+        }
+        if (detached.empty()) {
+            return;
+        }
+
+        WorldEvent::BroadCast(this, &IWorldEvent::OnActorsDetached, detached);
+        for (auto &actor : detached) {
+            // a listener may have detached it already.
+            if (actor->world != this) {
+                continue;
+            }
+            actor->DetachFromWorld();
+            RemoveActor(actor.get());
         }
     }
 
     void World::Reset()
     {
+        components.Clear();
+        for (auto &actor : actors) {
+            actor->DetachFromWorld();
+            actor->handle     = ActorHandle{};
+            actor->worldIndex = ActorHandle::INVALID_INDEX;
+        }
         actors.clear();
+        actorIndices.clear();
+
+        freeHandles.clear();
+        for (uint32_t i = 0; i < handleSlots.size(); ++i) {
+            auto &slot = handleSlots[i];
+            if (slot.actorIndex != ActorHandle::INVALID_INDEX) {
+                slot.actorIndex = ActorHandle::INVALID_INDEX;
+                ++slot.generation;
+            }
+            freeHandles.emplace_back(i);
+        }
     }
 
     void World::AddSubSystem(const Name &name, IWorldSubSystem* sys)
     {
         SKY_ASSERT(subSystems.emplace(name, sys).second);
+        scheduler.AddSubSystem(name.GetStr(), sys);
         sys->OnAttachToWorld(*this);
     }
 
@@ -0,0 +1,283 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <framework/world/WorldScheduler.h>
+#include <framework/world/World.h>
+#include <framework/serialization/SerializationContext.h>
+#include <core/profile/Profiler.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+namespace sky {
+
+    namespace {
+        const char *PHASE_NAMES[] = {"PRE_PHYSICS", "PHYSICS", "POST_PHYSICS", "PRE_RENDER"};
+        static_assert(std::size(PHASE_NAMES) == static_cast<size_t>(TickPhase::NUM));
+
+        uint64_t Now()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // small stable ids for the trace, in the order threads first run a system.
+        uint32_t GetTraceThread()
+        {
+            static std::atomic_uint32_t next{0};
+            thread_local uint32_t index = next.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        std::string GetTypeName(const Uuid &typeId)
+        {
+            const auto *type = SerializationContext::Get()->FindTypeById(typeId);
+            return type != nullptr && type->info != nullptr ? std::string(type->info->name) : typeId.ToString();
+        }
+
+        void AppendEscaped(std::string &out, const std::string &str)
+        {
+            for (auto c : str) {
+                if (c == '"' || c == '\\') {
+                    out += '\\';
+                }
+                out += c;
+            }
+        }
+    } // namespace
+
+    WorldScheduler::WorldScheduler(World &w) : world(w)
+    {
+    }
+
+    void WorldScheduler::AddSubSystem(const std::string_view &name, IWorldSubSystem *system)
+    {
+        subSystems.emplace_back(std::string(name), system);
+    }
+
+    void WorldScheduler::Tick(float time)
+    {
+        SKY_PROFILE_NAME("World Tick")
+        if (traceEnable) {
+            trace.clear();
+            frameBegin = Now();
+        }
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(TickPhase::NUM); ++i) {
+            auto phase = static_cast<TickPhase>(i);
+            Build(phase, time);
+            Run(phase);
+
+            // the next phase sees the world transforms of this one.
+            world.GetTransformSystem().Update();
+        }
+    }
+
+    void WorldScheduler::Build(TickPhase phase, float time)
+    {
+        systems.clear();
+        nodes.clear();
+        segment = 0;
+
+        auto &storage  = world.GetComponentStorage();
+        auto *registry = ComponentTypeRegistry::Get();
+        for (uint32_t i = 0; i < storage.GetTypeNum(); ++i) {
+            auto count = static_cast<uint32_t>(storage.GetComponents(i).size());
+            if (count == 0) {
+                continue;
+            }
+            const auto &entry = registry->GetEntry(i);
+            if (!entry.hasTick || entry.tick.phase != phase) {
+                continue;
+            }
+
+            // a tick always writes its own components.
+            TickAccess access = entry.tick.access;
+            if (!access.exclusive) {
+                access.writes.emplace_back(i);
+            }
+
+            std::vector<std::function<void()>> funcs;
+            if (entry.tick.parallel) {
+                for (uint32_t begin = 0; begin < count; begin += CHUNK_SIZE) {
+                    auto end = std::min(begin + CHUNK_SIZE, count);
+                    funcs.emplace_back([&storage, i, begin, end, time]() {
+                        const auto &components = storage.GetComponents(i);
+                        for (uint32_t j = begin; j < end; ++j) {
+                            components[j]->Tick(time);
+                        }
+                    });
+                }
+            } else {
+                funcs.emplace_back([&storage, i, time]() {
+                    // indexed loop, a tick may add or remove components.
+                    for (size_t j = 0; j < storage.GetComponents(i).size(); ++j) {
+                        storage.GetComponents(i)[j]->Tick(time);
+                    }
+                });
+            }
+            AddSystem(GetTypeName(entry.typeId), std::move(access), std::move(funcs));
+        }
+
+        for (auto &[name, system] : subSystems) {
+            TickDesc desc;
+            system->DeclareTick(desc);
+            if (desc.phase != phase) {
+                continue;
+            }
+
+            std::vector<std::function<void()>> funcs;
+            funcs.emplace_back([system = system, time]() { system->Tick(time); });
+            AddSystem(name, std::move(desc.access), std::move(funcs));
+        }
+    }
+
+    void WorldScheduler::AddSystem(std::string name, TickAccess access, std::vector<std::function<void()>> &&funcs)
+    {
+        auto index = static_cast<uint32_t>(systems.size());
+
+        // exclusive systems run alone on the calling thread, they order everything around them.
+        std::vector<uint32_t> dependencies;
+        if (access.exclusive) {
+            segment = index + 1;
+        } else {
+            for (uint32_t i = segment; i < index; ++i) {
+                if (systems[i].access.Conflicts(access)) {
+                    dependencies.emplace_back(systems[i].exit);
+                }
+            }
+        }
+
+        auto &system  = systems.emplace_back();
+        system.name   = std::move(name);
+        system.access = std::move(access);
+        system.first  = static_cast<uint32_t>(nodes.size());
+        for (auto &func : funcs) {
+            nodes.emplace_back(Node{index, std::move(func), dependencies});
+        }
+        system.last = static_cast<uint32_t>(nodes.size());
+
+        if (system.last - system.first > 1) {
+            std::vector<uint32_t> chunks(system.last - system.first);
+            for (uint32_t i = 0; i < chunks.size(); ++i) {
+                chunks[i] = system.first + i;
+            }
+            nodes.emplace_back(Node{index, {}, std::move(chunks)});
+        }
+        system.exit = static_cast<uint32_t>(nodes.size() - 1);
+    }
+
+    void WorldScheduler::Run(TickPhase phase)
+    {
+        if (deterministic) {
+            for (uint32_t i = 0; i < nodes.size(); ++i) {
+                Execute(phase, i);
+            }
+            return;
+        }
+
+        uint32_t begin = 0;
+        auto count = static_cast<uint32_t>(systems.size());
+        for (uint32_t i = 0; i <= count; ++i) {
+            if (i < count && !systems[i].access.exclusive) {
+                continue;
+            }
+            if (begin < i) {
+                RunGraph(phase, systems[begin].first, systems[i - 1].exit + 1);
+            }
+            if (i < count) {
+                for (uint32_t n = systems[i].first; n <= systems[i].exit; ++n) {
+                    Execute(phase, n);
+                }
+            }
+            begin = i + 1;
+        }
+    }
+
+    void WorldScheduler::RunGraph(TickPhase phase, uint32_t first, uint32_t last)
+    {
+        if (last - first == 1) {
+            Execute(phase, first);
+            return;
+        }
+
+        graph.Reset();
+        std::vector<TaskGraph::Handle> handles;
+        handles.reserve(last - first);
+        for (uint32_t i = first; i < last; ++i) {
+            handles.emplace_back(graph.Add(systems[nodes[i].system].name.c_str(), [this, phase, i]() {
+                Execute(phase, i);
+            }));
+        }
+        for (uint32_t i = first; i < last; ++i) {
+            for (auto dependency : nodes[i].dependencies) {
+                SKY_ASSERT(dependency >= first && dependency < i);
+                handles[dependency - first].Precede(handles[i - first]);
+            }
+        }
+
+        graph.Dispatch();
+        graph.Wait();
+    }
+
+    void WorldScheduler::Execute(TickPhase phase, uint32_t index)
+    {
+        const auto &node = nodes[index];
+        if (!node.func) {
+            return;
+        }
+        if (!traceEnable) {
+            node.func();
+            return;
+        }
+
+        auto begin = Now();
+        node.func();
+        auto end = Now();
+
+        TraceEvent event;
+        event.name   = systems[node.system].name;
+        event.phase  = phase;
+        event.thread = GetTraceThread();
+        event.begin  = begin - frameBegin;
+        event.end    = end - frameBegin;
+        for (auto dependency : node.dependencies) {
+            const auto &name = systems[nodes[dependency].system].name;
+            if (std::find(event.dependencies.begin(), event.dependencies.end(), name) == event.dependencies.end()) {
+                event.dependencies.emplace_back(name);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(traceMutex);
+        trace.emplace_back(std::move(event));
+    }
+
+    std::string WorldScheduler::DumpTrace() const
+    {
+        std::string out = "{\"traceEvents\":[";
+        char buffer[128];
+        for (size_t i = 0; i < trace.size(); ++i) {
+            const auto &event = trace[i];
+            out += i == 0 ? "\n" : ",\n";
+            out += "{\"name\":\"";
+            AppendEscaped(out, event.name);
+            snprintf(buffer, sizeof(buffer), R"(","cat":"%s","ph":"X","pid":0,"tid":%u,"ts":%.3f,"dur":%.3f,)",
+                PHASE_NAMES[static_cast<uint32_t>(event.phase)], event.thread,
+                static_cast<double>(event.begin) / 1000.0, static_cast<double>(event.end - event.begin) / 1000.0);
+            out += buffer;
+            out += "\"args\":{\"dependencies\":[";
+            for (size_t j = 0; j < event.dependencies.size(); ++j) {
+                out += j == 0 ? "\"" : ",\"";
+                AppendEscaped(out, event.dependencies[j]);
+                out += "\"";
+            }
+            out += "]}}";
+        }
+        out += "\n]}";
+        return out;
+    }
+
+} // namespace sky
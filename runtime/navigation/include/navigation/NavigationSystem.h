@@ -24,6 +24,7 @@ namespace sky::ai {
     private:
         void OnAttachToWorld(World &world) override;
         void OnDetachFromWorld(World &world) override;
+        void DeclareTick(TickDesc &desc) const override;
 
         CounterPtr<NaviMesh> naviMesh;
     };
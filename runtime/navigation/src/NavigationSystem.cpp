@@ -27,6 +27,12 @@ namespace sky::ai {
         }
     }
 
+    void NavigationSystem::DeclareTick(TickDesc &desc) const
+    {
+        desc.phase = TickPhase::POST_PHYSICS;
+        desc.access.Nothing();
+    }
+
     void NavigationSystem::OnNavMeshChanged()
     {
 
@@ -28,6 +28,8 @@ namespace sky::phy {
         virtual void SetDebugDrawEnable(bool en) {}
         virtual void SetGravity(const Vector3 &gravity) {}
 
+        void DeclareTick(TickDesc &desc) const override;
+
     protected:
         virtual void AddRigidBodyImpl(RigidBody *rb) = 0;
         virtual void RemoveRigidBodyImpl(RigidBody *rb) = 0;
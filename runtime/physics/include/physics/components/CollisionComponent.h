@@ -5,6 +5,7 @@
 #pragma once
 
 #include <framework/world/Component.h>
+#include <framework/interface/ITransformEvent.h>
 #include <framework/serialization/ArrayVisitor.h>
 #include <physics/RigidBody.h>
 #include <physics/PhysicsBase.h>
@@ -21,7 +22,7 @@ namespace sky::phy {
         MeshPhysicsConfig config;
     };
 
-    class CollisionComponent : public ComponentAdaptor<CollisionData> {
+    class CollisionComponent : public ComponentAdaptor<CollisionData>, public ITransformEvent {
     public:
         CollisionComponent() = default;
         ~CollisionComponent() override = default;
@@ -42,12 +43,15 @@ namespace sky::phy {
         void OnAttachToWorld() override;
         void OnDetachFromWorld() override;
         void Tick(float time) override;
+        void OnTransformChanged(const Transform& global, const Transform& local) override;
 
         void RebuildShape();
         PhysicsWorld* GetWorld() const;
 
         PhysicsShape* shape = nullptr;
         CollisionObject* collisionObject = nullptr;
+
+        EventBinder<ITransformEvent> binder;
     };
 
 } // namespace sky::phy
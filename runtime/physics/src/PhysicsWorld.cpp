@@ -3,9 +3,18 @@
 //
 
 #include <physics/PhysicsWorld.h>
+#include <physics/components/RigidBodyComponent.h>
+#include <framework/world/TransformComponent.h>
 
 namespace sky::phy {
 
+    void PhysicsWorld::DeclareTick(TickDesc &desc) const
+    {
+        // the step moves rigid bodies back into their transforms.
+        desc.phase = TickPhase::PHYSICS;
+        desc.access.Write<TransformComponent>().Write<RigidBodyComponent>();
+    }
+
     void PhysicsWorld::AddCollisionObject(CollisionObject *obj)
     {
         AddCollisionObjectImpl(obj);
@@ -63,11 +63,13 @@ namespace sky::phy {
             collisionObject->SetShape(shape);
             collisionObject->SetWorldTransform(actor->GetComponent<TransformComponent>()->GetWorldTransform());
             world->AddCollisionObject(collisionObject);
+            binder.Bind(this, actor);
         }
     }
 
     void CollisionComponent::OnDetachFromWorld()
     {
+        binder.Reset();
         auto *world = GetWorld();
         if (world != nullptr && collisionObject != nullptr) {
             world->RemoveCollisionObject(collisionObject);
@@ -79,6 +81,13 @@ namespace sky::phy {
 
     }
 
+    void CollisionComponent::OnTransformChanged(const Transform& global, const Transform& local)
+    {
+        if (collisionObject != nullptr) {
+            collisionObject->SetWorldTransform(global);
+        }
+    }
+
     void CollisionComponent::RebuildShape()
     {
         // TODO
@@ -97,6 +106,6 @@ namespace sky::phy {
 
     PhysicsWorld* CollisionComponent::GetWorld() const
     {
-        return static_cast<PhysicsWorld*>(actor->GetWorld()->GetSubSystem(Name(PhysicsWorld::NAME.data())));
+        return static_cast<PhysicsWorld*>(actor->GetWorld()->GetSubSystem(Name(NameLiteral(PhysicsWorld::NAME))));
     }
 } // namespace sky::phy
\ No newline at end of file
@@ -21,7 +21,7 @@ namespace sky::editor {
 
     void EditorGuiInstance::Init(World &world, NativeWindow* window)
     {
-        renderScene = static_cast<RenderSceneProxy*>(world.GetSubSystem(Name("RenderScene")))->GetRenderScene();
+        renderScene = static_cast<RenderSceneProxy*>(world.GetSubSystem("RenderScene"_name))->GetRenderScene();
         auto *imguiFeature = renderScene->GetFeature<ImGuiFeatureProcessor>();
         if (imguiFeature != nullptr) {
             guiInstance = imguiFeature->CreateImGuiInstance();
@@ -106,7 +106,7 @@ namespace sky::ai {
     void RecastNaviMesh::OnAttachToWorld(World &world)
     {
         if (debugDraw) {
-            auto *renderScene = static_cast<RenderSceneProxy*>(world.GetSubSystem(Name("RenderScene")))->GetRenderScene();
+            auto *renderScene = static_cast<RenderSceneProxy*>(world.GetSubSystem("RenderScene"_name))->GetRenderScene();
             renderScene->AddPrimitive(primitive.get());
         }
     }
@@ -114,7 +114,7 @@ namespace sky::ai {
     void RecastNaviMesh::OnDetachFromWorld(World &world)
     {
         if (debugDraw != nullptr) {
-            auto *renderScene = static_cast<RenderSceneProxy *>(world.GetSubSystem(Name("RenderScene")))->GetRenderScene();
+            auto *renderScene = static_cast<RenderSceneProxy *>(world.GetSubSystem("RenderScene"_name))->GetRenderScene();
             renderScene->RemovePrimitive(primitive.get());
         }
     }
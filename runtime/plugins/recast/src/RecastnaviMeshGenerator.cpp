@@ -26,7 +26,7 @@ namespace sky::ai {
     {
         world = inWorld;
 
-        auto *navSys = static_cast<NavigationSystem*>(world->GetSubSystem(Name(NavigationSystem::NAME.data())));
+        auto *navSys = static_cast<NavigationSystem*>(world->GetSubSystem(Name(NameLiteral(NavigationSystem::NAME))));
         navMesh = static_cast<RecastNaviMesh*>(navSys->GetNaviMesh().Get());
         navMesh->SetBounds({{-50.f, -50.f, -50.f}, {50.f, 50.f, 50.f}});
         navMesh->PrepareForBuild();
@@ -142,7 +142,7 @@ namespace sky::ai {
             generator->Setup(navMesh);
             generator->StartAsync();
 
-            dependencies.emplace_back(generator->GetTask());
+            dependencies.emplace_back(generator);
             tileGenerators.emplace_back(generator);
         }
     }
@@ -120,10 +120,12 @@ namespace sky::editor {
         sourcePath.bundle = SourceAssetBundle::WORKSPACE;
         sourcePath.path   = ss.str();
 
-        auto file = AssetDataBase::Get()->CreateOrOpenFile(sourcePath);
-        auto archive = file->WriteAsArchive();
-        BinaryOutputArchive bin(*archive);
-        imageData.Save(bin);
+        {
+            auto file = AssetDataBase::Get()->CreateOrOpenFile(sourcePath);
+            auto archive = file->WriteAsArchive();
+            BinaryOutputArchive bin(*archive);
+            imageData.Save(bin);
+        }
 
         heightMapSource = AssetDataBase::Get()->RegisterAsset(sourcePath);
         return true;
@@ -225,7 +225,7 @@ namespace sky::editor {
         renderScene = nullptr;
         terrainComponent = nullptr;
         if (world != nullptr) {
-            renderScene = static_cast<RenderSceneProxy *>(world->GetWorld()->GetSubSystem(Name("RenderScene")))->GetRenderScene();
+            renderScene = static_cast<RenderSceneProxy *>(world->GetWorld()->GetSubSystem("RenderScene"_name))->GetRenderScene();
             for (auto *prim : helper->GetPrimitives()) {
                 renderScene->AddPrimitive(prim);
             }
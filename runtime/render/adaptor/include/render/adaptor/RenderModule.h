@@ -6,6 +6,7 @@
 
 #include <framework/interface/IModule.h>
 #include <rhi/Instance.h>
+#include <string>
 
 namespace sky {
 
@@ -23,6 +24,7 @@ namespace sky {
         void InitFeatures();
 
         rhi::API api = rhi::API::DEFAULT;
+        std::string psoFallback; // technique path, batches wait for their pipeline when it is empty.
     };
 
 } // namespace sky
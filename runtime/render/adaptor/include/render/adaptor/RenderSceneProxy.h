@@ -18,6 +18,8 @@ namespace sky {
 
         RenderScene *GetRenderScene() const { return renderScene; }
 
+        void DeclareTick(TickDesc &desc) const override;
+
     private:
         RenderScene *renderScene = nullptr;
     };
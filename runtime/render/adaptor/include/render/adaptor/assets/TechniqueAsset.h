@@ -60,4 +60,8 @@ namespace sky {
 
     CounterPtr<Technique> CreateTechniqueFromAsset(const TechniqueAssetPtr &asset);
     CounterPtr<GraphicsTechnique> CreateGfxTechFromAsset(const TechniqueAssetPtr &asset);
+    CounterPtr<ComputeTechnique> CreateCompTechFromAsset(const TechniqueAssetPtr &asset);
+
+    // shared by every user of the asset, registered to the technique library by uuid.
+    CounterPtr<GraphicsTechnique> FetchGfxTechFromAsset(const TechniqueAssetPtr &asset);
 }
@@ -7,13 +7,14 @@
 
 #include <framework/world/Component.h>
 #include <framework/asset/AssetEvent.h>
+#include <framework/interface/ITransformEvent.h>
 #include <render/adaptor/assets/MeshAsset.h>
 #include <render/resource/Mesh.h>
 #include <render/skeleton/SkeletonMeshRenderer.h>
 
 namespace sky {
 
-    class SkeletonMeshComponent : public ComponentBase, public IAssetEvent {
+    class SkeletonMeshComponent : public ComponentBase, public IAssetEvent, public ITransformEvent {
     public:
         SkeletonMeshComponent() = default;
         ~SkeletonMeshComponent() override;
@@ -36,6 +37,8 @@ namespace sky {
         void BuildRenderer();
 
         void OnAssetLoaded() override;
+        void OnTransformChanged(const Transform& global, const Transform& local) override;
+        void UpdateTransform();
 
         MeshAssetPtr meshAsset;
         RDMeshPtr meshInstance;
@@ -43,6 +46,7 @@ namespace sky {
 
         std::atomic_bool dirty = false;
         EventBinder<IAssetEvent, Uuid> binder;
+        EventBinder<ITransformEvent> transformBinder;
     };
 
 } // namespace receiveShadow
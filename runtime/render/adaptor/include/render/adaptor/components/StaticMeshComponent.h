@@ -6,13 +6,14 @@
 
 #include <framework/world/Component.h>
 #include <framework/asset/AssetEvent.h>
+#include <framework/interface/ITransformEvent.h>
 #include <render/adaptor/assets/MeshAsset.h>
 #include <render/resource/Mesh.h>
 #include <render/mesh/MeshRenderer.h>
 
 namespace sky {
 
-    class StaticMeshComponent : public ComponentBase, public IAssetEvent {
+    class StaticMeshComponent : public ComponentBase, public IAssetEvent, public ITransformEvent {
     public:
         StaticMeshComponent() = default;
         ~StaticMeshComponent() override;
@@ -53,6 +54,8 @@ namespace sky {
         void BuildRenderer();
 
         void OnAssetLoaded() override;
+        void OnTransformChanged(const Transform& global, const Transform& local) override;
+        void UpdateTransform();
 
         bool isStatic = true;
         bool castShadow = false;
@@ -69,6 +72,7 @@ namespace sky {
         bool multiply = false;
 
         EventBinder<IAssetEvent, Uuid> binder;
+        EventBinder<ITransformEvent> transformBinder;
     };
 
 } // namespace receiveShadow
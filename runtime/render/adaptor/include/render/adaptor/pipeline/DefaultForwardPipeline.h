@@ -12,6 +12,8 @@
 #include <render/adaptor/pipeline/BRDFLutPass.h>
 #include <render/adaptor/pipeline/ShadowMapPass.h>
 #include <render/adaptor/pipeline/EmptyPass.h>
+#include <render/adaptor/pipeline/GPUCullingPass.h>
+#include <render/adaptor/pipeline/HizOcclusionPass.h>
 #include <memory>
 
 namespace sky {
@@ -24,6 +26,9 @@ namespace sky {
 
         void SetOutput(RenderWindow *wnd);
 
+        // draw the bounds of primitives rejected by hi-z occlusion culling.
+        void SetOcclusionDebug(bool enable);
+
     private:
         void InitPass();
         void SetupGlobal(rdg::RenderGraph &rdg, uint32_t w, uint32_t h);
@@ -43,6 +48,8 @@ namespace sky {
 
         std::unique_ptr<DepthPass>          depth;
         std::unique_ptr<HizGenerator>       hiz;
+        std::unique_ptr<GPUCullingPass>     gpuCulling;
+        std::unique_ptr<HizOcclusionPass>   hizOcclusion;
         std::unique_ptr<ShadowMapPass>      shadowMap;
         std::unique_ptr<ForwardMSAAPass>    forward;
         std::unique_ptr<PostProcessingPass> postProcess;
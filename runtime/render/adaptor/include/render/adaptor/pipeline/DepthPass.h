@@ -55,8 +55,19 @@ namespace sky {
         HizGenerator(const RDGfxTechPtr &resolveTech, const RDGfxTechPtr &downTech);
         ~HizGenerator() = default;
 
-        void BuildHizPass(rdg::RenderGraph &rdg, const rhi::ImagePtr& hiz, uint32_t width, uint32_t height);
+        // viewProject is the matrix of the depth the pyramid is built from this frame.
+        void BuildHizPass(rdg::RenderGraph &rdg, const rhi::ImagePtr& hiz, uint32_t width, uint32_t height, const Matrix4 &viewProject);
         void AddPass(RenderScenePipeline& pipeline);
+
+        // HizBuffer holds the pyramid of the last frame until the mips are rebuilt.
+        bool IsHistoryValid() const { return historyValid; }
+        const Matrix4 &GetHistoryViewProject() const { return historyViewProject; }
+
+        uint32_t GetWidth() const { return hizWidth; }
+        uint32_t GetHeight() const { return hizHeight; }
+        uint32_t GetMipCount() const { return static_cast<uint32_t>(mipNames.size()); }
+        const Name &GetMipName(uint32_t mip) const { return mipNames[mip]; }
+        const Matrix4 &GetViewProject() const { return currentViewProject; }
     private:
         RDGfxTechPtr technique;
         rhi::ImagePtr hizDepth;
@@ -64,7 +75,14 @@ namespace sky {
 
         std::vector<std::unique_ptr<HizGenerateMip>> mips;
         std::vector<rhi::ImageViewPtr> mipViews;
+        std::vector<Name> mipNames;
         rhi::ImageViewPtr fullMipView;
+
+        uint32_t hizWidth  = 0;
+        uint32_t hizHeight = 0;
+        bool historyValid = false;
+        Matrix4 historyViewProject = Matrix4::Identity();
+        Matrix4 currentViewProject = Matrix4::Identity();
     };
 
 } // namespace sky
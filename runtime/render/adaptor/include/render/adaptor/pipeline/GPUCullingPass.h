@@ -0,0 +1,31 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <render/renderpass/ComputePass.h>
+
+namespace sky {
+    class HizGenerator;
+
+    // culls the gpu scene against the main camera and writes the indirect draw commands.
+    // the HIZ test reads the pyramid of the last frame, it is skipped until the generator has a valid history.
+    class GPUCullingPass : public ComputePass {
+    public:
+        explicit GPUCullingPass(const RDCompTechPtr &tech);
+        ~GPUCullingPass() override = default;
+
+        void Setup(rdg::RenderGraph &rdg, RenderScene &scene) override;
+
+        void SetCullFlags(uint32_t flags) { cullFlags = flags; }
+        void SetHizGenerator(const HizGenerator *generator) { hiz = generator; }
+
+    private:
+        void SetupCompute(rdg::ComputePassBuilder &builder, RenderScene &scene) override;
+
+        uint32_t cullFlags;
+        const HizGenerator *hiz = nullptr;
+    };
+
+} // namespace sky
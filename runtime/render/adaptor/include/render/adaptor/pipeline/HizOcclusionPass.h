@@ -0,0 +1,69 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <render/renderpass/ComputePass.h>
+#include <render/resource/Buffer.h>
+#include <render/debug/DebugRenderer.h>
+#include <render/RenderPrimitive.h>
+#include <render/GPUCulling.h>
+#include <memory>
+
+namespace sky {
+    class HizGenerator;
+    class SceneView;
+
+    // copies a small mip of the hiz pyramid and the gpu culling counters into host visible buffers.
+    // a slot is read once the frame that wrote it has retired, the cpu pyramid then feeds the occlusion stage of SceneCulling.
+    // the pyramid lags the inflight frame count behind, boxes are reprojected with the matrix it was rendered with.
+    class HizOcclusionPass : public ComputePass {
+    public:
+        explicit HizOcclusionPass(const RDCompTechPtr &tech);
+        ~HizOcclusionPass() override;
+
+        void Setup(rdg::RenderGraph &rdg, RenderScene &scene) override;
+
+        void SetHizGenerator(const HizGenerator *generator) { hiz = generator; }
+
+        // occlusion culling of cpu built queues, the readback keeps running for the stats.
+        void SetCpuOcclusion(bool enable) { cpuOcclusion = enable; }
+
+        // draw the bounds of primitives rejected by the occlusion test.
+        void SetDebugDraw(bool enable) { debugDraw = enable; }
+
+        const HizPyramid &GetPyramid() const { return pyramid; }
+
+    private:
+        struct ReadbackSlot {
+            RDBufferPtr buffer;
+            Matrix4 viewProject = Matrix4::Identity();
+            uint32_t width  = 0;
+            uint32_t height = 0;
+            bool pending = false;
+        };
+
+        void Resolve(ReadbackSlot &slot, RenderScene &scene);
+        void UpdateDebugDraw(RenderScene &scene, const SceneView &view);
+
+        const HizGenerator *hiz = nullptr;
+
+        std::vector<ReadbackSlot> slots;
+        uint32_t current = 0;
+
+        RDDynamicUniformBufferPtr ubo;
+        RDBufferPtr emptyStats;
+
+        HizPyramid pyramid;
+        Matrix4 pyramidViewProject = Matrix4::Identity();
+        bool pyramidValid = false;
+        bool cpuOcclusion = true;
+
+        bool debugDraw = false;
+        RenderScene *debugScene = nullptr;
+        std::unique_ptr<RenderPrimitive> debugPrimitive;
+        std::unique_ptr<DebugRenderer> debugRenderer;
+    };
+
+} // namespace sky
@@ -50,8 +50,30 @@ namespace sky {
             const auto &data = pipeline->Context()->rdgData;
 //            ss << "Triangles: " << data.triangleData << "\n";
             ss << "DrawCalls: " << data.drawCall << "\n";
+            ss << "PipelineBinds: " << data.pipelineBind << " (skipped " << data.pipelineBindSkipped << ")\n";
+            ss << "ResourceBinds Skipped: " << data.resourceBindSkipped << "\n";
+            ss << "Merged Draws: " << data.mergedDraw << "\n";
+            ss << "Indirect Draws: " << data.indirectDraw << "\n";
+            ss << "Parallel Chunks: " << data.parallelChunk << "\n";
         }
 
+        const auto &frameStats = Renderer::Get()->GetFrameAllocatorStats();
+        ss << "Frame Memory: " << frameStats.allocatedBytes / 1024 << "KB in " << frameStats.allocations << " allocations, "
+           << frameStats.heapAllocations << " arena blocks, " << Renderer::Get()->GetHeapAllocationsPerFrame() << " heap allocations\n";
+
+        auto psoStats = RHI::Get()->GetDevice()->GetPipelineLibraryStats();
+        ss << "PSO: " << psoStats.hit << " hits, " << psoStats.miss << " created (" << psoStats.libraryHit << " from library), "
+           << static_cast<float>(psoStats.createTime) / 1000.f << "ms, "
+           << Renderer::Get()->GetPipelineCompiler()->GetPendingCount() << " pending\n";
+
+        const auto &cullStats = scene->GetCulling().GetStats();
+        ss << "Culling: " << cullStats.tested << " tested, " << cullStats.frustumRejected << " frustum rejects, "
+           << cullStats.occlusionRejected << " occlusion rejects\n";
+
+        const auto &gpuStats = scene->GetGPUScene().GetCullStats();
+        ss << "GPU Culling: " << gpuStats.visible << " visible, " << gpuStats.frustumRejected << " frustum rejects, "
+           << gpuStats.occlusionRejected << " occlusion rejects\n";
+
         text->Reset(*scene);
 
         float x = ((float)displayWidth + 999.f) / 1000.f * 10.f;
@@ -84,13 +84,17 @@ namespace sky {
         options.add_options()
             ("e,engine", "Engine Directory", cxxopts::value<std::string>())
             ("p,project", "Project Directory", cxxopts::value<std::string>())
-            ("r,rhi", "RHI Type", cxxopts::value<std::string>());
+            ("r,rhi", "RHI Type", cxxopts::value<std::string>())
+            ("pso-fallback", "Technique drawn while a pipeline compiles", cxxopts::value<std::string>());
 
         if (!args.args.empty()) {
             auto result = options.parse(static_cast<int32_t>(args.args.size()), args.args.data());
             if (result.count("rhi") != 0u) {
                 api = rhi::GetApiByString(result["rhi"].as<std::string>());
             }
+            if (result.count("pso-fallback") != 0u) {
+                psoFallback = result["pso-fallback"].as<std::string>();
+            }
         }
     }
 
@@ -121,6 +125,7 @@ namespace sky {
         // init renderer
         Renderer::Get()->Init();
         Renderer::Get()->SetCacheFolder(Platform::Get()->GetInternalPath());
+        Renderer::Get()->LoadPipelineLibrary();
         return true;
     }
 
@@ -167,11 +172,37 @@ namespace sky {
         }
         LoadAndRegister(am, "techniques/meshlet_debug.tech");
         LoadAndRegister(am, "techniques/debug.tech");
+
+        if (!psoFallback.empty()) {
+            auto asset = am->LoadAssetFromPath<Technique>(psoFallback);
+            asset->BlockUntilLoaded();
+            Renderer::Get()->GetPipelineCompiler()->SetFallbackTechnique(FetchGfxTechFromAsset(asset));
+        }
+
+        Renderer::Get()->PrewarmPipelines([am](const Name &name) -> RDGfxTechPtr {
+            auto tech = RenderTechniqueLibrary::Get()->FetchGfxTechnique(name);
+            if (tech) {
+                return tech;
+            }
+
+            // material techniques are registered by asset uuid.
+            auto uuid = Uuid::CreateFromString(name.GetStr());
+            if (!uuid) {
+                return {};
+            }
+            auto asset = am->LoadAsset<Technique>(uuid);
+            if (!asset) {
+                return {};
+            }
+            asset->BlockUntilLoaded();
+            return FetchGfxTechFromAsset(asset);
+        });
     }
 
     void RenderModule::Shutdown()
     {
         Renderer::Get()->StopRender();
+        Renderer::Get()->SavePipelineLibrary();
 
         RenderTechniqueLibrary::Destroy();
         MeshFeature::Destroy();
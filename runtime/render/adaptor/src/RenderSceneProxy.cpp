@@ -4,6 +4,7 @@
 
 #include <render/adaptor/RenderSceneProxy.h>
 #include <render/Renderer.h>
+#include <framework/world/TransformComponent.h>
 
 namespace sky {
 
@@ -17,4 +18,10 @@ namespace sky {
         Renderer::Get()->RemoveScene(renderScene);
     }
 
+    void RenderSceneProxy::DeclareTick(TickDesc &desc) const
+    {
+        desc.phase = TickPhase::PRE_RENDER;
+        desc.access.Read<TransformComponent>();
+    }
+
 } // namespace sky
\ No newline at end of file
@@ -85,7 +85,7 @@ namespace sky {
             debugRender->SetTechnique(RenderTechniqueLibrary::Get()->FetchGfxTechnique(Name("techniques/debug.tech")));
         }
 
-        auto *renderScene = static_cast<RenderSceneProxy*>(actor->GetWorld()->GetSubSystem(Name("RenderScene")))->GetRenderScene();
+        auto *renderScene = static_cast<RenderSceneProxy*>(actor->GetWorld()->GetSubSystem("RenderScene"_name))->GetRenderScene();
         renderScene->AddPrimitive(debugRender->GetPrimitive());
 
         dirty = true;
@@ -95,7 +95,7 @@ namespace sky {
 
     void AnimationPreviewComponent::OnDetachFromWorld()
     {
-        auto *renderScene = static_cast<RenderSceneProxy*>(actor->GetWorld()->GetSubSystem(Name("RenderScene")))->GetRenderScene();
+        auto *renderScene = static_cast<RenderSceneProxy*>(actor->GetWorld()->GetSubSystem("RenderScene"_name))->GetRenderScene();
         renderScene->RemovePrimitive(debugRender->GetPrimitive());
 
         transformEvent.Reset();
@@ -183,7 +183,7 @@ namespace sky {
             debugRender->SetTechnique(RenderTechniqueLibrary::Get()->FetchGfxTechnique(Name("techniques/debug.tech")));
         }
 
-        auto *renderScene = static_cast<RenderSceneProxy*>(actor->GetWorld()->GetSubSystem(Name("RenderScene")))->GetRenderScene();
+        auto *renderScene = static_cast<RenderSceneProxy*>(actor->GetWorld()->GetSubSystem("RenderScene"_name))->GetRenderScene();
         renderScene->AddPrimitive(debugRender->GetPrimitive());
 
         transformEvent.Bind(this, actor);
@@ -192,7 +192,7 @@ namespace sky {
 
     void CharacterLocomotion::OnDetachFromWorld()
     {
-        auto *renderScene = static_cast<RenderSceneProxy*>(actor->GetWorld()->GetSubSystem(Name("RenderScene")))->GetRenderScene();
+        auto *renderScene = static_cast<RenderSceneProxy*>(actor->GetWorld()->GetSubSystem("RenderScene"_name))->GetRenderScene();
         renderScene->RemovePrimitive(debugRender->GetPrimitive());
 
         transformEvent.Reset();
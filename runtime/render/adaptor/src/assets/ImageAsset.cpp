@@ -30,7 +30,7 @@ namespace sky {
         }
 
         archive.LoadValue(dataSize);
-        dataOffset = static_cast<uint32_t>(archive.GetStream().Tell());
+        dataOffset = static_cast<uint32_t>(archive.Tell());
     }
 
     void ImageAssetData::Save(BinaryOutputArchive &archive) const
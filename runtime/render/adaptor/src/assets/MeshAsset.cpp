@@ -23,18 +23,10 @@ namespace sky {
         uint32_t size = 0;
 
         // materials
-        archive.LoadValue(size);
-        materials.resize(size);
-        for (uint32_t i = 0; i < size; ++i) {
-            archive.LoadValue(reinterpret_cast<char *>(&materials[i]), sizeof(Uuid));
-        }
+        archive.LoadValue(materials);
 
         // subMesh
-        archive.LoadValue(size);
-        subMeshes.resize(size);
-        for (uint32_t i = 0; i < size; ++i) {
-            archive.LoadValue(reinterpret_cast<char *>(&subMeshes[i]), sizeof(MeshSubSection));
-        }
+        archive.LoadValue(subMeshes);
 
         // buffers
         archive.LoadValue(size);
@@ -67,7 +59,7 @@ namespace sky {
 
         // data size
         archive.LoadValue(dataSize);
-        dataOffset = static_cast<uint32_t>(archive.GetStream().Tell());
+        dataOffset = static_cast<uint32_t>(archive.Tell());
     }
 
     void MeshAssetData::Save(BinaryOutputArchive &archive) const
@@ -75,16 +67,10 @@ namespace sky {
         archive.SaveValue(version);
         archive.SaveValue(skeleton);
 
-        archive.SaveValue(static_cast<uint32_t>(materials.size()));
-        for (const auto &uuid : materials) {
-            archive.SaveValue(reinterpret_cast<const char*>(&uuid), sizeof(Uuid));
-        }
+        archive.SaveValue(materials);
 
         // subMesh
-        archive.SaveValue(static_cast<uint32_t>(subMeshes.size()));
-        for (const auto &subMesh : subMeshes) {
-            archive.SaveValue(reinterpret_cast<const char*>(&subMesh), sizeof(MeshSubSection));
-        }
+        archive.SaveValue(subMeshes);
 
         // primitives
         archive.SaveValue(static_cast<uint32_t>(buffers.size()));
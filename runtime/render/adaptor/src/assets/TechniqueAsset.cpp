@@ -2,6 +2,7 @@
 // Created by Zach Lee on 2023/2/23.
 //
 #include <render/adaptor/assets/TechniqueAsset.h>
+#include <render/RenderTechniqueLibrary.h>
 #include <shader/ShaderCompiler.h>
 
 namespace sky {
@@ -106,6 +107,12 @@ namespace sky {
             }
             return tech;
         }
+
+        if (data.type == TechAssetType::COMPUTE) {
+            auto *tech = new ComputeTechnique();
+            tech->SetShader({Name(data.shader.shader.c_str()), data.shader.taskOrCSMain});
+            return tech;
+        }
         return nullptr;
     }
 
@@ -114,4 +121,26 @@ namespace sky {
         auto tech = CreateTechniqueFromAsset(asset);
         return static_cast<GraphicsTechnique*>(tech.Get());
     }
+
+    CounterPtr<ComputeTechnique> CreateCompTechFromAsset(const TechniqueAssetPtr &asset)
+    {
+        auto tech = CreateTechniqueFromAsset(asset);
+        return static_cast<ComputeTechnique*>(tech.Get());
+    }
+
+    CounterPtr<GraphicsTechnique> FetchGfxTechFromAsset(const TechniqueAssetPtr &asset)
+    {
+        auto *library = RenderTechniqueLibrary::Get();
+        Name name(asset->GetUuid().ToString().c_str());
+
+        auto tech = library->FetchGfxTechnique(name);
+        if (!tech) {
+            tech = CreateGfxTechFromAsset(asset);
+            if (tech) {
+                library->RegisterGfxTech(name, tech);
+                tech = library->FetchGfxTechnique(name);
+            }
+        }
+        return tech;
+    }
 }
@@ -28,15 +28,27 @@ namespace sky {
     {
         if (dirty.load()) {
             BuildRenderer();
+            UpdateTransform();
             dirty.store(false);
         }
+    }
 
-        if (renderer != nullptr) {
-            auto *ts = actor->GetComponent<TransformComponent>();
+    void SkeletonMeshComponent::UpdateTransform()
+    {
+        auto *ts = actor->GetComponent<TransformComponent>();
+        if (renderer != nullptr && ts != nullptr) {
             renderer->UpdateTransform(ts->GetWorldMatrix());
         }
     }
 
+    void SkeletonMeshComponent::OnTransformChanged(const Transform& global, const Transform& local)
+    {
+        // pushed by the world once per frame, only for moved actors.
+        if (renderer != nullptr) {
+            renderer->UpdateTransform(global.ToMatrix());
+        }
+    }
+
     void SkeletonMeshComponent::BuildRenderer()
     {
         if (meshAsset) {
@@ -77,11 +89,12 @@ namespace sky {
 
     void SkeletonMeshComponent::OnAttachToWorld()
     {
-
+        transformBinder.Bind(this, actor);
     }
 
     void SkeletonMeshComponent::OnDetachFromWorld()
     {
+        transformBinder.Reset();
         ShutDown();
     }
 
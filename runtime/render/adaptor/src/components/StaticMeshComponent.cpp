@@ -153,6 +153,7 @@ namespace sky {
         }
 
         renderer = mf->CreateStaticMesh();
+        renderer->SetGPUDriven(isStatic);
         SetMultiply(multiply);
 //        renderer->SetMesh(meshInstance, enableMeshShading);
     }
@@ -174,22 +175,35 @@ namespace sky {
     {
         if (dirty.load()) {
             BuildRenderer();
+            UpdateTransform();
             dirty.store(false);
         }
+    }
 
-        if (renderer != nullptr) {
-            auto *ts = actor->GetComponent<TransformComponent>();
+    void StaticMeshComponent::UpdateTransform()
+    {
+        auto *ts = actor->GetComponent<TransformComponent>();
+        if (renderer != nullptr && ts != nullptr) {
             renderer->UpdateTransform(ts->GetWorldMatrix());
         }
     }
 
-    void StaticMeshComponent::OnAttachToWorld()
+    void StaticMeshComponent::OnTransformChanged(const Transform& global, const Transform& local)
     {
+        // pushed by the world once per frame, only for moved actors.
+        if (renderer != nullptr) {
+            renderer->UpdateTransform(global.ToMatrix());
+        }
+    }
 
+    void StaticMeshComponent::OnAttachToWorld()
+    {
+        transformBinder.Bind(this, actor);
     }
 
     void StaticMeshComponent::OnDetachFromWorld()
     {
+        transformBinder.Reset();
         ShutDown();
     }
 } // namespace sky
\ No newline at end of file
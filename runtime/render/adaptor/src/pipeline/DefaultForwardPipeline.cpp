@@ -22,12 +22,21 @@ namespace sky {
         return CreateGfxTechFromAsset(std::static_pointer_cast<Asset<Technique>>(asset));
     }
 
+    RDCompTechPtr LoadCompTech(const std::string& name)
+    {
+        auto asset = AssetManager::Get()->LoadAssetFromPath(name);
+        asset->BlockUntilLoaded();
+        return CreateCompTechFromAsset(std::static_pointer_cast<Asset<Technique>>(asset));
+    }
+
     void DefaultForwardPipeline::InitPass()
     {
         auto postTech = LoadGfxTech("techniques/post_processing.tech");
         auto brdfTech = LoadGfxTech("techniques/brdf_lut.tech");
         auto depthResolveTech = LoadGfxTech("techniques/depth_resolve.tech");
         auto depthDownSampleTech = LoadGfxTech("techniques/depth_downsample.tech");
+        auto gpuCullingTech = LoadCompTech("techniques/gpu_culling.tech");
+        auto hizReadbackTech = LoadCompTech("techniques/hiz_readback.tech");
 
         rhi::DescriptorSetLayout::Descriptor desc = {};
         auto stageFlags = rhi::ShaderStageFlagBit::VS | rhi::ShaderStageFlagBit::FS | rhi::ShaderStageFlagBit::TAS | rhi::ShaderStageFlagBit::MS;
@@ -88,6 +97,10 @@ namespace sky {
         present     = std::make_unique<PresentPass>(output->GetSwapChain());
 
         hiz = std::make_unique<HizGenerator>(depthResolveTech, depthDownSampleTech);
+        gpuCulling = std::make_unique<GPUCullingPass>(gpuCullingTech);
+        gpuCulling->SetHizGenerator(hiz.get());
+        hizOcclusion = std::make_unique<HizOcclusionPass>(hizReadbackTech);
+        hizOcclusion->SetHizGenerator(hiz.get());
 
         empty = std::make_unique<EmptyPass>();
 
@@ -107,6 +120,11 @@ namespace sky {
         InitPass();
     }
 
+    void DefaultForwardPipeline::SetOcclusionDebug(bool enable)
+    {
+        hizOcclusion->SetDebugDraw(enable);
+    }
+
     void DefaultForwardPipeline::SetupScreenExternalImages(rdg::RenderGraph &rdg, uint32_t w, uint32_t h)
     {
         bool first = false;
@@ -170,6 +188,8 @@ namespace sky {
         AddPass(brdfLut.get());
         AddPass(shadowMap.get());
 
+        AddPass(gpuCulling.get());
+
         forward->Resize(renderWidth, renderHeight);
         AddPass(forward.get());
 
@@ -178,8 +198,11 @@ namespace sky {
         postProcess->Resize(renderWidth, renderHeight);
         AddPass(postProcess.get());
 
-//        hiz->BuildHizPass(rdg, hizDepth, renderWidth, renderHeight);
-//        hiz->AddPass(*this);
+        // the pyramid of this frame is read by culling of the following frames.
+        auto *sceneView = scene->GetSceneView(Name("MainCamera"));
+        hiz->BuildHizPass(rdg, hizDepth, renderWidth, renderHeight, sceneView->GetViewProject());
+        hiz->AddPass(*this);
+        AddPass(hizOcclusion.get());
 
         AddPass(present.get());
     }
@@ -58,6 +58,7 @@ namespace sky {
         subPass.AddQueue(Name("queue1"))
             .SetRasterID(Name("DepthOnly"))
             .SetView(sceneView)
+            .SetSort(rdg::RasterQueueSort::FRONT_TO_BACK)
             .SetLayout(layout);
     }
 
@@ -194,7 +195,7 @@ namespace sky {
         depthResolve = std::make_unique<HizGenerateMip>(technique, Name(FWD_DS.data()), Name("HizMipmap0"), rhi::AccessFlagBit::NONE);
     }
 
-    void HizGenerator::BuildHizPass(rdg::RenderGraph &rdg, const rhi::ImagePtr& hiz, uint32_t width, uint32_t height)
+    void HizGenerator::BuildHizPass(rdg::RenderGraph &rdg, const rhi::ImagePtr& hiz, uint32_t width, uint32_t height, const Matrix4 &viewProject)
     {
         uint32_t level = rhi::GetMipLevel(width, height);
         SKY_ASSERT(level >= 1);
@@ -214,7 +215,8 @@ namespace sky {
 
         auto &rsg = rdg.resourceGraph;
 
-        std::vector<Name> names(level);
+        auto &names = mipNames;
+        names.resize(level);
         for (uint32_t i = 0; i < level; ++i) {
             std::stringstream ss;
             ss << "HizMipmap" << i;
@@ -244,6 +246,12 @@ namespace sky {
             rsg.ImportImageView(Name("HizBuffer"), hiz, fullMipView, rhi::AccessFlagBit::FRAGMENT_SRV);
         }
 
+        // the content of HizBuffer was rendered with the matrix of the last build.
+        historyValid = !rebuildImageView;
+        historyViewProject = currentViewProject;
+        currentViewProject = viewProject;
+        hizWidth  = width;
+        hizHeight = height;
 
         uint32_t tmpWidth = width;
         uint32_t tmpHeight = height;
@@ -116,11 +116,13 @@ namespace sky {
         subPass.AddQueue(Name("queue1"))
                 .SetRasterID(Name("ForwardColor"))
                 .SetView(sceneView)
+                .SetSort(rdg::RasterQueueSort::FRONT_TO_BACK)
                 .SetLayout(layout);
 
         subPass.AddQueue(Name("queue2"))
                 .SetRasterID(Name("Transparent"))
                 .SetView(sceneView)
+                .SetSort(rdg::RasterQueueSort::BACK_TO_FRONT)
                 .SetLayout(layout);
 
         subPass.AddQueue(Name("queue3"))
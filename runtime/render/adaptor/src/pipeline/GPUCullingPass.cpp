@@ -0,0 +1,86 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <render/adaptor/pipeline/GPUCullingPass.h>
+#include <render/adaptor/pipeline/DepthPass.h>
+#include <render/rdg/RenderGraph.h>
+#include <render/RenderScene.h>
+#include <render/Renderer.h>
+#include <core/math/MathUtil.h>
+
+namespace sky {
+
+    static constexpr uint32_t CULL_GROUP_SIZE = 64;
+    static constexpr uint32_t HIZ_RESOURCE_INDEX = 4;
+
+    GPUCullingPass::GPUCullingPass(const RDCompTechPtr &tech)
+        : ComputePass(Name("GPUCulling"), tech)
+        , cullFlags(static_cast<uint32_t>(GPUCullFlagBit::FRUSTUM) | static_cast<uint32_t>(GPUCullFlagBit::HIZ))
+    {
+        auto stage = rhi::ShaderStageFlagBit::CS;
+        computeResources.emplace_back(ComputeResource{
+            Name(GPUScene::CULL_CONSTANTS.data()),
+            rdg::ComputeView{Name("CullConstants"), rdg::ComputeType::CBV, stage}
+        });
+        computeResources.emplace_back(ComputeResource{
+            Name(GPUScene::INSTANCE_BUFFER.data()),
+            rdg::ComputeView{Name("Instances"), rdg::ComputeType::SRV, stage}
+        });
+        computeResources.emplace_back(ComputeResource{
+            Name(GPUScene::COMMAND_BUFFER.data()),
+            rdg::ComputeView{Name("Commands"), rdg::ComputeType::UAV, stage, rdg::ResourceAccessBit::WRITE}
+        });
+        computeResources.emplace_back(ComputeResource{
+            Name(GPUScene::COUNT_BUFFER.data()),
+            rdg::ComputeView{Name("DrawCount"), rdg::ComputeType::UAV, stage, rdg::ResourceAccessBit::READ_WRITE}
+        });
+        computeResources.emplace_back(ComputeResource{
+            Name("GPUCullHiz"),
+            rdg::ComputeView{Name("HizBuffer"), rdg::ComputeType::SRV, stage}
+        });
+        samplers.emplace_back(SamplerResource{Name("PointSampler"), Name("HizBufferSampler")});
+    }
+
+    void GPUCullingPass::Setup(rdg::RenderGraph &rdg, RenderScene &scene)
+    {
+        auto *sceneView = scene.GetSceneView(Name("MainCamera"));
+        if (sceneView == nullptr || !IsReady()) {
+            return;
+        }
+
+        auto &gpuScene = scene.GetGPUScene();
+        auto flags = cullFlags;
+
+        bool useHiz = hiz != nullptr && hiz->IsHistoryValid() && (flags & static_cast<uint32_t>(GPUCullFlagBit::HIZ)) != 0;
+        if (useHiz) {
+            computeResources[HIZ_RESOURCE_INDEX].name = Name("HizBuffer");
+            gpuScene.SetOcclusion(hiz->GetHistoryViewProject(), hiz->GetWidth(), hiz->GetHeight(), hiz->GetMipCount());
+        } else {
+            // no pyramid is generated yet, hiz culling stays disabled and reads a placeholder.
+            flags &= ~static_cast<uint32_t>(GPUCullFlagBit::HIZ);
+            computeResources[HIZ_RESOURCE_INDEX].name = Name("GPUCullHiz");
+
+            auto res = Renderer::Get()->GetDefaultResource().texture2DBlack;
+            rdg.resourceGraph.ImportImageView(Name("GPUCullHiz"), res->GetImage(), res->GetImageView(), rhi::AccessFlagBit::FRAGMENT_SRV);
+        }
+
+        gpuScene.Setup(rdg, *sceneView, flags);
+
+        groupX = Ceil(gpuScene.GetInstanceCount(), CULL_GROUP_SIZE);
+        ComputePass::Setup(rdg, scene);
+
+        // the pyramid is rewritten later in the frame, hand it back to the fragment stage first.
+        if (useHiz) {
+            rdg.AddTransitionPass(Name("GPUCullHizTransition"), Name("HizBuffer"), rdg::DependencyInfo{
+                rdg::ComputeType::SRV, rdg::ResourceAccessBit::READ, rhi::ShaderStageFlagBit::FS
+            });
+        }
+    }
+
+    void GPUCullingPass::SetupCompute(rdg::ComputePassBuilder &builder, RenderScene &scene)
+    {
+        builder.AddIndirectOutput(Name(GPUScene::COMMAND_BUFFER.data()));
+    }
+
+} // namespace sky
@@ -0,0 +1,200 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <render/adaptor/pipeline/HizOcclusionPass.h>
+#include <render/adaptor/pipeline/DepthPass.h>
+#include <render/rdg/RenderGraph.h>
+#include <render/RenderTechniqueLibrary.h>
+#include <render/RenderScene.h>
+#include <render/Renderer.h>
+#include <core/math/MathUtil.h>
+#include <cstring>
+
+namespace sky {
+
+    static constexpr uint32_t HIZ_READBACK_GROUP_SIZE  = 8;
+    static constexpr uint32_t HIZ_READBACK_MAX_SIZE    = 128;
+    static constexpr uint32_t HIZ_READBACK_HEADER_SIZE = static_cast<uint32_t>(sizeof(GPUCullStats));
+
+    static constexpr uint32_t SOURCE_RESOURCE_INDEX = 1;
+    static constexpr uint32_t STATS_RESOURCE_INDEX  = 2;
+
+    struct HizReadbackInfo {
+        uint32_t width;
+        uint32_t height;
+        uint32_t hasStats;
+        uint32_t padding;
+    };
+
+    HizOcclusionPass::HizOcclusionPass(const RDCompTechPtr &tech)
+        : ComputePass(Name("HizReadback"), tech)
+    {
+        auto stage = rhi::ShaderStageFlagBit::CS;
+        computeResources.emplace_back(ComputeResource{
+            Name("HizReadbackInfo"),
+            rdg::ComputeView{Name("ReadbackInfo"), rdg::ComputeType::CBV, stage}
+        });
+        computeResources.emplace_back(ComputeResource{
+            Name("HizMipmap0"),
+            rdg::ComputeView{Name("HizSource"), rdg::ComputeType::SRV, stage}
+        });
+        computeResources.emplace_back(ComputeResource{
+            Name("HizReadbackEmptyStats"),
+            rdg::ComputeView{Name("CullStats"), rdg::ComputeType::SRV, stage}
+        });
+        computeResources.emplace_back(ComputeResource{
+            Name("HizReadbackBuffer"),
+            rdg::ComputeView{Name("Readback"), rdg::ComputeType::UAV, stage, rdg::ResourceAccessBit::WRITE}
+        });
+    }
+
+    HizOcclusionPass::~HizOcclusionPass()
+    {
+        if (debugScene != nullptr) {
+            debugScene->RemovePrimitive(debugPrimitive.get());
+        }
+    }
+
+    void HizOcclusionPass::Setup(rdg::RenderGraph &rdg, RenderScene &scene)
+    {
+        auto *sceneView = scene.GetSceneView(Name("MainCamera"));
+        if (sceneView == nullptr || hiz == nullptr || hiz->GetMipCount() == 0 || !IsReady()) {
+            return;
+        }
+
+        if (slots.empty()) {
+            slots.resize(Renderer::Get()->GetInflightFrameCount());
+
+            ubo = new DynamicUniformBuffer();
+            ubo->Init(sizeof(HizReadbackInfo));
+
+            emptyStats = new Buffer();
+            emptyStats->Init(sizeof(GPUCullStats), rhi::BufferUsageFlagBit::STORAGE, rhi::MemoryType::GPU_ONLY);
+        }
+
+        // the frame that wrote this slot has retired by the time the slot comes around again.
+        current = (current + 1) % static_cast<uint32_t>(slots.size());
+        auto &slot = slots[current];
+        if (slot.pending) {
+            Resolve(slot, scene);
+        }
+
+        if (pyramidValid && cpuOcclusion) {
+            scene.GetCulling().SetOcclusion(sceneView, &pyramid, pyramidViewProject);
+        }
+        UpdateDebugDraw(scene, *sceneView);
+
+        // largest mip fitting the readback size, the cpu test only needs a coarse pyramid.
+        uint32_t mip    = 0;
+        uint32_t width  = hiz->GetWidth();
+        uint32_t height = hiz->GetHeight();
+        while (mip + 1 < hiz->GetMipCount() && (width > HIZ_READBACK_MAX_SIZE || height > HIZ_READBACK_MAX_SIZE)) {
+            width  = std::max(1U, width / 2U);
+            height = std::max(1U, height / 2U);
+            ++mip;
+        }
+        width  = std::min(width, HIZ_READBACK_MAX_SIZE);
+        height = std::min(height, HIZ_READBACK_MAX_SIZE);
+
+        if (!slot.buffer) {
+            slot.buffer = new Buffer();
+            slot.buffer->Init(HIZ_READBACK_HEADER_SIZE + HIZ_READBACK_MAX_SIZE * HIZ_READBACK_MAX_SIZE * sizeof(float),
+                rhi::BufferUsageFlagBit::STORAGE, rhi::MemoryType::GPU_TO_CPU);
+        }
+        slot.viewProject = hiz->GetViewProject();
+        slot.width   = width;
+        slot.height  = height;
+        slot.pending = true;
+
+        // counters are only written when the gpu culling pass was recorded this frame.
+        bool hasStats = scene.GetGPUScene().GetCullView() != nullptr;
+        ubo->WriteT(0, HizReadbackInfo{width, height, hasStats ? 1U : 0U, 0});
+
+        auto &rg = rdg.resourceGraph;
+        rg.ImportUBO(Name("HizReadbackInfo"), ubo);
+        rg.ImportBuffer(Name("HizReadbackBuffer"), slot.buffer->GetRHIBuffer(), rhi::AccessFlagBit::NONE);
+        if (!hasStats) {
+            rg.ImportBuffer(Name("HizReadbackEmptyStats"), emptyStats->GetRHIBuffer(), rhi::AccessFlagBit::NONE);
+        }
+
+        computeResources[SOURCE_RESOURCE_INDEX].name = hiz->GetMipName(mip);
+        computeResources[STATS_RESOURCE_INDEX].name  = hasStats ? Name(GPUScene::COUNT_BUFFER.data()) : Name("HizReadbackEmptyStats");
+
+        groupX = Ceil(width, HIZ_READBACK_GROUP_SIZE);
+        groupY = Ceil(height, HIZ_READBACK_GROUP_SIZE);
+        ComputePass::Setup(rdg, scene);
+
+        // mips are imported as fragment resources by the next frame.
+        rdg.AddTransitionPass(Name("HizReadbackTransition"), computeResources[SOURCE_RESOURCE_INDEX].name, rdg::DependencyInfo{
+            rdg::ComputeType::SRV, rdg::ResourceAccessBit::READ, rhi::ShaderStageFlagBit::FS
+        });
+    }
+
+    void HizOcclusionPass::Resolve(ReadbackSlot &slot, RenderScene &scene)
+    {
+        const auto &buffer = slot.buffer->GetRHIBuffer();
+        const uint8_t *data = buffer->Map();
+
+        GPUCullStats stats = {};
+        std::memcpy(&stats, data, sizeof(GPUCullStats));
+        scene.GetGPUScene().SetCullStats(stats);
+
+        pyramid.Build(reinterpret_cast<const float *>(data + HIZ_READBACK_HEADER_SIZE), slot.width, slot.height);
+        buffer->UnMap();
+
+        pyramidViewProject = slot.viewProject;
+        pyramidValid = true;
+        slot.pending = false;
+    }
+
+    void HizOcclusionPass::UpdateDebugDraw(RenderScene &scene, const SceneView &view)
+    {
+        if (!debugDraw) {
+            if (debugScene != nullptr) {
+                debugScene->RemovePrimitive(debugPrimitive.get());
+                debugScene = nullptr;
+            }
+            return;
+        }
+
+        if (!debugRenderer) {
+            debugRenderer  = std::make_unique<DebugRenderer>();
+            debugPrimitive = std::make_unique<RenderPrimitive>();
+
+            RenderBatch batch = {RenderTechniqueLibrary::Get()->FetchGfxTechnique(Name("techniques/debug.tech"))};
+            batch.topo = rhi::PrimitiveTopology::LINE_LIST;
+            debugPrimitive->batches.emplace_back(batch);
+        }
+
+        if (debugScene == nullptr) {
+            scene.AddPrimitive(debugPrimitive.get());
+            debugScene = &scene;
+        }
+
+        const auto &world = view.GetWorld();
+        Vector3 viewPos(world[3].x, world[3].y, world[3].z);
+        AABB bound = {viewPos, viewPos};
+
+        debugRenderer->Reset();
+        debugRenderer->SetColor(Color32(255, 0, 0, 255));
+
+        // bits belong to the last build, primitives added since then are not drawn.
+        auto &culling = scene.GetCulling();
+        const auto &primitives = scene.GetPrimitives();
+        const auto *occluded = culling.GetOccluded(&view);
+        auto count = std::min(culling.GetPrimitiveCount(), static_cast<uint32_t>(primitives.size()));
+        for (uint32_t i = 0; occluded != nullptr && i < count; ++i) {
+            if (TestVisibility(occluded, i) && primitives[i] != debugPrimitive.get()) {
+                debugRenderer->DrawAABB(primitives[i]->worldBound);
+                Merge(bound, primitives[i]->worldBound, bound);
+            }
+        }
+
+        // the bound reaches the camera, the debug lines are never rejected by the occlusion test themselves.
+        debugPrimitive->worldBound = bound;
+        debugPrimitive->args.clear();
+        debugRenderer->Render(debugPrimitive.get());
+    }
+
+} // namespace sky
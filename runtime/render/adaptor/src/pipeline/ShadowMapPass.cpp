@@ -81,6 +81,7 @@ namespace sky {
         builder.AddQueue(Name("queue1"))
             .SetRasterID(Name("Shadow"))
             .SetView(sceneView)
+            .SetSort(rdg::RasterQueueSort::FRONT_TO_BACK)
             .SetLayout(layout);
     }
 } // namespace sky
\ No newline at end of file
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <rhi/Commands.h>
+#include <rhi/ComputePipeline.h>
 #include <rhi/Fence.h>
 #include <rhi/QueryPool.h>
 
@@ -16,8 +17,10 @@ namespace sky::rhi {
         ComputeEncoder() = default;
         virtual ~ComputeEncoder() = default;
 
-//        void BindComputePipeline(const ComputePipelinePtr &pso);
-//        void Dispatch(uint32_t x, uint32_t y, uint32_t z);
+        virtual ComputeEncoder &BindPipeline(const ComputePipelinePtr &pso) { return *this; }
+        virtual ComputeEncoder &BindSet(uint32_t id, const DescriptorSetPtr &set) { return *this; }
+        virtual ComputeEncoder &SetOffset(uint32_t set, uint32_t binding, uint32_t index, uint32_t offset) { return *this; }
+        virtual ComputeEncoder &Dispatch(uint32_t x, uint32_t y, uint32_t z) { return *this; }
     };
 
     struct PassBeginInfo {
@@ -49,11 +52,45 @@ namespace sky::rhi {
         virtual GraphicsEncoder &DrawIndirect(const BufferPtr &buffer, uint32_t offset, uint32_t count, uint32_t stride) = 0;
         virtual GraphicsEncoder &DispatchMesh(const CmdDispatchMesh &dispatch) = 0;
         virtual GraphicsEncoder &NextSubPass() = 0;
+        virtual GraphicsEncoder &NextSubPass(SubPassContent contents) { return NextSubPass(); }
         virtual GraphicsEncoder &EndPass() = 0;
         virtual GraphicsEncoder &BindSet(uint32_t id, const DescriptorSetPtr &set) = 0;
         virtual GraphicsEncoder &SetOffset(uint32_t set, uint32_t binding, uint32_t index, uint32_t offset) { return *this; }
     };
 
+    // records one sub pass as several chunks, each chunk may be encoded on its own thread.
+    // the serial form hands out the parent encoder, chunks must then be encoded in order on the calling thread.
+    class ParallelEncoder {
+    public:
+        explicit ParallelEncoder(uint32_t count) : chunkCount(count) {}
+        virtual ~ParallelEncoder() = default;
+
+        virtual bool IsParallel() const { return false; }
+
+        // every chunk index is begun and ended by exactly one thread.
+        virtual GraphicsEncoder &BeginChunk(uint32_t index) = 0;
+        virtual void EndChunk(uint32_t index) {}
+
+        // replay the chunks in index order into the parent pass.
+        virtual void Execute() {}
+
+        uint32_t GetChunkCount() const { return chunkCount; }
+
+    protected:
+        uint32_t chunkCount;
+    };
+
+    class SerialParallelEncoder : public ParallelEncoder {
+    public:
+        SerialParallelEncoder(GraphicsEncoder &parent, uint32_t count) : ParallelEncoder(count), encoder(parent) {}
+        ~SerialParallelEncoder() override = default;
+
+        GraphicsEncoder &BeginChunk(uint32_t index) override { return encoder; }
+
+    private:
+        GraphicsEncoder &encoder;
+    };
+
     class BlitEncoder {
     public:
         BlitEncoder() = default;
@@ -114,6 +151,14 @@ namespace sky::rhi {
 
         virtual std::shared_ptr<GraphicsEncoder> EncodeGraphics() = 0;
         virtual std::shared_ptr<BlitEncoder>     EncodeBlit()     = 0;
+        virtual std::shared_ptr<ComputeEncoder>  EncodeCompute()  { return nullptr; }
+
+        // passes recorded in parallel are begun with SubPassContent::SECONDARY_COMMAND_BUFFERS, every sub pass is then encoded through EncodeParallel.
+        virtual bool SupportParallelEncode() const { return false; }
+        virtual std::shared_ptr<ParallelEncoder> EncodeParallel(GraphicsEncoder &parent, uint32_t chunkCount)
+        {
+            return std::make_shared<SerialParallelEncoder>(parent, chunkCount);
+        }
 
         virtual void ResetQueryPool(const QueryPoolPtr &queryPool, uint32_t first, uint32_t count) {}
         virtual void
@@ -20,5 +20,6 @@ namespace sky::rhi {
             PipelineLayoutPtr pipelineLayout;
         };
     };
+    using ComputePipelinePtr = std::shared_ptr<ComputePipeline>;
 
 }
\ No newline at end of file
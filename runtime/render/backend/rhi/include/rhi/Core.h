@@ -528,11 +528,16 @@ namespace sky::rhi {
         uint32_t size;
     };
 
+    class FileStream;
+
     struct IUploadStream : public RefObject {
         IUploadStream() = default;
         ~IUploadStream() override = default;
         virtual const uint8_t *Data(uint64_t offset) = 0;
         virtual void ReadData(uint64_t offset, uint64_t size, uint8_t *out) = 0;
+
+        // set for streams that still have to read from disk.
+        virtual FileStream *AsFileStream() { return nullptr; }
     };
 
     struct BufferUploadRequest {
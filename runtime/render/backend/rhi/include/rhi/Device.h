@@ -14,11 +14,13 @@
 #include <rhi/Fence.h>
 #include <rhi/Shader.h>
 #include <rhi/GraphicsPipeline.h>
+#include <rhi/ComputePipeline.h>
 #include <rhi/Semaphore.h>
 #include <rhi/DescriptorSet.h>
 #include <rhi/VertexAssembly.h>
 #include <rhi/DescriptorSetPool.h>
 #include <rhi/QueryPool.h>
+#include <rhi/PipelineLibrary.h>
 
 #ifdef SKY_ENABLE_XR
 #include <rhi/XRInterface.h>
@@ -77,6 +79,8 @@ namespace sky::rhi {
         virtual FencePtr CreateFence(const Fence::Descriptor &desc) = 0;
         virtual ShaderPtr CreateShader(const Shader::Descriptor &desc) = 0;
         virtual GraphicsPipelinePtr CreateGraphicsPipeline(const GraphicsPipeline::Descriptor &desc) = 0;
+        virtual ComputePipelinePtr CreateComputePipeline(const ComputePipeline::Descriptor &desc) { return nullptr; }
+        virtual PipelineLibraryPtr CreatePipelineLibrary(const PipelineLibrary::Descriptor &desc) { return nullptr; }
         virtual DescriptorSetLayoutPtr CreateDescriptorSetLayout(const DescriptorSetLayout::Descriptor &desc) = 0;
         virtual PipelineLayoutPtr CreatePipelineLayout(const PipelineLayout::Descriptor &desc) = 0;
         virtual SemaphorePtr CreateSema(const Semaphore::Descriptor &desc) = 0;
@@ -107,7 +111,17 @@ namespace sky::rhi {
         // mesh shader
         virtual void FeatureQuery(MeshShaderProperties& prop) const {}
 
+        // pipelines created after this call go through the library.
+        virtual void SetPipelineLibrary(const PipelineLibraryPtr &library) { pipelineLibrary = library; }
+        const PipelineLibraryPtr &GetPipelineLibrary() const { return pipelineLibrary; }
+
+        // identifies device and driver version, serialized libraries are only valid for the same key.
+        virtual std::string GetPipelineLibraryKey() const { return ""; }
+        virtual PipelineLibraryStats GetPipelineLibraryStats() const { return {}; }
+
     protected:
+        PipelineLibraryPtr pipelineLibrary;
+
         DeviceFeature enabledFeature;
         Limitation limitation;
         Constants constants;
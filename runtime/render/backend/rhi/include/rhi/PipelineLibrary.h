@@ -5,9 +5,18 @@
 #pragma once
 
 #include <rhi/Core.h>
+#include <memory>
+#include <vector>
 
 namespace sky::rhi {
 
+    struct PipelineLibraryStats {
+        uint32_t hit         = 0; // pipeline object reused by the device.
+        uint32_t miss        = 0; // pipeline created by the driver.
+        uint32_t libraryHit  = 0; // created pipelines the driver found in the library, when the driver reports it.
+        uint64_t createTime  = 0; // microseconds spent in driver pipeline creation.
+    };
+
     class PipelineLibrary {
     public:
         PipelineLibrary() = default;
@@ -18,6 +27,11 @@ namespace sky::rhi {
             uint32_t dataSize = 0;
             const char* data = nullptr;
         };
+
+        // blob returned by Serialize is tagged with Device::GetPipelineLibraryKey, it is rejected by other drivers.
+        virtual bool Serialize(std::vector<uint8_t> &out) const { return false; }
+        virtual bool Merge(const std::vector<std::shared_ptr<PipelineLibrary>> &libraries) { return false; }
     };
+    using PipelineLibraryPtr = std::shared_ptr<PipelineLibrary>;
 
-} // namespace sky::rhi
\ No newline at end of file
+} // namespace sky::rhi
@@ -12,6 +12,8 @@
 
 namespace sky::rhi {
 
+    // the file is mapped from base to the end, uploads copy straight out of the page cache.
+    // files that can not be mapped fall back to reads.
     class FileStream : public IUploadStream {
     public:
         FileStream(const FilePtr &f, uint64_t base);
@@ -20,9 +22,31 @@ namespace sky::rhi {
         const uint8_t *Data(uint64_t offset) override;
         void ReadData(uint64_t offset, uint64_t size, uint8_t *out) override;
 
+        FileStream *AsFileStream() override { return this; }
+
+        // asks the os to page a mapped range in ahead of the upload, nothing for unmapped files.
+        void WillNeed(uint64_t offset, uint64_t size) const;
+
+        const FilePtr &GetFile() const { return file; }
+        uint64_t GetBaseOffset() const { return baseOffset; }
+
     private:
         FilePtr file;
         uint64_t baseOffset;
+        BinaryDataPtr view;
+    };
+
+    // bytes that are already in memory, e.g. the result of an async read.
+    class BinaryDataStream : public IUploadStream {
+    public:
+        explicit BinaryDataStream(const BinaryDataPtr &bin) : data(bin) {}
+        ~BinaryDataStream() override = default;
+
+        const uint8_t *Data(uint64_t offset) override;
+        void ReadData(uint64_t offset, uint64_t size, uint8_t *out) override;
+
+    private:
+        BinaryDataPtr data;
     };
 
     class RawPtrStream : public IUploadStream {
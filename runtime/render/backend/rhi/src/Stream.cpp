@@ -8,18 +8,43 @@ namespace sky::rhi {
 
     FileStream::FileStream(const FilePtr &f, uint64_t base) : file(f), baseOffset(base) // NOLINT
     {
+        if (file->CanMap()) {
+            view = file->Map(baseOffset, 0, FileAccessHint::SEQUENTIAL);
+        }
     }
 
     const uint8_t *FileStream::Data(uint64_t offset)
     {
-        return nullptr;
+        return view ? view->Data() + offset : nullptr;
+    }
+
+    void FileStream::WillNeed(uint64_t offset, uint64_t size) const
+    {
+        if (view && offset + size <= view->Size()) {
+            // a view of the same mapping, dropped right away.
+            file->Map(baseOffset + offset, size, FileAccessHint::WILL_NEED);
+        }
     }
 
     void FileStream::ReadData(uint64_t offset, uint64_t size, uint8_t *out)
     {
+        if (view && offset + size <= view->Size()) {
+            memcpy(out, view->Data() + offset, size);
+            return;
+        }
         file->ReadData(baseOffset + offset, size, out);
     }
 
+    const uint8_t *BinaryDataStream::Data(uint64_t offset)
+    {
+        return data->Data() + offset;
+    }
+
+    void BinaryDataStream::ReadData(uint64_t offset, uint64_t size, uint8_t *out)
+    {
+        memcpy(out, data->Data() + offset, size);
+    }
+
     const uint8_t *RawPtrStream::Data(uint64_t offset)
     {
         return data + offset;
@@ -23,6 +23,8 @@ namespace sky::vk {
     class Queue;
     class CommandBuffer;
     class SecondaryCommands;
+    class FrameCommandPools;
+    class ParallelEncoder;
 
     struct PassBeginInfo {
         vk::FrameBufferPtr frameBuffer;
@@ -40,13 +42,18 @@ namespace sky::vk {
 
         void BindShaderResource(const DescriptorSetBinderPtr &binder);
         void BindPipeline(const ComputePipelinePtr &pso);
-        void Dispatch(uint32_t x, uint32_t y, uint32_t z);
+
+        rhi::ComputeEncoder &BindPipeline(const rhi::ComputePipelinePtr &pso) override;
+        rhi::ComputeEncoder &BindSet(uint32_t id, const rhi::DescriptorSetPtr &set) override;
+        rhi::ComputeEncoder &SetOffset(uint32_t set, uint32_t binding, uint32_t index, uint32_t offset) override;
+        rhi::ComputeEncoder &Dispatch(uint32_t x, uint32_t y, uint32_t z) override;
 
     private:
         friend class CommandBuffer;
         CommandBuffer        &cmdBuffer;
         VkCommandBuffer       cmd              = VK_NULL_HANDLE;
         VkPipeline            currentPso       = VK_NULL_HANDLE;
+        DescriptorSetBinder   currentBinder;
     };
 
     class GraphicsEncoder : public rhi::GraphicsEncoder {
@@ -82,14 +89,17 @@ namespace sky::vk {
         rhi::GraphicsEncoder &BindSet(uint32_t id, const rhi::DescriptorSetPtr &set) override;
         rhi::GraphicsEncoder &SetOffset(uint32_t set, uint32_t binding, uint32_t index, uint32_t offset) override;
         rhi::GraphicsEncoder &NextSubPass() override;
+        rhi::GraphicsEncoder &NextSubPass(rhi::SubPassContent contents) override;
         rhi::GraphicsEncoder &EndPass() override;
 
     private:
         friend class CommandBuffer;
+        friend class ParallelEncoder;
         CommandBuffer        &cmdBuffer;
         VkCommandBuffer       cmd              = VK_NULL_HANDLE;
         VkPipeline            currentPso       = VK_NULL_HANDLE;
         VkRenderPassBeginInfo vkBeginInfo      = {};
+        uint32_t              subPassIndex     = 0;
         VkViewport            viewport{};
         VkRect2D              scissor{};
         VertexAssemblyPtr     currentAssembler;
@@ -165,6 +175,9 @@ namespace sky::vk {
         void Submit(rhi::Queue &queue, const rhi::SubmitInfo &submit) override;
         std::shared_ptr<rhi::GraphicsEncoder> EncodeGraphics() override;
         std::shared_ptr<rhi::BlitEncoder> EncodeBlit() override;
+        std::shared_ptr<rhi::ComputeEncoder> EncodeCompute() override;
+        bool SupportParallelEncode() const override { return true; }
+        std::shared_ptr<rhi::ParallelEncoder> EncodeParallel(rhi::GraphicsEncoder &parent, uint32_t chunkCount) override;
         void QueueBarrier(const rhi::ImageBarrier &imageBarrier) override;
         void QueueBarrier(const rhi::ImagePtr &image, const rhi::ImageSubRange &range, const rhi::BarrierInfo &barrierInfo) override;
         void QueueBarrier(const rhi::BufferPtr &buffer, uint64_t offset, uint64_t range, const rhi::BarrierInfo &barrierInfo) override;
@@ -187,6 +200,11 @@ namespace sky::vk {
 
         VkCommandPool   pool;
         VkCommandBuffer cmdBuffer;
+        uint32_t        queueFamilyIndex = 0;
+
+        // secondary buffers recorded for this primary, recycled when it begins again.
+        std::unique_ptr<FrameCommandPools> framePools;
+
         std::vector<VkBufferMemoryBarrier> bufferBarriers;
         std::vector<VkImageMemoryBarrier> imageBarriers;
         VkPipelineStageFlags srcStageMask = 0;
@@ -195,6 +213,30 @@ namespace sky::vk {
 
     using CommandBufferPtr = std::shared_ptr<CommandBuffer>;
 
+    // records chunks of a subpass into secondary command buffers, one per chunk.
+    // chunks may be recorded from different threads and are executed in index order.
+    class ParallelEncoder : public rhi::ParallelEncoder {
+    public:
+        ParallelEncoder(GraphicsEncoder &parent, FrameCommandPools &pools, uint32_t count);
+        ~ParallelEncoder() override = default;
+
+        bool IsParallel() const override { return true; }
+        rhi::GraphicsEncoder &BeginChunk(uint32_t index) override;
+        void EndChunk(uint32_t index) override;
+        void Execute() override;
+
+    private:
+        struct Chunk {
+            CommandBufferPtr cmdBuffer;
+            std::unique_ptr<GraphicsEncoder> encoder;
+        };
+
+        GraphicsEncoder &parent;
+        FrameCommandPools &pools;
+        VkCommandBufferInheritanceInfo inheritance = {};
+        std::vector<Chunk> chunks;
+    };
+
     class SecondaryCommands {
     public:
         SecondaryCommands()  = default;
@@ -5,6 +5,9 @@
 #include "vulkan/CommandBuffer.h"
 #include "vulkan/DevObject.h"
 #include "vulkan/vulkan.h"
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace sky::vk {
 
@@ -23,12 +26,47 @@ namespace sky::vk {
 
         CommandBufferPtr Allocate(const CommandBuffer::VkDescriptor &);
 
+        // every command buffer of the pool returns to the initial state.
+        void Reset();
+
+        uint32_t GetQueueFamilyIndex() const { return queueFamilyIndex; }
+
     private:
         friend class Device;
         explicit CommandPool(Device &);
 
         VkCommandPool pool;
+        uint32_t queueFamilyIndex = 0;
     };
 
     using CommandPoolPtr = std::shared_ptr<CommandPool>;
+
+    // secondary command buffers of one frame, every recording thread owns a pool.
+    // buffers are recycled by Reset once the frame has retired, command pools are never shared between threads.
+    class FrameCommandPools {
+    public:
+        FrameCommandPools(Device &dev, uint32_t queueFamily) : device(dev), queueFamilyIndex(queueFamily) {}
+        ~FrameCommandPools() = default;
+
+        // thread safe, the buffer is allocated from the pool of the calling thread.
+        CommandBufferPtr AllocateSecondary();
+
+        // not thread safe, no thread may record into the frame.
+        void Reset();
+
+    private:
+        struct ThreadPool {
+            CommandPoolPtr pool;
+            std::vector<CommandBufferPtr> buffers;
+            uint32_t used = 0;
+        };
+
+        ThreadPool &GetThreadPool();
+
+        Device &device;
+        uint32_t queueFamilyIndex;
+
+        std::mutex mutex;
+        std::unordered_map<std::thread::id, std::unique_ptr<ThreadPool>> pools;
+    };
 } // namespace sky::vk
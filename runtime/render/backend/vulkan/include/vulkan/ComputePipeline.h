@@ -22,6 +22,7 @@ namespace sky::vk {
         ~ComputePipeline();
 
         VkPipeline GetNativeHandle() const;
+        const PipelineLayoutPtr &GetPipelineLayout() const { return pipelineLayout; }
     private:
         friend class Device;
         ComputePipeline(Device &);
@@ -20,6 +20,8 @@
 #include <vulkan/Semaphore.h>
 #include <vulkan/DescriptorSetPool.h>
 #include <vulkan/QueryPool.h>
+#include <vulkan/PipelineLibrary.h>
+#include <atomic>
 #include <vulkan/vulkan.h>
 
 namespace sky::vk {
@@ -72,6 +74,10 @@ namespace sky::vk {
         VkDescriptorSetLayout GetDescriptorSetLayout(uint32_t hash, VkDescriptorSetLayoutCreateInfo * = nullptr);
         VkRenderPass          GetRenderPass(uint32_t hash, VkRenderPassCreateInfo2 * = nullptr);
         VkPipeline            GetPipeline(uint32_t hash, VkGraphicsPipelineCreateInfo * = nullptr);
+
+        // driver pipeline creation through the pipeline library, timed for the library stats.
+        VkPipeline CreateVkPipeline(const VkGraphicsPipelineCreateInfo &pipelineInfo);
+        VkPipeline CreateVkPipeline(const VkComputePipelineCreateInfo &pipelineInfo);
         const AccessInfo     &GetAccessInfo(const rhi::AccessFlags& flags);
 
         // features
@@ -81,6 +87,10 @@ namespace sky::vk {
         int32_t FindProperties(uint32_t memoryTypeBits, VkMemoryPropertyFlags requiredProperties) const;
         void FeatureQuery(rhi::MeshShaderProperties& properties) const override;
 
+        // pipeline library
+        std::string GetPipelineLibraryKey() const override;
+        rhi::PipelineLibraryStats GetPipelineLibraryStats() const override;
+
         // rhi
         rhi::Queue *GetQueue(rhi::QueueType type) const override;
 
@@ -93,12 +103,14 @@ namespace sky::vk {
         CREATE_DEV_OBJ(Fence)
         CREATE_DEV_OBJ(Shader)
         CREATE_DEV_OBJ(GraphicsPipeline)
+        CREATE_DEV_OBJ(ComputePipeline)
         CREATE_DEV_OBJ(DescriptorSetLayout)
         CREATE_DEV_OBJ(PipelineLayout)
         CREATE_DEV_OBJ(VertexAssembly)
         CREATE_DEV_OBJ(Sampler)
         CREATE_DEV_OBJ(DescriptorSetPool)
         CREATE_DEV_OBJ(QueryPool)
+        CREATE_DEV_OBJ(PipelineLibrary)
         CREATE_DEV_OBJ_FUNC(Semaphore, Sema)
 
 #ifdef SKY_ENABLE_XR
@@ -132,6 +144,9 @@ namespace sky::vk {
 
         void PrintSupportedExtensions() const;
         void SetupDefaultResources();
+
+        template <typename Info, typename Func>
+        VkPipeline CreateVkPipeline(const Info &pipelineInfo, uint32_t stageCount, Func &&func);
         friend class Instance;
         explicit Device(Instance &);
         Instance        &instance;
@@ -178,6 +193,12 @@ namespace sky::vk {
         CacheManager<VkPipeline, uint32_t>            pipelines;
         CacheManager<VkRenderPass, uint32_t>          renderPasses;
         CacheManager<AccessInfo, uint64_t>            accessInfos;
+
+        bool creationFeedback = false;
+        std::atomic<uint32_t> pipelineHit = 0;
+        std::atomic<uint32_t> pipelineMiss = 0;
+        std::atomic<uint32_t> pipelineLibraryHit = 0;
+        std::atomic<uint64_t> pipelineCreateTime = 0;
     };
 
     const std::vector<const char *> &GetDeviceExtensions();
@@ -21,6 +21,7 @@ namespace sky::vk {
         Device *CreateDevice(const Device::Descriptor &) override;
 
         VkInstance GetInstance() const;
+        uint32_t GetMinorVersion() const { return minorVersion; }
     private:
         bool Init(const Descriptor &) override;
 
@@ -6,21 +6,32 @@
 
 #include <rhi/PipelineLibrary.h>
 #include <vulkan/DevObject.h>
+#include <vulkan/vulkan.h>
 
 namespace sky::vk {
     class Device;
 
+    // VkPipelineCache, serialized data carries a header with the identity of the device that wrote it.
     class PipelineLibrary : public rhi::PipelineLibrary, public DevObject{
     public:
         explicit PipelineLibrary(Device &dev) : DevObject(dev) {}
         ~PipelineLibrary() override;
 
+        bool Serialize(std::vector<uint8_t> &out) const override;
+        bool Merge(const std::vector<rhi::PipelineLibraryPtr> &libraries) override;
+
+        VkPipelineCache GetNativeHandle() const { return cache; }
+
+        // false when no data was given or it was rejected, the cache then starts empty.
+        bool HasInitialData() const { return initialData; }
 
     private:
         friend class Device;
         bool Init(const Descriptor &desc);
 
         VkPipelineCache cache = VK_NULL_HANDLE;
+        bool initialData = false;
     };
+    using PipelineLibraryPtr = std::shared_ptr<PipelineLibrary>;
 
 } // namespace sky::vk
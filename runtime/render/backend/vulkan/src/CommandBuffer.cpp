@@ -2,6 +2,7 @@
 // Created by Zach Lee on 2021/11/7.
 //
 #include "vulkan/CommandBuffer.h"
+#include "vulkan/CommandPool.h"
 #include "core/logger/Logger.h"
 #include "vulkan/Device.h"
 #include "vulkan/Fence.h"
@@ -64,6 +65,11 @@ namespace sky::vk {
 
     void CommandBuffer::Begin()
     {
+        // the primary has retired, so have the secondaries recorded for it.
+        if (framePools) {
+            framePools->Reset();
+        }
+
         VkCommandBufferBeginInfo beginInfo = {};
         beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         beginInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
@@ -122,6 +128,19 @@ namespace sky::vk {
         return std::make_shared<BlitEncoder>(*this);
     }
 
+    std::shared_ptr<rhi::ComputeEncoder> CommandBuffer::EncodeCompute()
+    {
+        return std::make_shared<ComputeEncoder>(*this);
+    }
+
+    std::shared_ptr<rhi::ParallelEncoder> CommandBuffer::EncodeParallel(rhi::GraphicsEncoder &parent, uint32_t chunkCount)
+    {
+        if (!framePools) {
+            framePools = std::make_unique<FrameCommandPools>(device, queueFamilyIndex);
+        }
+        return std::make_shared<ParallelEncoder>(static_cast<GraphicsEncoder&>(parent), *framePools, chunkCount);
+    }
+
     void CommandBuffer::QueueBarrier(const rhi::ImageBarrier &imageBarrier)
     {
         const auto &view = std::static_pointer_cast<ImageView>(imageBarrier.view);
@@ -344,9 +363,32 @@ namespace sky::vk {
         }
     }
 
-    void ComputeEncoder::Dispatch(uint32_t x, uint32_t y, uint32_t z)
+    rhi::ComputeEncoder &ComputeEncoder::BindPipeline(const rhi::ComputePipelinePtr &pso)
     {
+        auto vkPso = std::static_pointer_cast<ComputePipeline>(pso);
+        BindPipeline(vkPso);
+        currentBinder.SetPipelineLayout(vkPso->GetPipelineLayout());
+        currentBinder.SetBindPoint(VK_PIPELINE_BIND_POINT_COMPUTE);
+        return *this;
+    }
+
+    rhi::ComputeEncoder &ComputeEncoder::BindSet(uint32_t id, const rhi::DescriptorSetPtr &set)
+    {
+        currentBinder.BindSet(id, std::static_pointer_cast<DescriptorSet>(set));
+        return *this;
+    }
+
+    rhi::ComputeEncoder &ComputeEncoder::SetOffset(uint32_t set, uint32_t binding, uint32_t index, uint32_t offset)
+    {
+        currentBinder.SetOffset(set, binding, index, offset);
+        return *this;
+    }
+
+    rhi::ComputeEncoder &ComputeEncoder::Dispatch(uint32_t x, uint32_t y, uint32_t z)
+    {
+        currentBinder.OnBind(cmd);
         vkCmdDispatch(cmd, x, y, z);
+        return *this;
     }
 
     GraphicsEncoder::GraphicsEncoder(CommandBuffer &cb) : cmdBuffer(cb)
@@ -379,6 +421,7 @@ namespace sky::vk {
         vkBeginInfo.pClearValues    = beginInfo.clearValues;
 
         vkCmdBeginRenderPass(cmd, &vkBeginInfo, beginInfo.contents);
+        subPassIndex = 0;
 
         viewport = {0, 0, static_cast<float>(extent.width), static_cast<float>(extent.height), 0.f, 1.f};
         scissor  = {{0, 0}, extent};
@@ -521,6 +564,7 @@ namespace sky::vk {
 
         VkSubpassContents contents = info.contents == rhi::SubPassContent::INLINE ? VK_SUBPASS_CONTENTS_INLINE : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
         vkCmdBeginRenderPass(cmd, &vkBeginInfo, contents);
+        subPassIndex = 0;
 
         viewport = {0, 0, static_cast<float>(extent.width), static_cast<float>(extent.height), 0.f, 1.f};
         scissor  = {{0, 0}, extent};
@@ -680,7 +724,19 @@ namespace sky::vk {
 
     rhi::GraphicsEncoder &GraphicsEncoder::NextSubPass()
     {
-        vkCmdNextSubpass(cmd, VK_SUBPASS_CONTENTS_INLINE);
+        return NextSubPass(rhi::SubPassContent::INLINE);
+    }
+
+    rhi::GraphicsEncoder &GraphicsEncoder::NextSubPass(rhi::SubPassContent contents)
+    {
+        ++subPassIndex;
+        if (contents == rhi::SubPassContent::INLINE) {
+            vkCmdNextSubpass(cmd, VK_SUBPASS_CONTENTS_INLINE);
+            SetViewport(1, &viewport);
+            SetScissor(1, &scissor);
+        } else {
+            vkCmdNextSubpass(cmd, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+        }
         return *this;
     }
 
@@ -781,6 +837,54 @@ namespace sky::vk {
         return *this;
     }
 
+    ParallelEncoder::ParallelEncoder(GraphicsEncoder &encoder, FrameCommandPools &framePools, uint32_t count)
+        : rhi::ParallelEncoder(count)
+        , parent(encoder)
+        , pools(framePools)
+        , chunks(count)
+    {
+        inheritance.sType       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritance.renderPass  = parent.vkBeginInfo.renderPass;
+        inheritance.subpass     = parent.subPassIndex;
+        inheritance.framebuffer = parent.vkBeginInfo.framebuffer;
+    }
+
+    rhi::GraphicsEncoder &ParallelEncoder::BeginChunk(uint32_t index)
+    {
+        auto &chunk = chunks[index];
+        chunk.cmdBuffer = pools.AllocateSecondary();
+        chunk.cmdBuffer->Begin(inheritance);
+
+        // dynamic states are not inherited from the primary.
+        chunk.encoder = std::make_unique<GraphicsEncoder>(*chunk.cmdBuffer);
+        chunk.encoder->vkBeginInfo  = parent.vkBeginInfo;
+        chunk.encoder->subPassIndex = parent.subPassIndex;
+        chunk.encoder->viewport     = parent.viewport;
+        chunk.encoder->scissor      = parent.scissor;
+        chunk.encoder->SetViewport(1, &parent.viewport);
+        chunk.encoder->SetScissor(1, &parent.scissor);
+        return *chunk.encoder;
+    }
+
+    void ParallelEncoder::EndChunk(uint32_t index)
+    {
+        chunks[index].cmdBuffer->End();
+    }
+
+    void ParallelEncoder::Execute()
+    {
+        std::vector<VkCommandBuffer> handles;
+        handles.reserve(chunks.size());
+        for (auto &chunk : chunks) {
+            if (chunk.cmdBuffer) {
+                handles.emplace_back(chunk.cmdBuffer->GetNativeHandle());
+            }
+        }
+        if (!handles.empty()) {
+            vkCmdExecuteCommands(parent.cmd, static_cast<uint32_t>(handles.size()), handles.data());
+        }
+    }
+
     void SecondaryCommands::Emplace(const CommandBufferPtr &cmd)
     {
         std::lock_guard<std::mutex> lock(mutex);
@@ -33,9 +33,15 @@ namespace sky::vk {
             LOG_E(TAG, "create command pool failed -%u", rst);
             return false;
         }
+        queueFamilyIndex = des.queueFamilyIndex;
         return true;
     }
 
+    void CommandPool::Reset()
+    {
+        vkResetCommandPool(device.GetNativeHandle(), pool, 0);
+    }
+
     CommandBufferPtr CommandPool::Allocate(const CommandBuffer::VkDescriptor &des)
     {
         VkCommandBufferAllocateInfo cbInfo = {};
@@ -58,6 +64,43 @@ namespace sky::vk {
         }
         cmdBuffer->pool = pool;
         cmdBuffer->cmdBuffer = buffer;
+        cmdBuffer->queueFamilyIndex = queueFamilyIndex;
         return std::shared_ptr<CommandBuffer>(cmdBuffer);
     }
+
+    FrameCommandPools::ThreadPool &FrameCommandPools::GetThreadPool()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &threadPool = pools[std::this_thread::get_id()];
+        if (!threadPool) {
+            threadPool = std::make_unique<ThreadPool>();
+
+            CommandPool::VkDescriptor des = {};
+            des.queueFamilyIndex = queueFamilyIndex;
+            threadPool->pool = device.CreateDeviceObject<CommandPool>(des);
+        }
+        return *threadPool;
+    }
+
+    CommandBufferPtr FrameCommandPools::AllocateSecondary()
+    {
+        auto &threadPool = GetThreadPool();
+        if (threadPool.used == threadPool.buffers.size()) {
+            CommandBuffer::VkDescriptor des = {};
+            des.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            des.needFence = false;
+            threadPool.buffers.emplace_back(threadPool.pool->Allocate(des));
+        }
+        return threadPool.buffers[threadPool.used++];
+    }
+
+    void FrameCommandPools::Reset()
+    {
+        for (auto &[id, threadPool] : pools) {
+            if (threadPool->used != 0) {
+                threadPool->pool->Reset();
+                threadPool->used = 0;
+            }
+        }
+    }
 } // namespace sky::vk
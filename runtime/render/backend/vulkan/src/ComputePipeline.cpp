@@ -32,14 +32,11 @@ namespace sky::vk {
         pipelineInfo.stage.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
         pipelineInfo.stage.stage  = shader->GetShaderStage();
         pipelineInfo.stage.module = shader->GetNativeHandle();
-        pipelineInfo.stage.pName  = "main";
+        pipelineInfo.stage.pName  = shader->GetEntry().c_str();
         pipelineInfo.stage.pSpecializationInfo = nullptr;
 
-        auto rst = vkCreateComputePipelines(device.GetNativeHandle(), VK_NULL_HANDLE, 1, &pipelineInfo, VKL_ALLOC, &pipeline);
-        if (rst != VK_SUCCESS) {
-            LOG_E(TAG, "create Pipeline failed, %d", rst);
-        }
-        return pipeline;
+        pipeline = device.CreateVkPipeline(pipelineInfo);
+        return pipeline != VK_NULL_HANDLE;
     }
 
     VkPipeline ComputePipeline::GetNativeHandle() const
@@ -12,6 +12,8 @@
 
 #include <rhi/Util.h>
 
+#include <chrono>
+
 #ifdef SKY_ENABLE_XR
 #include <openxr/openxr_platform.h>
 #endif
@@ -324,6 +326,9 @@ namespace sky::vk {
         UpdateFormatFeatures();
         UpdateConstants();
 
+        // creation feedback is core since 1.3, it reports whether the pipeline library was hit.
+        creationFeedback = VK_API_VERSION_MINOR(phyProps.properties.apiVersion) >= 3 && instance.GetMinorVersion() >= 3;
+
         VkDeviceCreateInfo devInfo = {};
         devInfo.sType              = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
 #ifndef ANDROID
@@ -514,14 +519,91 @@ namespace sky::vk {
             return pipelines.Find(hash);
         }
 
-        return pipelines.FindOrEmplace(hash, [this, pipelineInfo]() {
-            VkPipeline pipeline;
-            auto       rst = vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, pipelineInfo, VKL_ALLOC, &pipeline);
-            if (rst != VK_SUCCESS) {
-                LOG_E(TAG, "create Pipeline failed, %d", rst);
-            }
-            return pipeline;
+        bool created = false;
+        auto pipeline = pipelines.FindOrEmplace(hash, [this, pipelineInfo, &created]() {
+            created = true;
+            return CreateVkPipeline(*pipelineInfo);
         });
+        if (!created) {
+            ++pipelineHit;
+        }
+        return pipeline;
+    }
+
+    template <typename Info, typename Func>
+    VkPipeline Device::CreateVkPipeline(const Info &pipelineInfo, uint32_t stageCount, Func &&func)
+    {
+        Info createInfo = pipelineInfo;
+
+        VkPipelineCreationFeedback feedback = {};
+        std::vector<VkPipelineCreationFeedback> stageFeedbacks(stageCount);
+        VkPipelineCreationFeedbackCreateInfo feedbackInfo = {VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
+        if (creationFeedback) {
+            feedbackInfo.pNext = createInfo.pNext;
+            feedbackInfo.pPipelineCreationFeedback = &feedback;
+            feedbackInfo.pipelineStageCreationFeedbackCount = stageCount;
+            feedbackInfo.pPipelineStageCreationFeedbacks = stageFeedbacks.data();
+            createInfo.pNext = &feedbackInfo;
+        }
+
+        const auto &library = std::static_pointer_cast<PipelineLibrary>(pipelineLibrary);
+        VkPipelineCache cache = library ? library->GetNativeHandle() : VK_NULL_HANDLE;
+
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        auto begin = std::chrono::steady_clock::now();
+        auto rst = func(cache, createInfo, pipeline);
+        auto end = std::chrono::steady_clock::now();
+        if (rst != VK_SUCCESS) {
+            LOG_E(TAG, "create Pipeline failed, %d", rst);
+            return VK_NULL_HANDLE;
+        }
+
+        ++pipelineMiss;
+        pipelineCreateTime += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+        if ((feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT) != 0) {
+            ++pipelineLibraryHit;
+        }
+        return pipeline;
+    }
+
+    VkPipeline Device::CreateVkPipeline(const VkGraphicsPipelineCreateInfo &pipelineInfo)
+    {
+        return CreateVkPipeline(pipelineInfo, pipelineInfo.stageCount,
+            [this](VkPipelineCache cache, const VkGraphicsPipelineCreateInfo &info, VkPipeline &pipeline) {
+                return vkCreateGraphicsPipelines(device, cache, 1, &info, VKL_ALLOC, &pipeline);
+            });
+    }
+
+    VkPipeline Device::CreateVkPipeline(const VkComputePipelineCreateInfo &pipelineInfo)
+    {
+        return CreateVkPipeline(pipelineInfo, 1,
+            [this](VkPipelineCache cache, const VkComputePipelineCreateInfo &info, VkPipeline &pipeline) {
+                return vkCreateComputePipelines(device, cache, 1, &info, VKL_ALLOC, &pipeline);
+            });
+    }
+
+    std::string Device::GetPipelineLibraryKey() const
+    {
+        const auto &props = phyProps.properties;
+
+        static const char *HEX = "0123456789abcdef";
+        std::string uuid;
+        for (uint8_t v : props.pipelineCacheUUID) {
+            uuid += HEX[v >> 4];
+            uuid += HEX[v & 0xF];
+        }
+        return "vk_" + std::to_string(props.vendorID) + "_" + std::to_string(props.deviceID) + "_" +
+            std::to_string(props.driverVersion) + "_" + uuid;
+    }
+
+    rhi::PipelineLibraryStats Device::GetPipelineLibraryStats() const
+    {
+        rhi::PipelineLibraryStats stats = {};
+        stats.hit        = pipelineHit.load();
+        stats.miss       = pipelineMiss.load();
+        stats.libraryHit = pipelineLibraryHit.load();
+        stats.createTime = pipelineCreateTime.load();
+        return stats;
     }
 
     const AccessInfo &Device::GetAccessInfo(const rhi::AccessFlags& flags)
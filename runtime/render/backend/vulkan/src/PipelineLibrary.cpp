@@ -4,11 +4,62 @@
 
 #include <vulkan/PipelineLibrary.h>
 #include <core/logger/Logger.h>
+#include <core/hash/Crc32.h>
 #include <vulkan/Device.h>
+#include <cstring>
 
 namespace sky::vk {
     static const char* TAG = "Vulkan";
 
+    static constexpr uint32_t LIBRARY_MAGIC   = 0x4C504B53; // SKPL
+    static constexpr uint32_t LIBRARY_VERSION = 1;
+
+    struct LibraryHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t vendorID;
+        uint32_t deviceID;
+        uint32_t driverVersion;
+        uint32_t dataSize;
+        uint32_t dataCrc;
+        uint8_t  uuid[VK_UUID_SIZE];
+    };
+
+    static LibraryHeader MakeHeader(const Device &device)
+    {
+        const auto &props = device.GetProperties();
+
+        LibraryHeader header = {};
+        header.magic         = LIBRARY_MAGIC;
+        header.version       = LIBRARY_VERSION;
+        header.vendorID      = props.vendorID;
+        header.deviceID      = props.deviceID;
+        header.driverVersion = props.driverVersion;
+        memcpy(header.uuid, props.pipelineCacheUUID, VK_UUID_SIZE);
+        return header;
+    }
+
+    // some drivers do not validate the blob they are given, data of another device or driver is dropped here.
+    static bool CheckHeader(const Device &device, const char *data, uint32_t size)
+    {
+        if (size < sizeof(LibraryHeader)) {
+            return false;
+        }
+
+        LibraryHeader header = {};
+        memcpy(&header, data, sizeof(LibraryHeader));
+
+        auto expected = MakeHeader(device);
+        return header.magic == expected.magic &&
+            header.version == expected.version &&
+            header.vendorID == expected.vendorID &&
+            header.deviceID == expected.deviceID &&
+            header.driverVersion == expected.driverVersion &&
+            memcmp(header.uuid, expected.uuid, VK_UUID_SIZE) == 0 &&
+            header.dataSize == size - sizeof(LibraryHeader) &&
+            header.dataCrc == Crc32::Cal(reinterpret_cast<const uint8_t *>(data) + sizeof(LibraryHeader), header.dataSize);
+    }
+
     PipelineLibrary::~PipelineLibrary()
     {
         if (cache != VK_NULL_HANDLE) {
@@ -22,8 +73,17 @@ namespace sky::vk {
         cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
         cacheInfo.pNext = nullptr;
         cacheInfo.flags = desc.externalSynchronized ? VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT : 0;
-        cacheInfo.initialDataSize = desc.dataSize;
-        cacheInfo.pInitialData = desc.data;
+
+        if (desc.data != nullptr && desc.dataSize != 0) {
+            if (CheckHeader(device, desc.data, desc.dataSize)) {
+                cacheInfo.initialDataSize = desc.dataSize - sizeof(LibraryHeader);
+                cacheInfo.pInitialData = desc.data + sizeof(LibraryHeader);
+                initialData = true;
+            } else {
+                LOG_W(TAG, "pipeline library data does not match the device, ignored");
+            }
+        }
+
         auto res = vkCreatePipelineCache(device.GetNativeHandle(), &cacheInfo, VKL_ALLOC, &cache);
         if (res != VK_SUCCESS) {
             LOG_E(TAG, "create pipeline cache failed, %d", res);
@@ -33,4 +93,40 @@ namespace sky::vk {
         return true;
     }
 
-} // namespace sky::vk
\ No newline at end of file
+    bool PipelineLibrary::Serialize(std::vector<uint8_t> &out) const
+    {
+        size_t size = 0;
+        if (vkGetPipelineCacheData(device.GetNativeHandle(), cache, &size, nullptr) != VK_SUCCESS) {
+            return false;
+        }
+
+        out.resize(sizeof(LibraryHeader) + size);
+        if (vkGetPipelineCacheData(device.GetNativeHandle(), cache, &size, out.data() + sizeof(LibraryHeader)) != VK_SUCCESS) {
+            out.clear();
+            return false;
+        }
+        out.resize(sizeof(LibraryHeader) + size);
+
+        auto header = MakeHeader(device);
+        header.dataSize = static_cast<uint32_t>(size);
+        header.dataCrc  = Crc32::Cal(out.data() + sizeof(LibraryHeader), header.dataSize);
+        memcpy(out.data(), &header, sizeof(LibraryHeader));
+        return true;
+    }
+
+    bool PipelineLibrary::Merge(const std::vector<rhi::PipelineLibraryPtr> &libraries)
+    {
+        std::vector<VkPipelineCache> caches;
+        for (const auto &library : libraries) {
+            auto *vkLibrary = static_cast<PipelineLibrary *>(library.get());
+            if (vkLibrary != nullptr && vkLibrary != this) {
+                caches.emplace_back(vkLibrary->cache);
+            }
+        }
+        if (caches.empty()) {
+            return true;
+        }
+        return vkMergePipelineCaches(device.GetNativeHandle(), cache, static_cast<uint32_t>(caches.size()), caches.data()) == VK_SUCCESS;
+    }
+
+} // namespace sky::vk
@@ -2,7 +2,7 @@
 // Created by Zach Lee on 2022/1/9.
 //
 
-#include <core/hash/Crc32.h>
+#include <core/hash/Hash.h>
 #include <core/logger/Logger.h>
 #include <vulkan/Basic.h>
 #include <vulkan/Device.h>
@@ -39,7 +39,8 @@ namespace sky::vk {
             LOG_E(TAG, "create shader module failed %d", rst);
             return false;
         }
-        hash = Crc32::Cal(reinterpret_cast<const uint8_t *>(shaderInfo.pCode), static_cast<uint32_t>(shaderInfo.codeSize));
+        uint64_t codeHash = Hash64(shaderInfo.pCode, shaderInfo.codeSize);
+        hash = static_cast<uint32_t>(codeHash ^ (codeHash >> 32));
         return true;
     }
 
@@ -40,6 +40,7 @@ namespace sky::builder {
         {"SKIN",     RenderVertexFlagBit::SKIN},
         {"INSTANCE", RenderVertexFlagBit::INSTANCE},
         {"MESH_SHADER", RenderVertexFlagBit::MESH_SHADER},
+        {"AUTO_INSTANCE", RenderVertexFlagBit::AUTO_INSTANCE},
     };
 
     static void ProcessShader(rapidjson::Document &document, ShaderRefData &shaderRef, TechAssetType type)
@@ -199,6 +200,12 @@ namespace sky::builder {
         GetVariants(document, data);
     }
 
+    static void ProcessCompute(rapidjson::Document &document, TechniqueAssetData &data, const AssetBuildRequest &request)
+    {
+        data.type = TechAssetType::COMPUTE;
+        ProcessShader(document, data.shader, data.type);
+    }
+
     void TechniqueBuilder::Request(const AssetBuildRequest &request, AssetBuildResult &result)
     {
         std::string json;
@@ -218,6 +225,11 @@ namespace sky::builder {
             TechniqueAssetData &assetData = asset->Data();
             ProcessGraphics(document, assetData, request);
             AssetManager::Get()->SaveAsset(asset, request.target);
+        } else if (type == "compute") {
+            auto asset = am->FindOrCreateAsset<Technique>(request.assetInfo->uuid);
+            TechniqueAssetData &assetData = asset->Data();
+            ProcessCompute(document, assetData, request);
+            AssetManager::Get()->SaveAsset(asset, request.target);
         }
         result.retCode = AssetBuildRetCode::SUCCESS;
     }
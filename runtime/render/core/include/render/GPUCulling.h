@@ -0,0 +1,114 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/math/Matrix4.h>
+#include <core/shapes/Frustum.h>
+#include <render/resource/Meshlet.h>
+#include <rhi/Commands.h>
+#include <vector>
+
+namespace sky {
+
+    // data layouts shared with shaders/gpu_culling.hlsl, keep both sides in sync.
+    // the functions below are the cpu reference of the culling kernels and follow the shader line by line.
+
+    enum class GPUInstanceFlagBit : uint32_t {
+        NONE         = 0x00,
+        VALID        = 0x01,
+        CONE_CULLING = 0x02,
+    };
+
+    enum class GPUCullFlagBit : uint32_t {
+        NONE    = 0x00,
+        FRUSTUM = 0x01,
+        HIZ     = 0x02,
+        CONE    = 0x04,
+    };
+
+    struct GPUInstance {
+        Matrix4  worldMatrix;
+        Vector4  boundCenter;  // world space, w unused
+        Vector4  boundExtent;  // world space half size, w unused
+
+        uint32_t indexCount    = 0;
+        uint32_t firstIndex    = 0;
+        int32_t  vertexOffset  = 0;
+        uint32_t commandIndex  = 0;
+        uint32_t meshletOffset = 0;
+        uint32_t meshletCount  = 0;
+        uint32_t flags         = 0;
+        uint32_t padding       = 0;
+    };
+    static_assert(sizeof(GPUInstance) == 128);
+
+    struct GPUCullConstants {
+        Vector4  planes[6];    // xyz: outward normal, w: distance
+        Vector4  viewPos;
+        Matrix4  viewProject;
+        Vector4  hizSize;      // xy: size of mip 0, z: mip count
+        uint32_t instanceCount = 0;
+        uint32_t flags         = 0;
+        uint32_t padding[2]    = {0, 0};
+    };
+    static_assert(sizeof(GPUCullConstants) == 208);
+
+    // layout of the draw count buffer, the culling kernel counts every rejected instance by its failing test.
+    struct GPUCullStats {
+        uint32_t visible           = 0;
+        uint32_t frustumRejected   = 0;
+        uint32_t occlusionRejected = 0;
+        uint32_t padding           = 0;
+    };
+    static_assert(sizeof(GPUCullStats) == 16);
+
+    // layout of VkDrawIndexedIndirectCommand.
+    using GPUDrawCommand = rhi::CmdDrawIndexed;
+    static_assert(sizeof(GPUDrawCommand) == 20);
+
+    // max reduced depth pyramid, depth is expected in [0, 1] with 1 at the far plane.
+    class HizPyramid {
+    public:
+        HizPyramid() = default;
+        ~HizPyramid() = default;
+
+        void Build(const float *depth, uint32_t width, uint32_t height);
+
+        // furthest depth covered by texels [x0, x1] x [y0, y1] of one mip.
+        float Fetch(uint32_t mip, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) const;
+
+        uint32_t GetMipCount() const { return static_cast<uint32_t>(mips.size()); }
+        uint32_t GetWidth(uint32_t mip) const { return mips[mip].width; }
+        uint32_t GetHeight(uint32_t mip) const { return mips[mip].height; }
+
+    private:
+        struct Mip {
+            uint32_t width  = 0;
+            uint32_t height = 0;
+            std::vector<float> data;
+        };
+        std::vector<Mip> mips;
+    };
+
+    void FillCullConstants(GPUCullConstants &constants, const Frustum &frustum, const Matrix4 &viewProject, const Vector3 &viewPos);
+
+    bool GPUFrustumTest(const GPUCullConstants &constants, const Vector4 &center, const Vector4 &extent);
+
+    // false if the box lies entirely behind the furthest depth of the pyramid texels it covers.
+    bool GPUHizTest(const GPUCullConstants &constants, const HizPyramid &hiz, const Vector4 &center, const Vector4 &extent);
+
+    // false if every triangle of the meshlet faces away from the view.
+    bool GPUConeTest(const GPUCullConstants &constants, const GPUInstance &instance, const Meshlet &meshlet);
+
+    // instance pass, one command per instance at its commandIndex.
+    // culled instances keep their command with instanceCount 0, returns the number of visible instances.
+    uint32_t GPUCullInstances(const GPUCullConstants &constants, const GPUInstance *instances,
+                              const HizPyramid *hiz, GPUDrawCommand *commands, GPUCullStats *stats = nullptr);
+
+    // meshlet pass of one instance, appends visible meshlet indices relative to meshletOffset.
+    uint32_t GPUCullMeshlets(const GPUCullConstants &constants, const GPUInstance &instance, const Meshlet *meshlets,
+                             const HizPyramid *hiz, uint32_t *visible);
+
+} // namespace sky
@@ -0,0 +1,85 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <render/GPUCulling.h>
+#include <render/RenderPrimitive.h>
+#include <render/resource/Buffer.h>
+#include <vector>
+
+namespace sky {
+    class SceneView;
+    namespace rdg {
+        struct RenderGraph;
+    } // namespace rdg
+
+    // static primitives packed into one gpu instance buffer.
+    // draw arguments are written by the culling compute pass, every primitive owns one indirect command.
+    class GPUScene {
+    public:
+        GPUScene() = default;
+        ~GPUScene() = default;
+
+        static constexpr std::string_view INSTANCE_BUFFER = "GPUScene_Instances";
+        static constexpr std::string_view COMMAND_BUFFER  = "GPUScene_Commands";
+        static constexpr std::string_view COUNT_BUFFER    = "GPUScene_DrawCount";
+        static constexpr std::string_view CULL_CONSTANTS  = "GPUScene_CullConstants";
+
+        // only primitives with a single indexed draw are accepted.
+        bool AddPrimitive(RenderPrimitive *primitive);
+        void RemovePrimitive(RenderPrimitive *primitive);
+
+        // transform or bounds changed, the instance is uploaded by the next Setup.
+        void UpdatePrimitive(RenderPrimitive *primitive);
+
+        // depth pyramid of an earlier frame for the HIZ test, viewProject is the matrix the pyramid was rendered with.
+        void SetOcclusion(const Matrix4 &viewProject, uint32_t width, uint32_t height, uint32_t mipCount);
+
+        // upload dirty instances and import the gpu buffers into the graph.
+        void Setup(rdg::RenderGraph &rdg, const SceneView &view, uint32_t cullFlags);
+
+        // counters of a finished frame, written back by the readback of the draw count buffer.
+        void SetCullStats(const GPUCullStats &stats) { cullStats = stats; }
+        const GPUCullStats &GetCullStats() const { return cullStats; }
+
+        // view the commands are culled for, nullptr if no culling pass was recorded this frame.
+        const SceneView *GetCullView() const { return cullView; }
+        void ResetCullView() { cullView = nullptr; }
+
+        uint32_t GetInstanceCount() const { return static_cast<uint32_t>(primitives.size()); }
+        uint32_t GetUploadCount() const { return uploadCount; }
+        bool Contains(const RenderPrimitive *primitive) const;
+
+    private:
+        static void FillInstance(GPUInstance &instance, const RenderPrimitive &primitive, uint32_t slot);
+
+        void MarkDirty(uint32_t slot);
+        void Resize(uint32_t count);
+        void UploadDirty(rdg::RenderGraph &rdg);
+
+        std::vector<RenderPrimitive*> primitives;
+        std::vector<GPUInstance> instances;
+        std::vector<uint32_t> dirtySlots;
+        std::vector<uint8_t> dirtyFlags;
+
+        RDBufferPtr instanceBuffer;
+        RDBufferPtr commandBuffer;
+        RDBufferPtr countBuffer;
+        RDDynamicBuffer staging;
+        RDUniformBufferPtr constants;
+
+        const SceneView *cullView = nullptr;
+
+        Matrix4 hizViewProject = Matrix4::Identity();
+        Vector4 hizSize;
+        GPUCullStats cullStats;
+
+        uint32_t capacity = 0;
+        uint32_t stagingCapacity = 0;
+        uint32_t uploadCount = 0;
+        bool fullUpload = false;
+    };
+
+} // namespace sky
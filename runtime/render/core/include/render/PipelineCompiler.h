@@ -0,0 +1,130 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <taskflow/taskflow.hpp>
+#include <core/file/FileSystem.h>
+#include <render/resource/Technique.h>
+
+namespace sky {
+
+    // everything needed to build a pipeline again in a later session.
+    struct PipelineVariant {
+        Name technique;
+        ShaderVariantKey key;
+        bool meshShading = false;
+        rhi::PrimitiveTopology topo = rhi::PrimitiveTopology::TRIANGLE_LIST;
+        rhi::PolygonMode polygonMode = rhi::PolygonMode::FILL;
+        uint32_t passHash = 0;
+        uint32_t subPassID = 0;
+        std::vector<rhi::VertexAttributeDesc> attributes; // semantic names are not kept.
+        std::vector<rhi::VertexBindingDesc> bindings;
+    };
+
+    struct PipelineRequest {
+        RDProgramPtr program;
+        rhi::PipelineState state;
+        rhi::VertexInputPtr vertexDesc;
+        uint32_t vertexHash = 0;
+        rhi::RenderPassPtr pass;
+        uint32_t subPassID = 0;
+    };
+
+    // graphics pipelines keyed by program, pipeline state, vertex layout and compatible render pass.
+    // missing pipelines are built by background jobs, the requester gets nothing until the job has finished.
+    class PipelineCompiler {
+    public:
+        PipelineCompiler();
+        ~PipelineCompiler();
+
+        using TechniqueResolver = std::function<RDGfxTechPtr(const Name &)>;
+        using PipelineBuilder = std::function<rhi::GraphicsPipelinePtr(const PipelineRequest &)>;
+
+        // returns the pipeline when it is ready, otherwise a compile job is queued.
+        // variant is recorded for the next session when it is provided.
+        rhi::GraphicsPipelinePtr RequestPso(const PipelineRequest &request, const PipelineVariant *variant = nullptr);
+
+        // builds on the calling thread, used by the fallback technique.
+        rhi::GraphicsPipelinePtr RequestPsoSync(const PipelineRequest &request);
+
+        // batches with a pending pipeline are drawn with this technique, skipped when it is empty.
+        // the fallback shader has to read its vertex inputs from the layout of the batch it replaces.
+        void SetFallbackTechnique(const RDGfxTechPtr &tech) { fallback = tech; }
+        const RDGfxTechPtr &GetFallbackTechnique() const { return fallback; }
+
+        // replaces GraphicsTechnique::BuildPso, empty restores it.
+        void SetBuilder(const PipelineBuilder &func) { builder = func; }
+
+        // synchronous compile on backends that can not create pipelines on worker threads.
+        void SetAsync(bool enable) { async = enable; }
+        bool IsAsync() const { return async; }
+
+        uint32_t GetPendingCount() const { return pending.load(); }
+        void WaitIdle();
+
+        // programs are resolved on the calling thread, pipelines are compiled once a render pass with the same hash shows up.
+        void Prewarm(const std::vector<PipelineVariant> &variants, const TechniqueResolver &resolver);
+
+        // queues a resolved request until a render pass with the compatible hash is requested.
+        void Defer(uint32_t passHash, PipelineRequest &&request);
+        std::vector<PipelineVariant> GetCapturedVariants() const;
+
+        bool SaveVariants(const FilePath &path) const;
+        static bool LoadVariants(const FilePath &path, std::vector<PipelineVariant> &variants);
+
+        static uint32_t HashVertexLayout(const std::vector<rhi::VertexAttributeDesc> &attributes, const std::vector<rhi::VertexBindingDesc> &bindings);
+        static uint32_t HashPipelineState(const rhi::PipelineState &state);
+
+    private:
+        struct PipelineKey {
+            const Program *program;
+            uint32_t stateHash;
+            uint32_t vertexHash;
+            uint32_t passHash;
+            uint32_t subPassID;
+
+            bool operator==(const PipelineKey &rhs) const
+            {
+                return program == rhs.program && stateHash == rhs.stateHash && vertexHash == rhs.vertexHash &&
+                    passHash == rhs.passHash && subPassID == rhs.subPassID;
+            }
+        };
+
+        struct PipelineKeyHash {
+            size_t operator()(const PipelineKey &key) const;
+        };
+
+        struct PipelineEntry {
+            PipelineRequest request; // keeps program and vertex input alive while the key refers to them.
+            rhi::GraphicsPipelinePtr pso;
+            bool compiling = false;
+        };
+        using PipelineEntryPtr = std::shared_ptr<PipelineEntry>;
+
+        PipelineKey MakeKey(const PipelineRequest &request) const;
+        void Compile(const PipelineEntryPtr &entry);
+        void FlushDeferred(const rhi::RenderPassPtr &pass);
+
+        RDGfxTechPtr fallback;
+        PipelineBuilder builder;
+        bool async = true;
+
+        mutable std::mutex mutex;
+        std::unordered_map<PipelineKey, PipelineEntryPtr, PipelineKeyHash> pipelines;
+        std::unordered_map<PipelineKey, PipelineVariant, PipelineKeyHash> captured;
+
+        // pre-warmed requests waiting for a render pass, keyed by compatible hash.
+        std::unordered_map<uint32_t, std::vector<PipelineRequest>> deferred;
+
+        std::atomic<uint32_t> pending = 0;
+        tf::Executor executor;
+    };
+
+} // namespace sky
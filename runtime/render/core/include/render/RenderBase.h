@@ -42,6 +42,7 @@ namespace sky {
         SKIN         = 0x01,
         INSTANCE     = 0x02,
         MESH_SHADER  = 0x04,
+        AUTO_INSTANCE = 0x08,
     };
     using RenderVertexFlags = Flags<RenderVertexFlagBit>;
     ENABLE_FLAG_BIT_OPERATOR(RenderVertexFlagBit)
@@ -7,6 +7,9 @@
 #include <core/math/Matrix4.h>
 
 namespace sky {
+    // instances per auto instanced draw, matches MAX_AUTO_INSTANCE in default_local.hlslh.
+    static constexpr uint32_t MAX_AUTO_INSTANCE = 128;
+
     struct SceneViewInfo {
         Matrix4 world;
         Matrix4 view;
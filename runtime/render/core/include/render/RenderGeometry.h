@@ -42,6 +42,10 @@ namespace sky {
         void FillVertexBuffer(std::vector<rhi::BufferView> &vbs);
         rhi::VertexAssemblyPtr Request(const RDProgramPtr& program, rhi::VertexInputPtr &vtxDesc);
         rhi::VertexInputPtr    Request(const RDProgramPtr& program);
+
+        // vertex layout the program reads from this geometry, false when a stream is missing.
+        bool FillVertexDesc(const RDProgramPtr& program,
+            std::vector<rhi::VertexAttributeDesc> &attributes, std::vector<rhi::VertexBindingDesc> &bindings) const;
         void Reset();
         void Upload();
         bool IsReady() const;
@@ -0,0 +1,47 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <render/RenderBuiltinLayout.h>
+#include <render/resource/Buffer.h>
+#include <render/resource/ResourceGroup.h>
+
+namespace sky {
+
+    // per frame instance data of auto instanced draws.
+    // every draw reads up to MAX_AUTO_INSTANCE entries through a dynamic offset on the instance set.
+    class RenderInstanceStream {
+    public:
+        RenderInstanceStream() = default;
+        ~RenderInstanceStream() = default;
+
+        // switch to the region of the next inflight frame, once per frame.
+        void Reset();
+
+        // make room for count instances drawn with at most drawCount draws.
+        void Reserve(uint32_t count, uint32_t drawCount);
+
+        // allocate count consecutive instances, returns the byte offset inside the frame region.
+        uint32_t Allocate(uint32_t count);
+        void Write(uint32_t offset, uint32_t index, const InstanceLocal &data);
+
+        void OnBind(rhi::GraphicsEncoder &encoder, uint32_t offset) const;
+
+        uint32_t GetUsedSize() const { return cursor; }
+
+    private:
+        void Resize(uint32_t size);
+
+        RDDynamicBuffer buffer;
+        RDResourceLayoutPtr layout;
+        RDResourceGroupPtr resourceGroup;
+        rhi::DescriptorSetPoolPtr pool;
+
+        uint32_t alignment = 256;
+        uint32_t capacity  = 0;
+        uint32_t cursor    = 0;
+    };
+
+} // namespace sky
@@ -7,6 +7,7 @@
 #include <core/shapes/AABB.h>
 #include <core/std/Container.h>
 #include <render/RenderDrawArgs.h>
+#include <render/RenderBuiltinLayout.h>
 #include <render/RenderGeometry.h>
 #include <render/resource/Material.h>
 #include <render/resource/ResourceGroup.h>
@@ -43,6 +44,9 @@ namespace sky {
 
         uint32_t valueVersion = ~(0U);
         uint32_t batchVersion = ~(0U);
+
+        // pipeline is still compiling, pso holds the fallback or nothing.
+        bool psoPending = false;
     };
 
     struct RenderPrimitive {
@@ -68,10 +72,14 @@ namespace sky {
 
         std::vector<DrawArgs> args;
         rhi::BufferPtr        indirectBuffer;
+        uint32_t              indirectOffset = 0;
 
         // shader resources
         RDResourceGroupPtr instanceSet;
 
+        // instance data read from the instance stream by auto instanced draws.
+        InstanceLocal instanceData = {Matrix4::Identity(), Matrix4::Identity()};
+
         // cache object
         uint32_t vaoVersion = ~(0U);
         std::vector<RenderBatch> batches;
@@ -89,6 +97,11 @@ namespace sky {
     struct RenderDrawItem {
         RenderPrimitive *primitive = nullptr;
         uint32_t techIndex = 0;
+
+        // auto instanced draw, instances are read from the instance stream at instanceOffset.
+        // 0 for a regular draw of the primitive.
+        uint32_t instanceCount  = 0;
+        uint32_t instanceOffset = 0;
     };
 
 } // namespace sky
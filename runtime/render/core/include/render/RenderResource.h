@@ -7,6 +7,7 @@
 #include <core/template/ReferenceObject.h>
 #include <core/name/Name.h>
 #include <core/util/Uuid.h>
+#include <core/file/AsyncFileIO.h>
 #include <rhi/Stream.h>
 #include <rhi/Queue.h>
 #include <string>
@@ -54,8 +55,66 @@ namespace sky {
             return uploadQueue != nullptr && uploadQueue->HasComplete(uploadHandle);
         }
 
+        // reads file backed sources ahead on the async io service, the upload picks the bytes up afterwards.
+        // mapped files are only paged in ahead, the upload copies straight from the mapping.
+        void Prefetch()
+        {
+            if (prefetches.empty()) {
+                PrefetchImpl();
+            }
+        }
+
+        bool IsPrefetched() const
+        {
+            for (const auto &read : prefetches) {
+                if (read && !read->IsDone()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
     protected:
         virtual uint64_t UploadImpl() = 0;
+        virtual void PrefetchImpl() {}
+
+        // one entry per request, empty for sources that are already in memory or mapped.
+        template <typename Request>
+        void PrefetchRequest(const Request &request)
+        {
+            auto *stream = request.source ? request.source->AsFileStream() : nullptr;
+            if (stream == nullptr || request.size == 0) {
+                prefetches.emplace_back();
+                return;
+            }
+            if (stream->Data(0) != nullptr) {
+                stream->WillNeed(request.offset, request.size);
+                prefetches.emplace_back();
+                return;
+            }
+
+            FileReadRequest read = {};
+            read.file   = stream->GetFile();
+            read.offset = stream->GetBaseOffset() + request.offset;
+            read.size   = request.size;
+            prefetches.emplace_back(AsyncFileIO::Get()->Read(std::move(read)));
+        }
+
+        // failed reads keep the original source, the upload then reads the file itself.
+        template <typename Request>
+        static void ApplyPrefetch(Request &request, const AsyncReadPtr &read)
+        {
+            if (!read) {
+                return;
+            }
+            read->Wait();
+            if (read->GetStatus() == IOStatus::SUCCESS && read->GetBytes() == request.size) {
+                request.source = new rhi::BinaryDataStream(read->GetData());
+                request.offset = 0;
+            }
+        }
+
+        std::vector<AsyncReadPtr> prefetches;
 
         Uuid resID;
         rhi::Queue* uploadQueue = nullptr;
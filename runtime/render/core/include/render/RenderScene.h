@@ -6,7 +6,10 @@
 
 #include <vector>
 #include <core/std/Container.h>
+#include <core/memory/Allocator.h>
 #include <render/SceneView.h>
+#include <render/SceneCulling.h>
+#include <render/GPUScene.h>
 #include <render/RenderPrimitive.h>
 #include <render/RenderPipeline.h>
 #include <render/FeatureProcessor.h>
@@ -31,6 +34,9 @@ namespace sky {
         void RemovePrimitive(RenderPrimitive *primitive);
 
         const PmrVector<RenderPrimitive *> &GetPrimitives() const { return primitives; }
+        SceneCulling &GetCulling() { return culling; }
+        GPUScene &GetGPUScene() { return gpuScene; }
+
         void AddFeature(IFeatureProcessor *feature);
 
         const RenderPipelineFlags &GetRenderPipelineFlags() const { return renderFlags; }
@@ -49,7 +55,7 @@ namespace sky {
         RenderScene();
         ~RenderScene();
 
-        PmrUnSyncPoolRes resources;
+        PmrUnSyncPoolRes resources{SystemAllocator::Get()->GetMemoryResource(MemoryTag::SCENE)};
 
         uint32_t viewCounter = 0;
 
@@ -58,6 +64,8 @@ namespace sky {
 
         PmrHashMap<Name, SceneView*> viewMap;
         PmrVector<RenderPrimitive *> primitives;
+        SceneCulling culling;
+        GPUScene gpuScene;
 
         RenderPipelineFlags renderFlags;
     };
@@ -8,6 +8,7 @@
 #include <core/name/Name.h>
 #include <render/resource/Technique.h>
 #include <unordered_map>
+#include <mutex>
 
 namespace sky {
 
@@ -20,6 +21,7 @@ namespace sky {
         RDGfxTechPtr FetchGfxTechnique(const Name &name);
 
     private:
+        std::mutex mutex;
         std::unordered_map<Name, RDGfxTechPtr> techniques;
     };
 
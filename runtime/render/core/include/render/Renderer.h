@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <core/environment/Singleton.h>
+#include <core/memory/FrameAllocator.h>
 
 #include <rhi/Device.h>
 #include <rhi/Instance.h>
@@ -20,6 +21,7 @@
 #include <render/FeatureProcessor.h>
 #include <render/RenderStreamManager.h>
 #include <render/RenderPipeline.h>
+#include <render/PipelineCompiler.h>
 #include <render/resource/MaterialManager.h>
 
 namespace sky {
@@ -48,12 +50,25 @@ namespace sky {
         RenderResourceGC *GetResourceGC() const;
         RenderStreamManager *GetStreamingManager() const { return streamManager.get(); }
         MaterialManager *GetMaterialManager() const { return materialManager.get(); }
+        PipelineCompiler *GetPipelineCompiler() const { return pipelineCompiler.get(); }
+
+        // transient memory of the frame being built, recycled after the inflight frames in AfterRender.
+        FrameAllocator *GetFrameAllocator() { return &frameAllocator; }
+        const FrameAllocatorStats &GetFrameAllocatorStats() const { return frameAllocator.GetLastFrameStats(); }
+        uint64_t GetHeapAllocationsPerFrame() const { return frameHeapAllocations; }
 
         const RenderDefaultResource &GetDefaultResource() const { return defaultResource; }
 
         void SetCacheFolder(const std::string &path) { cacheFolder = path; }
         const std::string &GetCacheFolder() const { return cacheFolder; }
 
+        // pipeline library persisted in the cache folder, one file per device and driver version.
+        void LoadPipelineLibrary();
+        void SavePipelineLibrary() const;
+
+        // compile the pipeline variants captured by the last session.
+        void PrewarmPipelines(const PipelineCompiler::TechniqueResolver &resolver);
+
         void SetShaderCompiler(ShaderCompileFunc func) { shaderCompiler = func; }
         ShaderCompileFunc GetShaderCompiler() const { return shaderCompiler; }
 
@@ -78,7 +93,10 @@ namespace sky {
 
         rhi::Device *device = nullptr;
 
-        PmrUnSyncPoolRes mainPool;
+        PmrUnSyncPoolRes mainPool{SystemAllocator::Get()->GetMemoryResource(MemoryTag::RENDER)};
+        FrameAllocator frameAllocator;
+        uint64_t frameHeapAllocations = 0;
+        uint64_t totalHeapAllocations = 0;
 
         uint32_t totalFrame = 0;
         uint32_t inflightFrameCount = 2;
@@ -89,9 +107,11 @@ namespace sky {
         PmrList<std::unique_ptr<RenderWindow, decltype(&Renderer::DestroyObj<RenderWindow>)>> windows;
         PmrVector<std::unique_ptr<RenderResourceGC>> delayReleaseCollections;
         PmrVector<std::unique_ptr<IFeatureProcessorBuilder>> features;
+        std::vector<RenderScene*> renderScenes; // reused every frame.
 
         std::unique_ptr<RenderStreamManager> streamManager;
         std::unique_ptr<MaterialManager> materialManager;
+        std::unique_ptr<PipelineCompiler> pipelineCompiler;
         std::unique_ptr<RenderPipeline> pipeline;
 
         ShaderCompileFunc shaderCompiler = nullptr;
@@ -0,0 +1,77 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/shapes/FrustumCulling.h>
+#include <core/std/Container.h>
+#include <render/GPUCulling.h>
+#include <vector>
+
+namespace sky {
+    class SceneView;
+    struct RenderPrimitive;
+
+    // per scene culling stage, world bounds are kept as SoA and each scene view is culled once per build.
+    // visibility bitsets are indexed by primitive order in RenderScene::GetPrimitives().
+    class SceneCulling {
+    public:
+        explicit SceneCulling(PmrResource *resource);
+        ~SceneCulling() = default;
+
+        struct Stats {
+            uint32_t tested            = 0;
+            uint32_t frustumRejected   = 0;
+            uint32_t occlusionRejected = 0;
+        };
+
+        // refresh bounds and ready state, drops visibility of the last build.
+        void Update(const PmrVector<RenderPrimitive *> &primitives);
+
+        // occlusion test of the view for the next build, the pyramid must stay alive until then.
+        // viewProject is the matrix the pyramid was rendered with, boxes are reprojected into that frame.
+        void SetOcclusion(const SceneView *view, const HizPyramid *hiz, const Matrix4 &viewProject);
+
+        // ready primitives visible in any frustum of the view and not occluded.
+        const uint64_t *GetVisibility(const SceneView *view);
+
+        // primitives rejected by the occlusion test of the last build, nullptr if the view was not culled.
+        const uint64_t *GetOccluded(const SceneView *view) const;
+
+        // counters of every view culled since the last update.
+        const Stats &GetStats() const { return stats; }
+
+        // ready primitives, used by queues without culling.
+        const uint64_t *GetReadyMask() const { return ready.data(); }
+
+        uint32_t GetPrimitiveCount() const { return bounds.Size(); }
+        uint32_t GetWordCount() const { return static_cast<uint32_t>(ready.size()); }
+
+        void Cull(const Frustum *frustums, uint32_t count, uint64_t *visibility) const;
+
+    private:
+        struct ViewVisibility {
+            uint32_t version = 0;
+            std::vector<uint64_t> bits;
+            std::vector<uint64_t> occluded;
+        };
+
+        struct Occluder {
+            uint32_t version = 0;
+            const HizPyramid *hiz = nullptr;
+            GPUCullConstants constants;
+        };
+
+        void Occlude(const Occluder &occluder, ViewVisibility &visibility);
+
+        AABBSoA bounds;
+        std::vector<uint64_t> ready;
+
+        uint32_t version = 0;
+        PmrHashMap<const SceneView *, ViewVisibility> views;
+        PmrHashMap<const SceneView *, Occluder> occluders;
+        Stats stats;
+    };
+
+} // namespace sky
@@ -33,6 +33,7 @@ namespace sky {
         const Matrix4 &GetViewProject() const { return viewInfo[0].viewProject; }
 
         bool FrustumCulling(const AABB &aabb) const;
+        const PmrVector<Frustum> &GetFrustums() const { return frustums; }
 
         uint32_t GetViewID() const { return viewID; }
         uint32_t GetViewCount() const { return viewCount; }
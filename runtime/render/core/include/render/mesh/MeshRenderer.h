@@ -30,6 +30,9 @@ namespace sky {
         void SetMesh(const RDMeshPtr &mesh, bool meshShading = false);
         void SetDebugFlags(const MeshDebugFlags& flag);
 
+        // static primitives are culled and drawn through the gpu scene, applied by the next SetMesh.
+        void SetGPUDriven(bool enable) { gpuDriven = enable; }
+
         void UpdateTransform(const Matrix4 &matrix);
 
         void BuildGeometry();
@@ -54,6 +57,7 @@ namespace sky {
         RDDynamicUniformBufferPtr ubo;
 
         bool enableMeshShading = false;
+        bool gpuDriven = false;
         RenderGeometryPtr ownGeometry;
         MeshDebugFlags debugFlags;
 
@@ -25,6 +25,7 @@ namespace sky::rdg {
         RasterQueueBuilder &SetRasterID(const Name &id);
         RasterQueueBuilder &SetLayout(const RDResourceLayoutPtr &layout);
         RasterQueueBuilder &SetView(SceneView *view);
+        RasterQueueBuilder &SetSort(RasterQueueSort sort);
 
         RenderGraph &rdg;
         RasterQueue &queue;
@@ -73,6 +74,11 @@ namespace sky::rdg {
 
     struct ComputePassBuilder {
         ComputePassBuilder &AddComputeView(const Name &name, const ComputeView &view);
+        ComputePassBuilder &AddSamplerView(const Name &name, const Name& viewName);
+        ComputePassBuilder &AddIndirectOutput(const Name &name);
+        ComputePassBuilder &SetLayout(const RDResourceLayoutPtr &layout);
+        ComputePassBuilder &SetPipeline(const rhi::ComputePipelinePtr &pso);
+        ComputePassBuilder &Dispatch(uint32_t x, uint32_t y, uint32_t z);
 
         RenderGraph &rdg;
         ComputePass &compute;
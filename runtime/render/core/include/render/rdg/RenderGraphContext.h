@@ -13,6 +13,7 @@
 #include <render/rdg/RenderGraphTypes.h>
 #include <render/rdg/RenderGraphData.h>
 #include <render/resource/ResourceGroup.h>
+#include <render/RenderInstanceStream.h>
 
 namespace sky::rhi {
     class Device;
@@ -36,7 +37,7 @@ namespace sky::rdg {
         }
 
         tf::Executor executor;
-        PmrUnSyncPoolRes resources;
+        PmrResource *resources = nullptr; // frame arena of the renderer, graph data is dropped with the frame.
         std::unique_ptr<TransientPool> pool;
 
         rhi::Device *device = nullptr;
@@ -46,6 +47,7 @@ namespace sky::rdg {
         LinearStorage transientStorage { RDG_TRANSIENT_BLOCK_SIZE }; // storage for frame data, pod only.
 
         RenderGraphData rdgData;
+        RenderInstanceStream instanceStream;
 
         uint32_t frameIndex = 0;
         RDResourceGroupPtr emptySet;
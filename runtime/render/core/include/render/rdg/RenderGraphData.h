@@ -12,10 +12,42 @@ namespace sky::rdg {
         uint32_t triangleData;
         uint32_t drawCall;
 
+        // state changes issued and skipped by the raster queue executor.
+        uint32_t pipelineBind;
+        uint32_t pipelineBindSkipped;
+        uint32_t resourceBindSkipped;
+
+        // draw items folded into auto instanced draws.
+        uint32_t mergedDraw;
+
+        // draws whose arguments were written by gpu culling.
+        uint32_t indirectDraw;
+
+        // secondary command buffers recorded on worker threads.
+        uint32_t parallelChunk;
+
         void Reset()
         {
             triangleData = 0;
             drawCall = 0;
+            pipelineBind = 0;
+            pipelineBindSkipped = 0;
+            resourceBindSkipped = 0;
+            mergedDraw = 0;
+            indirectDraw = 0;
+            parallelChunk = 0;
+        }
+
+        void Accumulate(const RenderGraphData &other)
+        {
+            triangleData += other.triangleData;
+            drawCall += other.drawCall;
+            pipelineBind += other.pipelineBind;
+            pipelineBindSkipped += other.pipelineBindSkipped;
+            resourceBindSkipped += other.resourceBindSkipped;
+            mergedDraw += other.mergedDraw;
+            indirectDraw += other.indirectDraw;
+            parallelChunk += other.parallelChunk;
         }
     };
 
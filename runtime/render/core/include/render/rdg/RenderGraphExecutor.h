@@ -21,10 +21,16 @@ namespace sky::rdg {
 
         void Barriers(const PmrHashMap<VertexType, std::vector<GraphBarrier>>& barriers) const;
 
+        // a pass is recorded into secondary command buffers when one of its queues is large enough to split.
+        bool UseParallelRecord(Vertex pass) const;
+        void ExecuteQueue(const RasterQueue &queue);
+        void EncodeQueue(const RasterQueue &queue, size_t begin, size_t end, rhi::GraphicsEncoder &encoder, RenderGraphData &stat) const;
+
         RenderGraph &graph;
         std::shared_ptr<rhi::GraphicsEncoder> currentEncoder;
         uint32_t currentSubPassIndex = 0;
         uint32_t currentSubPassNum = 1;
+        bool parallelPass = false;
         std::vector<Name> callStack;
     };
 
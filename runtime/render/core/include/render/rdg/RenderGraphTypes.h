@@ -44,6 +44,13 @@ namespace sky::rdg {
     enum class PresentType {
         PRESENT
     };
+
+    // draw item order of a raster queue.
+    enum class RasterQueueSort : uint8_t {
+        NONE,          // keep scene order
+        FRONT_TO_BACK, // group by pipeline and resources first, near to far inside the same states
+        BACK_TO_FRONT, // far to near first, for blending
+    };
     using AttachmentType = std::variant<RasterType, ComputeType, TransferType, PresentType>;
 
     enum class ResourceAccessBit : uint32_t {
@@ -213,8 +220,9 @@ namespace sky::rdg {
             : sceneView(nullptr)
             , passID(pass)
             , drawItems(res)
-            , sort(false)
+            , sort(RasterQueueSort::NONE)
             , culling(true)
+            , indirect(false)
         {}
 
         using Tag = RasterQueueTag;
@@ -222,12 +230,15 @@ namespace sky::rdg {
         const SceneView *sceneView;
         uint32_t passID;
         Name rasterID;   // invalid id
-        PmrList<RenderDrawItem> drawItems;
+        PmrVector<RenderDrawItem> drawItems;
         RDResourceLayoutPtr layout;
         ResourceGroup *resourceGroup = nullptr;
 
-        bool sort;
+        RasterQueueSort sort;
         bool culling;
+
+        // draw gpu scene primitives with the indirect commands culled for this view.
+        bool indirect;
     };
 
     struct RasterPass {
@@ -267,6 +278,7 @@ namespace sky::rdg {
             : computeViews(res)
             , frontBarriers(res)
             , rearBarriers(res)
+            , indirectOutputs(res)
             {}
 
         using Tag = ComputePassTag;
@@ -274,8 +286,16 @@ namespace sky::rdg {
         PmrHashMap<VertexType, std::vector<GraphBarrier>> frontBarriers; // key resID
         PmrHashMap<VertexType, std::vector<GraphBarrier>> rearBarriers;  // key resID
 
+        // buffers written by the dispatch and consumed as indirect arguments by later draws.
+        PmrVector<VertexType> indirectOutputs;
+
         RDResourceLayoutPtr layout;
         ResourceGroup *resourceGroup = nullptr;
+
+        rhi::ComputePipelinePtr pso;
+        uint32_t groupX = 0;
+        uint32_t groupY = 1;
+        uint32_t groupZ = 1;
     };
 
     struct CopyBlitPass {
@@ -5,16 +5,51 @@
 #pragma once
 
 #include <render/renderpass/PassBase.h>
+#include <render/resource/Technique.h>
 
 namespace sky {
 
+    namespace rdg {
+        struct ComputePassBuilder;
+    } // namespace rdg
+
     class ComputePass : public PassBase {
     public:
-        explicit ComputePass(const Name &name_) : PassBase(name_) {}
+        explicit ComputePass(const Name &name_, const RDCompTechPtr &tech) // NOLINT
+            : PassBase(name_)
+            , technique(tech)
+        {}
         ~ComputePass() override = default;
 
+        void Setup(rdg::RenderGraph &rdg, RenderScene &scene) override;
+
+        // pso is missing on backends without compute support.
+        bool IsReady();
+
+    protected:
+        virtual void SetupCompute(rdg::ComputePassBuilder &builder, RenderScene &scene) {}
+
+        struct ComputeResource {
+            Name name;
+            rdg::ComputeView computeView;
+        };
+
+        struct SamplerResource {
+            Name name;
+            Name viewName;
+        };
+
+        std::vector<ComputeResource> computeResources;
+        std::vector<SamplerResource> samplers;
+
+        uint32_t groupX = 1;
+        uint32_t groupY = 1;
+        uint32_t groupZ = 1;
+
     private:
-        RDGfxTechPtr technique;
+        RDCompTechPtr technique;
+        RDProgramPtr program;
+        rhi::ComputePipelinePtr pso;
     };
 
-} // namespace sky
\ No newline at end of file
+} // namespace sky
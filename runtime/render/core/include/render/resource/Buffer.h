@@ -46,6 +46,7 @@ namespace sky {
 
     protected:
         uint64_t UploadImpl() override;
+        void PrefetchImpl() override;
 
         rhi::Device *device = nullptr;
         rhi::Buffer::Descriptor bufferDesc = {};
@@ -56,6 +56,7 @@ namespace sky {
         void SetRasterTag(const Name &tag);
         void AddVertexFlag(RenderVertexFlagBit flagBit, const Name &key);
         void ProcessVertexVariantKey(const RenderVertexFlags& flags, ShaderVariantKey &key);
+        bool HasVertexFlag(RenderVertexFlagBit flagBit) const { return vertexFlags.find(flagBit) != vertexFlags.end(); }
 
         RDProgramPtr RequestProgram(const ShaderVariantKey &key, bool meshShading = false);
 
@@ -84,6 +85,8 @@ namespace sky {
         ~ComputeTechnique() override = default;
 
         RDProgramPtr RequestProgram(const ShaderVariantKey &key);
+
+        static rhi::ComputePipelinePtr BuildPso(const RDProgramPtr &program);
     private:
         RDProgramPtr FillProgramInternal(const ShaderVariantKey &key);
 
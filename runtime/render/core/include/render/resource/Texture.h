@@ -35,6 +35,7 @@ namespace sky {
         const rhi::ImagePtr &GetImage() const { return image; }
     protected:
         uint64_t UploadImpl() override;
+        void PrefetchImpl() override;
 
         rhi::Device *device = nullptr;
         rhi::Image::Descriptor imageDesc = {};
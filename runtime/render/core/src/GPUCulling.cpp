@@ -0,0 +1,240 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <render/GPUCulling.h>
+#include <algorithm>
+#include <cmath>
+
+namespace sky {
+
+    static bool TestFlag(uint32_t flags, GPUCullFlagBit bit)
+    {
+        return (flags & static_cast<uint32_t>(bit)) != 0;
+    }
+
+    static bool TestFlag(uint32_t flags, GPUInstanceFlagBit bit)
+    {
+        return (flags & static_cast<uint32_t>(bit)) != 0;
+    }
+
+    void HizPyramid::Build(const float *depth, uint32_t width, uint32_t height)
+    {
+        mips.clear();
+
+        auto &base = mips.emplace_back();
+        base.width  = width;
+        base.height = height;
+        base.data.assign(depth, depth + static_cast<size_t>(width) * height);
+
+        while (mips.back().width > 1 || mips.back().height > 1) {
+            const auto &src = mips.back();
+
+            Mip dst;
+            dst.width  = std::max(1U, src.width / 2);
+            dst.height = std::max(1U, src.height / 2);
+            dst.data.resize(static_cast<size_t>(dst.width) * dst.height);
+
+            // odd sizes fold the last row / column into the border texel, the reduction stays conservative.
+            for (uint32_t y = 0; y < dst.height; ++y) {
+                uint32_t sy0 = y * src.height / dst.height;
+                uint32_t sy1 = ((y + 1) * src.height + dst.height - 1) / dst.height - 1;
+                for (uint32_t x = 0; x < dst.width; ++x) {
+                    uint32_t sx0 = x * src.width / dst.width;
+                    uint32_t sx1 = ((x + 1) * src.width + dst.width - 1) / dst.width - 1;
+
+                    float furthest = 0.f;
+                    for (uint32_t sy = sy0; sy <= sy1; ++sy) {
+                        for (uint32_t sx = sx0; sx <= sx1; ++sx) {
+                            furthest = std::max(furthest, src.data[sy * src.width + sx]);
+                        }
+                    }
+                    dst.data[y * dst.width + x] = furthest;
+                }
+            }
+            mips.emplace_back(std::move(dst));
+        }
+    }
+
+    float HizPyramid::Fetch(uint32_t mip, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) const
+    {
+        const auto &level = mips[mip];
+        x1 = std::min(x1, level.width - 1);
+        y1 = std::min(y1, level.height - 1);
+
+        float furthest = 0.f;
+        for (uint32_t y = y0; y <= y1; ++y) {
+            for (uint32_t x = x0; x <= x1; ++x) {
+                furthest = std::max(furthest, level.data[y * level.width + x]);
+            }
+        }
+        return furthest;
+    }
+
+    void FillCullConstants(GPUCullConstants &constants, const Frustum &frustum, const Matrix4 &viewProject, const Vector3 &viewPos)
+    {
+        for (uint32_t i = 0; i < 6; ++i) {
+            const auto &plane = frustum.planes[i];
+            constants.planes[i] = Vector4(plane.normal.x, plane.normal.y, plane.normal.z, plane.distance);
+        }
+        constants.viewPos     = Vector4(viewPos.x, viewPos.y, viewPos.z, 1.f);
+        constants.viewProject = viewProject;
+    }
+
+    bool GPUFrustumTest(const GPUCullConstants &constants, const Vector4 &center, const Vector4 &extent)
+    {
+        for (const auto &plane : constants.planes) {
+            float s = plane.x * center.x + plane.y * center.y + plane.z * center.z - plane.w;
+            float r = extent.x * std::abs(plane.x) + extent.y * std::abs(plane.y) + extent.z * std::abs(plane.z);
+            if (s > r) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool GPUHizTest(const GPUCullConstants &constants, const HizPyramid &hiz, const Vector4 &center, const Vector4 &extent)
+    {
+        float minX = 1.f;
+        float minY = 1.f;
+        float maxX = 0.f;
+        float maxY = 0.f;
+        float minZ = 1.f;
+
+        for (uint32_t i = 0; i < 8; ++i) {
+            Vector4 corner(center.x + ((i & 1) != 0 ? extent.x : -extent.x),
+                           center.y + ((i & 2) != 0 ? extent.y : -extent.y),
+                           center.z + ((i & 4) != 0 ? extent.z : -extent.z),
+                           1.f);
+            Vector4 clip = constants.viewProject * corner;
+
+            // box crosses the near plane, the projected rect is unbounded.
+            if (clip.w <= 1e-5f) {
+                return true;
+            }
+
+            float invW = 1.f / clip.w;
+            float u = clip.x * invW * 0.5f + 0.5f;
+            float v = clip.y * invW * 0.5f + 0.5f;
+            minX = std::min(minX, u);
+            minY = std::min(minY, v);
+            maxX = std::max(maxX, u);
+            maxY = std::max(maxY, v);
+            minZ = std::min(minZ, clip.z * invW);
+        }
+
+        minX = std::clamp(minX, 0.f, 1.f);
+        minY = std::clamp(minY, 0.f, 1.f);
+        maxX = std::clamp(maxX, 0.f, 1.f);
+        maxY = std::clamp(maxY, 0.f, 1.f);
+
+        // pick the mip where the rect spans at most two texels per axis.
+        float width  = (maxX - minX) * constants.hizSize.x;
+        float height = (maxY - minY) * constants.hizSize.y;
+        auto mipCount = static_cast<uint32_t>(constants.hizSize.z);
+        auto mip = static_cast<uint32_t>(std::ceil(std::log2(std::max(std::max(width, height), 1.f))));
+        mip = std::min(mip, mipCount - 1);
+
+        auto mipWidth  = static_cast<float>(hiz.GetWidth(mip));
+        auto mipHeight = static_cast<float>(hiz.GetHeight(mip));
+        auto x0 = static_cast<uint32_t>(minX * mipWidth);
+        auto y0 = static_cast<uint32_t>(minY * mipHeight);
+        auto x1 = static_cast<uint32_t>(maxX * mipWidth);
+        auto y1 = static_cast<uint32_t>(maxY * mipHeight);
+
+        return minZ <= hiz.Fetch(mip, x0, y0, x1, y1);
+    }
+
+    bool GPUConeTest(const GPUCullConstants &constants, const GPUInstance &instance, const Meshlet &meshlet)
+    {
+        // degenerated cone, triangles face every direction.
+        if (meshlet.coneAxis.w >= 0.99f) {
+            return true;
+        }
+
+        const auto &world = instance.worldMatrix;
+        Vector4 apex = world * Vector4(meshlet.coneApex.x, meshlet.coneApex.y, meshlet.coneApex.z, 1.f);
+        Vector4 axis4 = world * Vector4(meshlet.coneAxis.x, meshlet.coneAxis.y, meshlet.coneAxis.z, 0.f);
+
+        Vector3 axis(axis4.x, axis4.y, axis4.z);
+        axis.Normalize();
+        Vector3 view(apex.x - constants.viewPos.x, apex.y - constants.viewPos.y, apex.z - constants.viewPos.z);
+        view.Normalize();
+
+        return view.Dot(axis) < meshlet.coneAxis.w;
+    }
+
+    // returns the first failing test, NONE if the bounds are visible.
+    static GPUCullFlagBit CullBounds(const GPUCullConstants &constants, const HizPyramid *hiz, const Vector4 &center, const Vector4 &extent)
+    {
+        if (TestFlag(constants.flags, GPUCullFlagBit::FRUSTUM) && !GPUFrustumTest(constants, center, extent)) {
+            return GPUCullFlagBit::FRUSTUM;
+        }
+        if (hiz != nullptr && TestFlag(constants.flags, GPUCullFlagBit::HIZ) && !GPUHizTest(constants, *hiz, center, extent)) {
+            return GPUCullFlagBit::HIZ;
+        }
+        return GPUCullFlagBit::NONE;
+    }
+
+    uint32_t GPUCullInstances(const GPUCullConstants &constants, const GPUInstance *instances,
+                              const HizPyramid *hiz, GPUDrawCommand *commands, GPUCullStats *stats)
+    {
+        uint32_t visibleCount = 0;
+        for (uint32_t i = 0; i < constants.instanceCount; ++i) {
+            const auto &instance = instances[i];
+
+            bool valid  = TestFlag(instance.flags, GPUInstanceFlagBit::VALID);
+            auto result = valid ? CullBounds(constants, hiz, instance.boundCenter, instance.boundExtent) : GPUCullFlagBit::NONE;
+            bool visible = valid && result == GPUCullFlagBit::NONE;
+
+            auto &cmd = commands[instance.commandIndex];
+            cmd.indexCount    = instance.indexCount;
+            cmd.instanceCount = visible ? 1 : 0;
+            cmd.firstIndex    = instance.firstIndex;
+            cmd.vertexOffset  = instance.vertexOffset;
+            cmd.firstInstance = 0;
+
+            visibleCount += visible ? 1 : 0;
+
+            if (stats != nullptr) {
+                stats->visible += visible ? 1 : 0;
+                stats->frustumRejected += result == GPUCullFlagBit::FRUSTUM ? 1 : 0;
+                stats->occlusionRejected += result == GPUCullFlagBit::HIZ ? 1 : 0;
+            }
+        }
+        return visibleCount;
+    }
+
+    uint32_t GPUCullMeshlets(const GPUCullConstants &constants, const GPUInstance &instance, const Meshlet *meshlets,
+                             const HizPyramid *hiz, uint32_t *visible)
+    {
+        const auto &world = instance.worldMatrix;
+
+        // radius follows the largest axis scale of the instance.
+        float scale = 0.f;
+        for (uint32_t i = 0; i < 3; ++i) {
+            Vector3 axis(world[i].x, world[i].y, world[i].z);
+            scale = std::max(scale, axis.Length());
+        }
+
+        uint32_t visibleCount = 0;
+        for (uint32_t i = 0; i < instance.meshletCount; ++i) {
+            const auto &meshlet = meshlets[instance.meshletOffset + i];
+
+            Vector4 center = world * Vector4(meshlet.center.x, meshlet.center.y, meshlet.center.z, 1.f);
+            float radius = meshlet.center.w * scale;
+            Vector4 extent(radius, radius, radius, 0.f);
+
+            bool pass = CullBounds(constants, hiz, center, extent) == GPUCullFlagBit::NONE;
+            if (pass && TestFlag(constants.flags, GPUCullFlagBit::CONE) && TestFlag(instance.flags, GPUInstanceFlagBit::CONE_CULLING)) {
+                pass = GPUConeTest(constants, instance, meshlet);
+            }
+
+            if (pass) {
+                visible[visibleCount++] = i;
+            }
+        }
+        return visibleCount;
+    }
+
+} // namespace sky
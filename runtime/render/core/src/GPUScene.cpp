@@ -0,0 +1,240 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <render/GPUScene.h>
+#include <render/SceneView.h>
+#include <render/rdg/RenderGraph.h>
+#include <algorithm>
+#include <cstring>
+
+namespace sky {
+
+    static constexpr uint32_t GPU_SCENE_MIN_CAPACITY = 1024;
+    static constexpr uint32_t GPU_SCENE_COUNT_SIZE   = static_cast<uint32_t>(sizeof(GPUCullStats));
+    static constexpr uint32_t GPU_SCENE_COMMAND_SIZE = static_cast<uint32_t>(sizeof(GPUDrawCommand));
+    static constexpr uint32_t GPU_SCENE_INVALID_SLOT = ~(0U);
+
+    static const rhi::CmdDrawIndexed *GetSingleIndexedDraw(const RenderPrimitive &primitive)
+    {
+        if (primitive.args.size() != 1) {
+            return nullptr;
+        }
+        const auto *draw = std::get_if<rhi::CmdDrawIndexed>(&primitive.args[0]);
+        return (draw != nullptr && draw->instanceCount == 1) ? draw : nullptr;
+    }
+
+    void GPUScene::FillInstance(GPUInstance &instance, const RenderPrimitive &primitive, uint32_t slot)
+    {
+        const auto &draw  = std::get<rhi::CmdDrawIndexed>(primitive.args[0]);
+        const auto &bound = primitive.worldBound;
+
+        instance.worldMatrix   = primitive.instanceData.worldMatrix;
+        instance.boundCenter   = Vector4((bound.min.x + bound.max.x) * 0.5f, (bound.min.y + bound.max.y) * 0.5f, (bound.min.z + bound.max.z) * 0.5f, 0.f);
+        instance.boundExtent   = Vector4((bound.max.x - bound.min.x) * 0.5f, (bound.max.y - bound.min.y) * 0.5f, (bound.max.z - bound.min.z) * 0.5f, 0.f);
+        instance.indexCount    = draw.indexCount;
+        instance.firstIndex    = draw.firstIndex;
+        instance.vertexOffset  = draw.vertexOffset;
+        instance.commandIndex  = slot;
+        instance.meshletOffset = 0;
+        instance.meshletCount  = 0;
+        instance.flags         = static_cast<uint32_t>(GPUInstanceFlagBit::VALID);
+    }
+
+    bool GPUScene::Contains(const RenderPrimitive *primitive) const
+    {
+        return commandBuffer && primitive->indirectBuffer == commandBuffer->GetRHIBuffer();
+    }
+
+    bool GPUScene::AddPrimitive(RenderPrimitive *primitive)
+    {
+        if (primitive == nullptr || GetSingleIndexedDraw(*primitive) == nullptr) {
+            return false;
+        }
+        SKY_ASSERT(!Contains(primitive));
+
+        auto slot = static_cast<uint32_t>(primitives.size());
+        if (slot >= capacity) {
+            Resize(std::max(capacity * 2, GPU_SCENE_MIN_CAPACITY));
+        }
+
+        primitives.emplace_back(primitive);
+        instances.emplace_back();
+        dirtyFlags.emplace_back(0);
+        FillInstance(instances.back(), *primitive, slot);
+
+        primitive->indirectBuffer = commandBuffer->GetRHIBuffer();
+        primitive->indirectOffset = slot * GPU_SCENE_COMMAND_SIZE;
+        MarkDirty(slot);
+        return true;
+    }
+
+    void GPUScene::RemovePrimitive(RenderPrimitive *primitive)
+    {
+        if (primitive == nullptr || !Contains(primitive)) {
+            return;
+        }
+
+        // swap the last instance into the hole, its command moves with it.
+        uint32_t slot = primitive->indirectOffset / GPU_SCENE_COMMAND_SIZE;
+        uint32_t last = static_cast<uint32_t>(primitives.size()) - 1;
+        SKY_ASSERT(primitives[slot] == primitive);
+
+        if (slot != last) {
+            primitives[slot] = primitives[last];
+            instances[slot]  = instances[last];
+            instances[slot].commandIndex = slot;
+            primitives[slot]->indirectOffset = slot * GPU_SCENE_COMMAND_SIZE;
+            MarkDirty(slot);
+        }
+
+        if (dirtyFlags[last] != 0) {
+            dirtySlots.erase(std::find(dirtySlots.begin(), dirtySlots.end(), last));
+        }
+
+        primitives.pop_back();
+        instances.pop_back();
+        dirtyFlags.pop_back();
+
+        primitive->indirectBuffer = nullptr;
+        primitive->indirectOffset = 0;
+    }
+
+    void GPUScene::UpdatePrimitive(RenderPrimitive *primitive)
+    {
+        if (primitive == nullptr || !Contains(primitive)) {
+            return;
+        }
+
+        uint32_t slot = primitive->indirectOffset / GPU_SCENE_COMMAND_SIZE;
+        FillInstance(instances[slot], *primitive, slot);
+        MarkDirty(slot);
+    }
+
+    void GPUScene::MarkDirty(uint32_t slot)
+    {
+        if (dirtyFlags[slot] == 0) {
+            dirtyFlags[slot] = 1;
+            dirtySlots.emplace_back(slot);
+        }
+    }
+
+    void GPUScene::Resize(uint32_t count)
+    {
+        capacity = count;
+
+        instanceBuffer = new Buffer();
+        instanceBuffer->Init(static_cast<uint64_t>(capacity) * sizeof(GPUInstance),
+            rhi::BufferUsageFlagBit::STORAGE | rhi::BufferUsageFlagBit::TRANSFER_DST, rhi::MemoryType::GPU_ONLY);
+
+        commandBuffer = new Buffer();
+        commandBuffer->Init(static_cast<uint64_t>(capacity) * GPU_SCENE_COMMAND_SIZE,
+            rhi::BufferUsageFlagBit::STORAGE | rhi::BufferUsageFlagBit::INDIRECT, rhi::MemoryType::GPU_ONLY);
+
+        if (!countBuffer) {
+            countBuffer = new Buffer();
+            countBuffer->Init(GPU_SCENE_COUNT_SIZE,
+                rhi::BufferUsageFlagBit::STORAGE | rhi::BufferUsageFlagBit::TRANSFER_DST, rhi::MemoryType::GPU_ONLY);
+
+            constants = new UniformBuffer();
+            constants->Init(sizeof(GPUCullConstants));
+        }
+
+        // new buffers start empty, every live instance is uploaded again.
+        for (auto *primitive : primitives) {
+            primitive->indirectBuffer = commandBuffer->GetRHIBuffer();
+        }
+        fullUpload = true;
+    }
+
+    void GPUScene::UploadDirty(rdg::RenderGraph &rdg)
+    {
+        if (fullUpload) {
+            dirtySlots.clear();
+            for (uint32_t i = 0; i < static_cast<uint32_t>(primitives.size()); ++i) {
+                dirtyFlags[i] = 1;
+                dirtySlots.emplace_back(i);
+            }
+            fullUpload = false;
+        }
+
+        uploadCount = static_cast<uint32_t>(dirtySlots.size());
+
+        // the region of a frame holds the zeroed draw count followed by the dirty instances.
+        uint32_t required = GPU_SCENE_COUNT_SIZE + uploadCount * static_cast<uint32_t>(sizeof(GPUInstance));
+        if (required > stagingCapacity) {
+            stagingCapacity = std::max(required, stagingCapacity * 2);
+            staging = new DynamicBuffer();
+            staging->Init(stagingCapacity, rhi::BufferUsageFlagBit::TRANSFER_SRC);
+        } else {
+            staging->SwapBuffer();
+        }
+
+        uint8_t *mapped = staging->GetMapped();
+        uint64_t base   = staging->GetOffset();
+        std::memset(mapped, 0, GPU_SCENE_COUNT_SIZE);
+        rdg.AddUploadPass("GPUSceneResetCount"_name, rdg::UploadPass{staging, countBuffer, base, 0, GPU_SCENE_COUNT_SIZE});
+
+        // sorted slots are merged into one copy per consecutive run.
+        std::sort(dirtySlots.begin(), dirtySlots.end());
+
+        uint32_t offset = GPU_SCENE_COUNT_SIZE;
+        for (size_t i = 0; i < dirtySlots.size();) {
+            size_t end = i + 1;
+            while (end < dirtySlots.size() && dirtySlots[end] == dirtySlots[end - 1] + 1) {
+                ++end;
+            }
+
+            auto first = dirtySlots[i];
+            auto count = static_cast<uint32_t>(end - i);
+            auto size  = count * static_cast<uint32_t>(sizeof(GPUInstance));
+            std::memcpy(mapped + offset, &instances[first], size);
+            rdg.AddUploadPass("GPUSceneUpload"_name, rdg::UploadPass{
+                staging, instanceBuffer, base + offset, static_cast<uint64_t>(first) * sizeof(GPUInstance), size});
+
+            for (size_t j = i; j < end; ++j) {
+                dirtyFlags[dirtySlots[j]] = 0;
+            }
+            offset += size;
+            i = end;
+        }
+        dirtySlots.clear();
+    }
+
+    void GPUScene::SetOcclusion(const Matrix4 &viewProject, uint32_t width, uint32_t height, uint32_t mipCount)
+    {
+        hizViewProject = viewProject;
+        hizSize = Vector4(static_cast<float>(width), static_cast<float>(height), static_cast<float>(mipCount), 0.f);
+    }
+
+    void GPUScene::Setup(rdg::RenderGraph &rdg, const SceneView &view, uint32_t cullFlags)
+    {
+        if (capacity == 0) {
+            Resize(GPU_SCENE_MIN_CAPACITY);
+        }
+
+        UploadDirty(rdg);
+
+        const auto &world = view.GetWorld();
+        GPUCullConstants cullConstants = {};
+        FillCullConstants(cullConstants, view.GetFrustums()[0], view.GetViewProject(), Vector3(world[3].x, world[3].y, world[3].z));
+        cullConstants.instanceCount = GetInstanceCount();
+        cullConstants.flags = cullFlags;
+
+        // the pyramid belongs to an earlier frame, boxes are reprojected with the matrix it was rendered with.
+        if ((cullFlags & static_cast<uint32_t>(GPUCullFlagBit::HIZ)) != 0) {
+            cullConstants.viewProject = hizViewProject;
+            cullConstants.hizSize = hizSize;
+        }
+        constants->WriteT(0, cullConstants);
+
+        auto &rg = rdg.resourceGraph;
+        rg.ImportBuffer(Name(INSTANCE_BUFFER.data()), instanceBuffer->GetRHIBuffer(), rhi::AccessFlagBit::TRANSFER_WRITE);
+        rg.ImportBuffer(Name(COUNT_BUFFER.data()), countBuffer->GetRHIBuffer(), rhi::AccessFlagBit::TRANSFER_WRITE);
+        rg.ImportBuffer(Name(COMMAND_BUFFER.data()), commandBuffer->GetRHIBuffer(), rhi::AccessFlagBit::INDIRECT_BUFFER);
+        rg.ImportUBO(Name(CULL_CONSTANTS.data()), constants);
+
+        cullView = &view;
+    }
+
+} // namespace sky
@@ -0,0 +1,356 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <render/PipelineCompiler.h>
+#include <render/RHI.h>
+#include <core/archive/FileArchive.h>
+#include <core/hash/Crc32.h>
+#include <core/hash/Hash.h>
+#include <core/logger/Logger.h>
+#include <render/RenderBase.h>
+#include <algorithm>
+#include <filesystem>
+
+static const char *TAG = "PipelineCompiler";
+
+namespace sky {
+
+    static constexpr uint32_t VARIANT_FILE_MAGIC   = 0x56505053; // SPPV
+    static constexpr uint32_t VARIANT_FILE_VERSION = 1;
+
+    // serialized sizes, used to reject counts a damaged file can not hold.
+    static constexpr uint32_t VARIANT_NAME_MAX_LENGTH = 256;
+    static constexpr size_t VARIANT_ATTRIBUTE_SIZE =
+        sizeof(uint32_t) * 3 + sizeof(rhi::Format);
+    static constexpr size_t VARIANT_BINDING_SIZE =
+        sizeof(uint32_t) * 2 + sizeof(rhi::VertexInputRate);
+    static constexpr size_t VARIANT_RECORD_MIN_SIZE = sizeof(uint32_t) + sizeof(ShaderVariantKey) + sizeof(uint8_t) +
+        sizeof(rhi::PrimitiveTopology) + sizeof(rhi::PolygonMode) + sizeof(uint32_t) * 4;
+
+    size_t PipelineCompiler::PipelineKeyHash::operator()(const PipelineKey &key) const
+    {
+        uint32_t hash = 0;
+        HashCombine32(hash, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(key.program)));
+        HashCombine32(hash, key.stateHash);
+        HashCombine32(hash, key.vertexHash);
+        HashCombine32(hash, key.passHash);
+        HashCombine32(hash, key.subPassID);
+        return hash;
+    }
+
+    PipelineCompiler::PipelineCompiler() : executor(2)
+    {
+    }
+
+    PipelineCompiler::~PipelineCompiler()
+    {
+        executor.wait_for_all();
+    }
+
+    uint32_t PipelineCompiler::HashVertexLayout(const std::vector<rhi::VertexAttributeDesc> &attributes, const std::vector<rhi::VertexBindingDesc> &bindings)
+    {
+        uint32_t hash = 0;
+        for (const auto &attr : attributes) {
+            HashCombine32(hash, attr.location);
+            HashCombine32(hash, attr.binding);
+            HashCombine32(hash, attr.offset);
+            HashCombine32(hash, static_cast<uint32_t>(attr.format));
+        }
+        for (const auto &binding : bindings) {
+            HashCombine32(hash, binding.binding);
+            HashCombine32(hash, binding.stride);
+            HashCombine32(hash, static_cast<uint32_t>(binding.inputRate));
+        }
+        return hash;
+    }
+
+    uint32_t PipelineCompiler::HashPipelineState(const rhi::PipelineState &state)
+    {
+        uint32_t hash = 0;
+        HashCombine32(hash, Crc32::Cal(state.depthStencil));
+        HashCombine32(hash, Crc32::Cal(state.multiSample));
+        HashCombine32(hash, Crc32::Cal(state.inputAssembly));
+        HashCombine32(hash, Crc32::Cal(state.rasterState));
+        HashCombine32(hash, Crc32::Cal(reinterpret_cast<const uint8_t*>(state.blendStates.data()),
+            static_cast<uint32_t>(state.blendStates.size() * sizeof(rhi::BlendState))));
+        return hash;
+    }
+
+    PipelineCompiler::PipelineKey PipelineCompiler::MakeKey(const PipelineRequest &request) const
+    {
+        return PipelineKey{request.program.Get(), HashPipelineState(request.state), request.vertexHash,
+            request.pass->GetCompatibleHash(), request.subPassID};
+    }
+
+    void PipelineCompiler::Compile(const PipelineEntryPtr &entry)
+    {
+        const auto &req = entry->request;
+        auto pso = builder ? builder(req) : GraphicsTechnique::BuildPso(req.program, req.state, req.vertexDesc, req.pass, req.subPassID);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        entry->pso = pso;
+        entry->compiling = false;
+        if (!pso) {
+            LOG_E(TAG, "compile pipeline failed");
+        }
+    }
+
+    rhi::GraphicsPipelinePtr PipelineCompiler::RequestPso(const PipelineRequest &request, const PipelineVariant *variant)
+    {
+        if (!request.program || !request.pass) {
+            return nullptr;
+        }
+
+        auto key = MakeKey(request);
+        PipelineEntryPtr entry;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto &slot = pipelines[key];
+            if (slot) {
+                return slot->pso;
+            }
+
+            slot = std::make_shared<PipelineEntry>();
+            slot->request = request;
+            slot->compiling = true;
+            entry = slot;
+
+            if (variant != nullptr) {
+                captured.emplace(key, *variant);
+            }
+        }
+
+        FlushDeferred(request.pass);
+
+        if (!async) {
+            Compile(entry);
+            return entry->pso;
+        }
+
+        ++pending;
+        executor.silent_async([this, entry]() {
+            Compile(entry);
+            --pending;
+        });
+        return nullptr;
+    }
+
+    rhi::GraphicsPipelinePtr PipelineCompiler::RequestPsoSync(const PipelineRequest &request)
+    {
+        if (!request.program || !request.pass) {
+            return nullptr;
+        }
+
+        auto key = MakeKey(request);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto iter = pipelines.find(key);
+            if (iter != pipelines.end() && !iter->second->compiling) {
+                return iter->second->pso;
+            }
+        }
+
+        auto entry = std::make_shared<PipelineEntry>();
+        entry->request = request;
+        Compile(entry);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        pipelines[key] = entry;
+        return entry->pso;
+    }
+
+    void PipelineCompiler::WaitIdle()
+    {
+        executor.wait_for_all();
+    }
+
+    void PipelineCompiler::FlushDeferred(const rhi::RenderPassPtr &pass)
+    {
+        std::vector<PipelineRequest> requests;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto iter = deferred.find(pass->GetCompatibleHash());
+            if (iter == deferred.end()) {
+                return;
+            }
+            requests.swap(iter->second);
+            deferred.erase(iter);
+        }
+
+        for (auto &request : requests) {
+            request.pass = pass;
+            RequestPso(request);
+        }
+    }
+
+    void PipelineCompiler::Prewarm(const std::vector<PipelineVariant> &variants, const TechniqueResolver &resolver)
+    {
+        auto *device = RHI::Get()->GetDevice();
+
+        uint32_t count = 0;
+        for (const auto &variant : variants) {
+            auto tech = resolver(variant.technique);
+            if (!tech) {
+                continue;
+            }
+
+            PipelineRequest request = {};
+            request.program = tech->RequestProgram(variant.key, variant.meshShading);
+            if (!request.program) {
+                continue;
+            }
+
+            rhi::VertexInput::Descriptor vtxDesc = {};
+            auto attributes = variant.attributes;
+            auto bindings = variant.bindings;
+            vtxDesc.attributesNum = static_cast<uint32_t>(attributes.size());
+            vtxDesc.bindingsNum = static_cast<uint32_t>(bindings.size());
+            vtxDesc.attributes = attributes.data();
+            vtxDesc.bindings = bindings.data();
+            request.vertexDesc = device->CreateVertexInput(vtxDesc);
+            request.vertexHash = HashVertexLayout(attributes, bindings);
+
+            request.state = tech->GetPipelineState();
+            request.state.inputAssembly.topology = variant.topo;
+            request.state.rasterState.polygonMode = variant.polygonMode;
+            request.subPassID = variant.subPassID;
+
+            Defer(variant.passHash, std::move(request));
+            ++count;
+        }
+        LOG_I(TAG, "pre-warm %u of %u pipeline variants", count, static_cast<uint32_t>(variants.size()));
+    }
+
+    void PipelineCompiler::Defer(uint32_t passHash, PipelineRequest &&request)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        deferred[passHash].emplace_back(std::move(request));
+    }
+
+    std::vector<PipelineVariant> PipelineCompiler::GetCapturedVariants() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<PipelineVariant> variants;
+        variants.reserve(captured.size());
+        for (const auto &[key, variant] : captured) {
+            variants.emplace_back(variant);
+        }
+        return variants;
+    }
+
+    bool PipelineCompiler::SaveVariants(const FilePath &path) const
+    {
+        auto variants = GetCapturedVariants();
+
+        OFileArchive archive(path);
+        if (!archive.IsOpen()) {
+            return false;
+        }
+
+        archive << VARIANT_FILE_MAGIC << VARIANT_FILE_VERSION << static_cast<uint32_t>(variants.size());
+        for (const auto &variant : variants) {
+            archive << std::string(variant.technique.GetStr());
+            for (const auto &v : variant.key.u64) {
+                archive << v;
+            }
+            archive << static_cast<uint8_t>(variant.meshShading) << variant.topo << variant.polygonMode;
+            archive << variant.passHash << variant.subPassID;
+
+            archive << static_cast<uint32_t>(variant.attributes.size());
+            for (const auto &attr : variant.attributes) {
+                archive << attr.location << attr.binding << attr.offset << attr.format;
+            }
+            archive << static_cast<uint32_t>(variant.bindings.size());
+            for (const auto &binding : variant.bindings) {
+                archive << binding.binding << binding.stride << binding.inputRate;
+            }
+        }
+        return true;
+    }
+
+    bool PipelineCompiler::LoadVariants(const FilePath &path, std::vector<PipelineVariant> &variants)
+    {
+        std::error_code ec;
+        auto fileSize = std::filesystem::file_size(path.GetStr(), ec);
+        if (ec) {
+            return false;
+        }
+
+        IFileArchive archive(path);
+        if (!archive.IsOpen()) {
+            return false;
+        }
+
+        // every count is checked against the bytes left, a damaged file drops all variants.
+        size_t consumed = 0;
+        auto read = [&archive, &consumed](auto &val) {
+            consumed += sizeof(val);
+            return archive.Load(val);
+        };
+        auto fits = [fileSize, &consumed](uint64_t num, size_t stride) {
+            return num <= (fileSize - std::min<uint64_t>(consumed, fileSize)) / stride;
+        };
+
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint32_t count = 0;
+        if (!read(magic) || !read(version) || !read(count)) {
+            return false;
+        }
+        if (magic != VARIANT_FILE_MAGIC || version != VARIANT_FILE_VERSION || !fits(count, VARIANT_RECORD_MIN_SIZE)) {
+            return false;
+        }
+
+        std::vector<PipelineVariant> loaded(count);
+        for (auto &variant : loaded) {
+            uint32_t nameLength = 0;
+            if (!read(nameLength) || nameLength > VARIANT_NAME_MAX_LENGTH || !fits(nameLength, 1)) {
+                return false;
+            }
+            std::string technique(nameLength, '\0');
+            if (!archive.LoadRaw(technique.data(), nameLength)) {
+                return false;
+            }
+            consumed += nameLength;
+            variant.technique = Name(technique.c_str());
+
+            bool res = true;
+            for (auto &v : variant.key.u64) {
+                res &= read(v);
+            }
+
+            uint8_t meshShading = 0;
+            res &= read(meshShading) && read(variant.topo) && read(variant.polygonMode);
+            res &= read(variant.passHash) && read(variant.subPassID);
+            variant.meshShading = meshShading != 0;
+
+            uint32_t attributeCount = 0;
+            res &= read(attributeCount);
+            if (!res || attributeCount > MAX_VERTEX_BUFFER_BINDINGS || !fits(attributeCount, VARIANT_ATTRIBUTE_SIZE)) {
+                return false;
+            }
+            variant.attributes.resize(attributeCount);
+            for (auto &attr : variant.attributes) {
+                res &= read(attr.location) && read(attr.binding) && read(attr.offset) && read(attr.format);
+            }
+
+            uint32_t bindingCount = 0;
+            res &= read(bindingCount);
+            if (!res || bindingCount > MAX_VERTEX_BUFFER_BINDINGS || !fits(bindingCount, VARIANT_BINDING_SIZE)) {
+                return false;
+            }
+            variant.bindings.resize(bindingCount);
+            for (auto &binding : variant.bindings) {
+                res &= read(binding.binding) && read(binding.stride) && read(binding.inputRate);
+            }
+            if (!res) {
+                return false;
+            }
+        }
+
+        variants = std::move(loaded);
+        return true;
+    }
+
+} // namespace sky
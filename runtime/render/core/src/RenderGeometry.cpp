@@ -26,22 +26,19 @@ namespace sky {
         }
     }
 
-    rhi::VertexInputPtr RenderGeometry::Request(const RDProgramPtr& program)
+    bool RenderGeometry::FillVertexDesc(const RDProgramPtr& program,
+        std::vector<rhi::VertexAttributeDesc> &attributes, std::vector<rhi::VertexBindingDesc> &bindings) const
     {
         auto *semantics = RenderSemantics::Get();
-        rhi::VertexInput::Descriptor vtxDesc = {};
 
         std::array<uint8_t, MAX_VERTEX_BUFFER_BINDINGS> bindingHash;
         bindingHash.fill(0xFF);
 
-        std::vector<rhi::VertexAttributeDesc> attributes;
-        std::vector<rhi::VertexBindingDesc> bindings;
-
         for (const auto &attr : program->GetVertexAttributes()) {
             auto semantic = semantics->QuerySemanticByName(attr.semantic);
             if (semantic == VertexSemanticFlagBit::NONE) {
                 LOG_E(TAG, "Vertex Semantic not Registered %s", attr.semantic.c_str());
-                return {};
+                return false;
             }
 
             auto iter  = std::find_if(vertexAttributes.begin(), vertexAttributes.end(), [semantic](const VertexAttribute &stream) -> bool {
@@ -50,7 +47,7 @@ namespace sky {
 
             if (iter == vertexAttributes.end()) {
                 // geometry not compatible with shader
-                return {};
+                return false;
             }
 
             const auto &stream = *iter;
@@ -76,7 +73,19 @@ namespace sky {
 
             attributes.emplace_back(attrDesc);
         }
+        return true;
+    }
+
+    rhi::VertexInputPtr RenderGeometry::Request(const RDProgramPtr& program)
+    {
+        std::vector<rhi::VertexAttributeDesc> attributes;
+        std::vector<rhi::VertexBindingDesc> bindings;
+        if (!FillVertexDesc(program, attributes, bindings)) {
+            return {};
+        }
+
         auto *device = RHI::Get()->GetDevice();
+        rhi::VertexInput::Descriptor vtxDesc = {};
 
         vtxDesc.attributesNum = static_cast<uint32_t>(attributes.size());
         vtxDesc.bindingsNum = static_cast<uint32_t>(bindings.size());
@@ -0,0 +1,98 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <render/RenderInstanceStream.h>
+#include <render/RHI.h>
+#include <core/util/Memory.h>
+#include <algorithm>
+#include <cstring>
+
+namespace sky {
+
+    static constexpr uint32_t INSTANCE_STREAM_MAX_SETS = 8;
+    static constexpr uint32_t INSTANCE_STREAM_RANGE = MAX_AUTO_INSTANCE * sizeof(InstanceLocal);
+    static constexpr uint32_t INSTANCE_STREAM_MIN_SIZE = 1024 * sizeof(InstanceLocal);
+
+    static const std::vector<rhi::DescriptorSetPool::PoolSize> INSTANCE_STREAM_SIZES = {
+        {rhi::DescriptorType::UNIFORM_BUFFER_DYNAMIC, INSTANCE_STREAM_MAX_SETS}
+    };
+
+    // same layout as the Local set of static meshes, the shader reads an array instead of a single entry.
+    static const std::vector<rhi::DescriptorSetLayout::SetBinding> INSTANCE_STREAM_BINDINGS = {
+        {rhi::DescriptorType::UNIFORM_BUFFER_DYNAMIC, 1, 0, rhi::ShaderStageFlagBit::VS, "AutoInstance"},
+    };
+
+    void RenderInstanceStream::Reset()
+    {
+        if (buffer) {
+            buffer->SwapBuffer();
+        }
+        cursor = 0;
+    }
+
+    void RenderInstanceStream::Reserve(uint32_t count, uint32_t drawCount)
+    {
+        // every draw may waste up to one alignment for its start offset.
+        uint32_t required = cursor + count * static_cast<uint32_t>(sizeof(InstanceLocal)) + drawCount * alignment;
+        if (required > capacity) {
+            Resize(std::max(required, std::max(capacity * 2, INSTANCE_STREAM_MIN_SIZE)));
+        }
+    }
+
+    uint32_t RenderInstanceStream::Allocate(uint32_t count)
+    {
+        SKY_ASSERT(count <= MAX_AUTO_INSTANCE);
+        uint32_t offset = Align(cursor, alignment);
+        SKY_ASSERT(offset + count * sizeof(InstanceLocal) <= capacity);
+        cursor = offset + count * static_cast<uint32_t>(sizeof(InstanceLocal));
+        return offset;
+    }
+
+    void RenderInstanceStream::Write(uint32_t offset, uint32_t index, const InstanceLocal &data)
+    {
+        std::memcpy(buffer->GetMapped() + offset + index * sizeof(InstanceLocal), &data, sizeof(InstanceLocal));
+    }
+
+    void RenderInstanceStream::OnBind(rhi::GraphicsEncoder &encoder, uint32_t offset) const
+    {
+        resourceGroup->OnBind(encoder, INSTANCE_SET);
+        encoder.SetOffset(INSTANCE_SET, 0, 0, static_cast<uint32_t>(buffer->GetOffset()) + offset);
+    }
+
+    void RenderInstanceStream::Resize(uint32_t size)
+    {
+        auto *device = RHI::Get()->GetDevice();
+        if (!layout) {
+            alignment = std::max(device->GetLimitations().minUniformBufferOffsetAlignment, 16U);
+
+            layout = new ResourceGroupLayout();
+            layout->SetRHILayout(device->CreateDescriptorSetLayout({INSTANCE_STREAM_BINDINGS}));
+            layout->AddNameHandler("AutoInstance"_name, {0, INSTANCE_STREAM_RANGE});
+
+            rhi::DescriptorSetPool::Descriptor poolDesc = {};
+            poolDesc.maxSets   = INSTANCE_STREAM_MAX_SETS;
+            poolDesc.sizeCount = static_cast<uint32_t>(INSTANCE_STREAM_SIZES.size());
+            poolDesc.sizeData  = INSTANCE_STREAM_SIZES.data();
+            pool = device->CreateDescriptorSetPool(poolDesc);
+        }
+
+        // the last draw of a frame still binds a full range.
+        capacity = Align(size, alignment);
+
+        RDDynamicBuffer newBuffer = new DynamicBuffer();
+        newBuffer->Init(capacity + INSTANCE_STREAM_RANGE, rhi::BufferUsageFlagBit::UNIFORM);
+
+        // keep instances already written in this frame, the old buffer is released after the inflight frames.
+        if (buffer && cursor != 0) {
+            std::memcpy(newBuffer->GetMapped(), buffer->GetMapped(), cursor);
+        }
+        buffer = newBuffer;
+
+        resourceGroup = new ResourceGroup();
+        resourceGroup->Init(layout, *pool);
+        resourceGroup->BindBuffer("AutoInstance"_name, buffer->GetRHIBuffer(), 0, INSTANCE_STREAM_RANGE, 0);
+        resourceGroup->Update();
+    }
+
+} // namespace sky
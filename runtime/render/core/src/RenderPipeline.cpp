@@ -33,6 +33,7 @@ namespace sky {
         rdgContext->pool->Init();
         rdgContext->device = RHI::Get()->GetDevice();
         rdgContext->emptySet = defaultRes.emptySet;
+        rdgContext->resources = Renderer::Get()->GetFrameAllocator();
 
         frameIndex = 0;
         inflightFrameCount = Renderer::Get()->GetInflightFrameCount();
@@ -57,6 +58,7 @@ namespace sky {
         rdgContext->Fence()->WaitAndReset();
         rdgContext->ImageAvailableSemaPool().Reset();
         rdgContext->pool->ResetPool();
+        rdgContext->instanceStream.Reset();
     }
 
     void RenderPipeline::Compile(rdg::RenderGraph &rdg) // NOLINT
@@ -65,21 +67,21 @@ namespace sky {
         {
             SKY_PROFILE_NAME("AccessCompiler")
             AccessCompiler             compiler(rdg);
-            PmrVector<boost::default_color_type> colors(rdg.accessGraph.vertices.size(), &rdg.context->resources);
+            PmrVector<boost::default_color_type> colors(rdg.accessGraph.vertices.size(), rdg.context->resources);
             boost::depth_first_search(rdg.accessGraph.graph, compiler, ColorMap(colors));  // NOLINT
         }
 
         {
             SKY_PROFILE_NAME("RenderResourceCompiler")
             RenderResourceCompiler               compiler(rdg);
-            PmrVector<boost::default_color_type> colors(rdg.vertices.size(), &rdg.context->resources);
+            PmrVector<boost::default_color_type> colors(rdg.vertices.size(), rdg.context->resources);
             boost::depth_first_search(rdg.graph, compiler, ColorMap(colors));
         }
 
         {
             SKY_PROFILE_NAME("RenderGraphPassCompiler")
             RenderGraphPassCompiler              compiler(rdg);
-            PmrVector<boost::default_color_type> colors(rdg.vertices.size(), &rdg.context->resources);
+            PmrVector<boost::default_color_type> colors(rdg.vertices.size(), rdg.context->resources);
             boost::depth_first_search(rdg.graph, compiler, ColorMap(colors));
         }
     }
@@ -108,7 +110,7 @@ namespace sky {
             uploader.UploadConstantBuffers();
 
             RenderGraphExecutor executor(rdg);
-            PmrVector<boost::default_color_type> colors(rdg.vertices.size(), &rdg.context->resources);
+            PmrVector<boost::default_color_type> colors(rdg.vertices.size(), rdg.context->resources);
             boost::depth_first_search(rdg.graph, executor, ColorMap(colors));
             commandBuffer->End();
 
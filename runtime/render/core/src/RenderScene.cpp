@@ -11,6 +11,7 @@ namespace sky {
         : features(&resources)
         , sceneViews(&resources)
         , primitives(&resources)
+        , culling(&resources)
     {
     }
 
@@ -95,6 +96,8 @@ namespace sky {
         primitives.erase(std::remove_if(primitives.begin(), primitives.end(), [primitive](const auto &v) {
             return primitive == v;
         }), primitives.end());
+
+        gpuScene.RemovePrimitive(primitive);
     }
 
     void RenderScene::AddFeature(IFeatureProcessor *feature)
@@ -13,25 +13,27 @@ namespace sky {
 
     void RenderStreamManager::UploadTexture(const RDTexturePtr &texture)
     {
+        texture->Prefetch();
         uploadQueue.emplace_back(texture.Get());
     }
 
     void RenderStreamManager::UploadBuffer(const RDBufferPtr &buffer)
     {
+        buffer->Prefetch();
         uploadQueue.emplace_back(buffer.Get());
     }
 
     void RenderStreamManager::Tick()
     {
+        // resources still waiting on disk stay queued and do not block the ones behind them.
         uint64_t current = 0;
-        while (!uploadQueue.empty()) {
-            auto &res = uploadQueue.front();
-            current += res->Upload(transferQueue);
-            uploadQueue.pop_front();
-
-            if (current >= limitPerFrame) {
-                break;
+        for (auto iter = uploadQueue.begin(); iter != uploadQueue.end() && current < limitPerFrame;) {
+            if (!(*iter)->IsPrefetched()) {
+                ++iter;
+                continue;
             }
+            current += (*iter)->Upload(transferQueue);
+            iter = uploadQueue.erase(iter);
         }
     }
 
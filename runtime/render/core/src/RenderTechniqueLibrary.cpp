@@ -8,11 +8,18 @@ namespace sky {
 
     void RenderTechniqueLibrary::RegisterGfxTech(const Name& name, const RDTechniquePtr &tech)
     {
+        // registered name is the key of captured pipeline variants.
+        if (tech && tech->GetName().Empty()) {
+            tech->SetName(name);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
         techniques.emplace(name, tech);
     }
 
     RDGfxTechPtr RenderTechniqueLibrary::FetchGfxTechnique(const Name &name)
     {
+        std::lock_guard<std::mutex> lock(mutex);
         auto iter = techniques.find(name);
         if (iter != techniques.end()) {
             RDGfxTechPtr tech = static_cast<GraphicsTechnique*>(iter->second.Get());
@@ -6,6 +6,10 @@
 #include <render/RHI.h>
 #include <render/rdg/RenderGraph.h>
 #include <core/profile/Profiler.h>
+#include <core/file/FileIO.h>
+#include <core/logger/Logger.h>
+
+static const char *TAG = "Renderer";
 
 namespace sky {
 
@@ -20,6 +24,7 @@ namespace sky {
     Renderer::~Renderer()
     {
         pipeline = nullptr;
+        pipelineCompiler = nullptr;
         streamManager = nullptr;
         defaultResource.Reset();
         features.clear();
@@ -42,6 +47,10 @@ namespace sky {
 
         materialManager = std::make_unique<MaterialManager>();
         materialManager->Init();
+
+        // gl contexts are bound to the render thread.
+        pipelineCompiler = std::make_unique<PipelineCompiler>();
+        pipelineCompiler->SetAsync(RHI::Get()->GetBackend() != rhi::API::GLES);
     }
 
     void Renderer::Tick(float time)
@@ -78,7 +87,7 @@ namespace sky {
 
         rdg::RenderGraph rdg(pipeline->Context());
 
-        std::vector<RenderScene*> renderScenes;
+        renderScenes.clear();
         for (auto &scn : scenes) {
             scn->Render(rdg);
 
@@ -110,6 +119,16 @@ namespace sky {
 
         delayReleaseCollections[(frameIndex + inflightFrameCount - 1) % inflightFrameCount]->Clear();
 
+        frameAllocator.NextFrame();
+
+        // engine heap allocations issued during the frame.
+        uint64_t heapAllocations = 0;
+        for (const auto &tag : SystemAllocator::Get()->GetStats().tags) {
+            heapAllocations += tag.allocations;
+        }
+        frameHeapAllocations = heapAllocations - totalHeapAllocations;
+        totalHeapAllocations = heapAllocations;
+
         totalFrame++;
         frameIndex = totalFrame % inflightFrameCount;
     }
@@ -119,6 +138,63 @@ namespace sky {
         device->WaitIdle();
     }
 
+    static FilePath GetPipelineLibraryPath(const std::string &folder, const rhi::Device &device)
+    {
+        return FilePath(folder) / FilePath("pipeline_" + device.GetPipelineLibraryKey() + ".bin");
+    }
+
+    static FilePath GetPipelineVariantPath(const std::string &folder)
+    {
+        return FilePath(folder) / FilePath("pipeline_variants.bin");
+    }
+
+    void Renderer::LoadPipelineLibrary()
+    {
+        if (cacheFolder.empty() || device->GetPipelineLibraryKey().empty()) {
+            return;
+        }
+
+        std::vector<uint8_t> data;
+        ReadBin(GetPipelineLibraryPath(cacheFolder, *device), data);
+
+        // pipelines may be created from worker threads.
+        rhi::PipelineLibrary::Descriptor desc = {};
+        desc.externalSynchronized = false;
+        desc.dataSize = static_cast<uint32_t>(data.size());
+        desc.data = reinterpret_cast<const char *>(data.data());
+        device->SetPipelineLibrary(device->CreatePipelineLibrary(desc));
+
+        LOG_I(TAG, "pipeline library loaded, %u bytes", desc.dataSize);
+    }
+
+    void Renderer::PrewarmPipelines(const PipelineCompiler::TechniqueResolver &resolver)
+    {
+        std::vector<PipelineVariant> variants;
+        if (cacheFolder.empty() || !PipelineCompiler::LoadVariants(GetPipelineVariantPath(cacheFolder), variants)) {
+            return;
+        }
+        pipelineCompiler->Prewarm(variants, resolver);
+    }
+
+    void Renderer::SavePipelineLibrary() const
+    {
+        if (!cacheFolder.empty() && pipelineCompiler) {
+            pipelineCompiler->WaitIdle();
+            pipelineCompiler->SaveVariants(GetPipelineVariantPath(cacheFolder));
+        }
+
+        const auto &library = device->GetPipelineLibrary();
+        std::vector<uint8_t> data;
+        if (cacheFolder.empty() || !library || !library->Serialize(data)) {
+            return;
+        }
+        WriteBin(GetPipelineLibraryPath(cacheFolder, *device), reinterpret_cast<const char *>(data.data()), data.size());
+
+        auto stats = device->GetPipelineLibraryStats();
+        LOG_I(TAG, "pipeline library saved, %u bytes, hit %u, miss %u, library hit %u, create time %.2fms",
+            static_cast<uint32_t>(data.size()), stats.hit, stats.miss, stats.libraryHit, static_cast<double>(stats.createTime) / 1000.0);
+    }
+
     RenderResourceGC *Renderer::GetResourceGC() const
     {
         return delayReleaseCollections[frameIndex].get();
@@ -0,0 +1,136 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <render/SceneCulling.h>
+#include <render/RenderPrimitive.h>
+#include <render/SceneView.h>
+#include <core/profile/Profiler.h>
+#include <bit>
+
+namespace sky {
+
+    SceneCulling::SceneCulling(PmrResource *resource)
+        : views(resource)
+        , occluders(resource)
+    {
+    }
+
+    void SceneCulling::Update(const PmrVector<RenderPrimitive *> &primitives)
+    {
+        SKY_PROFILE_NAME("Culling Update")
+
+        const auto count = static_cast<uint32_t>(primitives.size());
+        bounds.Resize(count);
+        ready.assign(GetVisibilityWordCount(count), 0);
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto *prim = primitives[i];
+            bounds.Set(i, prim->worldBound);
+            if (prim->geometry && prim->IsReady()) {
+                ready[i >> 6] |= 1ULL << (i & 63);
+            }
+        }
+
+        // drop views not requested since the last build.
+        for (auto iter = views.begin(); iter != views.end();) {
+            iter = iter->second.version != version ? views.erase(iter) : std::next(iter);
+        }
+
+        // occluders are set before the update of the build they apply to.
+        for (auto iter = occluders.begin(); iter != occluders.end();) {
+            iter = iter->second.version != version ? occluders.erase(iter) : std::next(iter);
+        }
+        ++version;
+        stats = {};
+    }
+
+    void SceneCulling::SetOcclusion(const SceneView *view, const HizPyramid *hiz, const Matrix4 &viewProject)
+    {
+        if (hiz == nullptr || hiz->GetMipCount() == 0) {
+            occluders.erase(view);
+            return;
+        }
+
+        auto &occluder = occluders[view];
+        occluder.version = version;
+        occluder.hiz = hiz;
+        occluder.constants = {};
+        occluder.constants.viewProject = viewProject;
+        occluder.constants.hizSize = Vector4(static_cast<float>(hiz->GetWidth(0)), static_cast<float>(hiz->GetHeight(0)),
+            static_cast<float>(hiz->GetMipCount()), 0.f);
+        occluder.constants.flags = static_cast<uint32_t>(GPUCullFlagBit::HIZ);
+    }
+
+    const uint64_t *SceneCulling::GetVisibility(const SceneView *view)
+    {
+        auto &visibility = views[view];
+        if (visibility.version == version) {
+            return visibility.bits.data();
+        }
+
+        SKY_PROFILE_NAME("Frustum Culling")
+        visibility.version = version;
+        visibility.bits.assign(ready.size(), 0);
+
+        const auto &frustums = view->GetFrustums();
+        Cull(frustums.data(), static_cast<uint32_t>(frustums.size()), visibility.bits.data());
+        uint32_t tested = 0;
+        uint32_t passed = 0;
+        for (size_t i = 0; i < ready.size(); ++i) {
+            tested += static_cast<uint32_t>(std::popcount(ready[i]));
+            visibility.bits[i] &= ready[i];
+            passed += static_cast<uint32_t>(std::popcount(visibility.bits[i]));
+        }
+        stats.tested += tested;
+        stats.frustumRejected += tested - passed;
+
+        visibility.occluded.clear();
+        auto iter = occluders.find(view);
+        if (iter != occluders.end()) {
+            SKY_PROFILE_NAME("Occlusion Culling")
+            Occlude(iter->second, visibility);
+        }
+        return visibility.bits.data();
+    }
+
+    const uint64_t *SceneCulling::GetOccluded(const SceneView *view) const
+    {
+        auto iter = views.find(view);
+        return iter != views.end() && !iter->second.occluded.empty() ? iter->second.occluded.data() : nullptr;
+    }
+
+    void SceneCulling::Occlude(const Occluder &occluder, ViewVisibility &visibility)
+    {
+        visibility.occluded.assign(visibility.bits.size(), 0);
+
+        // only frustum survivors are tested, the pyramid lookup is far more expensive than the planes.
+        for (uint32_t word = 0; word < static_cast<uint32_t>(visibility.bits.size()); ++word) {
+            uint64_t bits = visibility.bits[word];
+            while (bits != 0) {
+                uint32_t bit = static_cast<uint32_t>(std::countr_zero(bits));
+                bits &= bits - 1;
+
+                uint32_t index = word * 64 + bit;
+                Vector4 center(bounds.centerX[index], bounds.centerY[index], bounds.centerZ[index], 0.f);
+                Vector4 extent(bounds.extentX[index], bounds.extentY[index], bounds.extentZ[index], 0.f);
+                if (!GPUHizTest(occluder.constants, *occluder.hiz, center, extent)) {
+                    visibility.bits[word] &= ~(1ULL << bit);
+                    visibility.occluded[word] |= 1ULL << bit;
+                }
+            }
+        }
+
+        for (auto word : visibility.occluded) {
+            stats.occlusionRejected += static_cast<uint32_t>(std::popcount(word));
+        }
+    }
+
+    void SceneCulling::Cull(const Frustum *frustums, uint32_t count, uint64_t *visibility) const
+    {
+        for (uint32_t i = 0; i < count; ++i) {
+            FrustumCulling(frustums[i], bounds, visibility);
+        }
+    }
+
+} // namespace sky
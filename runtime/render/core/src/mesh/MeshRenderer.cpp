@@ -7,9 +7,11 @@
 #include <render/resource/Meshlet.h>
 #include <render/RenderBuiltinLayout.h>
 #include <render/Renderer.h>
+#include <render/RenderScene.h>
 #include <render/RHI.h>
 #include <core/math/MathUtil.h>
 #include <core/template/Overloaded.h>
+#include <cstring>
 
 namespace sky {
 
@@ -66,8 +68,18 @@ namespace sky {
 
             primitive->vertexFlags |= (primitive->clusterValid) ? RenderVertexFlagBit::MESH_SHADER : RenderVertexFlagBit::NONE;
 
+            bool gpuScenePrimitive = false;
             if (primitive->geometry->attributeSemantics.TestBit(VertexSemanticFlagBit::HAS_SKIN)) {
                 FillVertexFlags(primitive->vertexFlags);
+            } else if (!primitive->clusterValid) {
+                std::memcpy(&primitive->instanceData, ubo->GetAddress(), sizeof(InstanceLocal));
+                primitive->worldBound = AABB::Transform(primitive->localBound, primitive->instanceData.worldMatrix);
+
+                // gpu driven primitives are culled by the gpu scene, the others are merged into instanced draws.
+                gpuScenePrimitive = gpuDriven;
+                if (!gpuScenePrimitive) {
+                    primitive->vertexFlags |= RenderVertexFlagBit::AUTO_INSTANCE;
+                }
             }
 
             const auto &cluster = primitive->geometry->cluster;
@@ -81,15 +93,15 @@ namespace sky {
                 meshletInfos[index]->WriteT(0, MeshletInfo{sub.firstMeshlet, sub.meshletCount, 0, 0});
 
                 primitive->instanceSet = meshFeature->RequestMeshResourceGroup();
-                primitive->instanceSet->BindDynamicUBO(Name("Local"), ubo, 0);
-                primitive->instanceSet->BindDynamicUBO(Name("MeshletInfo"), meshletInfos[index], 0, sizeof(MeshletInfo), 0);
-                primitive->instanceSet->BindBuffer(Name("PositionBuf"), cluster->posBuffer->GetRHIBuffer(), posOffset, posSize, 0);
-                primitive->instanceSet->BindBuffer(Name("ExtBuf"), cluster->extBuffer->GetRHIBuffer(), extOffset, extSize, 0);
-
-                primitive->instanceSet->BindBuffer(Name("VertexIndices"), cluster->meshletVertices->GetRHIBuffer(), 0);
-                primitive->instanceSet->BindBuffer(Name("MeshletTriangles"), cluster->meshletTriangles->GetRHIBuffer(), 0);
-                primitive->instanceSet->BindBuffer(Name("Meshlets"), cluster->meshlets->GetRHIBuffer(),0);
-                primitive->instanceSet->BindBuffer(Name("InstanceBuffer"), instanceBuffer->GetRHIBuffer(),0);
+                primitive->instanceSet->BindDynamicUBO("Local"_name, ubo, 0);
+                primitive->instanceSet->BindDynamicUBO("MeshletInfo"_name, meshletInfos[index], 0, sizeof(MeshletInfo), 0);
+                primitive->instanceSet->BindBuffer("PositionBuf"_name, cluster->posBuffer->GetRHIBuffer(), posOffset, posSize, 0);
+                primitive->instanceSet->BindBuffer("ExtBuf"_name, cluster->extBuffer->GetRHIBuffer(), extOffset, extSize, 0);
+
+                primitive->instanceSet->BindBuffer("VertexIndices"_name, cluster->meshletVertices->GetRHIBuffer(), 0);
+                primitive->instanceSet->BindBuffer("MeshletTriangles"_name, cluster->meshletTriangles->GetRHIBuffer(), 0);
+                primitive->instanceSet->BindBuffer("Meshlets"_name, cluster->meshlets->GetRHIBuffer(),0);
+                primitive->instanceSet->BindBuffer("InstanceBuffer"_name, instanceBuffer->GetRHIBuffer(),0);
                 primitive->instanceSet->Update();
 
                 primitive->args.emplace_back(rhi::CmdDispatchMesh {
@@ -97,7 +109,7 @@ namespace sky {
                 });
             } else {
                 primitive->instanceSet = meshFeature->RequestResourceGroup();
-                primitive->instanceSet->BindDynamicUBO(Name("Local"), ubo, 0);
+                primitive->instanceSet->BindDynamicUBO("Local"_name, ubo, 0);
                 primitive->instanceSet->Update();
 
                 primitive->args.emplace_back(rhi::CmdDrawIndexed {
@@ -109,6 +121,9 @@ namespace sky {
                 });
             }
             scene->AddPrimitive(primitive.get());
+            if (gpuScenePrimitive) {
+                scene->GetGPUScene().AddPrimitive(primitive.get());
+            }
 
             SetMaterial(sub.material, index++);
         }
@@ -132,7 +147,7 @@ namespace sky {
 
         auto *primitive = meshletDebug->GetPrimitive();
         primitive->instanceSet = MeshFeature::Get()->RequestResourceGroup();
-        primitive->instanceSet->BindDynamicUBO(Name("Local"), ubo, 0);
+        primitive->instanceSet->BindDynamicUBO("Local"_name, ubo, 0);
         primitive->instanceSet->Update();
     }
 
@@ -188,15 +203,19 @@ namespace sky {
         }
 
         for (auto &primitive : primitives) {
+            // instanced grid draws keep their own arguments.
+            scene->GetGPUScene().RemovePrimitive(primitive.get());
+
             primitive->geometry = ownGeometry;
             primitive->vertexFlags |= RenderVertexFlagBit::INSTANCE;
+            primitive->vertexFlags.ResetBit(RenderVertexFlagBit::AUTO_INSTANCE);
 
             primitive->localBound.min *= Vector3((float)gridX, (float)gridY, (float)gridZ);
             primitive->localBound.max *= Vector3((float)gridX, (float)gridY, (float)gridZ);
 
             const auto &cluster = primitive->geometry->cluster;
             if (cluster && primitive->clusterValid) {
-                primitive->instanceSet->BindBuffer(Name("InstanceBuffer"), instanceBuffer->GetRHIBuffer(),0);
+                primitive->instanceSet->BindBuffer("InstanceBuffer"_name, instanceBuffer->GetRHIBuffer(),0);
                 primitive->instanceSet->Update();
 
                 for (auto &arg : primitive->args) {
@@ -241,7 +260,7 @@ namespace sky {
         debugFlags = flag;
         for (auto &prim : primitives) {
             for (auto &batch : prim->batches) {
-                batch.SetOption(Name("MESH_SHADER_DEBUG"), static_cast<uint8_t>(debugFlags.TestBit(MeshDebugFlagBit::MESHLET)));
+                batch.SetOption("MESH_SHADER_DEBUG"_name, static_cast<uint8_t>(debugFlags.TestBit(MeshDebugFlagBit::MESHLET)));
             }
 
             for (auto &batch : prim->batches) {
@@ -260,12 +279,15 @@ namespace sky {
 
     void MeshRenderer::UpdateTransform(const Matrix4 &matrix)
     {
-        ubo->WriteT(0, matrix);
-        ubo->WriteT(sizeof(Matrix4), matrix.InverseTranspose());
+        InstanceLocal local = {matrix, matrix.InverseTranspose()};
+        ubo->WriteT(0, local.worldMatrix);
+        ubo->WriteT(sizeof(Matrix4), local.inverseTranspose);
         ubo->Upload();
 
         for (auto &prim : primitives) {
             prim->worldBound = AABB::Transform(prim->localBound, matrix);
+            prim->instanceData = local;
+            scene->GetGPUScene().UpdatePrimitive(prim.get());
         }
     }
 
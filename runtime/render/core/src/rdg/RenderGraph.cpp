@@ -11,19 +11,19 @@ namespace sky::rdg {
 
     ResourceGraph::ResourceGraph(RenderGraphContext *ctx)
         : context(ctx)
-        , vertices(&ctx->resources)
-        , names(&ctx->resources)
-        , lastAccesses(&ctx->resources)
-        , tags(&ctx->resources)
-        , polymorphicDatas(&ctx->resources)
-        , images(&ctx->resources)
-        , importImages(&ctx->resources)
-        , imageViews(&ctx->resources)
-        , buffers(&ctx->resources)
-        , importBuffers(&ctx->resources)
-        , bufferViews(&ctx->resources)
+        , vertices(ctx->resources)
+        , names(ctx->resources)
+        , lastAccesses(ctx->resources)
+        , tags(ctx->resources)
+        , polymorphicDatas(ctx->resources)
+        , images(ctx->resources)
+        , importImages(ctx->resources)
+        , imageViews(ctx->resources)
+        , buffers(ctx->resources)
+        , importBuffers(ctx->resources)
+        , bufferViews(ctx->resources)
     {
-        AddVertex(Name("root"), Root{}, *this);
+        AddVertex("root"_name, Root{}, *this);
     }
 
     void ResourceGraph::AddImage(const Name &name, const GraphImage &image)
@@ -90,41 +90,41 @@ namespace sky::rdg {
 
     RenderGraph::RenderGraph(RenderGraphContext *ctx)
         : context(ctx)
-        , vertices(&ctx->resources)
-        , names(&ctx->resources)
-        , accessNodes(&ctx->resources)
-        , tags(&ctx->resources)
-        , polymorphicDatas(&ctx->resources)
-        , rasterPasses(&ctx->resources)
-        , subPasses(&ctx->resources)
-        , computePasses(&ctx->resources)
-        , copyBlitPasses(&ctx->resources)
-        , presentPasses(&ctx->resources)
+        , vertices(ctx->resources)
+        , names(ctx->resources)
+        , accessNodes(ctx->resources)
+        , tags(ctx->resources)
+        , polymorphicDatas(ctx->resources)
+        , rasterPasses(ctx->resources)
+        , subPasses(ctx->resources)
+        , computePasses(ctx->resources)
+        , copyBlitPasses(ctx->resources)
+        , presentPasses(ctx->resources)
         , resourceGraph(ctx)
         , accessGraph(ctx)
     {
-        AddVertex(Name("root"), Root{}, *this);
+        AddVertex("root"_name, Root{}, *this);
 
         ctx->rdgData.Reset();
     }
 
     RasterPassBuilder RenderGraph::AddRasterPass(const Name &name, uint32_t width, uint32_t height)
     {
-        auto vtx = AddVertex(name, RasterPass(width, height, &context->resources), *this);
+        auto vtx = AddVertex(name, RasterPass(width, height, context->resources), *this);
         add_edge(0, vtx, graph);
         return RasterPassBuilder{*this, rasterPasses[polymorphicDatas[vtx]], vtx};
     }
 
     ComputePassBuilder RenderGraph::AddComputePass(const Name &name)
     {
-        auto vtx = AddVertex(name, ComputePass{&context->resources}, *this);
+        auto vtx = AddVertex(name, ComputePass{context->resources}, *this);
         add_edge(0, vtx, graph);
         return ComputePassBuilder{*this, computePasses[polymorphicDatas[vtx]], vtx};
     }
 
     CopyPassBuilder RenderGraph::AddCopyPass(const Name &name)
     {
-        auto vtx = AddVertex(name, CopyBlitPass{&context->resources}, *this);
+        auto vtx = AddVertex(name, CopyBlitPass{context->resources}, *this);
         add_edge(0, vtx, graph);
         return CopyPassBuilder{*this, copyBlitPasses[polymorphicDatas[vtx]], vtx};
     }
@@ -140,7 +140,7 @@ namespace sky::rdg {
         auto resID = FindVertex(resName, resourceGraph);
         SKY_ASSERT(resID != INVALID_VERTEX);
 
-        auto vtx = AddVertex(name, TransitionPass(resID, &context->resources), *this);
+        auto vtx = AddVertex(name, TransitionPass(resID, context->resources), *this);
         add_edge(0, vtx, graph);
         AddDependency(resID, vtx, deps);
     }
@@ -153,14 +153,14 @@ namespace sky::rdg {
         std::visit(Overloaded{
             [&](const ImportSwapChainTag &tag) {
                 const auto &res = resourceGraph.swapChains[Index(resID, resourceGraph)];
-                auto vtx = AddVertex(name, PresentPass(resID, res.desc.swapchain, &context->resources), *this);
+                auto vtx = AddVertex(name, PresentPass(resID, res.desc.swapchain, context->resources), *this);
                 add_edge(0, vtx, graph);
                 AddDependency(resID, vtx, DependencyInfo{PresentType::PRESENT, ResourceAccessBit::READ, {}});
             },
 #ifdef SKY_ENABLE_XR
             [&](const ImportXRSwapChainTag &tag) {
                 const auto &res = resourceGraph.xrSwapChains[Index(resID, resourceGraph)];
-                auto vtx = AddVertex(name, PresentPass(resID, res.desc.swapchain, &context->resources), *this);
+                auto vtx = AddVertex(name, PresentPass(resID, res.desc.swapchain, context->resources), *this);
                 add_edge(0, vtx, graph);
                 AddDependency(resID, vtx, DependencyInfo{PresentType::PRESENT, ResourceAccessBit::READ, {}});
             },
@@ -171,9 +171,9 @@ namespace sky::rdg {
 
     AccessGraph::AccessGraph(RenderGraphContext *ctx)
         : context(ctx)
-        , vertices(&ctx->resources)
-        , tags(&ctx->resources)
-        , polymorphicDatas(&ctx->resources)
+        , vertices(ctx->resources)
+        , tags(ctx->resources)
+        , polymorphicDatas(ctx->resources)
     {
     }
 
@@ -246,7 +246,7 @@ namespace sky::rdg {
 
     RasterSubPassBuilder RasterPassBuilder::AddRasterSubPass(const Name &name)
     {
-        auto dst = AddVertex(name, RasterSubPass{&rdg.context->resources}, rdg);
+        auto dst = AddVertex(name, RasterSubPass{rdg.context->resources}, rdg);
         add_edge(vertex, dst, rdg.graph);
         auto &rasterPass = rdg.rasterPasses[rdg.polymorphicDatas[vertex]];
         auto &subPass = rdg.subPasses[rdg.polymorphicDatas[dst]];
@@ -336,7 +336,7 @@ namespace sky::rdg {
 
     RasterQueueBuilder RasterSubPassBuilder::AddQueue(const Name &name)
     {
-        auto res = AddVertex(name, RasterQueue(&rdg.context->resources, vertex), rdg);
+        auto res = AddVertex(name, RasterQueue(rdg.context->resources, vertex), rdg);
         auto &queue = rdg.rasterQueues[rdg.polymorphicDatas[res]];
         add_edge(vertex, res, rdg.graph);
         return RasterQueueBuilder{rdg, queue, res};
@@ -344,7 +344,7 @@ namespace sky::rdg {
 
     FullScreenBuilder RasterSubPassBuilder::AddFullScreen(const Name &name)
     {
-        auto res = AddVertex(name, FullScreenBlit(&rdg.context->resources, vertex), rdg);
+        auto res = AddVertex(name, FullScreenBlit(rdg.context->resources, vertex), rdg);
         auto &fullscreen = rdg.fullScreens[rdg.polymorphicDatas[res]];
         add_edge(vertex, res, rdg.graph);
         return FullScreenBuilder{rdg, fullscreen, res};
@@ -386,6 +386,60 @@ namespace sky::rdg {
         return *this;
     }
 
+    ComputePassBuilder &ComputePassBuilder::AddComputeView(const Name &name, const ComputeView &view)
+    {
+        auto res = FindVertex(name, rdg.resourceGraph);
+        SKY_ASSERT(res != INVALID_VERTEX);
+
+        compute.computeViews.emplace(name, view);
+        rdg.AddDependency(res, vertex, DependencyInfo{view.type, view.access, view.visibility});
+        return *this;
+    }
+
+    ComputePassBuilder &ComputePassBuilder::AddSamplerView(const Name &name, const Name& viewName)
+    {
+        auto res = FindVertex(name, rdg.resourceGraph);
+        SKY_ASSERT(res != INVALID_VERTEX);
+
+        compute.computeViews.emplace(name, ComputeView{viewName});
+        return *this;
+    }
+
+    ComputePassBuilder &ComputePassBuilder::AddIndirectOutput(const Name &name)
+    {
+        auto res = FindVertex(name, rdg.resourceGraph);
+        SKY_ASSERT(res != INVALID_VERTEX);
+
+        compute.indirectOutputs.emplace_back(res);
+        return *this;
+    }
+
+    ComputePassBuilder &ComputePassBuilder::SetLayout(const RDResourceLayoutPtr &layout)
+    {
+        compute.layout = layout;
+        return *this;
+    }
+
+    ComputePassBuilder &ComputePassBuilder::SetPipeline(const rhi::ComputePipelinePtr &pso)
+    {
+        compute.pso = pso;
+        return *this;
+    }
+
+    ComputePassBuilder &ComputePassBuilder::Dispatch(uint32_t x, uint32_t y, uint32_t z)
+    {
+        compute.groupX = x;
+        compute.groupY = y;
+        compute.groupZ = z;
+        return *this;
+    }
+
+    RasterQueueBuilder &RasterQueueBuilder::SetSort(RasterQueueSort sort)
+    {
+        queue.sort = sort;
+        return *this;
+    }
+
     FullScreenBuilder &FullScreenBuilder::SetTechnique(const RDGfxTechPtr &tech)
     {
         fullscreen.technique = tech;
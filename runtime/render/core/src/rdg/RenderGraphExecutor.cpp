@@ -33,6 +33,22 @@ namespace sky::rdg {
         return res;
     }
 
+    static rhi::BufferPtr GetGraphBuffer(ResourceGraph &resourceGraph, VertexType resID)
+    {
+        rhi::BufferPtr res;
+        std::visit(Overloaded{
+            [&](const BufferTag &) {
+                res = resourceGraph.buffers[Index(resID, resourceGraph)].desc.buffer;
+            },
+            [&](const ImportBufferTag &) {
+                res = resourceGraph.importBuffers[Index(resID, resourceGraph)].desc.buffer;
+            },
+            [&](const auto &) {
+            }
+        }, Tag(resID, resourceGraph));
+        return res;
+    }
+
     void RenderGraphExecutor::Barriers(const PmrHashMap<VertexType, std::vector<GraphBarrier>>& barrierSet) const
     {
         const auto &mainCommandBuffer = graph.context->MainCommandBuffer();
@@ -113,6 +129,171 @@ namespace sky::rdg {
         mainCommandBuffer->FlushBarriers();
     }
 
+    // queues below this size are recorded inline, splitting them costs more than it saves.
+    static constexpr size_t PARALLEL_RECORD_MIN_ITEMS = 256;
+    static constexpr size_t PARALLEL_RECORD_CHUNK_ITEMS = 128;
+
+    bool RenderGraphExecutor::UseParallelRecord(Vertex pass) const
+    {
+        for (const auto &queue : graph.rasterQueues) {
+            if (queue.drawItems.size() >= PARALLEL_RECORD_MIN_ITEMS &&
+                graph.subPasses[Index(queue.passID, graph)].parent == pass) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void RenderGraphExecutor::ExecuteQueue(const RasterQueue &queue)
+    {
+        auto &stat = graph.context->rdgData;
+        if (!parallelPass) {
+            EncodeQueue(queue, 0, queue.drawItems.size(), *currentEncoder, stat);
+            return;
+        }
+
+        auto &executor = graph.context->executor;
+        auto itemCount = queue.drawItems.size();
+        auto chunkCount = static_cast<uint32_t>(std::min(itemCount / PARALLEL_RECORD_CHUNK_ITEMS + 1, executor.num_workers() + 1));
+        auto chunkSize = (itemCount + chunkCount - 1) / chunkCount;
+
+        auto parallel = graph.context->MainCommandBuffer()->EncodeParallel(*currentEncoder, chunkCount);
+        std::vector<RenderGraphData> chunkStats(chunkCount);
+        auto encodeChunk = [&](uint32_t index) {
+            auto begin = std::min(itemCount, index * chunkSize);
+            auto end = std::min(itemCount, begin + chunkSize);
+            chunkStats[index].Reset();
+            EncodeQueue(queue, begin, end, parallel->BeginChunk(index), chunkStats[index]);
+            parallel->EndChunk(index);
+        };
+
+        if (chunkCount > 1 && parallel->IsParallel()) {
+            tf::Taskflow taskflow;
+            for (uint32_t i = 0; i < chunkCount; ++i) {
+                taskflow.emplace([&encodeChunk, i]() { encodeChunk(i); });
+            }
+            executor.run(taskflow).wait();
+            stat.parallelChunk += chunkCount;
+        } else {
+            for (uint32_t i = 0; i < chunkCount; ++i) {
+                encodeChunk(i);
+            }
+        }
+        parallel->Execute();
+
+        for (const auto &chunkStat : chunkStats) {
+            stat.Accumulate(chunkStat);
+        }
+    }
+
+    void RenderGraphExecutor::EncodeQueue(const RasterQueue &queue, size_t begin, size_t end, rhi::GraphicsEncoder &encoder, RenderGraphData &stat) const
+    {
+        // states bound by the previous draw item of this queue.
+        // descriptor sets follow the pipeline layout, so they are bound again after a pipeline change.
+        const rhi::GraphicsPipeline *lastPso = nullptr;
+        const ResourceGroup *lastBatchGroup = nullptr;
+        const rhi::VertexAssembly *lastVao = nullptr;
+        const rhi::Buffer *lastIndexBuffer = nullptr;
+        uint64_t lastIndexOffset = 0;
+
+        for (size_t i = begin; i < end; ++i) {
+            const auto &item = queue.drawItems[i];
+            auto &batch = item.primitive->batches[item.techIndex];
+
+            bool psoChanged = batch.pso.get() != lastPso;
+            if (psoChanged) {
+                encoder.BindPipeline(batch.pso);
+                lastPso = batch.pso.get();
+                stat.pipelineBind++;
+
+                if (queue.resourceGroup != nullptr && ((batch.pso->GetDescriptorMask() & (1 << 0)) != 0u)) {
+                    queue.resourceGroup->OnBind(encoder, 0);
+                } else {
+                    graph.context->emptySet->OnBind(encoder, 0);
+                }
+            } else {
+                stat.pipelineBindSkipped++;
+                stat.resourceBindSkipped++;
+            }
+
+            ResourceGroup *batchGroup = batch.batchGroup && ((batch.pso->GetDescriptorMask() & (1 << 1)) != 0u) ?
+                batch.batchGroup.Get() : graph.context->emptySet.Get();
+            if (psoChanged || batchGroup != lastBatchGroup) {
+                batchGroup->OnBind(encoder, 1);
+                lastBatchGroup = batchGroup;
+            } else {
+                stat.resourceBindSkipped++;
+            }
+
+            if ((batch.pso->GetDescriptorMask() & (1 << 2)) != 0u) {
+                if (item.instanceCount != 0) {
+                    graph.context->instanceStream.OnBind(encoder, item.instanceOffset);
+                } else if (item.primitive->instanceSet) {
+                    item.primitive->instanceSet->OnBind(encoder, 2);
+                }
+            }
+
+            if (batch.vao) {
+                if (batch.vao.get() != lastVao) {
+                    encoder.BindAssembly(batch.vao);
+                    lastVao = batch.vao.get();
+                } else {
+                    stat.resourceBindSkipped++;
+                }
+            } else {
+                std::vector<rhi::BufferView> vertexBuffers;
+                item.primitive->geometry->FillVertexBuffer(vertexBuffers);
+                encoder.BindVertexBuffers(vertexBuffers);
+                lastVao = nullptr;
+            }
+
+            const auto &ib = item.primitive->geometry->indexBuffer;
+            if (ib.buffer) {
+                auto view = ib.MakeView();
+                if (view.buffer.get() != lastIndexBuffer || view.offset != lastIndexOffset) {
+                    encoder.BindIndexBuffer(view, ib.indexType);
+                    lastIndexBuffer = view.buffer.get();
+                    lastIndexOffset = view.offset;
+                } else {
+                    stat.resourceBindSkipped++;
+                }
+            }
+
+            for (const auto &arg : item.primitive->args) {
+                std::visit(Overloaded{
+                    [&](rhi::CmdDrawLinear v) {
+                        v.instanceCount = item.instanceCount != 0 ? item.instanceCount : v.instanceCount;
+                        encoder.DrawLinear(v);
+                    },
+                    [&](rhi::CmdDrawIndexed v) {
+                        if (queue.indirect && item.primitive->indirectBuffer) {
+                            // instance count was written by gpu culling.
+                            encoder.DrawIndexedIndirect(item.primitive->indirectBuffer,
+                                item.primitive->indirectOffset, 1, sizeof(rhi::CmdDrawIndexed));
+                            stat.indirectDraw++;
+                            return;
+                        }
+                        v.instanceCount = item.instanceCount != 0 ? item.instanceCount : v.instanceCount;
+                        encoder.DrawIndexed(v);
+                        stat.triangleData += v.indexCount / 3 * v.instanceCount;
+                    },
+                    [&](const rhi::CmdDispatchMesh &v) {
+                        encoder.DispatchMesh(v);
+                    },
+                    [&](const rhi::Viewport &v) {
+                        encoder.SetViewport(1, &v);
+                    },
+                    [&](const rhi::Rect2D &v) {
+                        encoder.SetScissor(1, &v);
+                    },
+                    [&](const auto &) {}
+                }, arg);
+
+                stat.drawCall++;
+            }
+        }
+    }
+
     [[maybe_unused]] void RenderGraphExecutor::discover_vertex(Vertex u, const Graph& g) // NOLINT
     {
         const auto &mainCommandBuffer = graph.context->MainCommandBuffer();
@@ -127,6 +308,9 @@ namespace sky::rdg {
                 beginInfo.clearCount  = static_cast<uint32_t>(raster.clearValues.size());
                 beginInfo.clearValues = raster.clearValues.data();
 
+                parallelPass = mainCommandBuffer->SupportParallelEncode() && UseParallelRecord(u);
+                beginInfo.contents = parallelPass ? rhi::SubPassContent::SECONDARY_COMMAND_BUFFERS : rhi::SubPassContent::INLINE;
+
                 currentEncoder = mainCommandBuffer->EncodeGraphics();
                 currentEncoder->BeginPass(beginInfo);
 
@@ -141,12 +325,21 @@ namespace sky::rdg {
 
                 ++currentSubPassIndex;
                 if (currentSubPassIndex < currentSubPassNum) {
-                    currentEncoder->NextSubPass();
+                    currentEncoder->NextSubPass(parallelPass ? rhi::SubPassContent::SECONDARY_COMMAND_BUFFERS : rhi::SubPassContent::INLINE);
                 }
             },
             [&](const ComputePassTag &) {
                 auto &compute = graph.computePasses[Index(u, graph)];
                 Barriers(compute.frontBarriers);
+
+                auto encoder = compute.pso ? mainCommandBuffer->EncodeCompute() : nullptr;
+                if (encoder && compute.groupX != 0) {
+                    encoder->BindPipeline(compute.pso);
+                    if (compute.resourceGroup != nullptr) {
+                        compute.resourceGroup->OnBind(*encoder, 0);
+                    }
+                    encoder->Dispatch(compute.groupX, compute.groupY, compute.groupZ);
+                }
                 callStack.emplace_back(graph.names[u]);
             },
             [&](const TransitionTag &) {
@@ -185,72 +378,21 @@ namespace sky::rdg {
                 callStack.emplace_back(graph.names[u]);
             },
             [&](const RasterQueueTag &) {
-                auto &queue = graph.rasterQueues[Index(u, graph)];
-                for (auto &item : queue.drawItems) {
-                    auto &batch = item.primitive->batches[item.techIndex];
-
-                    currentEncoder->BindPipeline(batch.pso);
-                    if (queue.resourceGroup != nullptr && ((batch.pso->GetDescriptorMask() & (1 << 0)) != 0u)) {
-                        queue.resourceGroup->OnBind(*currentEncoder, 0);
-                    } else {
-                        graph.context->emptySet->OnBind(*currentEncoder, 0);
-                    }
-
-                    if (batch.batchGroup && ((batch.pso->GetDescriptorMask() & (1 << 1)) != 0u)) {
-                        batch.batchGroup->OnBind(*currentEncoder, 1);
-                    } else {
-                        graph.context->emptySet->OnBind(*currentEncoder, 1);
-                    }
-
-                    if (item.primitive->instanceSet && ((batch.pso->GetDescriptorMask() & (1 << 2)) != 0u)) {
-                        item.primitive->instanceSet->OnBind(*currentEncoder, 2);
-                    }
-
-                    if (batch.vao) {
-                        currentEncoder->BindAssembly(batch.vao);
-                    } else {
-                        std::vector<rhi::BufferView> vertexBuffers;
-                        item.primitive->geometry->FillVertexBuffer(vertexBuffers);
-                        currentEncoder->BindVertexBuffers(vertexBuffers);
-                    }
-
-                    const auto &ib = item.primitive->geometry->indexBuffer;
-                    if (ib.buffer) {
-                        currentEncoder->BindIndexBuffer(ib.MakeView(), ib.indexType);
-                    }
-
-                    for (const auto &arg : item.primitive->args) {
-                        std::visit(Overloaded{
-                            [&](const rhi::CmdDrawLinear &v) {
-                                currentEncoder->DrawLinear(v);
-                            },
-                            [&](const rhi::CmdDrawIndexed &v) {
-                                currentEncoder->DrawIndexed(v);
-                                graph.context->rdgData.triangleData += v.indexCount / 3 * v.instanceCount;
-                            },
-                            [&](const rhi::CmdDispatchMesh &v) {
-                                currentEncoder->DispatchMesh(v);
-                            },
-                            [&](const rhi::Viewport &v) {
-                                currentEncoder->SetViewport(1, &v);
-                            },
-                            [&](const rhi::Rect2D &v) {
-                                currentEncoder->SetScissor(1, &v);
-                            },
-                            [&](const auto &) {}
-                        }, arg);
-
-                        graph.context->rdgData.drawCall++;
-                    }
-                }
+                ExecuteQueue(graph.rasterQueues[Index(u, graph)]);
             },
             [&](const FullScreenBlitTag &) {
                 auto &fullScreen = graph.fullScreens[Index(u, graph)];
-                currentEncoder->BindPipeline(fullScreen.pso);
+                auto parallel = parallelPass ? mainCommandBuffer->EncodeParallel(*currentEncoder, 1) : nullptr;
+                auto &encoder = parallel ? parallel->BeginChunk(0) : *currentEncoder;
+                encoder.BindPipeline(fullScreen.pso);
                 if (fullScreen.resourceGroup != nullptr) {
-                    fullScreen.resourceGroup->OnBind(*currentEncoder, 0);
+                    fullScreen.resourceGroup->OnBind(encoder, 0);
+                }
+                encoder.DrawLinear({3, 1, 0, 0});
+                if (parallel) {
+                    parallel->EndChunk(0);
+                    parallel->Execute();
                 }
-                currentEncoder->DrawLinear({3, 1, 0, 0});
             },
             [&](const auto &) {}
         }, Tag(u, graph));
@@ -262,12 +404,22 @@ namespace sky::rdg {
             [&](const RasterPassTag &) {
                 auto &raster = graph.rasterPasses[Index(u, graph)];
                 currentEncoder->EndPass();
+                parallelPass = false;
                 Barriers(raster.rearBarriers);
                 callStack.pop_back();
             },
             [&](const ComputePassTag &) {
                 auto &compute = graph.computePasses[Index(u, graph)];
                 Barriers(compute.rearBarriers);
+
+                // indirect arguments are read by draws that do not show up as accesses in the graph.
+                const auto &mainCommandBuffer = graph.context->MainCommandBuffer();
+                for (auto resID : compute.indirectOutputs) {
+                    auto buffer = GetGraphBuffer(graph.resourceGraph, resID);
+                    mainCommandBuffer->QueueBarrier(buffer, 0, buffer->GetBufferDesc().size,
+                        rhi::BarrierInfo{rhi::AccessFlagBit::COMPUTE_UAV_WRITE, rhi::AccessFlagBit::INDIRECT_BUFFER});
+                }
+                mainCommandBuffer->FlushBarriers();
                 callStack.pop_back();
             },
             [&](const CopyBlitTag &) {
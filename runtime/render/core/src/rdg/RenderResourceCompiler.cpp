@@ -64,6 +64,10 @@ namespace sky::rdg {
                     const auto &buffer = rdg.resourceGraph.buffers[Index(res, rdg.resourceGraph)];
                     rsg.BindBuffer(view.name, buffer.desc.buffer, 0);
                 },
+                [&](const ImportBufferTag &) {
+                    const auto &buffer = rdg.resourceGraph.importBuffers[Index(res, rdg.resourceGraph)];
+                    rsg.BindBuffer(view.name, buffer.desc.buffer, 0);
+                },
                 [&](const ImportImageTag &) {
                     const auto &image = rdg.resourceGraph.importImages[Index(res, rdg.resourceGraph)];
                     rsg.BindTexture(view.name, image.res, 0);
@@ -114,8 +118,10 @@ namespace sky::rdg {
         for (auto &[name, compute] : pass.computeViews) {
             MountResource(u, FindVertex(name, rdg.resourceGraph));
         }
-        pass.resourceGroup = rdg.context->pool->RequestResourceGroup(u, pass.layout);
-        BindResourceGroup(rdg, pass.computeViews, *pass.resourceGroup);
+        if (pass.layout) {
+            pass.resourceGroup = rdg.context->pool->RequestResourceGroup(u, pass.layout);
+            BindResourceGroup(rdg, pass.computeViews, *pass.resourceGroup);
+        }
     }
 
     void RenderResourceCompiler::Compile(Vertex u, CopyBlitPass &pass)
@@ -6,19 +6,71 @@
 #include <render/RenderPrimitive.h>
 #include <render/rdg/RenderGraph.h>
 #include <render/RenderScene.h>
+#include <render/Renderer.h>
+#include <render/PipelineCompiler.h>
 #include <core/logger/Logger.h>
+#include <core/profile/Profiler.h>
+#include <core/util/RadixSort.h>
+#include <core/template/Overloaded.h>
+#include <core/hash/Hash.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
 
 static const char *TAG = "Renderer";
 
 namespace sky::rdg {
-    static void BuildRenderBatch(RenderPrimitive* primitive, uint32_t batchIndex, const RasterPass &pass, uint32_t subPassId)
+    // 1024 primitives per job.
+    static constexpr uint32_t QUEUE_BUILD_CHUNK_WORDS = 16;
+
+    static void RequestBatchPso(PipelineCompiler &compiler, RenderPrimitive* primitive, RenderBatch &batch, const ShaderVariantKey &final,
+        const rhi::PipelineState &state, const RasterPass &pass, uint32_t subPassId)
     {
-        auto &batch = primitive->batches[batchIndex];
+        PipelineVariant variant = {};
+        variant.technique   = batch.technique->GetName();
+        variant.key         = final;
+        variant.meshShading = primitive->clusterValid;
+        variant.topo        = batch.topo;
+        variant.polygonMode = batch.polygonMode;
+        variant.passHash    = pass.renderPass->GetCompatibleHash();
+        variant.subPassID   = subPassId;
+        if (primitive->geometry) {
+            primitive->geometry->FillVertexDesc(batch.program, variant.attributes, variant.bindings);
+        }
+        for (auto &attr : variant.attributes) {
+            attr.sematic = nullptr;
+        }
+
+        PipelineRequest request = {};
+        request.program    = batch.program;
+        request.state      = state;
+        request.vertexDesc = batch.vertexDesc;
+        request.vertexHash = PipelineCompiler::HashVertexLayout(variant.attributes, variant.bindings);
+        request.pass       = pass.renderPass;
+        request.subPassID  = subPassId;
+
+        // techniques without a name can not be resolved again, they are not captured.
+        batch.pso = compiler.RequestPso(request, !variant.technique.Empty() ? &variant : nullptr);
+        batch.psoPending = !batch.pso;
+        if (batch.pso) {
+            return;
+        }
 
-        ShaderVariantKey vertexKey = {};
-        batch.technique->ProcessVertexVariantKey(primitive->vertexFlags, vertexKey);
+        // fallback shares the vertex layout of the batch, only its program differs.
+        const auto &fallback = compiler.GetFallbackTechnique();
+        if (fallback) {
+            request.program = fallback->RequestProgram(pass.passKey);
+            request.state = fallback->GetPipelineState();
+            request.state.inputAssembly.topology = batch.topo;
+            request.state.rasterState.polygonMode = batch.polygonMode;
+            batch.pso = compiler.RequestPsoSync(request);
+        }
+    }
 
-        ShaderVariantKey final = pass.passKey | vertexKey | batch.batchKey;
+    // resolve step, may create programs and pipelines. must run on a single thread.
+    static void BuildRenderBatch(RenderPrimitive* primitive, uint32_t batchIndex, const ShaderVariantKey &final, const RasterPass &pass, uint32_t subPassId)
+    {
+        auto &batch = primitive->batches[batchIndex];
 
         bool needRebuildPso = false;
         if (final != batch.cacheFinalKey || !batch.program) {
@@ -45,6 +97,9 @@ namespace sky::rdg {
             needRebuildPso = true;
         }
 
+        // pending pipelines are polled until the compile job has finished.
+        needRebuildPso |= batch.psoPending;
+
         if (needRebuildPso) {
             needRebuildPso &= static_cast<bool>(batch.program);
 //            needRebuildPso &= static_cast<bool>(batch.vertexDesc);
@@ -57,7 +112,12 @@ namespace sky::rdg {
                 pState.inputAssembly.topology = batch.topo;
                 pState.rasterState.polygonMode = batch.polygonMode;
 
-                batch.pso = GraphicsTechnique::BuildPso(batch.program, pState, batch.vertexDesc, pass.renderPass, subPassId);
+                auto *compiler = Renderer::Get()->GetPipelineCompiler();
+                if (compiler != nullptr) {
+                    RequestBatchPso(*compiler, primitive, batch, final, pState, pass, subPassId);
+                } else {
+                    batch.pso = GraphicsTechnique::BuildPso(batch.program, pState, batch.vertexDesc, pass.renderPass, subPassId);
+                }
             }
         }
 
@@ -70,29 +130,252 @@ namespace sky::rdg {
         }
     }
 
-    static void BuildRenderPrimitive(RenderGraph &graph, RasterQueue &queue, RenderPrimitive* primitive)
+    struct DrawCandidate {
+        RenderPrimitive *primitive;
+        uint32_t batchIndex;
+        ShaderVariantKey finalKey;
+    };
+
+    struct QueueBuildJob {
+        RasterQueue *queue;
+        const RasterPass *pass;
+        uint32_t subPassId;
+        const uint64_t *visibility;
+        uint32_t beginWord;
+        uint32_t endWord;
+        PmrVector<DrawCandidate> candidates; // frame memory, filled on worker threads.
+    };
+
+    // parallel step, only reads primitive and technique states.
+    static void CollectCandidates(const PmrVector<RenderPrimitive *> &primitives, QueueBuildJob &job)
+    {
+        const auto &queue = *job.queue;
+        uint32_t sceneMask = queue.sceneView != nullptr ? queue.sceneView->GetViewMask() : 0xFFFFFFFF;
+
+        for (uint32_t i = job.beginWord; i < job.endWord; ++i) {
+            for (uint64_t bits = job.visibility[i]; bits != 0; bits &= bits - 1) {
+                auto *primitive = primitives[(i << 6) + static_cast<uint32_t>(std::countr_zero(bits))];
+
+                for (uint32_t j = 0; j < primitive->batches.size(); ++j) {
+                    const auto &batch = primitive->batches[j];
+
+                    uint32_t viewMask = batch.technique->GetViewMask();
+                    const Name &rasterID = batch.technique->GetRasterID();
+                    if ((sceneMask & viewMask) != sceneMask || rasterID != queue.rasterID) {
+                        continue;
+                    }
+
+                    ShaderVariantKey vertexKey = {};
+                    batch.technique->ProcessVertexVariantKey(primitive->vertexFlags, vertexKey);
+                    job.candidates.emplace_back(DrawCandidate{primitive, j, job.pass->passKey | vertexKey | batch.batchKey});
+                }
+            }
+        }
+    }
+
+    // dense ids keep state keys small, ids follow the first appearance inside the queue.
+    class StateIdMap {
+    public:
+        explicit StateIdMap(PmrResource *res) : ids(res) {}
+
+        uint64_t Get(uint64_t state, uint64_t mask)
+        {
+            auto [iter, inserted] = ids.emplace(state, static_cast<uint64_t>(ids.size()));
+            return iter->second & mask;
+        }
+
+        uint64_t Get(const void *ptr, uint64_t mask)
+        {
+            return Get(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr)), mask);
+        }
+
+        void Reset() { ids.clear(); }
+
+    private:
+        PmrHashMap<uint64_t, uint64_t> ids;
+    };
+
+    // geometry and draw range, identical identities are candidates of one instanced draw.
+    static uint64_t DrawIdentity(const RenderPrimitive &primitive)
+    {
+        uint32_t hash = 0;
+        for (const auto &arg : primitive.args) {
+            std::visit(Overloaded{
+                [&hash](const rhi::CmdDrawIndexed &v) {
+                    HashCombine32(hash, v.indexCount);
+                    HashCombine32(hash, v.firstIndex);
+                    HashCombine32(hash, static_cast<uint32_t>(v.vertexOffset));
+                },
+                [&hash](const rhi::CmdDrawLinear &v) {
+                    HashCombine32(hash, v.vertexCount);
+                    HashCombine32(hash, v.firstVertex);
+                },
+                [](const auto &) {}
+            }, arg);
+        }
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(primitive.geometry.Get())) ^ (static_cast<uint64_t>(hash) << 32);
+    }
+
+    // positive float bits are ordered like the float values.
+    static uint32_t ViewDistanceBits(const RenderPrimitive &primitive, const Vector3 &eye)
     {
-        const auto &subPass = graph.subPasses[Index(queue.passID, graph)];
-        const auto &rasterPass = graph.rasterPasses[Index(subPass.parent, graph)];
+        Vector3 delta = (primitive.worldBound.min + primitive.worldBound.max) * 0.5f - eye;
+        float dist = delta.Dot(delta);
+        uint32_t bits = 0;
+        std::memcpy(&bits, &dist, sizeof(float));
+        return bits;
+    }
+
+    // every queue belongs to one sub pass, so the pass part of the key is implied by the queue order.
+    // FRONT_TO_BACK: | pso 16 | batch group 16 | draw identity 16 | distance 16 |
+    // BACK_TO_FRONT: | inverse distance 32 | pso 12 | batch group 10 | draw identity 10 |
+    static void SortDrawItems(RasterQueue &queue, StateIdMap &psoIds, StateIdMap &groupIds, StateIdMap &drawIds)
+    {
+        const auto count = static_cast<uint32_t>(queue.drawItems.size());
+        if (queue.sort == RasterQueueSort::NONE || count < 2) {
+            return;
+        }
+
+        Vector3 eye = {};
+        if (queue.sceneView != nullptr) {
+            const auto &world = queue.sceneView->GetWorld();
+            eye = Vector3(world[3].x, world[3].y, world[3].z);
+        }
 
-        for (uint32_t i = 0; i < primitive->batches.size(); ++i) {
-            auto &batch = primitive->batches[i];
+        psoIds.Reset();
+        groupIds.Reset();
+        drawIds.Reset();
 
-            uint32_t viewMask = batch.technique->GetViewMask();
-            Name rasterID = batch.technique->GetRasterID();
+        auto *res = queue.drawItems.get_allocator().resource();
+        PmrVector<RadixSortItem> items(count, res);
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto &item = queue.drawItems[i];
+            const auto &batch = item.primitive->batches[item.techIndex];
+            uint32_t dist = ViewDistanceBits(*item.primitive, eye);
 
-            uint32_t sceneMask = queue.sceneView != nullptr ? queue.sceneView->GetViewMask() : 0xFFFFFFFF;
-            if ((sceneMask & viewMask) != sceneMask || rasterID != queue.rasterID) {
+            uint64_t key = 0;
+            if (queue.sort == RasterQueueSort::FRONT_TO_BACK) {
+                key = (psoIds.Get(batch.pso.get(), 0xFFFF) << 48) |
+                    (groupIds.Get(batch.batchGroup.Get(), 0xFFFF) << 32) |
+                    (drawIds.Get(DrawIdentity(*item.primitive), 0xFFFF) << 16) |
+                    static_cast<uint64_t>(dist >> 16);
+            } else {
+                key = (static_cast<uint64_t>(~dist) << 32) |
+                    (psoIds.Get(batch.pso.get(), 0xFFF) << 20) |
+                    (groupIds.Get(batch.batchGroup.Get(), 0x3FF) << 10) |
+                    drawIds.Get(DrawIdentity(*item.primitive), 0x3FF);
+            }
+            items[i] = RadixSortItem{key, i};
+        }
+
+        PmrVector<RadixSortItem> scratch(count, res);
+        const auto *sorted = RadixSort(items.data(), scratch.data(), count);
+
+        PmrVector<RenderDrawItem> drawItems(queue.drawItems.get_allocator());
+        drawItems.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            drawItems.emplace_back(queue.drawItems[sorted[i].value]);
+        }
+        queue.drawItems.swap(drawItems);
+    }
+
+    static bool IsAutoInstance(const RenderDrawItem &item)
+    {
+        const auto &primitive = *item.primitive;
+        if (!primitive.vertexFlags.TestBit(RenderVertexFlagBit::AUTO_INSTANCE) ||
+            !primitive.batches[item.techIndex].technique->HasVertexFlag(RenderVertexFlagBit::AUTO_INSTANCE)) {
+            return false;
+        }
+
+        return std::all_of(primitive.args.begin(), primitive.args.end(), [](const DrawArgs &arg) {
+            const auto *indexed = std::get_if<rhi::CmdDrawIndexed>(&arg);
+            const auto *linear = std::get_if<rhi::CmdDrawLinear>(&arg);
+            return (indexed != nullptr && indexed->instanceCount == 1) || (linear != nullptr && linear->instanceCount == 1);
+        });
+    }
+
+    static bool SameDrawArgs(const DrawArgs &lhs, const DrawArgs &rhs)
+    {
+        if (lhs.index() != rhs.index()) {
+            return false;
+        }
+
+        if (const auto *indexed = std::get_if<rhi::CmdDrawIndexed>(&lhs)) {
+            const auto &other = std::get<rhi::CmdDrawIndexed>(rhs);
+            return indexed->indexCount == other.indexCount && indexed->firstIndex == other.firstIndex && indexed->vertexOffset == other.vertexOffset;
+        }
+
+        const auto &linear = std::get<rhi::CmdDrawLinear>(lhs);
+        const auto &other = std::get<rhi::CmdDrawLinear>(rhs);
+        return linear.vertexCount == other.vertexCount && linear.firstVertex == other.firstVertex;
+    }
+
+    // both items must be auto instanced.
+    static bool CanMergeDraw(const RenderDrawItem &lhs, const RenderDrawItem &rhs)
+    {
+        const auto &lb = lhs.primitive->batches[lhs.techIndex];
+        const auto &rb = rhs.primitive->batches[rhs.techIndex];
+        if (lb.pso != rb.pso || lb.batchGroup.Get() != rb.batchGroup.Get() || lb.vao != rb.vao ||
+            lhs.primitive->geometry.Get() != rhs.primitive->geometry.Get()) {
+            return false;
+        }
+
+        const auto &la = lhs.primitive->args;
+        const auto &ra = rhs.primitive->args;
+        return la.size() == ra.size() && std::equal(la.begin(), la.end(), ra.begin(), SameDrawArgs);
+    }
+
+    // fold runs of identical draws into one instanced draw, instance data is written to the frame instance stream.
+    static void MergeDrawItems(RasterQueue &queue, RenderInstanceStream &stream, RenderGraphData &stat)
+    {
+        const auto count = static_cast<uint32_t>(queue.drawItems.size());
+
+        // run length of every item that starts a run, 0 for regular draws.
+        PmrVector<uint32_t> runs(count, 0, queue.drawItems.get_allocator().resource());
+        uint32_t instanceNum = 0;
+        uint32_t drawNum = 0;
+        for (uint32_t i = 0; i < count;) {
+            if (!IsAutoInstance(queue.drawItems[i])) {
+                ++i;
                 continue;
             }
-            BuildRenderBatch(primitive, i, rasterPass, subPass.subPassID);
 
-            if (batch.pso) {
-                queue.drawItems.emplace_back(RenderDrawItem{
-                    primitive, i
-                });
+            uint32_t end = i + 1;
+            while (end < count && end - i < MAX_AUTO_INSTANCE &&
+                IsAutoInstance(queue.drawItems[end]) && CanMergeDraw(queue.drawItems[i], queue.drawItems[end])) {
+                ++end;
             }
+            runs[i] = end - i;
+            instanceNum += end - i;
+            ++drawNum;
+            i = end;
         }
+
+        if (instanceNum == 0) {
+            return;
+        }
+        stream.Reserve(instanceNum, drawNum);
+
+        PmrVector<RenderDrawItem> drawItems(queue.drawItems.get_allocator());
+        drawItems.reserve(count - instanceNum + drawNum);
+        for (uint32_t i = 0; i < count;) {
+            const auto &item = queue.drawItems[i];
+            if (runs[i] == 0) {
+                drawItems.emplace_back(item);
+                ++i;
+                continue;
+            }
+
+            uint32_t offset = stream.Allocate(runs[i]);
+            for (uint32_t j = 0; j < runs[i]; ++j) {
+                stream.Write(offset, j, queue.drawItems[i + j].primitive->instanceData);
+            }
+            drawItems.emplace_back(RenderDrawItem{item.primitive, item.techIndex, runs[i], offset});
+
+            stat.mergedDraw += runs[i] - 1;
+            i += runs[i];
+        }
+        queue.drawItems.swap(drawItems);
     }
 
     void RenderSceneVisitor::BuildRenderQueue()
@@ -103,16 +386,69 @@ namespace sky::rdg {
             prim->PrepareBatch();
         }
 
+        auto &culling = scene->GetCulling();
+        culling.Update(primitives);
+
+        // split every queue into primitive ranges, queues sharing a scene view share the same visibility bits.
+        const uint32_t wordCount = culling.GetWordCount();
+        auto *frameRes = graph.context->resources;
+        PmrVector<QueueBuildJob> jobs(frameRes);
+
+        // gpu culled commands are only valid for the view of this frame's culling pass.
+        auto &gpuScene = scene->GetGPUScene();
+        const auto *gpuCullView = gpuScene.GetCullView();
+        gpuScene.ResetCullView();
+
         for (auto &queue : graph.rasterQueues) {
-            for (const auto &prim : primitives) {
-                if (!prim->geometry || !prim->IsReady()) {
-                    continue;
-                }
+            queue.indirect = gpuCullView != nullptr && queue.sceneView == gpuCullView;
+
+            const auto &subPass = graph.subPasses[Index(queue.passID, graph)];
+            const auto &rasterPass = graph.rasterPasses[Index(subPass.parent, graph)];
+
+            const uint64_t *visibility = queue.culling && queue.sceneView != nullptr ?
+                culling.GetVisibility(queue.sceneView) : culling.GetReadyMask();
 
-                if (queue.culling && queue.sceneView != nullptr && !queue.sceneView->FrustumCulling(prim->worldBound)) {
-                    continue;
+            for (uint32_t i = 0; i < wordCount; i += QUEUE_BUILD_CHUNK_WORDS) {
+                jobs.emplace_back(QueueBuildJob{&queue, &rasterPass, subPass.subPassID, visibility,
+                    i, std::min(i + QUEUE_BUILD_CHUNK_WORDS, wordCount), PmrVector<DrawCandidate>(frameRes)});
+            }
+        }
+
+        if (jobs.size() > 1) {
+            SKY_PROFILE_NAME("Collect Draw Candidates")
+            tf::Taskflow flow;
+            for (auto &job : jobs) {
+                flow.emplace([&primitives, &job]() { CollectCandidates(primitives, job); });
+            }
+            graph.context->executor.run(flow).wait();
+        } else {
+            for (auto &job : jobs) {
+                CollectCandidates(primitives, job);
+            }
+        }
+
+        // jobs are ordered by queue and primitive range, merging them in order keeps the serial draw order.
+        {
+            SKY_PROFILE_NAME("Resolve Draw Candidates")
+            for (auto &job : jobs) {
+                for (auto &candidate : job.candidates) {
+                    BuildRenderBatch(candidate.primitive, candidate.batchIndex, candidate.finalKey, *job.pass, job.subPassId);
+
+                    if (candidate.primitive->batches[candidate.batchIndex].pso) {
+                        job.queue->drawItems.emplace_back(RenderDrawItem{candidate.primitive, candidate.batchIndex});
+                    }
                 }
-                BuildRenderPrimitive(graph, queue, prim);
+            }
+        }
+
+        {
+            SKY_PROFILE_NAME("Sort Draw Items")
+            StateIdMap psoIds(frameRes);
+            StateIdMap groupIds(frameRes);
+            StateIdMap drawIds(frameRes);
+            for (auto &queue : graph.rasterQueues) {
+                SortDrawItems(queue, psoIds, groupIds, drawIds);
+                MergeDrawItems(queue, graph.context->instanceStream, graph.context->rdgData);
             }
         }
 
@@ -3,8 +3,42 @@
 //
 
 #include <render/renderpass/ComputePass.h>
+#include <render/rdg/RenderGraph.h>
 
 namespace sky {
 
+    bool ComputePass::IsReady()
+    {
+        if (!pso && technique) {
+            program = technique->RequestProgram({});
+            if (program) {
+                pso = ComputeTechnique::BuildPso(program);
+                layout = program->RequestLayout(PASS_SET);
+            }
+        }
+        return static_cast<bool>(pso);
+    }
 
-} // namespace sky
\ No newline at end of file
+    void ComputePass::Setup(rdg::RenderGraph &rdg, RenderScene &scene)
+    {
+        if (!IsReady()) {
+            return;
+        }
+
+        auto builder = rdg.AddComputePass(name);
+        for (auto &res : computeResources) {
+            builder.AddComputeView(res.name, res.computeView);
+        }
+
+        for (auto &res : samplers) {
+            builder.AddSamplerView(res.name, res.viewName);
+        }
+
+        SetupCompute(builder, scene);
+
+        builder.SetLayout(layout)
+            .SetPipeline(pso)
+            .Dispatch(groupX, groupY, groupZ);
+    }
+
+} // namespace sky
@@ -34,8 +34,17 @@ namespace sky {
         sourceData = data;
     }
 
+    void Buffer::PrefetchImpl()
+    {
+        PrefetchRequest(sourceData);
+    }
+
     uint64_t Buffer::UploadImpl()
     {
+        if (!prefetches.empty()) {
+            ApplyPrefetch(sourceData, prefetches[0]);
+            prefetches.clear();
+        }
         uploadHandle = uploadQueue->UploadBuffer(buffer, sourceData);
         sourceData.source = nullptr;
         return sourceData.size;
@@ -138,8 +138,12 @@ namespace sky {
         }
     }
 
-    void ResourceGroup::OnBind(rhi::ComputeEncoder& encoder, uint32_t index)
+    void ResourceGroup::OnBind(rhi::ComputeEncoder& encoder, uint32_t setID)
     {
+        encoder.BindSet(setID, set);
+        for (auto &[binding, ubo] : dynamicUBOS) {
+            encoder.SetOffset(setID,  binding, 0, static_cast<uint32_t>(ubo->GetOffset()));
+        }
     }
 
 } // namespace sky
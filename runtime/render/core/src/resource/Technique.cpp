@@ -114,6 +114,18 @@ namespace sky {
         return shader->AcquireShaderBinary(key, stages);
     }
 
+    rhi::ComputePipelinePtr ComputeTechnique::BuildPso(const RDProgramPtr &program)
+    {
+        rhi::ComputePipeline::Descriptor descriptor = {};
+        descriptor.pipelineLayout = program->GetPipelineLayout();
+        for (const auto &shader : program->GetShaders()) {
+            if (shader->GetStage() == rhi::ShaderStageFlagBit::CS) {
+                descriptor.shader = shader;
+            }
+        }
+        return descriptor.shader ? RHI::Get()->GetDevice()->CreateComputePipeline(descriptor) : nullptr;
+    }
+
     rhi::GraphicsPipelinePtr GraphicsTechnique::BuildPso(const RDProgramPtr &program,
         const rhi::PipelineState &state,
         const rhi::VertexInputPtr &vertexDesc,
@@ -121,12 +121,24 @@ namespace sky {
         IStreamableResource::Upload(queue);
     }
 
+    void Texture::PrefetchImpl()
+    {
+        for (const auto &req : data.slices) {
+            PrefetchRequest(req);
+        }
+    }
+
     uint64_t Texture::UploadImpl()
     {
         uint64_t size = 0;
-        for (auto &req : data.slices) {
+        for (uint32_t i = 0; i < data.slices.size(); ++i) {
+            auto &req = data.slices[i];
+            if (i < prefetches.size()) {
+                ApplyPrefetch(req, prefetches[i]);
+            }
             size += req.size;
         }
+        prefetches.clear();
         uploadHandle = uploadQueue->UploadImage(image, data.slices);
         data.slices.clear();
         return size;
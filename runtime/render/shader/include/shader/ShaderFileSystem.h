@@ -31,6 +31,8 @@ namespace sky {
 
         void AppendBinaryCache(const Name& name, ShaderCompileTarget target, const MD5 &md5, const CounterPtr<MemoryArchive>& memory);
         CounterPtr<MemoryArchive> LoadBinaryCache(const ShaderCacheEntry& entry, ShaderCompileTarget target);
+        // reads the entry on the async io service, the callback gets nullptr when the read failed.
+        void LoadBinaryCacheAsync(const ShaderCacheEntry& entry, ShaderCompileTarget target, std::function<void(const CounterPtr<MemoryArchive>&)> &&callback);
 
         const NativeFileSystemPtr &GetIntermediateBinaryFS(ShaderCompileTarget target) const;
         const FileSystemPtr &GetCacheFS() const { return cacheFS; }
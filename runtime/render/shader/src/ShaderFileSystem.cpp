@@ -5,6 +5,8 @@
 #include <shader/ShaderFileSystem.h>
 #include <shader/ShaderCompiler.h>
 #include <shader/ShaderCacheManager.h>
+#include <core/file/AsyncFileIO.h>
+
 namespace sky {
 
     ShaderFileSystem::ShaderFileSystem() : executor(1)
@@ -106,6 +108,36 @@ namespace sky {
         return memory;
     }
 
+    void ShaderFileSystem::LoadBinaryCacheAsync(const ShaderCacheEntry& entry, ShaderCompileTarget target, std::function<void(const CounterPtr<MemoryArchive>&)> &&callback)
+    {
+        FilePtr file;
+        if (cacheFS) {
+            FilePath filePath(entry.savedFileName.GetStr());
+            FilePath targetPath(ShaderCompiler::GetTargetName(target).GetStr().data());
+            file = cacheFS->OpenFile(targetPath / filePath);
+        }
+
+        if (!file) {
+            callback({});
+            return;
+        }
+
+        CounterPtr<MemoryArchive> memory = new MemoryArchive();
+        memory->Resize(entry.length);
+
+        FileReadRequest request = {};
+        request.file     = file;
+        request.offset   = entry.offset;
+        request.size     = entry.length;
+        request.dst      = reinterpret_cast<uint8_t *>(memory->Address());
+        request.priority = IOPriority::HIGH;
+        request.callback = [memory, callback = std::move(callback)](AsyncRead &read) {
+            bool success = read.GetStatus() == IOStatus::SUCCESS && read.GetBytes() == read.GetRequest().size;
+            callback(success ? memory : CounterPtr<MemoryArchive>{});
+        };
+        AsyncFileIO::Get()->Read(std::move(request));
+    }
+
     void ShaderFileSystem::AppendBinaryCache(const Name& shader, ShaderCompileTarget target, const MD5 &md5, const CounterPtr<MemoryArchive>& memory)
     {
         if (!cacheFS) {
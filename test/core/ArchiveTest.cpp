@@ -4,7 +4,10 @@
 
 #include <core/archive/StreamArchive.h>
 #include <core/archive/MemoryArchive.h>
+#include <core/archive/BinaryDataArchive.h>
+#include <core/archive/BufferedArchive.h>
 #include <gtest/gtest.h>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 
@@ -20,8 +23,9 @@ struct TestArchiveData {
 
 TEST(StreamArchiveTest, FStreamArchiveTestInOut)
 {
+    auto path = std::filesystem::temp_directory_path() / "sky_archive_test.bin";
     {
-        std::fstream f("archive_test.bin", std::ios::out | std::ios::binary);
+        std::fstream f(path, std::ios::out | std::ios::binary);
         OStreamArchive s(f);
 
         TestArchiveData t  = {};
@@ -35,7 +39,7 @@ TEST(StreamArchiveTest, FStreamArchiveTestInOut)
     }
 
     {
-        std::fstream f("archive_test.bin", std::ios::in | std::ios::binary);
+        std::fstream f(path, std::ios::in | std::ios::binary);
         IStreamArchive s(f);
 
         TestArchiveData t = {};
@@ -47,6 +51,7 @@ TEST(StreamArchiveTest, FStreamArchiveTestInOut)
         ASSERT_EQ(t.d, 4);
         ASSERT_EQ(t.e, 5);
     }
+    std::filesystem::remove(path);
 }
 
 TEST(StreamArchiveTest, SStreamArchiveTestInOut)
@@ -109,4 +114,111 @@ TEST(StreamArchiveTest, MemoryArchive)
     }
 
     ASSERT_EQ(archive.Size(), (4 + 4 + 8 + (4 + t.size())));
-}
\ No newline at end of file
+}
+TEST(StreamArchiveTest, BinaryDataArchiveTest)
+{
+    std::string t("test binary archive");
+
+    MemoryArchive archive;
+    archive << 1 << 3.0 << t;
+
+    BinaryDataPtr bin = new BinaryData(static_cast<uint32_t>(archive.Size()));
+    memcpy(bin->Data(), archive.Data(), archive.Size());
+
+    IBinaryDataArchive input(bin);
+    ASSERT_TRUE(input.IsOpen());
+
+    int a = 0;
+    double c = 0.0;
+    std::string d;
+    input >> a >> c;
+    ASSERT_EQ(input.Tell(), 12);
+    input >> d;
+
+    ASSERT_EQ(a, 1);
+    ASSERT_EQ(c, 3.0);
+    ASSERT_EQ(d, t);
+    ASSERT_EQ(input.Get(), EOF);
+}
+
+TEST(StreamArchiveTest, BufferedArchiveStreamTest)
+{
+    std::vector<TestArchiveData> values(100);
+    for (uint32_t i = 0; i < values.size(); ++i) {
+        values[i].b = i;
+    }
+    std::vector<uint8_t> block(1000, 7);
+
+    std::stringstream ss;
+    {
+        OStreamArchive stream(ss);
+        BufferedOutputArchive archive(stream, 16);
+        archive << 1 << 2.0 << std::string("buffered") << values;
+        archive.SaveRaw(block.data(), block.size());
+        archive << 3U;
+    }
+    ss << "tail";
+
+    IStreamArchive stream(ss);
+    {
+        // small chunks force refills, partial copies and direct reads of the large block.
+        BufferedInputArchive archive(stream, 16);
+        int a = 0;
+        double b = 0.0;
+        std::string c;
+        std::vector<TestArchiveData> d;
+        std::vector<uint8_t> e(block.size());
+        uint32_t f = 0;
+        archive >> a >> b >> c >> d;
+        ASSERT_TRUE(archive.LoadRaw(e.data(), e.size()));
+        archive >> f;
+
+        ASSERT_EQ(a, 1);
+        ASSERT_EQ(b, 2.0);
+        ASSERT_EQ(c, "buffered");
+        ASSERT_EQ(d.size(), values.size());
+        ASSERT_EQ(d[99].b, 99);
+        ASSERT_EQ(e, block);
+        ASSERT_EQ(f, 3U);
+        ASSERT_EQ(archive.Tell(), ss.str().size() - 4);
+    }
+
+    // read ahead bytes are given back to the stream.
+    std::string tail(4, 0);
+    stream.LoadRaw(tail.data(), tail.size());
+    ASSERT_EQ(tail, "tail");
+}
+
+TEST(StreamArchiveTest, BufferedArchiveMemoryTest)
+{
+    BufferedOutputArchive output;
+    output << 1U << std::string("memory") << 2U;
+
+    {
+        BufferedInputArchive input(output.Data(), output.Size());
+        uint32_t a = 0;
+        std::string b;
+        uint32_t c = 0;
+        input >> a >> b >> c;
+        ASSERT_EQ(a, 1U);
+        ASSERT_EQ(b, "memory");
+        ASSERT_EQ(c, 2U);
+
+        uint64_t overrun = 0;
+        ASSERT_FALSE(input.Load(overrun));
+    }
+
+    // memory backed stream archives are read in place and the stream follows the buffer.
+    BinaryDataPtr bin = new BinaryData(static_cast<uint32_t>(output.Size()));
+    memcpy(bin->Data(), output.Data(), output.Size());
+    IBinaryDataArchive stream(bin);
+    {
+        BufferedInputArchive input(stream);
+        uint32_t a = 0;
+        input >> a;
+    }
+    ASSERT_EQ(stream.Tell(), 4);
+    std::string b;
+    stream >> b;
+    ASSERT_EQ(b, "memory");
+}
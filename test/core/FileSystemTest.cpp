@@ -3,6 +3,7 @@
 //
 
 #include <core/file/FileSystem.h>
+#include <core/file/AsyncFileIO.h>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <codecvt>
@@ -11,7 +12,7 @@ using namespace sky;
 TEST(FileSystemTest, FileTest)
 {
     FilePath path("test.txt");
-    NativeFileSystem fs("./");
+    NativeFileSystem fs(std::filesystem::temp_directory_path() / "sky_file_test");
     {
         auto file = fs.CreateOrOpenFile(path);
         auto archive = file->WriteAsArchive();
@@ -25,4 +26,169 @@ TEST(FileSystemTest, FileTest)
         archive->Load(val);
         ASSERT_EQ(val, 0xFFFF0000);
     }
-}
\ No newline at end of file
+    std::filesystem::remove_all(fs.GetPath().GetStr());
+}
+TEST(FileSystemTest, FileMapTest)
+{
+    FilePath path("map_test.bin");
+    NativeFileSystem fs(std::filesystem::temp_directory_path() / "sky_map_test");
+
+    std::vector<uint32_t> values(100000);
+    for (uint32_t i = 0; i < values.size(); ++i) {
+        values[i] = i * 7;
+    }
+    {
+        auto file = fs.CreateOrOpenFile(path);
+        auto archive = file->WriteAsArchive();
+        archive->SaveRaw(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(uint32_t));
+    }
+
+    BinaryDataPtr view;
+    {
+        auto file = fs.OpenFile(path);
+        ASSERT_TRUE(file->CanMap());
+
+        auto whole = file->Map(0, 0);
+        ASSERT_TRUE(whole);
+        ASSERT_TRUE(whole->IsView());
+        ASSERT_EQ(whole->Size(), values.size() * sizeof(uint32_t));
+        ASSERT_EQ(memcmp(whole->Data(), values.data(), whole->Size()), 0);
+
+        view = file->Map(400, 4000, FileAccessHint::WILL_NEED);
+        ASSERT_EQ(view->Size(), 4000);
+        ASSERT_EQ(*reinterpret_cast<const uint32_t *>(view->Data()), values[100]);
+
+        // reads go through the mapping once it exists.
+        uint32_t value = 0;
+        file->ReadData(4 * 500, sizeof(uint32_t), reinterpret_cast<uint8_t *>(&value));
+        ASSERT_EQ(value, values[500]);
+
+        ASSERT_FALSE(file->Map(whole->Size() + 1, 0));
+        ASSERT_FALSE(file->Map(16, whole->Size()));
+    }
+
+    // the view outlives the file object, writes stay private.
+    view->Data()[0] = 0xFF;
+    ASSERT_EQ(*reinterpret_cast<const uint32_t *>(view->Data() + 4), values[101]);
+    {
+        auto file = fs.OpenFile(path);
+        uint32_t value = 0;
+        file->ReadData(400, sizeof(uint32_t), reinterpret_cast<uint8_t *>(&value));
+        ASSERT_EQ(value, values[100]);
+    }
+
+    view->Resize(8);
+    ASSERT_FALSE(view->IsView());
+    ASSERT_EQ(*reinterpret_cast<const uint32_t *>(view->Data() + 4), values[101]);
+
+    view = nullptr;
+    std::filesystem::remove_all(fs.GetPath().GetStr());
+}
+
+TEST(FileSystemTest, AsyncReadTest)
+{
+    static constexpr uint32_t FILE_NUM = 64;
+    NativeFileSystem fs(std::filesystem::temp_directory_path() / "sky_async_read_test");
+
+    std::vector<FilePtr> files;
+    for (uint32_t i = 0; i < FILE_NUM; ++i) {
+        std::string content(1000 + i * 37, static_cast<char>('a' + i % 26));
+        auto file = fs.CreateOrOpenFile(std::to_string(i) + ".bin");
+        file->AppendData(content.data(), content.size());
+        files.emplace_back(fs.OpenFile(std::to_string(i) + ".bin"));
+    }
+
+    for (auto backend : {IOBackend::THREAD_POOL, IOBackend::IO_URING}) {
+        AsyncFileIO::Descriptor desc = {};
+        desc.backend    = backend;
+        desc.queueDepth = 8;
+        desc.threadNum  = 2;
+        desc.callback   = IOCallbackMode::IO_THREAD;
+        AsyncFileIO io(desc);
+
+        std::atomic_uint32_t callbacks{0};
+        std::vector<FileReadRequest> requests;
+        for (uint32_t i = 0; i < FILE_NUM; ++i) {
+            FileReadRequest request = {};
+            request.file     = files[i];
+            request.priority = static_cast<IOPriority>(i % 3);
+            request.callback = [&callbacks](AsyncRead &) { ++callbacks; };
+            requests.emplace_back(std::move(request));
+        }
+        auto reads = io.ReadBatch(std::move(requests));
+
+        // a sub range into caller memory.
+        std::vector<uint8_t> partial(100);
+        FileReadRequest request = {};
+        request.file   = files[3];
+        request.offset = 10;
+        request.size   = partial.size();
+        request.dst    = partial.data();
+        auto partialRead = io.Read(std::move(request));
+
+        request = {};
+        request.file = new NativeFile(fs.GetPath() / FilePath("missing.bin"));
+        auto missing = io.Read(std::move(request));
+
+        io.WaitIdle();
+        ASSERT_EQ(callbacks.load(), FILE_NUM);
+        for (uint32_t i = 0; i < FILE_NUM; ++i) {
+            ASSERT_EQ(reads[i]->GetStatus(), IOStatus::SUCCESS);
+            const auto &data = reads[i]->GetData();
+            ASSERT_EQ(data->Size(), 1000 + i * 37);
+            ASSERT_EQ(data->Data()[data->Size() - 1], static_cast<uint8_t>('a' + i % 26));
+        }
+        partialRead->Wait();
+        ASSERT_EQ(partialRead->GetStatus(), IOStatus::SUCCESS);
+        ASSERT_EQ(partialRead->GetBytes(), partial.size());
+        ASSERT_EQ(partial[0], static_cast<uint8_t>('d'));
+        ASSERT_EQ(missing->GetStatus(), IOStatus::FAILED);
+
+        auto stats = io.GetStats();
+        ASSERT_EQ(stats.completed, FILE_NUM + 2);
+        ASSERT_EQ(stats.failed, 1);
+        ASSERT_GE(stats.maxQueueDepth, 1);
+    }
+    std::filesystem::remove_all(fs.GetPath().GetStr());
+}
+
+TEST(FileSystemTest, AsyncReadCancelTest)
+{
+    NativeFileSystem fs(std::filesystem::temp_directory_path() / "sky_async_cancel_test");
+    std::string content(64 * 1024, 'x');
+    fs.CreateOrOpenFile("data.bin")->AppendData(content.data(), content.size());
+    auto file = fs.OpenFile("data.bin");
+
+    // a depth of one leaves the ring the least room for reads, cancels and the wake up poll.
+    for (auto backend : {IOBackend::THREAD_POOL, IOBackend::IO_URING}) {
+        AsyncFileIO::Descriptor desc = {};
+        desc.backend    = backend;
+        desc.queueDepth = 1;
+        desc.threadNum  = 1;
+        desc.callback   = IOCallbackMode::IO_THREAD;
+        AsyncFileIO io(desc);
+
+        std::vector<FileReadRequest> requests(256);
+        for (auto &request : requests) {
+            request.file     = file;
+            request.priority = IOPriority::LOW;
+        }
+        auto reads = io.ReadBatch(std::move(requests));
+
+        uint32_t cancelled = 0;
+        for (auto iter = reads.rbegin(); iter != reads.rend(); ++iter) {
+            if (io.Cancel(*iter)) {
+                ASSERT_EQ((*iter)->GetStatus(), IOStatus::CANCELLED);
+                ASSERT_FALSE((*iter)->GetData());
+                ++cancelled;
+            }
+        }
+        io.WaitIdle();
+        ASSERT_GT(cancelled, 0);
+        for (auto &read : reads) {
+            ASSERT_TRUE(read->IsDone());
+        }
+        ASSERT_GE(io.GetStats().cancelled, cancelled);
+    }
+    std::filesystem::remove_all(fs.GetPath().GetStr());
+}
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include <core/hash/Hash.h>
+#include <core/hash/Crc32.h>
 
 using namespace sky;
 
@@ -17,4 +18,86 @@ TEST(HashTest, Murmur3Test)
     uint32_t hash2 = Murmur3Hash32({1, 2, 3, 4, 5}, 0);
 
     ASSERT_EQ(hash1, hash2);
-}
\ No newline at end of file
+}
+
+namespace {
+
+    std::vector<uint8_t> RandomBytes(size_t size, uint32_t seed)
+    {
+        std::vector<uint8_t> data(size);
+        for (auto &v : data) {
+            seed = seed * 1664525U + 1013904223U;
+            v = static_cast<uint8_t>(seed >> 24);
+        }
+        return data;
+    }
+
+} // namespace
+
+TEST(HashTest, Crc32HardwareTest)
+{
+    ASSERT_EQ(Crc32::Cal(std::string_view("123456789")), 0xE3069283U);
+    ASSERT_EQ(Crc32::Cal(std::string_view("123456789")), Crc32::ConstCal("123456789"));
+
+    auto data = RandomBytes(100000, 7);
+    std::vector<size_t> lengths = {0, 1, 3, 7, 8, 9, 15, 16, 63, 255, 256, 257, 767, 768, 769, 1000, 8191, 24575, 24576, 24577, 100000};
+    for (size_t length : lengths) {
+        for (size_t offset : {0, 1, 3}) {
+            if (offset + length > data.size()) {
+                continue;
+            }
+            const uint8_t *ptr = data.data() + offset;
+            ASSERT_EQ(Crc32::Extend(0, ptr, length), Crc32::ExtendSoftware(0, ptr, length)) << length << " " << offset;
+        }
+    }
+
+    std::string str(reinterpret_cast<const char *>(data.data()), 5000);
+    ASSERT_EQ(Crc32::Cal(str), Crc32::ConstCal(str));
+}
+
+TEST(HashTest, Crc32ExtendTest)
+{
+    auto data = RandomBytes(30000, 11);
+    uint32_t full = Crc32::Cal(data.data(), static_cast<uint32_t>(data.size()));
+
+    for (size_t split : {0, 1, 100, 4096, 20000, 30000}) {
+        uint32_t crc = Crc32::Extend(0, data.data(), split);
+        crc = Crc32::Extend(crc, data.data() + split, data.size() - split);
+        ASSERT_EQ(crc, full);
+    }
+}
+
+TEST(HashTest, Hash64SimdTest)
+{
+    ASSERT_EQ(Hash64(nullptr, 0), 0x2D06800538D394C2ULL);
+
+    auto previous = GetHash64SimdLevel();
+    auto data = RandomBytes(3 * 1024 * 1024 + 17, 3);
+
+    std::vector<size_t> lengths;
+    for (size_t i = 0; i <= 2000; ++i) {
+        lengths.emplace_back(i);
+    }
+    lengths.emplace_back(1024 * 1024);
+    lengths.emplace_back(data.size());
+
+    for (uint64_t seed : {0ULL, 1ULL, 0x9E3779B97F4A7C15ULL}) {
+        std::vector<uint64_t> expected;
+        SetHash64SimdLevel(HashSimdLevel::SCALAR);
+        ASSERT_EQ(GetHash64SimdLevel(), HashSimdLevel::SCALAR);
+        for (size_t length : lengths) {
+            expected.emplace_back(Hash64(data.data(), length, seed));
+        }
+
+        for (auto level : {HashSimdLevel::SSE2, HashSimdLevel::AVX2}) {
+            SetHash64SimdLevel(level);
+            for (size_t i = 0; i < lengths.size(); ++i) {
+                ASSERT_EQ(Hash64(data.data(), lengths[i], seed), expected[i]) << lengths[i] << " " << seed;
+            }
+        }
+    }
+    SetHash64SimdLevel(previous);
+
+    ASSERT_NE(Hash64(data.data(), 100, 0), Hash64(data.data(), 100, 1));
+    ASSERT_NE(Hash64(data.data(), 1000, 0), Hash64(data.data() + 1, 1000, 0));
+}
@@ -0,0 +1,305 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/logger/Logger.h>
+#include <core/logger/LogSink.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace sky;
+
+namespace {
+
+    struct CaptureSink : public ILogSink {
+        void Write(const LogRecord &record) override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            lines.emplace_back(std::string(record.tag) + "|" + Logger::GetLevelName(record.level) + "|" + std::string(record.message));
+            times.emplace_back(record.time);
+        }
+
+        std::vector<std::string> Get()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return lines;
+        }
+
+        std::mutex mutex;
+        std::vector<std::string> lines;
+        std::vector<uint64_t> times;
+    };
+
+    // the logger owns sinks, route everything into a capture sink for one test.
+    struct LoggerScope {
+        LoggerScope()
+        {
+            Logger::ClearSinks();
+            Logger::AddSink(sink);
+        }
+
+        ~LoggerScope()
+        {
+            Logger::Flush();
+            Logger::ClearSinks();
+            Logger::ClearTagLevels();
+            Logger::SetLevel(LogLevel::INFO);
+            Logger::SetAsync(true);
+            Logger::AddSink(new StdoutLogSink());
+        }
+
+        CaptureSink *sink = new CaptureSink();
+    };
+
+} // namespace
+
+TEST(LoggerTest, DeferredFormatTest)
+{
+    LoggerScope scope;
+
+    auto *text = new char[16];
+    snprintf(text, 16, "%s", "copied");
+    LOG_I("Test", "%s %d %.1f %llu", text, 42, 1.5, 7ULL);
+    LOG_W("Test", "%s", static_cast<const char *>(nullptr));
+    LOG_E("Test", "plain");
+    // the string is captured at the call, not at formatting time.
+    delete[] text;
+
+    Logger::Flush();
+    auto lines = scope.sink->Get();
+    ASSERT_EQ(lines.size(), 3);
+    ASSERT_EQ(lines[0], "Test|INFO|copied 42 1.5 7");
+    ASSERT_EQ(lines[1], "Test|WARNING|(null)");
+    ASSERT_EQ(lines[2], "Test|ERROR|plain");
+}
+
+TEST(LoggerTest, LongMessageTest)
+{
+    LoggerScope scope;
+
+    std::string text(4000, 'x');
+    LOG_I("Test", "%s", text.c_str());
+    Logger::Flush();
+
+    auto lines = scope.sink->Get();
+    ASSERT_EQ(lines.size(), 1);
+    ASSERT_EQ(lines[0], "Test|INFO|" + text);
+}
+
+TEST(LoggerTest, HugeMessageOrderTest)
+{
+    LoggerScope scope;
+
+    // too big for the ring, written on the calling thread behind the queued line.
+    std::string text(200000, 'x');
+    LOG_I("Test", "small %d", 1);
+    LOG_I("Test", "%s", text.c_str());
+    LOG_I("Test", "small %d", 2);
+    Logger::Flush();
+
+    auto lines = scope.sink->Get();
+    ASSERT_EQ(lines.size(), 3);
+    ASSERT_EQ(lines[0], "Test|INFO|small 1");
+    ASSERT_EQ(lines[1], "Test|INFO|" + text);
+    ASSERT_EQ(lines[2], "Test|INFO|small 2");
+}
+
+TEST(LoggerTest, LevelFilterTest)
+{
+    LoggerScope scope;
+
+    Logger::SetLevel(LogLevel::WARN);
+    ASSERT_FALSE(Logger::IsEnabled(LogLevel::INFO, "Test"));
+    ASSERT_TRUE(Logger::IsEnabled(LogLevel::ERR, "Test"));
+
+    LOG_I("Test", "dropped");
+    LOG_W("Test", "kept");
+
+    // tag overrides go both ways.
+    Logger::SetTagLevel("Verbose", LogLevel::INFO);
+    Logger::SetTagLevel("Muted", LogLevel::NONE);
+    LOG_I("Verbose", "kept");
+    LOG_E("Muted", "dropped");
+    LOG_I("Test", "dropped");
+
+    Logger::Flush();
+    auto lines = scope.sink->Get();
+    ASSERT_EQ(lines.size(), 2);
+    ASSERT_EQ(lines[0], "Test|WARNING|kept");
+    ASSERT_EQ(lines[1], "Verbose|INFO|kept");
+}
+
+TEST(LoggerTest, FilterSkipsArgumentsTest)
+{
+    LoggerScope scope;
+    Logger::SetLevel(LogLevel::NONE);
+
+    uint32_t evaluated = 0;
+    auto arg = [&evaluated]() { return ++evaluated; };
+    LOG_E("Test", "%u", arg());
+
+    ASSERT_EQ(evaluated, 0);
+}
+
+TEST(LoggerTest, MultiThreadTest)
+{
+    LoggerScope scope;
+
+    static constexpr uint32_t THREAD_NUM = 4;
+    static constexpr uint32_t LOG_NUM    = 20000;
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < THREAD_NUM; ++i) {
+        threads.emplace_back([i]() {
+            for (uint32_t j = 0; j < LOG_NUM; ++j) {
+                LOG_I("Thread", "%u %u", i, j);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    Logger::Flush();
+
+    // every entry arrives once and in order per thread.
+    auto lines = scope.sink->Get();
+    ASSERT_EQ(lines.size(), THREAD_NUM * LOG_NUM);
+
+    std::vector<uint32_t> next(THREAD_NUM, 0);
+    for (const auto &line : lines) {
+        uint32_t thread = 0;
+        uint32_t index  = 0;
+        ASSERT_EQ(sscanf(line.c_str(), "Thread|INFO|%u %u", &thread, &index), 2);
+        ASSERT_LT(thread, THREAD_NUM);
+        ASSERT_EQ(index, next[thread]);
+        ++next[thread];
+    }
+}
+
+TEST(LoggerTest, WallTimeTest)
+{
+    LoggerScope scope;
+
+    auto now = []() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    };
+
+    // lines are ordered on a monotonic clock, sinks still get wall time.
+    uint64_t begin = now();
+    LOG_I("Test", "%d", 1);
+    LOG_I("Test", "%d", 2);
+    Logger::Flush();
+    uint64_t end = now();
+
+    std::lock_guard<std::mutex> lock(scope.sink->mutex);
+    ASSERT_EQ(scope.sink->times.size(), 2);
+    ASSERT_LE(scope.sink->times[0], scope.sink->times[1]);
+
+    // the offset between the clocks is taken once, allow some drift.
+    static constexpr uint64_t SLACK = 1000000000ULL;
+    ASSERT_GE(scope.sink->times[0] + SLACK, begin);
+    ASSERT_LE(scope.sink->times[1], end + SLACK);
+}
+
+TEST(LoggerTest, SyncModeTest)
+{
+    LoggerScope scope;
+    Logger::SetAsync(false);
+
+    LOG_I("Test", "%d", 1);
+    // written on the calling thread, no flush needed.
+    auto lines = scope.sink->Get();
+    ASSERT_EQ(lines.size(), 1);
+    ASSERT_EQ(lines[0], "Test|INFO|1");
+}
+
+TEST(LoggerTest, CrashFlushTest)
+{
+    LoggerScope scope;
+
+    // a sink stuck in a write holds the sink lock, like a thread that crashed inside it.
+    struct BlockingSink : public ILogSink {
+        void Write(const LogRecord &) override
+        {
+            entered = true;
+            entered.notify_all();
+            release.wait(false);
+        }
+
+        std::atomic_bool entered{false};
+        std::atomic_bool release{false};
+    };
+    auto *blocking = new BlockingSink();
+    Logger::AddSink(blocking);
+    Logger::SetAsync(false);
+
+    std::thread writer([]() { LOG_I("Test", "%d", 1); });
+    blocking->entered.wait(false);
+
+    // gives up on the held lock instead of waiting, runs once per process.
+    Logger::FlushOnCrash();
+
+    blocking->release = true;
+    blocking->release.notify_all();
+    writer.join();
+}
+
+TEST(LoggerTest, MemorySinkTest)
+{
+    LoggerScope scope;
+    auto *memory = new MemoryLogSink(4);
+    Logger::AddSink(memory);
+
+    for (int i = 0; i < 10; ++i) {
+        LOG_I("Test", "line %d", i);
+    }
+    Logger::Flush();
+
+    auto lines = memory->GetLines();
+    ASSERT_EQ(lines.size(), 4);
+    ASSERT_NE(lines[0].find("[Test] [INFO] : line 6"), std::string::npos);
+    ASSERT_NE(lines[3].find("[Test] [INFO] : line 9"), std::string::npos);
+}
+
+TEST(LoggerTest, RotatingFileSinkTest)
+{
+    std::string path = "logger_test.log";
+    for (uint32_t i = 0; i <= 2; ++i) {
+        std::remove(i == 0 ? path.c_str() : (path + "." + std::to_string(i)).c_str());
+    }
+
+    {
+        LoggerScope scope;
+        Logger::AddSink(new RotatingFileLogSink(path, 1024, 2));
+        for (int i = 0; i < 100; ++i) {
+            LOG_I("Test", "rotating line %d", i);
+        }
+        Logger::Flush();
+    }
+
+    auto fileSize = [](const std::string &name) -> long {
+        FILE *file = fopen(name.c_str(), "rb");
+        if (file == nullptr) {
+            return -1;
+        }
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fclose(file);
+        return size;
+    };
+
+    ASSERT_GE(fileSize(path), 0);
+    ASSERT_GE(fileSize(path + ".1"), 1024);
+    ASSERT_GE(fileSize(path + ".2"), 1024);
+    ASSERT_EQ(fileSize(path + ".3"), -1);
+
+    for (uint32_t i = 0; i <= 2; ++i) {
+        std::remove(i == 0 ? path.c_str() : (path + "." + std::to_string(i)).c_str());
+    }
+}
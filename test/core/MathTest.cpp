@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 #include <core/math/MathUtil.h>
+#include <random>
+#include "MathTestUtil.h"
 
 using namespace sky;
 
@@ -12,4 +14,55 @@ TEST(MathTest, MathUtilTest)
     for (uint32_t i = 0; i < 32; ++i) {
         ASSERT_EQ(CeilLog2(static_cast<uint32_t>(pow(2, i))), i);
     }
-}
\ No newline at end of file
+}
+
+namespace {
+
+    void ExpectNear(const Vector4 &lhs, const Vector4 &rhs, float tolerance)
+    {
+        for (uint32_t i = 0; i < 4; ++i) {
+            ASSERT_NEAR(lhs[i], rhs[i], tolerance * std::max(1.f, std::abs(rhs[i])));
+        }
+    }
+
+    void ExpectNear(const Matrix4 &lhs, const Matrix4 &rhs, float tolerance)
+    {
+        for (uint32_t i = 0; i < 4; ++i) {
+            ExpectNear(lhs[i], rhs[i], tolerance);
+        }
+    }
+
+    static constexpr float SIMD_TOLERANCE = 1e-5f;
+
+} // namespace
+
+TEST(MathTest, SimdCompareTest)
+{
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> dist(-10.f, 10.f);
+
+    for (uint32_t i = 0; i < 1024; ++i) {
+        Matrix4 a = RandomAffine(rng);
+        Matrix4 b = RandomAffine(rng);
+        Vector4 v(dist(rng), dist(rng), dist(rng), dist(rng));
+        Vector3 p(dist(rng), dist(rng), dist(rng));
+
+        ExpectNear(a * b, scalar::Mul(a, b), SIMD_TOLERANCE);
+        ExpectNear(a * v, scalar::Mul(a, v), SIMD_TOLERANCE);
+        ExpectNear(a.Inverse(), scalar::Inverse(a), SIMD_TOLERANCE);
+        ExpectNear(a * a.Inverse(), Matrix4::Identity(), 1e-4f);
+
+        Vector3 tp = a.TransformPoint(p);
+        Vector3 sp = scalar::TransformPoint(a, p);
+        ExpectNear(Vector4(tp.x, tp.y, tp.z, 0.f), Vector4(sp.x, sp.y, sp.z, 0.f), SIMD_TOLERANCE);
+
+        Vector4 va(dist(rng), dist(rng), dist(rng), dist(rng));
+        ASSERT_NEAR(va.Dot(v), (va.x * v.x + va.y * v.y) + (va.z * v.z + va.w * v.w), 1e-3f);
+
+        Quaternion q1(dist(rng), Vector3(dist(rng), dist(rng), dist(rng) + 20.f));
+        Quaternion q2(dist(rng), Vector3(dist(rng) + 20.f, dist(rng), dist(rng)));
+        Quaternion q3 = q1 * q2;
+        Quaternion q4 = scalar::Mul(q1, q2);
+        ExpectNear(Vector4(q3.x, q3.y, q3.z, q3.w), Vector4(q4.x, q4.y, q4.z, q4.w), SIMD_TOLERANCE);
+    }
+}
@@ -0,0 +1,26 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#pragma once
+
+#include <core/math/MathUtil.h>
+#include <random>
+
+namespace sky {
+
+    // rotation, non uniform scale and translation, the shape of a typical world matrix.
+    inline Matrix4 RandomAffine(std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> dist(-1.f, 1.f);
+        Vector3 axis(dist(rng), dist(rng), dist(rng) + 2.f);
+        Quaternion rot(dist(rng) * PI, axis);
+        Matrix4 res = rot.ToMatrix();
+        res[0] *= 1.5f + dist(rng);
+        res[1] *= 1.5f + dist(rng);
+        res[2] *= 1.5f + dist(rng);
+        res[3] = Vector4(dist(rng) * 10.f, dist(rng) * 10.f, dist(rng) * 10.f, 1.f);
+        return res;
+    }
+
+} // namespace sky
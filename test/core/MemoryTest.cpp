@@ -2,7 +2,12 @@
 // Created by Zach Lee on 2022/11/20.
 //
 #include <core/memory/TLSFAllocator.h>
+#include <core/memory/FrameAllocator.h>
 #include <gtest/gtest.h>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <thread>
 
 using namespace sky;
 
@@ -135,3 +140,239 @@ TEST(MemoryTest, TLSFAllocateTestNormal)
         ASSERT_EQ(block3->size, 65536 *2);
     }
 }
+
+TEST(MemoryTest, TLSFAllocatorTagStatsTest)
+{
+    TLSFAllocator allocator;
+
+    void *small = allocator.AllocateTagged(24, 8, MemoryTag::RENDER);
+    void *medium = allocator.AllocateTagged(4000, 64, MemoryTag::SCENE);
+    void *large = allocator.AllocateTagged(3 * 1024 * 1024, 256, MemoryTag::ASSET);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(small) % 16, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(medium) % 64, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(large) % 256, 0);
+    ASSERT_EQ(TLSFAllocator::GetAllocationSize(medium), 4000);
+
+    auto stats = allocator.GetStats();
+    ASSERT_EQ(stats.tags[static_cast<uint32_t>(MemoryTag::RENDER)].liveBytes, 24);
+    ASSERT_EQ(stats.tags[static_cast<uint32_t>(MemoryTag::SCENE)].liveBytes, 4000);
+    ASSERT_EQ(stats.tags[static_cast<uint32_t>(MemoryTag::ASSET)].liveBytes, 3 * 1024 * 1024);
+    ASSERT_GE(stats.reservedBytes, stats.usedBytes);
+
+    allocator.Deallocate(small);
+    allocator.Deallocate(medium);
+    allocator.Deallocate(large);
+
+    stats = allocator.GetStats();
+    for (auto &tag : stats.tags) {
+        ASSERT_EQ(tag.liveBytes, 0);
+    }
+    ASSERT_EQ(stats.tags[static_cast<uint32_t>(MemoryTag::SCENE)].peakBytes, 4000);
+    ASSERT_EQ(stats.tags[static_cast<uint32_t>(MemoryTag::SCENE)].allocations, 1);
+
+    allocator.FlushThreadCache();
+    stats = allocator.GetStats();
+    ASSERT_EQ(stats.cachedBytes, 0);
+    ASSERT_EQ(stats.usedBytes, 0);
+}
+
+TEST(MemoryTest, TLSFAllocatorStressTest)
+{
+    TLSFAllocator allocator;
+
+    static constexpr uint32_t THREAD_NUM = 8;
+    static constexpr uint32_t ITERATION  = 10000;
+
+    struct Record {
+        uint8_t *ptr;
+        size_t size;
+        uint8_t pattern;
+    };
+
+    // every thread frees half of its blocks and hands the rest to the next thread.
+    std::mutex mutex;
+    std::vector<std::vector<Record>> handOff(THREAD_NUM);
+    std::atomic_bool failed{false};
+
+    auto check = [&failed](const Record &record) {
+        for (size_t i = 0; i < record.size; ++i) {
+            if (record.ptr[i] != record.pattern) {
+                failed = true;
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < THREAD_NUM; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(t + 1);
+            std::vector<Record> live;
+            for (uint32_t i = 0; i < ITERATION; ++i) {
+                uint32_t pick = rng() % 100;
+                size_t size = pick < 80 ? rng() % 256 + 1 : (pick < 98 ? rng() % 65536 + 1 : rng() % (1024 * 1024) + 1);
+                size_t align = size_t(1) << (rng() % 9);
+
+                auto *ptr = static_cast<uint8_t *>(allocator.AllocateTagged(size, align, static_cast<MemoryTag>(rng() % static_cast<uint32_t>(MemoryTag::NUM))));
+                if (ptr == nullptr || reinterpret_cast<uintptr_t>(ptr) % align != 0) {
+                    failed = true;
+                    return;
+                }
+                auto pattern = static_cast<uint8_t>(rng());
+                memset(ptr, pattern, size);
+                live.emplace_back(Record{ptr, size, pattern});
+
+                if (live.size() > 64 && rng() % 2 == 0) {
+                    auto index = rng() % live.size();
+                    check(live[index]);
+                    allocator.Deallocate(live[index].ptr);
+                    live[index] = live.back();
+                    live.pop_back();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto &next = handOff[(t + 1) % THREAD_NUM];
+            next.insert(next.end(), live.begin(), live.end());
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_FALSE(failed);
+
+    threads.clear();
+    for (uint32_t t = 0; t < THREAD_NUM; ++t) {
+        threads.emplace_back([&, t]() {
+            for (auto &record : handOff[t]) {
+                check(record);
+                allocator.Deallocate(record.ptr);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_FALSE(failed);
+
+    auto stats = allocator.GetStats();
+    for (auto &tag : stats.tags) {
+        ASSERT_EQ(tag.liveBytes, 0);
+    }
+}
+
+TEST(MemoryTest, FrameAllocatorTest)
+{
+    FrameAllocator allocator(FrameAllocator::Descriptor{2, 4096});
+
+    auto *a = static_cast<uint8_t *>(allocator.Allocate(100, 8));
+    auto *b = static_cast<uint8_t *>(allocator.Allocate(100, 256));
+    auto *huge = static_cast<uint8_t *>(allocator.Allocate(64 * 1024, 16));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(b) % 256, 0);
+    memset(a, 1, 100);
+    memset(b, 2, 100);
+    memset(huge, 3, 64 * 1024);
+
+    {
+        PmrVector<uint32_t> values(&allocator);
+        FrameVector<uint64_t> stlValues{FrameStlAllocator<uint64_t>(&allocator)};
+        for (uint32_t i = 0; i < 1000; ++i) {
+            values.emplace_back(i);
+            stlValues.emplace_back(i);
+        }
+        ASSERT_EQ(values[999], 999);
+        ASSERT_EQ(stlValues[999], 999);
+    }
+
+    allocator.NextFrame();
+    auto stats = allocator.GetLastFrameStats();
+    ASSERT_GT(stats.allocations, 3);
+    ASSERT_GT(stats.heapAllocations, 0);
+
+    // double buffered, the previous frame is still intact.
+    allocator.Allocate(1000, 16);
+    ASSERT_EQ(a[99], 1);
+    ASSERT_EQ(b[99], 2);
+    ASSERT_EQ(huge[64 * 1024 - 1], 3);
+
+    // arenas are warm after one round, the same frame does not touch the heap again.
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        allocator.NextFrame();
+        for (uint32_t i = 0; i < 16; ++i) {
+            allocator.Allocate(200, 16);
+        }
+    }
+    allocator.NextFrame();
+    ASSERT_EQ(allocator.GetLastFrameStats().allocations, 16);
+    ASSERT_EQ(allocator.GetLastFrameStats().heapAllocations, 0);
+}
+
+TEST(MemoryTest, FrameAllocatorManyAllocatorsTest)
+{
+    // more allocators than any per thread cache, a thread keeps one arena in each.
+    static constexpr uint32_t ALLOCATOR_NUM = 8;
+    std::vector<std::unique_ptr<FrameAllocator>> allocators;
+    for (uint32_t i = 0; i < ALLOCATOR_NUM; ++i) {
+        allocators.emplace_back(std::make_unique<FrameAllocator>(FrameAllocator::Descriptor{1, 4096}));
+    }
+
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        for (uint32_t i = 0; i < 16; ++i) {
+            for (auto &allocator : allocators) {
+                allocator->Allocate(64, 16);
+            }
+        }
+        for (auto &allocator : allocators) {
+            allocator->NextFrame();
+            ASSERT_EQ(allocator->GetLastFrameStats().allocations, 16);
+            ASSERT_EQ(allocator->GetLastFrameStats().heapAllocations, frame == 0 ? 1 : 0);
+        }
+    }
+
+    // threads that come and go reuse the arenas of finished ones.
+    for (uint32_t round = 0; round < FrameAllocator::MAX_THREAD_ARENA * 2; ++round) {
+        std::thread([&allocators]() {
+            for (auto &allocator : allocators) {
+                allocator->Allocate(16, 16);
+            }
+        }).join();
+    }
+    for (auto &allocator : allocators) {
+        allocator->NextFrame();
+        ASSERT_EQ(allocator->GetLastFrameStats().allocations, FrameAllocator::MAX_THREAD_ARENA * 2);
+        ASSERT_LE(allocator->GetLastFrameStats().heapAllocations, 1);
+    }
+}
+
+TEST(MemoryTest, FrameAllocatorThreadTest)
+{
+    FrameAllocator allocator(FrameAllocator::Descriptor{3, 16 * 1024});
+
+    static constexpr uint32_t THREAD_NUM = 8;
+    for (uint32_t frame = 0; frame < 6; ++frame) {
+        std::atomic_bool failed{false};
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < THREAD_NUM; ++t) {
+            threads.emplace_back([&allocator, &failed, t]() {
+                PmrVector<uint32_t *> ptrs(&allocator);
+                for (uint32_t i = 0; i < 2000; ++i) {
+                    auto *ptr = static_cast<uint32_t *>(allocator.Allocate(sizeof(uint32_t) * 4, alignof(uint32_t)));
+                    ptr[0] = ptr[3] = t * 10000 + i;
+                    ptrs.emplace_back(ptr);
+                }
+                for (uint32_t i = 0; i < 2000; ++i) {
+                    if (ptrs[i][0] != t * 10000 + i || ptrs[i][3] != t * 10000 + i) {
+                        failed = true;
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        ASSERT_FALSE(failed);
+
+        allocator.NextFrame();
+        ASSERT_GE(allocator.GetLastFrameStats().allocations, THREAD_NUM * 2000);
+    }
+}
@@ -2,9 +2,12 @@
 // Created by blues on 2024/11/23.
 //
 #include <core/name/Name.h>
+#include <core/hash/Crc32.h>
 #include <gtest/gtest.h>
 #include <string>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include <unordered_map>
 #include <map>
@@ -33,4 +36,57 @@ TEST(NameTest, NameBaseTest)
     std::stringstream ss;
     ss << a;
     ASSERT_EQ(ss.str(), std::string(a.GetStr().data()));
-}
\ No newline at end of file
+}
+TEST(NameTest, NameLiteralTest)
+{
+    static_assert(Name::Hash("abc") == Crc32::ConstCal("abc"));
+    static_assert(NameLiteral("PhysicsWorld").hash != 0);
+
+    std::string str = "literal_name";
+    ASSERT_EQ(Name::Hash("literal_name"), Name::Hash(str.c_str(), static_cast<uint32_t>(str.length())));
+
+    Name a = "literal_name"_name;
+    Name b(str.c_str());
+    ASSERT_EQ(a, b);
+    ASSERT_EQ(a.GetStr(), std::string_view("literal_name"));
+
+    // equality against strings does not register them.
+    ASSERT_EQ(a, std::string_view("literal_name"));
+    ASSERT_NE(a, "literal_other");
+
+    ASSERT_TRUE(Name("").Empty());
+    ASSERT_EQ(Name().GetStr(), std::string_view(""));
+}
+
+TEST(NameTest, NameConcurrentTest)
+{
+    static constexpr uint32_t THREAD_NUM = 8;
+    static constexpr uint32_t NAME_NUM   = 4000;
+
+    std::vector<std::string> strings;
+    for (uint32_t i = 0; i < NAME_NUM; ++i) {
+        strings.emplace_back("concurrent_name_" + std::to_string(i));
+    }
+
+    std::vector<std::vector<Name>> results(THREAD_NUM);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < THREAD_NUM; ++t) {
+        threads.emplace_back([&strings, &results, t]() {
+            auto &names = results[t];
+            for (uint32_t i = 0; i < NAME_NUM; ++i) {
+                names.emplace_back(strings[(i + t * 97) % NAME_NUM].c_str());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (uint32_t t = 0; t < THREAD_NUM; ++t) {
+        for (uint32_t i = 0; i < NAME_NUM; ++i) {
+            const auto &expect = strings[(i + t * 97) % NAME_NUM];
+            ASSERT_EQ(results[t][i].GetStr(), std::string_view(expect));
+            ASSERT_EQ(results[t][i], results[0][(i + t * 97) % NAME_NUM]);
+        }
+    }
+}
@@ -4,8 +4,10 @@
 
 #include <core/shapes/Shapes.h>
 #include <core/shapes/Frustum.h>
+#include <core/shapes/FrustumCulling.h>
 #include <core/math/MathUtil.h>
 #include <gtest/gtest.h>
+#include <random>
 
 using namespace sky;
 TEST(ShapesTest, ViewFrustumTest)
@@ -58,3 +60,34 @@ TEST(ShapesTest, ViewFrustumTest)
         ASSERT_FALSE(Intersection(aabb4, CreateFrustumByViewProjectMatrix(mtx)));
     }
 }
+
+TEST(ShapesTest, FrustumCullingSoATest)
+{
+    const auto frustum = CreateFrustumByViewProjectMatrix(MakePerspective(90.f / 180.f * 3.14f, 1.0, 0.1f, 100.f));
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> pos(-120.f, 120.f);
+    std::uniform_real_distribution<float> ext(0.1f, 4.f);
+
+    for (uint32_t count : {1U, 7U, 8U, 63U, 64U, 65U, 1000U}) {
+        std::vector<AABB> boxes(count);
+        AABBSoA soa;
+        soa.Resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            Vector3 center(pos(rng), pos(rng), pos(rng));
+            Vector3 half(ext(rng), ext(rng), ext(rng));
+            boxes[i] = AABB{center - half, center + half};
+            soa.Set(i, boxes[i]);
+        }
+
+        std::vector<uint64_t> visibility(GetVisibilityWordCount(count), 0);
+        FrustumCulling(frustum, soa, visibility.data());
+
+        for (uint32_t i = 0; i < count; ++i) {
+            ASSERT_EQ(TestVisibility(visibility.data(), i), Intersection(boxes[i], frustum));
+        }
+        for (uint32_t i = count; i < visibility.size() * 64; ++i) {
+            ASSERT_FALSE(TestVisibility(visibility.data(), i));
+        }
+    }
+}
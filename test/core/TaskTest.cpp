@@ -3,7 +3,11 @@
 //
 
 #include <core/async/Task.h>
+#include <core/async/TaskGraph.h>
+#include <core/async/ParallelFor.h>
+#include <core/async/WorkStealingQueue.h>
 #include <gtest/gtest.h>
+#include <chrono>
 
 using namespace sky;
 
@@ -34,6 +38,242 @@ TEST(TaskTest, TaskTestBase)
     CounterPtr<TestTask> task = new TestTask(id);
     ASSERT_EQ(id, 0);
     task->StartAsync();
-    TaskExecutor::Get()->GetExecutor().wait_for_all();
+    TaskExecutor::Get()->WaitForAll();
     ASSERT_EQ(id, 20);
-}
\ No newline at end of file
+}
+
+class OrderTask : public Task {
+public:
+    OrderTask(std::atomic_uint32_t &c, std::vector<TaskPtr> deps) : counter(c)
+    {
+        dependencies = std::move(deps);
+    }
+
+    bool DoWork() override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        order = ++counter;
+        return true;
+    }
+
+    void OnComplete(bool result) override
+    {
+        success = result;
+    }
+
+    std::atomic_uint32_t &counter;
+    uint32_t order = 0;
+    bool success = false;
+};
+
+TEST(TaskTest, DependencyTest)
+{
+    std::atomic_uint32_t counter = 0;
+
+    CounterPtr<OrderTask> a = new OrderTask(counter, {});
+    a->SetPriority(TaskPriority::STREAMING);
+    a->StartAsync();
+
+    CounterPtr<OrderTask> b = new OrderTask(counter, {a});
+    b->SetPriority(TaskPriority::FRAME_CRITICAL);
+    b->StartAsync();
+
+    CounterPtr<OrderTask> c = new OrderTask(counter, {a, b});
+    c->SetAffinity(Name(TaskExecutor::IO_THREAD));
+    c->StartAsync();
+
+    c->Wait();
+    ASSERT_LT(a->order, b->order);
+    ASSERT_LT(b->order, c->order);
+    ASSERT_TRUE(c->success);
+    ASSERT_FALSE(c->IsWorking());
+}
+
+TEST(TaskTest, CancelTest)
+{
+    std::atomic_uint32_t counter = 0;
+
+    CounterPtr<OrderTask> a = new OrderTask(counter, {});
+    CounterPtr<OrderTask> b = new OrderTask(counter, {a});
+    b->Cancel();
+
+    a->StartAsync();
+    b->StartAsync();
+    TaskExecutor::Get()->WaitForAll();
+
+    ASSERT_TRUE(a->success);
+    ASSERT_FALSE(b->success);
+    ASSERT_EQ(b->order, 0);
+    ASSERT_EQ(counter, 1);
+}
+
+TEST(TaskTest, AffinityTest)
+{
+    auto *executor = TaskExecutor::Get();
+    std::thread::id first;
+    std::thread::id second;
+    executor->Dispatch(Name(TaskExecutor::RENDER_THREAD), [&first]() { first = std::this_thread::get_id(); });
+    executor->Dispatch(Name(TaskExecutor::RENDER_THREAD), [&second]() { second = std::this_thread::get_id(); });
+    executor->WaitForAll();
+
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, std::this_thread::get_id());
+}
+
+TEST(TaskTest, FrameGraphTest)
+{
+    TaskGraph graph;
+    for (uint32_t frame = 0; frame < 3; ++frame) {
+        std::vector<uint32_t> values(3, 0);
+        auto a = graph.Add("A", [&values]() { values[0] = 1; });
+        auto b = graph.Add("B", [&values]() { values[1] = values[0] + 1; });
+        auto c = graph.Add("C", [&values]() { values[2] = values[1] + 1; });
+        a.Precede(b);
+        b.Precede(c);
+
+        graph.Dispatch();
+        graph.Wait();
+        graph.Reset();
+        ASSERT_EQ(values[2], 3);
+        ASSERT_TRUE(graph.Empty());
+    }
+
+    uint32_t value = 0;
+    graph.Add("Cancelled", [&value]() { value = 1; });
+    graph.Cancel();
+    graph.Dispatch();
+    graph.Wait();
+    graph.Reset();
+    ASSERT_EQ(value, 0);
+}
+
+TEST(TaskTest, FrameGraphLifetimeTest)
+{
+    // the graph dies right after Wait, the last task must be done with it by then.
+    for (uint32_t i = 0; i < 2000; ++i) {
+        std::atomic_uint32_t value = 0;
+        TaskGraph graph;
+        auto a = graph.Add("A", [&value]() { ++value; });
+        auto b = graph.Add("B", [&value]() { ++value; });
+        auto c = graph.Add("C", [&value]() { ++value; });
+        a.Precede(c);
+        b.Precede(c);
+        graph.Dispatch();
+        graph.Wait();
+        ASSERT_EQ(value.load(), 3);
+    }
+
+    // a reused graph is reset right after Wait.
+    TaskGraph graph;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        std::atomic_uint32_t value = 0;
+        graph.Add("A", [&value]() { ++value; });
+        graph.Add("B", [&value]() { ++value; });
+        graph.Dispatch();
+        graph.Wait();
+        graph.Reset();
+        ASSERT_EQ(value.load(), 2);
+    }
+}
+
+TEST(TaskTest, WorkStealingQueueTest)
+{
+    static constexpr uint32_t COUNT = 100000;
+    WorkStealingQueue<uint32_t *> queue(16);
+    std::vector<uint32_t> items(COUNT);
+    std::vector<std::atomic_uint32_t> seen(COUNT);
+
+    std::atomic_bool done = false;
+    std::vector<std::thread> thieves;
+    for (uint32_t t = 0; t < 4; ++t) {
+        thieves.emplace_back([&]() {
+            while (!done.load() || !queue.Empty()) {
+                if (auto *item = queue.Steal(); item != nullptr) {
+                    seen[static_cast<uint32_t>(item - items.data())]++;
+                }
+            }
+        });
+    }
+
+    // owner pushes and pops while thieves take from the other end, the deque grows from 16.
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        queue.Push(&items[i]);
+        if (i % 3 == 0) {
+            if (auto *item = queue.Pop(); item != nullptr) {
+                seen[static_cast<uint32_t>(item - items.data())]++;
+            }
+        }
+    }
+    while (auto *item = queue.Pop()) {
+        seen[static_cast<uint32_t>(item - items.data())]++;
+    }
+    done = true;
+    for (auto &thread : thieves) {
+        thread.join();
+    }
+
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        ASSERT_EQ(seen[i].load(), 1);
+    }
+}
+
+TEST(TaskTest, WorkStealingBackendTest)
+{
+    TaskExecutor executor(4, TaskBackend::WORK_STEALING);
+    ASSERT_EQ(executor.GetBackend(), TaskBackend::WORK_STEALING);
+
+    std::atomic_uint32_t counter = 0;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        executor.Dispatch(TaskPriority::FRAME_CRITICAL, [&executor, &counter]() {
+            executor.Dispatch(TaskPriority::STREAMING, [&counter]() { ++counter; });
+            ++counter;
+        });
+    }
+    executor.WaitForAll();
+    ASSERT_EQ(counter.load(), 2000);
+
+    TaskGraph graph(TaskPriority::FRAME_CRITICAL, &executor);
+    std::vector<uint32_t> values(3, 0);
+    auto a = graph.Add("A", [&values]() { values[0] = 1; });
+    auto b = graph.Add("B", [&values]() { values[1] = values[0] + 1; });
+    auto c = graph.Add("C", [&values]() { values[2] = values[1] + 1; });
+    a.Precede(b);
+    c.Succeed(b);
+    graph.Dispatch();
+    graph.Wait();
+    ASSERT_EQ(values[2], 3);
+}
+
+TEST(TaskTest, ParallelForTest)
+{
+    for (auto backend : {TaskBackend::TASKFLOW, TaskBackend::WORK_STEALING}) {
+        TaskExecutor executor(4, backend);
+
+        std::vector<uint32_t> hits(10007, 0);
+        ParallelFor(executor, 0, static_cast<uint32_t>(hits.size()), [&hits](uint32_t first, uint32_t last) {
+            for (uint32_t i = first; i < last; ++i) {
+                hits[i]++;
+            }
+        }, 16);
+        for (auto v : hits) {
+            ASSERT_EQ(v, 1);
+        }
+
+        auto sum = ParallelReduce(executor, 1, 10001, uint64_t(0), [](uint32_t first, uint32_t last, uint64_t value) {
+            for (uint32_t i = first; i < last; ++i) {
+                value += i;
+            }
+            return value;
+        }, [](uint64_t x, uint64_t y) { return x + y; });
+        ASSERT_EQ(sum, 50005000ULL);
+
+        // nested loops must not deadlock when every worker waits on an inner loop.
+        std::atomic_uint32_t inner = 0;
+        ParallelFor(executor, 0, 64, [&](uint32_t first, uint32_t last) {
+            for (uint32_t i = first; i < last; ++i) {
+                ParallelFor(executor, 0, 256, [&inner](uint32_t f, uint32_t l) { inner += l - f; }, 8);
+            }
+        });
+        ASSERT_EQ(inner.load(), 64 * 256);
+    }
+}
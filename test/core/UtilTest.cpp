@@ -7,8 +7,11 @@
 #include <core/util/Uuid.h>
 #include <core/util/ArrayBitFlag.h>
 #include <core/util/TimeBlend.h>
+#include <core/util/RadixSort.h>
 
 #include <unordered_set>
+#include <algorithm>
+#include <random>
 #include <gtest/gtest.h>
 #include <string>
 
@@ -105,6 +108,29 @@ TEST(UtilTest, ArrayBitTest)
     ASSERT_EQ(bit.CheckBit(ArrayBitTestE::VAL33), false);
 }
 
+TEST(UtilTest, RadixSortTest)
+{
+    std::mt19937_64 rng(7);
+    std::vector<RadixSortItem> items(4096);
+    for (uint32_t i = 0; i < items.size(); ++i) {
+        // few distinct high bits, to exercise skipped passes and stability.
+        items[i] = RadixSortItem{(rng() & 0xFF000000000000FFULL), i};
+    }
+    std::vector<RadixSortItem> scratch(items.size());
+
+    auto expect = items;
+    std::stable_sort(expect.begin(), expect.end(), [](const auto &lhs, const auto &rhs) { return lhs.key < rhs.key; });
+
+    auto *res = RadixSort(items.data(), scratch.data(), items.size());
+    for (uint32_t i = 0; i < expect.size(); ++i) {
+        ASSERT_EQ(res[i].key, expect[i].key);
+        ASSERT_EQ(res[i].value, expect[i].value);
+    }
+
+    RadixSortItem single = {1, 0};
+    ASSERT_EQ(RadixSort(&single, scratch.data(), 1), &single);
+}
+
 struct MemoryBuf {
     std::vector<uint8_t> data;
 };
@@ -0,0 +1,115 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/archive/StreamArchive.h>
+#include <core/archive/BufferedArchive.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <sstream>
+#include <vector>
+
+using namespace sky;
+
+namespace {
+
+    struct SmallStruct {
+        float    a;
+        uint64_t b;
+        uint32_t c;
+        uint16_t d;
+        uint8_t  e;
+    };
+
+    template <typename Func>
+    double Measure(Func &&func)
+    {
+        auto begin = std::chrono::high_resolution_clock::now();
+        func();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    template <typename Archive>
+    void SaveFields(Archive &archive, const std::vector<SmallStruct> &values)
+    {
+        for (const auto &v : values) {
+            archive << v.a << v.b << v.c << v.d << v.e;
+        }
+    }
+
+    template <typename Archive>
+    void LoadFields(Archive &archive, std::vector<SmallStruct> &values)
+    {
+        for (auto &v : values) {
+            archive >> v.a >> v.b >> v.c >> v.d >> v.e;
+        }
+    }
+
+} // namespace
+
+TEST(ArchiveBench, SmallStructs)
+{
+    static constexpr uint32_t COUNT = 1000000;
+    std::vector<SmallStruct> values(COUNT);
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        values[i] = {static_cast<float>(i), i * 3ULL, i, static_cast<uint16_t>(i), static_cast<uint8_t>(i)};
+    }
+
+    // virtual LoadRaw/SaveRaw per field over a stringstream.
+    std::stringstream ss;
+    double streamSave = Measure([&]() {
+        OStreamArchive archive(ss);
+        SaveFields(archive, values);
+    });
+    std::vector<SmallStruct> streamOut(COUNT);
+    double streamLoad = Measure([&]() {
+        IStreamArchive archive(ss);
+        LoadFields(archive, streamOut);
+    });
+
+    // the same stream behind the buffered archives.
+    std::stringstream bs;
+    double bufferedStreamSave = Measure([&]() {
+        OStreamArchive stream(bs);
+        BufferedOutputArchive archive(stream);
+        SaveFields(archive, values);
+    });
+    std::vector<SmallStruct> bufferedStreamOut(COUNT);
+    double bufferedStreamLoad = Measure([&]() {
+        IStreamArchive stream(bs);
+        BufferedInputArchive archive(stream);
+        LoadFields(archive, bufferedStreamOut);
+    });
+
+    // contiguous memory, per field and in one block.
+    BufferedOutputArchive memory;
+    double spanSave = Measure([&]() { SaveFields(memory, values); });
+    std::vector<SmallStruct> spanOut(COUNT);
+    double spanLoad = Measure([&]() {
+        BufferedInputArchive archive(memory.Data(), memory.Size());
+        LoadFields(archive, spanOut);
+    });
+
+    BufferedOutputArchive bulk;
+    double bulkSave = Measure([&]() { bulk << values; });
+    std::vector<SmallStruct> bulkOut;
+    double bulkLoad = Measure([&]() {
+        BufferedInputArchive archive(bulk.Data(), bulk.Size());
+        archive >> bulkOut;
+    });
+
+    for (uint32_t i = 0; i < COUNT; i += 9973) {
+        ASSERT_EQ(streamOut[i].b, values[i].b);
+        ASSERT_EQ(bufferedStreamOut[i].b, values[i].b);
+        ASSERT_EQ(spanOut[i].c, values[i].c);
+        ASSERT_EQ(bulkOut[i].e, values[i].e);
+    }
+    ASSERT_EQ(ss.str(), bs.str());
+
+    printf("[ArchiveBench] %u structs save/load ms\n", COUNT);
+    printf("[ArchiveBench]   stream archive          %8.2f %8.2f\n", streamSave, streamLoad);
+    printf("[ArchiveBench]   buffered over stream    %8.2f %8.2f\n", bufferedStreamSave, bufferedStreamLoad);
+    printf("[ArchiveBench]   buffered over memory    %8.2f %8.2f\n", spanSave, spanLoad);
+    printf("[ArchiveBench]   trivially copyable bulk %8.2f %8.2f\n", bulkSave, bulkLoad);
+}
@@ -0,0 +1,147 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/event/Event.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace sky;
+
+namespace {
+
+    constexpr uint32_t KEY_NUM       = 10000;
+    constexpr uint32_t EVENT_NUM     = 1000000;
+    constexpr uint32_t LISTENER_NUM  = 100000;
+    constexpr uint32_t THREAD_NUM    = 4;
+
+    struct IBenchEvent : public EventTraits {
+        using KeyType = uint32_t;
+
+        virtual void OnValue(uint32_t value) = 0;
+    };
+
+    struct IBenchBatchEvent : public EventTraits {
+        using KeyType   = uint32_t;
+        using MutexType = std::mutex;
+
+        static constexpr StorageMode STORAGE = StorageMode::BATCHED;
+
+        virtual void OnValue(uint32_t value) = 0;
+    };
+
+    template <typename Interface>
+    struct Listener : public Interface {
+        void OnValue(uint32_t value) override { sum += value; ++count; }
+
+        uint64_t sum   = 0;
+        uint64_t count = 0;
+    };
+    using BenchListener      = Listener<IBenchEvent>;
+    using BenchBatchListener = Listener<IBenchBatchEvent>;
+
+    template <typename Func>
+    double MeasureMs(Func &&func)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    // cheap key scatter, keeps the map lookups out of cache like per actor events do.
+    uint32_t Scatter(uint32_t i)
+    {
+        return (i * 2654435761U) % KEY_NUM;
+    }
+
+} // namespace
+
+TEST(EventBench, BroadCast)
+{
+    std::vector<BenchListener> listeners(KEY_NUM);
+    std::vector<EventBinder<IBenchEvent>> binders(KEY_NUM);
+    for (uint32_t i = 0; i < KEY_NUM; ++i) {
+        binders[i].Bind(&listeners[i], i);
+    }
+
+    auto time = MeasureMs([]() {
+        for (uint32_t i = 0; i < EVENT_NUM; ++i) {
+            Event<IBenchEvent>::BroadCast(Scatter(i), &IBenchEvent::OnValue, i);
+        }
+    });
+
+    uint64_t count = 0;
+    for (auto &listener : listeners) {
+        count += listener.count;
+    }
+    ASSERT_EQ(count, EVENT_NUM);
+    printf("[EventBench] immediate %u events over %u keys, %.1fns/event\n", EVENT_NUM, KEY_NUM, time * 1e6 / EVENT_NUM);
+}
+
+TEST(EventBench, Disconnect)
+{
+    // one key per listener, like the per actor transform events.
+    std::vector<BenchListener> listeners(LISTENER_NUM);
+    auto binders = std::make_unique<EventBinder<IBenchEvent>[]>(LISTENER_NUM);
+    auto connect = MeasureMs([&]() {
+        for (uint32_t i = 0; i < LISTENER_NUM; ++i) {
+            binders[i].Bind(&listeners[i], KEY_NUM + i);
+        }
+    });
+
+    auto disconnect = MeasureMs([&]() {
+        for (uint32_t i = 0; i < LISTENER_NUM; ++i) {
+            binders[i].Reset();
+        }
+    });
+    printf("[EventBench] %u listeners, connect %.2fms, disconnect %.2fms\n", LISTENER_NUM, connect, disconnect);
+}
+
+TEST(EventBench, Batched)
+{
+    std::vector<BenchBatchListener> listeners(KEY_NUM);
+    std::vector<EventBinder<IBenchBatchEvent>> binders(KEY_NUM);
+    for (uint32_t i = 0; i < KEY_NUM; ++i) {
+        binders[i].Bind(&listeners[i], i);
+    }
+
+    // every thread raises the same keys, one event per key survives the flush.
+    auto queue = MeasureMs([]() {
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < THREAD_NUM; ++t) {
+            threads.emplace_back([t]() {
+                for (uint32_t i = t; i < EVENT_NUM; i += THREAD_NUM) {
+                    Event<IBenchBatchEvent>::BroadCast(Scatter(i), &IBenchBatchEvent::OnValue, i);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    });
+    auto flush = MeasureMs([]() { EventQueue::Get()->Flush(); });
+
+    uint64_t count = 0;
+    for (auto &listener : listeners) {
+        count += listener.count;
+    }
+    ASSERT_EQ(count, KEY_NUM);
+
+    // no duplicates, every queued event is delivered.
+    auto queueUnique = MeasureMs([]() {
+        for (uint32_t i = 0; i < KEY_NUM; ++i) {
+            Event<IBenchBatchEvent>::BroadCast(i, &IBenchBatchEvent::OnValue, i);
+        }
+    });
+    auto flushUnique = MeasureMs([]() { EventQueue::Get()->Flush(); });
+
+    printf("[EventBench] batched %u events from %u threads, queue %.1fns/event, flush %.2fms, %llu delivered\n",
+        EVENT_NUM, THREAD_NUM, queue * 1e6 / EVENT_NUM, flush, static_cast<unsigned long long>(count));
+    printf("[EventBench] batched %u unique events, queue %.1fns/event, flush %.1fns/event\n",
+        KEY_NUM, queueUnique * 1e6 / KEY_NUM, flushUnique * 1e6 / KEY_NUM);
+}
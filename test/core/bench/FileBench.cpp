@@ -0,0 +1,198 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/file/FileSystem.h>
+#include <core/file/AsyncFileIO.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+using namespace sky;
+
+namespace {
+
+    // payload layout of a baked product, a few large image slices and many small mesh buffers.
+    struct Payload {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    std::vector<Payload> WriteProduct(const FilePath &path, uint32_t images, uint32_t buffers)
+    {
+        std::vector<Payload> payloads;
+        std::vector<uint8_t> block(4 * 1024 * 1024);
+        for (size_t i = 0; i < block.size(); ++i) {
+            block[i] = static_cast<uint8_t>(i * 31);
+        }
+
+        std::fstream stream = path.OpenFStream(std::ios::out | std::ios::binary | std::ios::trunc);
+        uint64_t offset = 0;
+        auto write = [&](uint64_t size) {
+            stream.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(size));
+            payloads.emplace_back(Payload{offset, size});
+            offset += size;
+        };
+        for (uint32_t i = 0; i < images; ++i) {
+            write(block.size());
+            write(block.size() / 4);
+        }
+        for (uint32_t i = 0; i < buffers; ++i) {
+            write(16 * 1024 + (i % 7) * 4096);
+        }
+        return payloads;
+    }
+
+    // drops clean pages of the file so the next load has to hit the disk.
+    void DropPageCache(const FilePath &path)
+    {
+#if defined(__linux__)
+        int fd = open(path.GetStr().c_str(), O_RDONLY);
+        if (fd >= 0) {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+#endif
+    }
+
+    // copies every payload into a staging block the way Queue::UploadBuffer does.
+    template <typename Func>
+    double Load(const std::vector<Payload> &payloads, std::vector<uint8_t> &staging, Func &&read)
+    {
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (const auto &payload : payloads) {
+            read(payload, staging.data());
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+} // namespace
+
+TEST(FileBench, MappedLoad)
+{
+    FilePath path("file_bench.bin");
+    NativeFileSystem fs(std::filesystem::temp_directory_path() / "sky_file_bench");
+    auto payloads = WriteProduct(fs.GetPath() / path, 12, 600);
+    uint64_t total = payloads.back().offset + payloads.back().size;
+    std::vector<uint8_t> staging(4 * 1024 * 1024);
+
+    auto streamRead = [&]() {
+        auto file = fs.OpenFile(path);
+        return Load(payloads, staging, [&](const Payload &payload, uint8_t *out) {
+            file->ReadData(payload.offset, payload.size, out);
+        });
+    };
+    auto mappedRead = [&]() {
+        auto file = fs.OpenFile(path);
+        auto begin = std::chrono::high_resolution_clock::now();
+        auto view = file->Map(0, 0, FileAccessHint::SEQUENTIAL);
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count() +
+            Load(payloads, staging, [&](const Payload &payload, uint8_t *out) {
+                memcpy(out, view->Data() + payload.offset, payload.size);
+            });
+    };
+
+    DropPageCache(fs.GetPath() / path);
+    double streamCold = streamRead();
+    double streamWarm = streamRead();
+
+    DropPageCache(fs.GetPath() / path);
+    double mappedCold = mappedRead();
+    double mappedWarm = mappedRead();
+
+    printf("[FileBench] %zu payloads %.1f MB: stream cold %.2f ms warm %.2f ms, mapped cold %.2f ms warm %.2f ms\n",
+        payloads.size(), static_cast<double>(total) / (1024.0 * 1024.0), streamCold, streamWarm, mappedCold, mappedWarm);
+    std::filesystem::remove_all(fs.GetPath().GetStr());
+}
+
+TEST(FileBench, AsyncSmallAssets)
+{
+    static constexpr uint32_t ASSET_NUM = 10000;
+    NativeFileSystem fs(std::filesystem::temp_directory_path() / "sky_file_bench_assets");
+
+    std::vector<FilePtr> files;
+    uint64_t total = 0;
+    std::vector<char> content(16 * 1024, 's');
+    for (uint32_t i = 0; i < ASSET_NUM; ++i) {
+        auto name = std::to_string(i) + ".asset";
+        uint64_t size = 2048 + (i * 613) % (content.size() - 2048);
+        fs.CreateOrOpenFile(name)->AppendData(content.data(), size);
+        files.emplace_back(fs.OpenFile(name));
+        total += size;
+    }
+    double totalMB = static_cast<double>(total) / (1024.0 * 1024.0);
+
+    auto dropAll = [&]() {
+        for (auto &file : files) {
+            DropPageCache(file->GetPath());
+        }
+    };
+
+    // what AssetManager::LoadAsset does today, one blocking read after another.
+    auto runSync = [&]() {
+        auto begin = std::chrono::high_resolution_clock::now();
+        uint64_t bytes = 0;
+        for (auto &file : files) {
+            std::vector<uint8_t> data;
+            file->ReadBin(data);
+            bytes += data.size();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(bytes, total);
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+
+    auto runAsync = [&](IOBackend backend, uint32_t depth) {
+        AsyncFileIO::Descriptor desc = {};
+        desc.backend    = backend;
+        desc.queueDepth = depth;
+        desc.threadNum  = depth;
+        desc.callback   = IOCallbackMode::IO_THREAD;
+        AsyncFileIO io(desc);
+
+        std::vector<FileReadRequest> requests(files.size());
+        for (size_t i = 0; i < files.size(); ++i) {
+            requests[i].file = files[i];
+        }
+        auto begin = std::chrono::high_resolution_clock::now();
+        auto reads = io.ReadBatch(std::move(requests));
+        io.WaitIdle();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        auto stats = io.GetStats();
+        EXPECT_EQ(stats.bytesRead, total);
+        double ms = std::chrono::duration<double, std::milli>(end - begin).count();
+        printf("[FileBench] %s depth %u: %.2f ms %.1f MB/s %.0f files/s, queue depth avg %.1f max %u\n",
+            io.GetBackend() == IOBackend::IO_URING ? "io_uring" : "pool", depth, ms,
+            totalMB * 1000.0 / ms, ASSET_NUM * 1000.0 / ms, stats.avgQueueDepth, stats.maxQueueDepth);
+        return ms;
+    };
+
+    printf("[FileBench] %u assets %.1f MB\n", ASSET_NUM, totalMB);
+    for (bool cold : {true, false}) {
+        if (cold) {
+            dropAll();
+        }
+        printf("[FileBench] %s sync: %.2f ms\n", cold ? "cold" : "warm", runSync());
+        for (auto backend : {IOBackend::THREAD_POOL, IOBackend::IO_URING}) {
+            for (uint32_t depth : {4U, 32U, 128U}) {
+                if (cold) {
+                    dropAll();
+                }
+                runAsync(backend, depth);
+            }
+        }
+    }
+
+    files.clear();
+    std::filesystem::remove_all(fs.GetPath().GetStr());
+}
@@ -0,0 +1,91 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/hash/Hash.h>
+#include <core/hash/Crc32.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+
+using namespace sky;
+
+namespace {
+
+    std::vector<uint8_t> MakeBuffer(size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        uint32_t seed = 1;
+        for (auto &v : data) {
+            seed = seed * 1664525U + 1013904223U;
+            v = static_cast<uint8_t>(seed >> 24);
+        }
+        return data;
+    }
+
+    // returns ms, sink keeps the results alive.
+    template <typename Func>
+    double Measure(uint32_t repeat, Func &&func)
+    {
+        uint64_t sink = 0;
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < repeat; ++i) {
+            sink += func(i);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        EXPECT_NE(sink, 1);
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    const char *LevelName(HashSimdLevel level)
+    {
+        switch (level) {
+            case HashSimdLevel::AVX2: return "avx2";
+            case HashSimdLevel::SSE2: return "sse2";
+            default: return "scalar";
+        }
+    }
+
+} // namespace
+
+TEST(HashBench, LargeBuffer)
+{
+    static constexpr size_t SIZE   = 8 * 1024 * 1024;
+    static constexpr uint32_t REPEAT = 16;
+    auto data = MakeBuffer(SIZE);
+    double totalMB = static_cast<double>(SIZE) * REPEAT / (1024.0 * 1024.0);
+
+    double crcSoft = Measure(REPEAT, [&](uint32_t) { return Crc32::ExtendSoftware(0, data.data(), SIZE); });
+    double crcHw   = Measure(REPEAT, [&](uint32_t) { return Crc32::Extend(0, data.data(), SIZE); });
+    printf("crc32c software %.1f MB/s, dispatched (hw %d) %.1f MB/s\n",
+        totalMB * 1000.0 / crcSoft, Crc32::IsHardwareAccelerated(), totalMB * 1000.0 / crcHw);
+
+    double murmur = Measure(REPEAT, [&](uint32_t) { return Murmur3Hash32(data.data(), SIZE, 0); });
+    printf("murmur3_32 %.1f MB/s\n", totalMB * 1000.0 / murmur);
+
+    auto previous = GetHash64SimdLevel();
+    for (auto level : {HashSimdLevel::SCALAR, HashSimdLevel::SSE2, HashSimdLevel::AVX2}) {
+        SetHash64SimdLevel(level);
+        if (GetHash64SimdLevel() != level) {
+            continue;
+        }
+        double ms = Measure(REPEAT, [&](uint32_t) { return Hash64(data.data(), SIZE); });
+        printf("hash64 %s %.1f MB/s\n", LevelName(level), totalMB * 1000.0 / ms);
+    }
+    SetHash64SimdLevel(previous);
+}
+
+TEST(HashBench, SmallKeys)
+{
+    static constexpr uint32_t REPEAT = 1000000;
+    auto data = MakeBuffer(4096);
+
+    for (size_t size : {8, 16, 32, 64, 128, 256}) {
+        auto length = static_cast<uint32_t>(size);
+        double crc    = Measure(REPEAT, [&](uint32_t i) { return Crc32::Cal(data.data() + (i & 1023), length); });
+        double murmur = Measure(REPEAT, [&](uint32_t i) { return Murmur3Hash32(data.data() + (i & 1023), length, 0); });
+        double hash64 = Measure(REPEAT, [&](uint32_t i) { return Hash64(data.data() + (i & 1023), length); });
+        printf("%4zu bytes: crc32c %.1f ns, murmur3_32 %.1f ns, hash64 %.1f ns\n", size,
+            crc * 1e6 / REPEAT, murmur * 1e6 / REPEAT, hash64 * 1e6 / REPEAT);
+    }
+}
@@ -0,0 +1,97 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/logger/Logger.h>
+#include <core/logger/LogSink.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace sky;
+
+namespace {
+
+    // formats nothing itself, keeps the sink side cheap so the caller cost is measured.
+    struct NullSink : public ILogSink {
+        void Write(const LogRecord &record) override { count += record.message.size() != 0 ? 1 : 0; }
+
+        uint64_t count = 0;
+    };
+
+    struct Latency {
+        double average = 0.0;
+        double p99     = 0.0;
+    };
+
+    // frame sized bursts, the logger catches up in between like it would between frames.
+    Latency MeasureCalls(uint32_t threadNum, uint32_t burstNum, uint32_t callNum)
+    {
+        std::vector<std::vector<uint32_t>> samples(threadNum);
+        for (uint32_t burst = 0; burst < burstNum; ++burst) {
+            std::vector<std::thread> threads;
+            for (uint32_t i = 0; i < threadNum; ++i) {
+                threads.emplace_back([i, callNum, &samples]() {
+                    auto &local = samples[i];
+                    for (uint32_t j = 0; j < callNum; ++j) {
+                        auto begin = std::chrono::steady_clock::now();
+                        LOG_I("Bench", "frame %u object %u position %f name %s", i, j, 1.5f * static_cast<float>(j), "actor");
+                        auto end = std::chrono::steady_clock::now();
+                        local.emplace_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+                    }
+                });
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+            Logger::Flush();
+        }
+
+        std::vector<uint32_t> all;
+        for (auto &local : samples) {
+            all.insert(all.end(), local.begin(), local.end());
+        }
+        std::sort(all.begin(), all.end());
+
+        Latency res;
+        for (auto v : all) {
+            res.average += v;
+        }
+        res.average /= static_cast<double>(all.size());
+        res.p99 = all[all.size() * 99 / 100];
+        return res;
+    }
+
+} // namespace
+
+TEST(LoggerBench, CallerLatency)
+{
+    static constexpr uint32_t BURST_NUM = 100;
+    static constexpr uint32_t CALL_NUM  = 1000;
+
+    Logger::ClearSinks();
+    Logger::AddSink(new NullSink());
+
+    for (uint32_t threadNum : {1U, 4U}) {
+        Logger::SetAsync(false);
+        auto sync = MeasureCalls(threadNum, BURST_NUM, CALL_NUM);
+
+        Logger::SetAsync(true);
+        auto async = MeasureCalls(threadNum, BURST_NUM, CALL_NUM);
+
+        printf("[LoggerBench] threads %u, sync  avg %.1f ns p99 %.1f ns\n", threadNum, sync.average, sync.p99);
+        printf("[LoggerBench] threads %u, async avg %.1f ns p99 %.1f ns\n", threadNum, async.average, async.p99);
+    }
+
+    // filtered calls should cost a load and a compare.
+    Logger::SetLevel(LogLevel::WARN);
+    auto filtered = MeasureCalls(1, BURST_NUM, CALL_NUM);
+    Logger::SetLevel(LogLevel::INFO);
+    printf("[LoggerBench] filtered avg %.1f ns p99 %.1f ns\n", filtered.average, filtered.p99);
+
+    Logger::ClearSinks();
+    Logger::AddSink(new StdoutLogSink());
+}
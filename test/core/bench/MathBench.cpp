@@ -0,0 +1,60 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/math/MathUtil.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "../MathTestUtil.h"
+
+using namespace sky;
+
+namespace {
+
+    // keep the working set cache resident so the numbers reflect arithmetic throughput.
+    constexpr uint32_t COUNT      = 1024;
+    constexpr uint32_t MASK       = COUNT - 1;
+    constexpr uint32_t ITERATIONS = 1 << 18;
+
+    template <typename Func>
+    double MeasureNs(uint32_t count, Func &&func)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < count; ++i) {
+            func(i & MASK);
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count() / count;
+    }
+
+} // namespace
+
+TEST(MathBench, Simd)
+{
+    std::mt19937 rng(4321);
+    std::uniform_real_distribution<float> dist(-10.f, 10.f);
+
+    std::vector<Matrix4> matrices(COUNT);
+    std::vector<Vector3> points(COUNT);
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        matrices[i] = RandomAffine(rng);
+        points[i] = Vector3(dist(rng), dist(rng), dist(rng));
+    }
+
+    std::vector<Matrix4> outMatrices(COUNT);
+    std::vector<Vector3> outPoints(COUNT);
+
+    double mulSimd = MeasureNs(ITERATIONS, [&](uint32_t i) { outMatrices[i] = matrices[i] * matrices[(i + 1) & MASK]; });
+    double mulScalar = MeasureNs(ITERATIONS, [&](uint32_t i) { outMatrices[i] = scalar::Mul(matrices[i], matrices[(i + 1) & MASK]); });
+    double invSimd = MeasureNs(ITERATIONS, [&](uint32_t i) { outMatrices[i] = matrices[i].Inverse(); });
+    double invScalar = MeasureNs(ITERATIONS, [&](uint32_t i) { outMatrices[i] = scalar::Inverse(matrices[i]); });
+    double ptSimd = MeasureNs(ITERATIONS, [&](uint32_t i) { outPoints[i] = matrices[i].TransformPoint(points[i]); });
+    double ptScalar = MeasureNs(ITERATIONS, [&](uint32_t i) { outPoints[i] = scalar::TransformPoint(matrices[i], points[i]); });
+
+    printf("[MathBench] simd enabled: %d\n", SKY_MATH_SIMD);
+    printf("[MathBench] matrix mul simd %.2fns/op, scalar %.2fns/op\n", mulSimd, mulScalar);
+    printf("[MathBench] matrix inverse simd %.2fns/op, scalar %.2fns/op\n", invSimd, invScalar);
+    printf("[MathBench] transform point simd %.2fns/op, scalar %.2fns/op\n", ptSimd, ptScalar);
+    ASSERT_EQ(outMatrices.size(), outPoints.size());
+}
@@ -0,0 +1,187 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/memory/TLSFAllocator.h>
+#include <core/memory/FrameAllocator.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <thread>
+
+using namespace sky;
+
+namespace {
+
+    struct TraceOp {
+        uint32_t slot;
+        uint32_t size; // 0 frees the slot
+    };
+
+    // engine like trace, mostly small containers and nodes, some buffers and a few big staging blocks.
+    std::vector<TraceOp> BuildTrace(uint32_t seed, uint32_t count, uint32_t slots)
+    {
+        std::mt19937 rng(seed);
+        std::vector<bool> used(slots, false);
+        std::vector<TraceOp> trace;
+        trace.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t slot = rng() % slots;
+            if (used[slot]) {
+                trace.emplace_back(TraceOp{slot, 0});
+                used[slot] = false;
+                continue;
+            }
+
+            uint32_t pick = rng() % 1000;
+            uint32_t size = pick < 850 ? rng() % 128 + 8 : (pick < 990 ? rng() % 16384 + 256 : rng() % (512 * 1024) + 65536);
+            trace.emplace_back(TraceOp{slot, size});
+            used[slot] = true;
+        }
+        for (uint32_t slot = 0; slot < slots; ++slot) {
+            if (used[slot]) {
+                trace.emplace_back(TraceOp{slot, 0});
+            }
+        }
+        return trace;
+    }
+
+    template <typename Alloc, typename Free>
+    void Replay(const std::vector<TraceOp> &trace, uint32_t slots, Alloc &&alloc, Free &&free)
+    {
+        std::vector<void *> ptrs(slots, nullptr);
+        for (const auto &op : trace) {
+            if (op.size == 0) {
+                free(ptrs[op.slot]);
+                ptrs[op.slot] = nullptr;
+            } else {
+                ptrs[op.slot] = alloc(op.size);
+                static_cast<uint8_t *>(ptrs[op.slot])[0] = 1;
+            }
+        }
+    }
+
+    template <typename Func>
+    double RunThreads(uint32_t threadNum, Func &&func)
+    {
+        auto begin = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < threadNum; ++i) {
+            threads.emplace_back([&func, i]() { func(i); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+} // namespace
+
+TEST(MemoryBench, AllocationTrace)
+{
+    static constexpr uint32_t OP_COUNT = 1000000;
+    static constexpr uint32_t SLOTS    = 4096;
+
+    for (uint32_t threadNum : {1U, 4U}) {
+        std::vector<std::vector<TraceOp>> traces;
+        for (uint32_t i = 0; i < threadNum; ++i) {
+            traces.emplace_back(BuildTrace(i + 1, OP_COUNT, SLOTS));
+        }
+
+        MallocAllocator malloc;
+        double mallocMs = RunThreads(threadNum, [&](uint32_t i) {
+            Replay(traces[i], SLOTS, [&](size_t size) { return malloc.Allocate(size, 16); }, [&](void *ptr) { malloc.Deallocate(ptr); });
+        });
+
+        TLSFAllocator tlsf;
+        double tlsfMs = RunThreads(threadNum, [&](uint32_t i) {
+            Replay(traces[i], SLOTS, [&](size_t size) { return tlsf.Allocate(size, 16); }, [&](void *ptr) { tlsf.Deallocate(ptr); });
+            tlsf.FlushThreadCache();
+        });
+
+        auto stats = tlsf.GetStats();
+        printf("[MemoryBench] threads %u, ops %u: malloc %.2f ms, tlsf %.2f ms, reserved %.2f MB, fragmentation %.3f\n",
+            threadNum, OP_COUNT * threadNum, mallocMs, tlsfMs,
+            static_cast<double>(stats.reservedBytes) / (1024.0 * 1024.0), stats.fragmentation);
+    }
+}
+
+namespace {
+
+    // upstream that counts what reaches the heap.
+    class CountingResource : public PmrResource {
+    public:
+        uint32_t allocations = 0;
+
+    private:
+        void *do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocations;
+            return upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *p, size_t bytes, size_t alignment) override
+        {
+            upstream->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const PmrResource &other) const noexcept override { return this == &other; }
+
+#ifdef SKY_PLATFORM_WINDOWS
+        PmrResource *upstream = std::pmr::new_delete_resource();
+#else
+        PmrResource *upstream = boost::container::pmr::new_delete_resource();
+#endif
+    };
+
+    struct FakeDrawItem {
+        void *primitive;
+        uint32_t batch;
+        uint32_t instance;
+    };
+
+    // queue building of one frame, a few queues filled item by item and sorted through scratch buffers.
+    void BuildQueues(PmrResource *res, uint32_t queueNum, uint32_t itemNum)
+    {
+        PmrVector<PmrVector<FakeDrawItem>> queues(res);
+        for (uint32_t q = 0; q < queueNum; ++q) {
+            auto &queue = queues.emplace_back();
+            for (uint32_t i = 0; i < itemNum; ++i) {
+                queue.emplace_back(FakeDrawItem{nullptr, i, q});
+            }
+            PmrVector<uint64_t> keys(queue.size(), res);
+            PmrVector<uint64_t> scratch(queue.size(), res);
+            keys[0] = scratch[0] = queue.back().batch;
+        }
+    }
+
+} // namespace
+
+TEST(MemoryBench, FrameAllocator)
+{
+    static constexpr uint32_t FRAME_NUM = 200;
+    static constexpr uint32_t QUEUE_NUM = 16;
+    static constexpr uint32_t ITEM_NUM  = 2000;
+
+    CountingResource heap;
+    double heapMs = RunThreads(1, [&](uint32_t) {
+        for (uint32_t frame = 0; frame < FRAME_NUM; ++frame) {
+            BuildQueues(&heap, QUEUE_NUM, ITEM_NUM);
+        }
+    });
+
+    FrameAllocator frameAllocator;
+    uint32_t heapBlocks = 0;
+    double frameMs = RunThreads(1, [&](uint32_t) {
+        for (uint32_t frame = 0; frame < FRAME_NUM; ++frame) {
+            BuildQueues(&frameAllocator, QUEUE_NUM, ITEM_NUM);
+            frameAllocator.NextFrame();
+            heapBlocks += frameAllocator.GetLastFrameStats().heapAllocations;
+        }
+    });
+
+    printf("[MemoryBench] %u frames: heap %.2f ms, %.1f heap allocations per frame; frame arena %.2f ms, %.2f heap allocations per frame, last frame %u\n",
+        FRAME_NUM, heapMs, static_cast<double>(heap.allocations) / FRAME_NUM, frameMs,
+        static_cast<double>(heapBlocks) / FRAME_NUM, frameAllocator.GetLastFrameStats().heapAllocations);
+}
@@ -0,0 +1,106 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/name/Name.h>
+#include <core/hash/Crc32.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace sky;
+
+namespace {
+
+    // the registry before sharding, one mutex around a hash map.
+    class LockedRegistry {
+    public:
+        uint32_t FetchOrRegister(const char *str)
+        {
+            auto length = static_cast<uint32_t>(strlen(str));
+            uint32_t hash = Crc32::Cal(reinterpret_cast<const uint8_t *>(str), length);
+            std::lock_guard<std::mutex> lock(mutex);
+            auto iter = names.find(hash);
+            if (iter == names.end()) {
+                names.emplace(hash, std::string(str, length));
+            }
+            return hash;
+        }
+
+        std::string_view GetStr(uint32_t hash)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto iter = names.find(hash);
+            return iter != names.end() ? std::string_view(iter->second) : std::string_view{};
+        }
+
+    private:
+        std::mutex mutex;
+        std::unordered_map<uint32_t, std::string> names;
+    };
+
+    template <typename Func>
+    double RunThreads(uint32_t threadNum, Func &&func)
+    {
+        auto begin = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < threadNum; ++i) {
+            threads.emplace_back([&func, i]() { func(i); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+} // namespace
+
+TEST(NameBench, Contention)
+{
+    static constexpr uint32_t THREAD_NUM = 32;
+    static constexpr uint32_t NAME_NUM   = 2048;
+    static constexpr uint32_t ITERATION  = 50000;
+
+    std::vector<std::string> strings;
+    for (uint32_t i = 0; i < NAME_NUM; ++i) {
+        strings.emplace_back("bench_name_" + std::to_string(i));
+    }
+
+    // mostly lookups of names that exist, the first pass of every thread also interns.
+    std::atomic_size_t sink{0};
+    LockedRegistry locked;
+    double lockedMs = RunThreads(THREAD_NUM, [&](uint32_t t) {
+        size_t length = 0;
+        for (uint32_t i = 0; i < ITERATION; ++i) {
+            uint32_t handle = locked.FetchOrRegister(strings[(i * 7 + t) % NAME_NUM].c_str());
+            length += locked.GetStr(handle).length();
+        }
+        sink += length;
+    });
+
+    double shardedMs = RunThreads(THREAD_NUM, [&](uint32_t t) {
+        size_t length = 0;
+        for (uint32_t i = 0; i < ITERATION; ++i) {
+            Name name(strings[(i * 7 + t) % NAME_NUM].c_str());
+            length += name.GetStr().length();
+        }
+        sink += length;
+    });
+
+    double literalMs = RunThreads(THREAD_NUM, [&](uint32_t) {
+        size_t length = 0;
+        for (uint32_t i = 0; i < ITERATION; ++i) {
+            Name name = "bench_literal_name"_name;
+            length += name.GetStr().length();
+        }
+        sink += length;
+    });
+
+    printf("[NameBench] %u threads x %u intern + resolve: mutex %.2f ms, sharded %.2f ms, literal %.2f ms (%zu)\n",
+        THREAD_NUM, ITERATION, lockedMs, shardedMs, literalMs, sink.load());
+}
@@ -0,0 +1,208 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <core/async/ParallelFor.h>
+#include <core/async/TaskGraph.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+using namespace sky;
+
+namespace {
+
+    const TaskBackend BACKENDS[] = {TaskBackend::TASKFLOW, TaskBackend::WORK_STEALING};
+
+    const char *BackendName(TaskBackend backend)
+    {
+        return backend == TaskBackend::TASKFLOW ? "taskflow" : "work_stealing";
+    }
+
+    size_t WorkerCount()
+    {
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    template <typename Func>
+    double MeasureMs(Func &&func)
+    {
+        auto begin = std::chrono::high_resolution_clock::now();
+        func();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    // a few hundred nanoseconds of work, the size of a per-tile or per-chunk job.
+    uint32_t TinyWork(uint32_t seed)
+    {
+        uint32_t v = seed;
+        for (uint32_t i = 0; i < 64; ++i) {
+            v = v * 1664525U + 1013904223U;
+        }
+        return v;
+    }
+
+} // namespace
+
+TEST(CoreBench, ForkJoin)
+{
+    static constexpr uint32_t ROUNDS = 200;
+    static constexpr uint32_t JOBS   = 4096;
+
+    for (auto backend : BACKENDS) {
+        TaskExecutor executor(WorkerCount(), backend);
+        std::atomic_uint32_t sink = 0;
+
+        auto ms = MeasureMs([&]() {
+            for (uint32_t r = 0; r < ROUNDS; ++r) {
+                for (uint32_t i = 0; i < JOBS; ++i) {
+                    executor.Dispatch(TaskPriority::FRAME_CRITICAL, [&sink, i]() {
+                        sink.fetch_add(TinyWork(i) & 1, std::memory_order_relaxed);
+                    });
+                }
+                executor.WaitForAll();
+            }
+        });
+        printf("fork-join %-14s %u x %u jobs, %.2fms, %.1fns/job\n", BackendName(backend), ROUNDS, JOBS, ms,
+            ms * 1e6 / (ROUNDS * JOBS));
+    }
+}
+
+TEST(CoreBench, NestedForkJoin)
+{
+    // jobs spawn jobs, the work stealing backend keeps them on the spawning worker.
+    static constexpr uint32_t ROOTS  = 256;
+    static constexpr uint32_t CHILDREN = 256;
+
+    for (auto backend : BACKENDS) {
+        TaskExecutor executor(WorkerCount(), backend);
+        std::atomic_uint32_t count = 0;
+
+        auto ms = MeasureMs([&]() {
+            for (uint32_t i = 0; i < ROOTS; ++i) {
+                executor.Dispatch(TaskPriority::FRAME_CRITICAL, [&executor, &count, i]() {
+                    for (uint32_t j = 0; j < CHILDREN; ++j) {
+                        executor.Dispatch(TaskPriority::FRAME_CRITICAL, [&count, i, j]() {
+                            count.fetch_add(TinyWork(i ^ j) & 1 ? 1 : 1, std::memory_order_relaxed);
+                        });
+                    }
+                });
+            }
+            executor.WaitForAll();
+        });
+        ASSERT_EQ(count.load(), ROOTS * CHILDREN);
+        printf("nested    %-14s %u jobs, %.2fms, %.1fns/job\n", BackendName(backend), ROOTS * CHILDREN, ms,
+            ms * 1e6 / (ROOTS * CHILDREN));
+    }
+}
+
+TEST(CoreBench, TaskGraphDAG)
+{
+    static constexpr uint32_t LAYERS = 64;
+    static constexpr uint32_t WIDTH  = 256;
+    static constexpr uint32_t FRAMES = 20;
+
+    for (auto backend : BACKENDS) {
+        TaskExecutor executor(WorkerCount(), backend);
+        TaskGraph graph(TaskPriority::FRAME_CRITICAL, &executor);
+        std::vector<uint32_t> values(LAYERS * WIDTH, 0);
+
+        double total = 0.0;
+        for (uint32_t frame = 0; frame < FRAMES; ++frame) {
+            std::mt19937 rng(frame);
+            std::vector<TaskGraph::Handle> handles(LAYERS * WIDTH);
+            for (uint32_t l = 0; l < LAYERS; ++l) {
+                for (uint32_t w = 0; w < WIDTH; ++w) {
+                    uint32_t index = l * WIDTH + w;
+                    handles[index] = graph.Add("node", [&values, index]() { values[index] = TinyWork(index); });
+                    if (l == 0) {
+                        continue;
+                    }
+                    // two random parents in the previous layer.
+                    handles[(l - 1) * WIDTH + rng() % WIDTH].Precede(handles[index]);
+                    handles[(l - 1) * WIDTH + rng() % WIDTH].Precede(handles[index]);
+                }
+            }
+
+            total += MeasureMs([&]() {
+                graph.Dispatch();
+                graph.Wait();
+            });
+            graph.Reset();
+        }
+        printf("dag       %-14s %u nodes, %.3fms/frame\n", BackendName(backend), LAYERS * WIDTH, total / FRAMES);
+    }
+}
+
+TEST(CoreBench, ParallelFor)
+{
+    static constexpr uint32_t COUNT = 1 << 22;
+    std::vector<float> data(COUNT);
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        data[i] = static_cast<float>(i % 1024);
+    }
+
+    double expected = 0.0;
+    for (auto v : data) {
+        expected += std::sqrt(v);
+    }
+
+    for (auto backend : BACKENDS) {
+        TaskExecutor executor(WorkerCount(), backend);
+
+        std::vector<float> out(COUNT);
+        auto forMs = MeasureMs([&]() {
+            ParallelFor(executor, 0, COUNT, [&](uint32_t first, uint32_t last) {
+                for (uint32_t i = first; i < last; ++i) {
+                    out[i] = std::sqrt(data[i]);
+                }
+            }, 1024);
+        });
+
+        double sum = 0.0;
+        auto reduceMs = MeasureMs([&]() {
+            sum = ParallelReduce(executor, 0, COUNT, 0.0, [&](uint32_t first, uint32_t last, double value) {
+                for (uint32_t i = first; i < last; ++i) {
+                    value += std::sqrt(data[i]);
+                }
+                return value;
+            }, [](double a, double b) { return a + b; }, 1024);
+        });
+        ASSERT_NEAR(sum, expected, expected * 1e-9);
+
+        printf("parallel  %-14s for %.3fms, reduce %.3fms, %u items\n", BackendName(backend), forMs, reduceMs, COUNT);
+    }
+}
+
+TEST(CoreBench, Throughput)
+{
+    static constexpr uint32_t TASK_NUM = 1000000;
+    using Clock = std::chrono::steady_clock;
+
+    // latency is measured from dispatch to the start of the task.
+    std::vector<uint32_t> latency(TASK_NUM);
+    std::atomic_uint32_t counter = 0;
+
+    auto *executor = TaskExecutor::Get();
+    auto begin = Clock::now();
+    for (uint32_t i = 0; i < TASK_NUM; ++i) {
+        auto submit = Clock::now();
+        executor->Dispatch(TaskPriority::FRAME_CRITICAL, [&latency, &counter, submit, i]() {
+            latency[i] = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - submit).count());
+            counter.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+    executor->WaitForAll();
+    auto end = Clock::now();
+    ASSERT_EQ(counter.load(), TASK_NUM);
+
+    std::sort(latency.begin(), latency.end());
+    auto seconds = std::chrono::duration<double>(end - begin).count();
+    printf("dispatch  %u tasks, %.3fms, %.2f Mtasks/s\n", TASK_NUM, seconds * 1000.0, TASK_NUM / seconds / 1000000.0);
+    printf("latency   p50 %.2fus, p99 %.2fus, p99.9 %.2fus, max %.2fus\n",
+        latency[TASK_NUM / 2] / 1000.0, latency[TASK_NUM * 99 / 100] / 1000.0,
+        latency[TASK_NUM * 999 / 1000] / 1000.0, latency.back() / 1000.0);
+}
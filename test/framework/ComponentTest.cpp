@@ -6,7 +6,9 @@
 #include <framework/world/Actor.h>
 #include <framework/world/TransformComponent.h>
 #include <framework/serialization/SerializationUtil.h>
+#include <algorithm>
 #include <fstream>
+#include <mutex>
 #include <gtest/gtest.h>
 
 using namespace sky;
@@ -42,6 +44,63 @@ public:
     float GetB() const { return data.b; }
 };
 
+// ticks in chunks beside everything that does not touch it.
+class TickCountComponent : public ComponentAdaptor<TestComponentData> {
+public:
+    TickCountComponent() = default;
+    ~TickCountComponent() override = default;
+
+    COMPONENT_RUNTIME_INFO(TickCountComponent)
+
+    static void Reflect(SerializationContext *context)
+    {
+        REGISTER_BEGIN(TickCountComponent, context);
+    }
+
+    static void DeclareTick(TickDesc &desc)
+    {
+        desc.access.Nothing();
+        desc.parallel = true;
+    }
+
+    void Tick(float time) override { ++count; }
+
+    uint32_t count = 0;
+};
+
+// a leader moves its own actor, everybody else reads the world transform under it from another chunk.
+class FollowComponent : public ComponentAdaptor<TestComponentData> {
+public:
+    FollowComponent() = default;
+    ~FollowComponent() override = default;
+
+    COMPONENT_RUNTIME_INFO(FollowComponent)
+
+    static void Reflect(SerializationContext *context)
+    {
+        REGISTER_BEGIN(FollowComponent, context);
+    }
+
+    static void DeclareTick(TickDesc &desc)
+    {
+        desc.access.Write<TransformComponent>();
+        desc.parallel = true;
+    }
+
+    void Tick(float time) override
+    {
+        auto *trans = actor->GetComponent<TransformComponent>();
+        if (leader) {
+            trans->SetLocalTranslation(trans->GetLocalTranslation() + Vector3(1.f, 0.f, 0.f));
+        } else {
+            seen = trans->GetWorldTransform().translation.x;
+        }
+    }
+
+    bool  leader = false;
+    float seen   = -1.f;
+};
+
 class ComponentTest : public ::testing::Test {
 public:
     static void SetUpTestSuite()
@@ -49,6 +108,8 @@ public:
         auto *context = SerializationContext::Get();
         TestComponent::Reflect(context);
         TransformComponent::Reflect(context);
+        TickCountComponent::Reflect(context);
+        FollowComponent::Reflect(context);
     }
 
     static void TearDownTestSuite()
@@ -124,6 +185,59 @@ TEST_F(ComponentTest, ActorTest)
     }
 }
 
+TEST_F(ComponentTest, ComponentQueryTest)
+{
+    WorldPtr world = World::CreateWorld();
+
+    auto actor1 = world->CreateActor();
+    auto actor2 = world->CreateActor();
+    auto actor3 = world->CreateActor(false);
+    actor1->AddComponent<TestComponent>()->SetA(1);
+    actor3->AddComponent<TestComponent>()->SetA(3);
+    ASSERT_EQ(actor1->AddComponent<TestComponent>(), nullptr);
+
+    ASSERT_EQ(world->View<TransformComponent>().Size(), 2);
+    ASSERT_EQ(world->View<TestComponent>().Size(), 2);
+
+    int sum = 0;
+    for (auto *comp : world->View<TestComponent>()) {
+        sum += comp->GetA();
+    }
+    ASSERT_EQ(sum, 4);
+
+    uint32_t count = 0;
+    world->ForEach<TransformComponent, TestComponent>([&](TransformComponent &trans, TestComponent &test) {
+        ASSERT_EQ(trans.GetActor(), actor1.get());
+        ASSERT_EQ(test.GetA(), 1);
+        ++count;
+    });
+    ASSERT_EQ(count, 1);
+
+    // pooled components keep their address while others come and go.
+    auto *trans2 = actor2->GetComponent<TransformComponent>();
+    std::vector<ActorPtr> extra;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        extra.emplace_back(world->CreateActor());
+    }
+    for (auto &actor : extra) {
+        world->DetachFromWorld(actor);
+    }
+    ASSERT_EQ(actor2->GetComponent<TransformComponent>(), trans2);
+    ASSERT_EQ(world->View<TransformComponent>().Size(), 2);
+
+    actor1->RemoveComponent<TestComponent>();
+    world->DetachFromWorld(actor3);
+    ASSERT_EQ(world->View<TestComponent>().Size(), 0);
+
+    count = 0;
+    world->ForEach<TransformComponent, TestComponent>([&](TransformComponent &, TestComponent &) { ++count; });
+    ASSERT_EQ(count, 0);
+
+    // detached actors keep their components and bring them back.
+    world->AttachToWorld(actor3);
+    ASSERT_EQ(world->View<TestComponent>()[0], actor3->GetComponent<TestComponent>());
+}
+
 //TEST_F(ComponentTest, ActorHierarchy)
 //{
 //    {
@@ -182,4 +296,410 @@ TEST_F(ComponentTest, TransformComponentTest)
     ASSERT_EQ(data.local.translation.x, 1.f);
     ASSERT_EQ(data.local.translation.y, 2.f);
     ASSERT_EQ(data.local.translation.z, 3.f);
-}
\ No newline at end of file
+}
+
+namespace {
+    struct TransformBatchCounter : public ITransformBatchEvent {
+        void OnTransformsChanged(const std::vector<TransformComponent*> &changed) override
+        {
+            ++batchNum;
+            nodeNum += static_cast<uint32_t>(changed.size());
+        }
+
+        uint32_t batchNum = 0;
+        uint32_t nodeNum = 0;
+    };
+
+    struct TransformCounter : public ITransformEvent {
+        void OnTransformChanged(const Transform& global, const Transform& local) override
+        {
+            ++changeNum;
+            x = global.translation.x;
+        }
+
+        uint32_t changeNum = 0;
+        float x = 0.f;
+    };
+} // namespace
+
+TEST_F(ComponentTest, TransformHierarchyTest)
+{
+    WorldPtr world = World::CreateWorld();
+
+    auto root   = world->CreateActor();
+    auto child  = world->CreateActor();
+    auto leaf   = world->CreateActor();
+    auto other  = world->CreateActor();
+
+    auto *rootTrans  = root->GetComponent<TransformComponent>();
+    auto *childTrans = child->GetComponent<TransformComponent>();
+    auto *leafTrans  = leaf->GetComponent<TransformComponent>();
+    auto *otherTrans = other->GetComponent<TransformComponent>();
+
+    childTrans->SetParent(rootTrans);
+    leafTrans->SetParent(childTrans);
+    childTrans->SetLocalTranslation(Vector3(0, 1, 0));
+    leafTrans->SetLocalTranslation(Vector3(0, 0, 1));
+    world->Tick(0.f);
+    ASSERT_EQ(world->GetTransformSystem().GetLevelNum(), 3);
+
+    TransformBatchCounter counter;
+    EventBinder<ITransformBatchEvent> binder;
+    binder.Bind(&counter, world.Get());
+
+    // several setters in a row only mark the subtree dirty.
+    rootTrans->SetLocalTranslation(Vector3(1, 0, 0));
+    rootTrans->SetLocalScale(Vector3(2, 2, 2));
+    rootTrans->SetLocalTranslation(Vector3(2, 0, 0));
+    ASSERT_TRUE(rootTrans->IsDirty());
+    ASSERT_EQ(leafTrans->GetData().global.translation.x, 0.f);
+
+    // lazy read before the world update.
+    const auto &lazy = leafTrans->GetWorldTransform();
+    ASSERT_EQ(lazy.translation.x, 2.f);
+    ASSERT_EQ(lazy.translation.y, 2.f);
+    ASSERT_EQ(lazy.translation.z, 2.f);
+
+    world->Tick(0.f);
+    ASSERT_EQ(counter.batchNum, 1);
+    ASSERT_EQ(counter.nodeNum, 3);
+    ASSERT_FALSE(rootTrans->IsDirty());
+    ASSERT_EQ(childTrans->GetData().global.translation.y, 2.f);
+
+    // nothing dirty, nothing published.
+    world->Tick(0.f);
+    ASSERT_EQ(counter.batchNum, 1);
+
+    // reparenting keeps the world position.
+    otherTrans->SetLocalTranslation(Vector3(0, 0, 5));
+    childTrans->SetParent(otherTrans);
+    world->Tick(0.f);
+    ASSERT_EQ(childTrans->GetLocalTranslation().x, 2.f);
+    ASSERT_EQ(childTrans->GetLocalTranslation().y, 2.f);
+    ASSERT_EQ(childTrans->GetLocalTranslation().z, -5.f);
+    ASSERT_EQ(leafTrans->GetWorldTransform().translation.z, 2.f);
+
+    otherTrans->SetWorldTranslation(Vector3(0, 0, 0));
+    world->Tick(0.f);
+    ASSERT_EQ(leafTrans->GetData().global.translation.z, -3.f);
+    ASSERT_EQ(counter.batchNum, 3);
+
+    // detached nodes update immediately.
+    world->DetachFromWorld(root);
+    rootTrans->SetLocalTranslation(Vector3(3, 0, 0));
+    ASSERT_EQ(rootTrans->GetData().global.translation.x, 3.f);
+
+    // orphans keep their world transform.
+    world->DetachFromWorld(other);
+    other = nullptr;
+    world->Tick(0.f);
+    ASSERT_EQ(childTrans->GetParent(), nullptr);
+    ASSERT_EQ(leafTrans->GetWorldTransform().translation.z, -3.f);
+    ASSERT_EQ(world->GetTransformSystem().GetNodeNum(), 2);
+}
+
+TEST_F(ComponentTest, TransformLoneRootTest)
+{
+    WorldPtr world = World::CreateWorld();
+
+    auto actor = world->CreateActor();
+    auto *trans = actor->GetComponent<TransformComponent>();
+    world->Tick(0.f);
+
+    TransformBatchCounter batch;
+    EventBinder<ITransformBatchEvent> batchBinder;
+    batchBinder.Bind(&batch, world.Get());
+
+    TransformCounter counter;
+    EventBinder<ITransformEvent> binder;
+    binder.Bind(&counter, actor.get());
+
+    // a lone root publishes from its setter and leaves nothing for the world update.
+    trans->SetLocalTranslation(Vector3(4, 0, 0));
+    ASSERT_EQ(counter.changeNum, 1);
+    ASSERT_EQ(counter.x, 4.f);
+    ASSERT_FALSE(trans->IsDirty());
+
+    world->Tick(0.f);
+    ASSERT_EQ(counter.changeNum, 1);
+    ASSERT_EQ(batch.batchNum, 0);
+}
+
+namespace {
+    struct WorldEventCounter : public IWorldEvent {
+        void OnActorAttached(const ActorPtr &actor) override { ++attached; }
+        void OnActorDetached(const ActorPtr &actor) override { ++detached; }
+
+        void OnActorsAttached(const std::vector<ActorPtr> &actors) override { ++batches; attached += static_cast<uint32_t>(actors.size()); }
+        void OnActorsDetached(const std::vector<ActorPtr> &actors) override { ++batches; detached += static_cast<uint32_t>(actors.size()); }
+
+        uint32_t attached = 0;
+        uint32_t detached = 0;
+        uint32_t batches = 0;
+    };
+} // namespace
+
+TEST_F(ComponentTest, WorldActorHandleTest)
+{
+    WorldPtr world = World::CreateWorld();
+
+    WorldEventCounter counter;
+    EventBinder<IWorldEvent> binder;
+    binder.Bind(&counter, world.Get());
+
+    std::vector<ActorPtr> list;
+    for (uint32_t i = 0; i < 8; ++i) {
+        list.emplace_back(std::make_shared<Actor>(Uuid::CreateWithSeed(i + 1)));
+    }
+    world->AttachToWorld(list);
+    ASSERT_EQ(counter.batches, 1);
+    ASSERT_EQ(counter.attached, 8);
+    ASSERT_EQ(world->GetActors().size(), 8);
+
+    auto handle = list[7]->GetHandle();
+    ASSERT_TRUE(world->IsValid(handle));
+    ASSERT_EQ(world->GetActorByHandle(handle), list[7]);
+    ASSERT_EQ(world->GetActorByUuid(Uuid::CreateWithSeed(3)), list[2]);
+
+    // the last actor fills the hole, lookups follow it.
+    world->DetachFromWorld(list[0]);
+    ASSERT_EQ(counter.detached, 1);
+    ASSERT_EQ(world->GetActors()[0], list[7]);
+    ASSERT_EQ(world->GetActorByHandle(handle), list[7]);
+    ASSERT_EQ(world->GetActorByUuid(Uuid::CreateWithSeed(8)), list[7]);
+    ASSERT_EQ(world->GetActorByUuid(Uuid::CreateWithSeed(1)), nullptr);
+    ASSERT_FALSE(list[0]->GetHandle().IsValid());
+
+    // a freed slot comes back with a new generation.
+    auto oldHandle = list[1]->GetHandle();
+    world->DetachFromWorld(list[1]);
+    ASSERT_FALSE(world->IsValid(oldHandle));
+    world->AttachToWorld(list[1]);
+    ASSERT_EQ(list[1]->GetHandle().index, oldHandle.index);
+    ASSERT_NE(list[1]->GetHandle().generation, oldHandle.generation);
+    ASSERT_EQ(world->GetActorByHandle(oldHandle), nullptr);
+
+    // duplicated ids are refused.
+    world->AttachToWorld(std::make_shared<Actor>(Uuid::CreateWithSeed(3)));
+    ASSERT_EQ(world->GetActors().size(), 7);
+
+    // an actor listed twice is detached once.
+    world->DetachFromWorld(std::vector<ActorPtr>{list[2], list[2]});
+    ASSERT_EQ(counter.batches, 2);
+    ASSERT_EQ(counter.detached, 3);
+    ASSERT_EQ(list[2]->GetWorld(), nullptr);
+    ASSERT_EQ(world->GetActors().size(), 6);
+
+    // the actor list itself can be handed to a bulk detach.
+    world->DetachFromWorld(world->GetActors());
+    ASSERT_EQ(counter.batches, 3);
+    ASSERT_EQ(counter.detached, 9);
+    ASSERT_TRUE(world->GetActors().empty());
+    ASSERT_FALSE(world->IsValid(handle));
+}
+
+namespace {
+    // moves a detached actor into another world from inside the event.
+    struct ReentrantMover : public IWorldEvent {
+        void OnActorAttached(const ActorPtr &actor) override {}
+        void OnActorDetached(const ActorPtr &actor) override
+        {
+            if (!moving) {
+                moving = true;
+                target->AttachToWorld(actor);
+            }
+        }
+
+        World *target = nullptr;
+        bool moving = false;
+    };
+} // namespace
+
+TEST_F(ComponentTest, WorldReentrantDetachTest)
+{
+    WorldPtr world = World::CreateWorld();
+    WorldPtr other = World::CreateWorld();
+
+    std::vector<ActorPtr> list;
+    for (uint32_t i = 0; i < 3; ++i) {
+        list.emplace_back(std::make_shared<Actor>(Uuid::CreateWithSeed(i + 1)));
+    }
+    world->AttachToWorld(list);
+
+    ReentrantMover mover;
+    mover.target = other.Get();
+    EventBinder<IWorldEvent> binder;
+    binder.Bind(&mover, world.Get());
+
+    // the listener has moved the actor on, the outer call leaves both worlds alone.
+    world->DetachFromWorld(list[1]);
+    ASSERT_EQ(list[1]->GetWorld(), other.Get());
+    ASSERT_EQ(other->GetActorByUuid(Uuid::CreateWithSeed(2)), list[1]);
+    ASSERT_EQ(world->GetActors().size(), 2);
+    ASSERT_EQ(world->GetActorByUuid(Uuid::CreateWithSeed(1)), list[0]);
+    ASSERT_EQ(world->GetActorByUuid(Uuid::CreateWithSeed(3)), list[2]);
+    ASSERT_EQ(world->GetActorByHandle(list[2]->GetHandle()), list[2]);
+}
+
+namespace {
+    class ScheduleTestSystem : public IWorldSubSystem {
+    public:
+        using DeclareFunc = std::function<void(TickDesc &)>;
+
+        ScheduleTestSystem(std::string n, std::vector<std::string> &l, DeclareFunc func = {})
+            : name(std::move(n)), log(l), declare(std::move(func)) {}
+
+        void Tick(float time) override
+        {
+            std::lock_guard<std::mutex> lock(LOG_MUTEX);
+            log.emplace_back(name);
+        }
+
+        void DeclareTick(TickDesc &desc) const override
+        {
+            if (declare) {
+                declare(desc);
+            } else {
+                IWorldSubSystem::DeclareTick(desc);
+            }
+        }
+
+        static inline std::mutex LOG_MUTEX;
+
+    private:
+        std::string name;
+        std::vector<std::string> &log;
+        DeclareFunc declare;
+    };
+
+    const WorldScheduler::TraceEvent *FindTrace(const WorldScheduler &scheduler, const std::string &name)
+    {
+        const auto &trace = scheduler.GetTrace();
+        auto iter = std::find_if(trace.begin(), trace.end(), [&name](const auto &event) { return event.name == name; });
+        return iter != trace.end() ? &(*iter) : nullptr;
+    }
+} // namespace
+
+TEST_F(ComponentTest, WorldSchedulerTest)
+{
+    WorldPtr world = World::CreateWorld();
+
+    // 3 chunks of counters.
+    std::vector<TickCountComponent *> counters;
+    for (uint32_t i = 0; i < WorldScheduler::CHUNK_SIZE * 2 + 1; ++i) {
+        counters.emplace_back(world->CreateActor()->AddComponent<TickCountComponent>());
+    }
+
+    auto declare = [](TickPhase phase, bool write) {
+        return [phase, write](TickDesc &desc) {
+            desc.phase = phase;
+            if (write) {
+                desc.access.Write<TransformComponent>();
+            } else {
+                desc.access.Read<TransformComponent>();
+            }
+        };
+    };
+
+    std::vector<std::string> log;
+    world->AddSubSystem(Name("Render"), new ScheduleTestSystem("Render", log, declare(TickPhase::PRE_RENDER, false)));
+    world->AddSubSystem(Name("ReadA"), new ScheduleTestSystem("ReadA", log, declare(TickPhase::POST_PHYSICS, false)));
+    world->AddSubSystem(Name("ReadB"), new ScheduleTestSystem("ReadB", log, declare(TickPhase::POST_PHYSICS, false)));
+    world->AddSubSystem(Name("Writer"), new ScheduleTestSystem("Writer", log, declare(TickPhase::POST_PHYSICS, true)));
+    world->AddSubSystem(Name("Legacy"), new ScheduleTestSystem("Legacy", log));
+    world->AddSubSystem(Name("Physics"), new ScheduleTestSystem("Physics", log, declare(TickPhase::PHYSICS, true)));
+
+    auto &scheduler = world->GetScheduler();
+    scheduler.SetTraceEnable(true);
+    world->Tick(0.016f);
+
+    for (auto *counter : counters) {
+        ASSERT_EQ(counter->count, 1);
+    }
+
+    // phases run in order, registration order only matters inside a phase.
+    ASSERT_EQ(log.size(), 6);
+    ASSERT_EQ(log[0], "Physics");
+    ASSERT_EQ(log[5], "Render");
+
+    const auto &trace = scheduler.GetTrace();
+    ASSERT_EQ(std::count_if(trace.begin(), trace.end(), [](const auto &event) { return event.phase == TickPhase::PRE_PHYSICS; }), 3);
+
+    // readers share a slot, the writer waits for both, the undeclared system waits for everything before it.
+    const auto *readA  = FindTrace(scheduler, "ReadA");
+    const auto *readB  = FindTrace(scheduler, "ReadB");
+    const auto *writer = FindTrace(scheduler, "Writer");
+    const auto *legacy = FindTrace(scheduler, "Legacy");
+    ASSERT_NE(readA, nullptr);
+    ASSERT_NE(readB, nullptr);
+    ASSERT_NE(writer, nullptr);
+    ASSERT_NE(legacy, nullptr);
+    ASSERT_TRUE(readA->dependencies.empty());
+    ASSERT_TRUE(readB->dependencies.empty());
+    ASSERT_EQ(writer->dependencies, (std::vector<std::string>{"ReadA", "ReadB"}));
+    ASSERT_GE(writer->begin, readA->end);
+    ASSERT_GE(writer->begin, readB->end);
+    ASSERT_GE(legacy->begin, writer->end);
+    ASSERT_EQ(writer->phase, TickPhase::POST_PHYSICS);
+    ASSERT_EQ(FindTrace(scheduler, "Physics")->phase, TickPhase::PHYSICS);
+
+    auto json = scheduler.DumpTrace();
+    ASSERT_NE(json.find("\"traceEvents\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"Writer\",\"cat\":\"POST_PHYSICS\""), std::string::npos);
+    ASSERT_NE(json.find("\"dependencies\":[\"ReadA\",\"ReadB\"]"), std::string::npos);
+
+    // deterministic mode replays the schedule order on one thread.
+    log.clear();
+    scheduler.SetDeterministic(true);
+    world->Tick(0.016f);
+    ASSERT_EQ(log, (std::vector<std::string>{"Physics", "ReadA", "ReadB", "Writer", "Legacy", "Render"}));
+    ASSERT_EQ(counters.back()->count, 2);
+    for (const auto &event : scheduler.GetTrace()) {
+        ASSERT_EQ(event.thread, scheduler.GetTrace().front().thread);
+    }
+
+    // the next phase sees what the previous one moved.
+    auto *trans = world->CreateActor()->GetComponent<TransformComponent>();
+    auto *child = world->CreateActor()->GetComponent<TransformComponent>();
+    child->SetParent(trans);
+    world->Tick(0.016f);
+    trans->SetLocalTranslation(Vector3(1.f, 0.f, 0.f));
+    scheduler.SetDeterministic(false);
+    world->Tick(0.016f);
+    ASSERT_FALSE(child->IsDirty());
+    ASSERT_FLOAT_EQ(child->GetWorldTransform().translation.x, 1.f);
+}
+
+TEST_F(ComponentTest, ParallelResolveTest)
+{
+    WorldPtr world = World::CreateWorld();
+
+    // the leader sits in the middle chunk, its children in all three.
+    std::vector<FollowComponent *> followers;
+    for (uint32_t i = 0; i < WorldScheduler::CHUNK_SIZE * 3; ++i) {
+        followers.emplace_back(world->CreateActor()->AddComponent<FollowComponent>());
+    }
+    auto *leader = followers[WorldScheduler::CHUNK_SIZE + 1];
+    leader->leader = true;
+    auto *leaderTrans = leader->GetActor()->GetComponent<TransformComponent>();
+    for (auto *follower : followers) {
+        if (follower != leader) {
+            follower->GetActor()->GetComponent<TransformComponent>()->SetParent(leaderTrans);
+        }
+    }
+
+    for (int frame = 1; frame <= 4; ++frame) {
+        world->Tick(0.016f);
+        ASSERT_FLOAT_EQ(leaderTrans->GetWorldTransform().translation.x, static_cast<float>(frame));
+
+        // a child sees its parent either before or after the move, never anything torn.
+        for (auto *follower : followers) {
+            if (follower == leader) {
+                continue;
+            }
+            ASSERT_TRUE(follower->seen == static_cast<float>(frame - 1) || follower->seen == static_cast<float>(frame));
+            ASSERT_FLOAT_EQ(follower->GetActor()->GetComponent<TransformComponent>()->GetWorldTransform().translation.x,
+                static_cast<float>(frame));
+        }
+    }
+}
@@ -4,6 +4,9 @@
 #include "core/event/Event.h"
 #include <core/logger/Logger.h>
 #include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 using namespace sky;
 
@@ -111,4 +114,212 @@ TEST(EventTest, BroadCastTest)
     Event<ITestEvent2>::BroadCast(2, &ITestEvent2::E4, 8.f);
     ASSERT_EQ(listener1.b, 3.f);
     ASSERT_EQ(listener2.b, 6.f);
-}
\ No newline at end of file
+}
+
+TEST(EventTest, HandleTest)
+{
+    EventListener listener1;
+    EventListener listener2;
+    EventListener listener3;
+
+    auto handle1 = Event<ITestEvent2>::Connect(5, &listener1);
+    auto handle2 = Event<ITestEvent2>::Connect(5, &listener2);
+    auto handle3 = Event<ITestEvent2>::Connect(5, &listener3);
+
+    // the last listener fills the hole, everybody else still hears the key.
+    Event<ITestEvent2>::DisConnect(handle1);
+    Event<ITestEvent2>::BroadCast(5, &ITestEvent2::E3);
+    ASSERT_EQ(listener1.a, 0);
+    ASSERT_EQ(listener2.a, 3);
+    ASSERT_EQ(listener3.a, 3);
+
+    // a reused slot gets a new generation, the stale handle does not remove it.
+    auto handle4 = Event<ITestEvent2>::Connect(6, &listener1);
+    ASSERT_EQ(handle4.index, handle1.index);
+    ASSERT_NE(handle4.generation, handle1.generation);
+    Event<ITestEvent2>::DisConnect(handle1);
+    Event<ITestEvent2>::BroadCast(6, &ITestEvent2::E4, 1.f);
+    ASSERT_EQ(listener1.b, 1.f);
+
+    Event<ITestEvent2>::DisConnect(handle3);
+    Event<ITestEvent2>::BroadCast(5, &ITestEvent2::E4, 2.f);
+    ASSERT_EQ(listener2.b, 2.f);
+    ASSERT_EQ(listener3.b, 0.f);
+
+    Event<ITestEvent2>::DisConnect(handle2);
+    Event<ITestEvent2>::DisConnect(handle4);
+    Event<ITestEvent2>::BroadCast(5, &ITestEvent2::E4, 3.f);
+    Event<ITestEvent2>::BroadCast(6, &ITestEvent2::E4, 3.f);
+    ASSERT_EQ(listener1.b, 1.f);
+    ASSERT_EQ(listener2.b, 2.f);
+}
+
+struct ITestBatchEvent : public EventTraits {
+    using KeyType   = int;
+    using MutexType = std::mutex;
+
+    static constexpr StorageMode STORAGE = StorageMode::BATCHED;
+
+    virtual void OnValue(int value) = 0;
+    virtual void OnPing() = 0;
+};
+
+struct BatchListener : public ITestBatchEvent {
+    void OnValue(int value) override { values.emplace_back(value); }
+    void OnPing() override { ++pings; }
+
+    std::vector<int> values;
+    int pings = 0;
+};
+
+TEST(EventTest, BatchedTest)
+{
+    BatchListener listener1;
+    BatchListener listener2;
+    EventBinder<ITestBatchEvent> binder1;
+    EventBinder<ITestBatchEvent> binder2;
+    binder1.Bind(&listener1, 1);
+    binder2.Bind(&listener2, 2);
+
+    Event<ITestBatchEvent>::BroadCast(1, &ITestBatchEvent::OnValue, 1);
+    ASSERT_TRUE(listener1.values.empty());
+
+    // the same key and method coalesce, the last arguments win.
+    Event<ITestBatchEvent>::BroadCast(1, &ITestBatchEvent::OnValue, 2);
+    Event<ITestBatchEvent>::BroadCast(1, &ITestBatchEvent::OnPing);
+    Event<ITestBatchEvent>::BroadCast(2, &ITestBatchEvent::OnValue, 3);
+    EventQueue::Get()->Flush();
+    ASSERT_EQ(listener1.values, std::vector<int>{2});
+    ASSERT_EQ(listener1.pings, 1);
+    ASSERT_EQ(listener2.values, std::vector<int>{3});
+    ASSERT_EQ(listener2.pings, 0);
+
+    // a listener gone before the flush misses the event.
+    Event<ITestBatchEvent>::BroadCast(1, &ITestBatchEvent::OnPing);
+    binder1.Reset();
+    Event<ITestBatchEvent>::Flush();
+    ASSERT_EQ(listener1.pings, 1);
+
+    // every thread queues on its own, each key keeps the last value its thread sent.
+    constexpr int THREAD_NUM = 4;
+    constexpr int EVENT_NUM  = 1000;
+    BatchListener listeners[THREAD_NUM];
+    EventBinder<ITestBatchEvent> binders[THREAD_NUM];
+    for (int i = 0; i < THREAD_NUM; ++i) {
+        binders[i].Bind(&listeners[i], 100 + i);
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREAD_NUM; ++i) {
+        threads.emplace_back([i]() {
+            for (int j = 0; j < EVENT_NUM; ++j) {
+                Event<ITestBatchEvent>::BroadCast(100 + i, &ITestBatchEvent::OnValue, j);
+                Event<ITestBatchEvent>::BroadCast(100 + i, &ITestBatchEvent::OnPing);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EventQueue::Get()->Flush();
+    for (auto &listener : listeners) {
+        ASSERT_EQ(listener.values, std::vector<int>{EVENT_NUM - 1});
+        ASSERT_EQ(listener.pings, 1);
+    }
+
+    // flushed queues are empty.
+    EventQueue::Get()->Flush();
+    ASSERT_EQ(listeners[0].values.size(), 1);
+}
+
+struct ITestRemoveEvent : public EventTraits {
+    using KeyType = int;
+
+    virtual void OnHit() = 0;
+};
+
+struct ITestLockedRemoveEvent : public EventTraits {
+    using KeyType   = int;
+    using MutexType = std::mutex;
+
+    virtual void OnHit() = 0;
+};
+
+template <typename Interface>
+struct RemoveListener : public Interface {
+    void OnHit() override
+    {
+        ++hits;
+        if (target != nullptr) {
+            Event<Interface>::DisConnect(target);
+            target = nullptr;
+        }
+    }
+
+    Interface *target = nullptr;
+    int hits = 0;
+};
+
+template <typename Interface>
+void TestDisConnectInDispatch()
+{
+    // a listener removing itself does not hide the ones behind it.
+    {
+        RemoveListener<Interface> a;
+        RemoveListener<Interface> b;
+        RemoveListener<Interface> c;
+        a.target = &a;
+        Event<Interface>::Connect(1, &a);
+        Event<Interface>::Connect(1, &b);
+        Event<Interface>::Connect(1, &c);
+
+        Event<Interface>::BroadCast(1, &Interface::OnHit);
+        ASSERT_EQ(a.hits, 1);
+        ASSERT_EQ(b.hits, 1);
+        ASSERT_EQ(c.hits, 1);
+
+        Event<Interface>::BroadCast(1, &Interface::OnHit);
+        ASSERT_EQ(a.hits, 1);
+        ASSERT_EQ(b.hits, 2);
+        ASSERT_EQ(c.hits, 2);
+
+        Event<Interface>::DisConnect(&b);
+        Event<Interface>::DisConnect(&c);
+    }
+
+    // a listener removed by an earlier one is not called, the others still are.
+    {
+        RemoveListener<Interface> a;
+        RemoveListener<Interface> b;
+        RemoveListener<Interface> c;
+        RemoveListener<Interface> d;
+        a.target = &b;
+        Event<Interface>::Connect(2, &a);
+        Event<Interface>::Connect(2, &b);
+        Event<Interface>::Connect(2, &c);
+        auto handle = Event<Interface>::Connect(2, &d);
+
+        Event<Interface>::BroadCast(2, &Interface::OnHit);
+        ASSERT_EQ(a.hits, 1);
+        ASSERT_EQ(b.hits, 0);
+        ASSERT_EQ(c.hits, 1);
+        ASSERT_EQ(d.hits, 1);
+
+        // positions are fixed up after the broadcast, handles still remove the right listener.
+        Event<Interface>::DisConnect(handle);
+        Event<Interface>::BroadCast(2, &Interface::OnHit);
+        ASSERT_EQ(a.hits, 2);
+        ASSERT_EQ(b.hits, 0);
+        ASSERT_EQ(c.hits, 2);
+        ASSERT_EQ(d.hits, 1);
+
+        Event<Interface>::DisConnect(&a);
+        Event<Interface>::DisConnect(&c);
+    }
+}
+
+TEST(EventTest, DisConnectInDispatchTest)
+{
+    TestDisConnectInDispatch<ITestRemoveEvent>();
+    TestDisConnectInDispatch<ITestLockedRemoveEvent>();
+}
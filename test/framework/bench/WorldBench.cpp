@@ -0,0 +1,245 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <framework/world/World.h>
+#include <framework/world/TransformComponent.h>
+#include <framework/world/SimpleRotateComponent.h>
+#include <framework/serialization/JsonArchive.h>
+#include <core/archive/StreamArchive.h>
+#include <core/async/Task.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <sstream>
+#include <vector>
+
+using namespace sky;
+
+namespace {
+
+    constexpr uint32_t ACTOR_NUM = 100000;
+    constexpr uint32_t FRAMES    = 20;
+
+    // streamed level sized worlds, every GROUP actors hang below one parent.
+    constexpr uint32_t LEVEL_ACTOR_NUM = 100000;
+    constexpr uint32_t GROUP           = 10;
+
+    // prefab like trees, every node has BRANCH children down to TREE_DEPTH levels.
+    constexpr uint32_t TREE_NUM   = 100;
+    constexpr uint32_t TREE_DEPTH = 6;
+    constexpr uint32_t BRANCH     = 4;
+
+    void BuildTree(World &world, TransformComponent *parent, uint32_t depth) // NOLINT
+    {
+        if (depth == TREE_DEPTH) {
+            return;
+        }
+        for (uint32_t i = 0; i < BRANCH; ++i) {
+            auto *trans = world.CreateActor()->GetComponent<TransformComponent>();
+            trans->SetParent(parent);
+            trans->SetLocalTranslation(Vector3(static_cast<float>(i), 1.f, 0.f));
+            BuildTree(world, trans, depth + 1);
+        }
+    }
+
+    void BuildLevel(World &world)
+    {
+        TransformComponent *parent = nullptr;
+        for (uint32_t i = 0; i < LEVEL_ACTOR_NUM; ++i) {
+            auto *trans = world.CreateActor()->GetComponent<TransformComponent>();
+            if (i % GROUP == 0) {
+                parent = trans;
+            } else {
+                trans->SetParent(parent);
+            }
+        }
+    }
+
+    template <typename Func>
+    double MeasureMs(Func &&func)
+    {
+        auto begin = std::chrono::high_resolution_clock::now();
+        func();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+} // namespace
+
+TEST(WorldBench, TickTransformRotate)
+{
+    World::Reflect(SerializationContext::Get());
+
+    WorldPtr world = World::CreateWorld();
+    auto create = MeasureMs([&]() {
+        for (uint32_t i = 0; i < ACTOR_NUM; ++i) {
+            world->CreateActor()->AddComponent<SimpleRotateComponent>();
+        }
+    });
+    // first frame lays out the new actors.
+    world->Tick(0.016f);
+
+    // actor by actor, every actor walks its own components.
+    auto actorTick = MeasureMs([&]() {
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            for (const auto &actor : world->GetActors()) {
+                actor->Tick(0.016f);
+            }
+        }
+    });
+
+    // the world walks the pooled components type by type.
+    auto worldTick = MeasureMs([&]() {
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            world->Tick(0.016f);
+        }
+    });
+
+    // the same update written against the query api, no per component lookup.
+    auto query = MeasureMs([&]() {
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            world->ForEach<SimpleRotateComponent, TransformComponent>([](SimpleRotateComponent &rotate, TransformComponent &trans) {
+                rotate.angle += 0.016f * rotate.GetSpeed();
+                Quaternion quad;
+                quad.FromEulerYZX(Vector3{0, rotate.angle, 0.f});
+                trans.SetLocalRotation(quad);
+            });
+        }
+    });
+
+    float sum = 0.f;
+    auto lookup = MeasureMs([&]() {
+        for (const auto &actor : world->GetActors()) {
+            sum += actor->GetComponent<SimpleRotateComponent>()->angle;
+        }
+    });
+    ASSERT_GT(sum, 0.f);
+
+    printf("[WorldBench] %u actors, create %.2fms\n", ACTOR_NUM, create);
+    printf("[WorldBench] actor tick %.2fms/frame, world tick %.2fms/frame, query %.2fms/frame\n",
+        actorTick / FRAMES, worldTick / FRAMES, query / FRAMES);
+    printf("[WorldBench] GetComponent over all actors %.2fms\n", lookup);
+}
+
+TEST(WorldBench, ParallelTick)
+{
+    World::Reflect(SerializationContext::Get());
+
+    WorldPtr world = World::CreateWorld();
+    for (uint32_t i = 0; i < ACTOR_NUM; ++i) {
+        world->CreateActor()->AddComponent<SimpleRotateComponent>();
+    }
+    world->Tick(0.016f);
+
+    auto &scheduler = world->GetScheduler();
+    scheduler.SetDeterministic(true);
+    auto serial = MeasureMs([&]() {
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            world->Tick(0.016f);
+        }
+    });
+
+    scheduler.SetDeterministic(false);
+    auto parallel = MeasureMs([&]() {
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            world->Tick(0.016f);
+        }
+    });
+
+    scheduler.SetTraceEnable(true);
+    world->Tick(0.016f);
+    auto nodes = scheduler.GetTrace().size();
+    scheduler.SetTraceEnable(false);
+
+    printf("[WorldBench] %u actors, %u workers, %zu tasks/frame, deterministic %.2fms/frame, parallel %.2fms/frame\n",
+        ACTOR_NUM, TaskExecutor::Get()->GetWorkerCount(), nodes, serial / FRAMES, parallel / FRAMES);
+}
+
+TEST(WorldBench, MoveHierarchyRoots)
+{
+    World::Reflect(SerializationContext::Get());
+
+    WorldPtr world = World::CreateWorld();
+    std::vector<TransformComponent *> roots;
+    for (uint32_t i = 0; i < TREE_NUM; ++i) {
+        roots.emplace_back(world->CreateActor()->GetComponent<TransformComponent>());
+        BuildTree(*world, roots.back(), 1);
+    }
+    world->Tick(0.016f);
+
+    // gameplay code tends to set translation, rotation and scale one after another.
+    auto move = MeasureMs([&]() {
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            Quaternion quad;
+            quad.FromEulerYZX(Vector3{0, static_cast<float>(f), 0.f});
+            for (auto *root : roots) {
+                root->SetLocalTranslation(Vector3(static_cast<float>(f), 0.f, 0.f));
+                root->SetLocalRotation(quad);
+                root->SetLocalScale(Vector3(1.f + static_cast<float>(f) * 0.01f));
+            }
+            world->Tick(0.016f);
+        }
+    });
+
+    printf("[WorldBench] %zu nodes in %u trees of depth %u, move roots %.2fms/frame\n",
+        world->GetActors().size(), TREE_NUM, TREE_DEPTH, move / FRAMES);
+}
+
+TEST(WorldBench, ActorLookup)
+{
+    World::Reflect(SerializationContext::Get());
+
+    WorldPtr world = World::CreateWorld();
+    auto create = MeasureMs([&]() { BuildLevel(*world); });
+
+    std::vector<Uuid> ids;
+    for (const auto &actor : world->GetActors()) {
+        ids.emplace_back(actor->GetUuid());
+    }
+
+    // what a hierarchy resolve does, one lookup per actor.
+    uint32_t found = 0;
+    auto lookup = MeasureMs([&]() {
+        for (const auto &id : ids) {
+            found += world->GetActorByUuid(id) != nullptr ? 1 : 0;
+        }
+    });
+    ASSERT_EQ(found, LEVEL_ACTOR_NUM);
+
+    // unloading a streamed level in the order it was loaded.
+    std::vector<ActorPtr> actors = world->GetActors();
+    auto detach = MeasureMs([&]() {
+        for (const auto &actor : actors) {
+            world->DetachFromWorld(actor);
+        }
+    });
+    ASSERT_TRUE(world->GetActors().empty());
+
+    printf("[WorldBench] %u actors, create %.2fms, lookup all %.2fms, detach all %.2fms\n",
+        LEVEL_ACTOR_NUM, create, lookup, detach);
+}
+
+TEST(WorldBench, LoadJson)
+{
+    World::Reflect(SerializationContext::Get());
+
+    std::stringstream stream;
+    {
+        WorldPtr world = World::CreateWorld();
+        BuildLevel(*world);
+
+        OStreamArchive streamArchive(stream);
+        JsonOutputArchive archive(streamArchive);
+        world->SaveJson(archive);
+    }
+
+    WorldPtr world = World::CreateWorld();
+    auto load = MeasureMs([&]() {
+        IStreamArchive streamArchive(stream);
+        JsonInputArchive archive(streamArchive);
+        world->LoadJson(archive);
+    });
+    ASSERT_EQ(world->GetActors().size(), LEVEL_ACTOR_NUM);
+
+    printf("[WorldBench] load %u actors from %zu bytes of json, %.2fms\n", LEVEL_ACTOR_NUM, stream.str().size(), load);
+}
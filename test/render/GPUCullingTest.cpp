@@ -0,0 +1,274 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <gtest/gtest.h>
+#include <render/GPUCulling.h>
+#include <core/shapes/Shapes.h>
+#include <core/math/MathUtil.h>
+#include <random>
+
+using namespace sky;
+
+static GPUCullConstants MakeConstants(uint32_t flags)
+{
+    Matrix4 view = Matrix4::Identity();
+    Matrix4 viewProject = MakePerspective(ToRadian(60.f), 1.f, 0.1f, 100.f) * view.Inverse();
+
+    GPUCullConstants constants = {};
+    FillCullConstants(constants, CreateFrustumByViewProjectMatrix(viewProject), viewProject, Vector3(0.f, 0.f, 0.f));
+    constants.flags = flags;
+    return constants;
+}
+
+static GPUInstance MakeInstance(const Vector3 &center, float extent, uint32_t command)
+{
+    GPUInstance instance = {};
+    instance.worldMatrix  = Matrix4::Identity();
+    instance.boundCenter  = Vector4(center.x, center.y, center.z, 0.f);
+    instance.boundExtent  = Vector4(extent, extent, extent, 0.f);
+    instance.indexCount   = 36;
+    instance.firstIndex   = command * 36;
+    instance.vertexOffset = static_cast<int32_t>(command * 8);
+    instance.commandIndex = command;
+    instance.flags        = static_cast<uint32_t>(GPUInstanceFlagBit::VALID);
+    return instance;
+}
+
+TEST(GPUCullingTest, FrustumTest)
+{
+    auto constants = MakeConstants(static_cast<uint32_t>(GPUCullFlagBit::FRUSTUM));
+
+    ASSERT_TRUE(GPUFrustumTest(constants, Vector4(0.f, 0.f, -10.f, 0.f), Vector4(1.f, 1.f, 1.f, 0.f)));
+    ASSERT_FALSE(GPUFrustumTest(constants, Vector4(0.f, 0.f, 10.f, 0.f), Vector4(1.f, 1.f, 1.f, 0.f)));
+    ASSERT_FALSE(GPUFrustumTest(constants, Vector4(0.f, 0.f, -200.f, 0.f), Vector4(1.f, 1.f, 1.f, 0.f)));
+    ASSERT_FALSE(GPUFrustumTest(constants, Vector4(50.f, 0.f, -10.f, 0.f), Vector4(1.f, 1.f, 1.f, 0.f)));
+
+    // crossing a side plane.
+    ASSERT_TRUE(GPUFrustumTest(constants, Vector4(8.f, 0.f, -10.f, 0.f), Vector4(4.f, 1.f, 1.f, 0.f)));
+}
+
+TEST(GPUCullingTest, ConeTest)
+{
+    auto constants = MakeConstants(static_cast<uint32_t>(GPUCullFlagBit::CONE));
+    auto instance = MakeInstance(Vector3(0.f, 0.f, -10.f), 1.f, 0);
+    instance.worldMatrix.Translate(Vector3(0.f, 0.f, -10.f));
+
+    Meshlet meshlet = {};
+    meshlet.coneApex = Vector4(0.f, 0.f, 0.f, 0.f);
+
+    // every triangle faces away from the camera.
+    meshlet.coneAxis = Vector4(0.f, 0.f, -1.f, 0.5f);
+    ASSERT_FALSE(GPUConeTest(constants, instance, meshlet));
+
+    meshlet.coneAxis = Vector4(0.f, 0.f, 1.f, 0.5f);
+    ASSERT_TRUE(GPUConeTest(constants, instance, meshlet));
+
+    // degenerated cone.
+    meshlet.coneAxis = Vector4(0.f, 0.f, -1.f, 1.f);
+    ASSERT_TRUE(GPUConeTest(constants, instance, meshlet));
+}
+
+TEST(GPUCullingTest, HizPyramidTest)
+{
+    std::vector<float> depth = {
+        0.1f, 0.2f, 0.3f, 0.4f, 0.5f,
+        0.1f, 0.1f, 0.1f, 0.1f, 0.9f,
+        0.2f, 0.2f, 0.2f, 0.2f, 0.2f,
+    };
+
+    HizPyramid hiz;
+    hiz.Build(depth.data(), 5, 3);
+
+    ASSERT_EQ(hiz.GetMipCount(), 3);
+    ASSERT_EQ(hiz.GetWidth(1), 2);
+    ASSERT_EQ(hiz.GetHeight(1), 1);
+    ASSERT_EQ(hiz.GetWidth(2), 1);
+    ASSERT_EQ(hiz.GetHeight(2), 1);
+
+    // odd rows and columns are folded into the border texels.
+    ASSERT_FLOAT_EQ(hiz.Fetch(1, 0, 0, 0, 0), 0.3f);
+    ASSERT_FLOAT_EQ(hiz.Fetch(1, 1, 0, 1, 0), 0.9f);
+    ASSERT_FLOAT_EQ(hiz.Fetch(2, 0, 0, 0, 0), 0.9f);
+    ASSERT_FLOAT_EQ(hiz.Fetch(0, 0, 1, 3, 1), 0.1f);
+}
+
+TEST(GPUCullingTest, HizOcclusionTest)
+{
+    static constexpr uint32_t SIZE = 64;
+
+    // identity projection, ndc equals the box position.
+    GPUCullConstants constants = {};
+    constants.viewProject = Matrix4::Identity();
+    constants.flags = static_cast<uint32_t>(GPUCullFlagBit::HIZ);
+
+    // occluder covers the left half of the screen at depth 0.3.
+    std::vector<float> depth(SIZE * SIZE, 1.f);
+    for (uint32_t y = 0; y < SIZE; ++y) {
+        for (uint32_t x = 0; x < SIZE / 2; ++x) {
+            depth[y * SIZE + x] = 0.3f;
+        }
+    }
+
+    HizPyramid hiz;
+    hiz.Build(depth.data(), SIZE, SIZE);
+    constants.hizSize = Vector4(static_cast<float>(SIZE), static_cast<float>(SIZE), static_cast<float>(hiz.GetMipCount()), 0.f);
+
+    ASSERT_FALSE(GPUHizTest(constants, hiz, Vector4(-0.5f, 0.f, 0.8f, 0.f), Vector4(0.1f, 0.1f, 0.1f, 0.f)));
+    ASSERT_TRUE(GPUHizTest(constants, hiz, Vector4(-0.5f, 0.f, 0.1f, 0.f), Vector4(0.1f, 0.1f, 0.1f, 0.f)));
+    ASSERT_TRUE(GPUHizTest(constants, hiz, Vector4(0.5f, 0.f, 0.8f, 0.f), Vector4(0.1f, 0.1f, 0.1f, 0.f)));
+
+    // partially covered boxes stay visible.
+    ASSERT_TRUE(GPUHizTest(constants, hiz, Vector4(0.f, 0.f, 0.8f, 0.f), Vector4(0.2f, 0.2f, 0.1f, 0.f)));
+}
+
+TEST(GPUCullingTest, HizReprojectionTest)
+{
+    static constexpr uint32_t SIZE = 32;
+
+    // pyramid of an earlier frame, a wall at z = -10 covers the whole screen.
+    Matrix4 project = MakePerspective(ToRadian(60.f), 1.f, 0.1f, 100.f);
+    Matrix4 history = project * Matrix4::Identity().Inverse();
+    Vector4 wall = history * Vector4(0.f, 0.f, -10.f, 1.f);
+    std::vector<float> depth(SIZE * SIZE, wall.z / wall.w);
+
+    HizPyramid hiz;
+    hiz.Build(depth.data(), SIZE, SIZE);
+
+    // the camera moved since, boxes are tested in the frame the pyramid was rendered in.
+    Matrix4 view = Matrix4::Identity();
+    view.Translate(Vector3(0.f, 0.f, -15.f));
+    auto constants = MakeConstants(static_cast<uint32_t>(GPUCullFlagBit::HIZ));
+    constants.viewProject = history;
+    constants.hizSize = Vector4(static_cast<float>(SIZE), static_cast<float>(SIZE), static_cast<float>(hiz.GetMipCount()), 0.f);
+
+    ASSERT_FALSE(GPUHizTest(constants, hiz, Vector4(0.f, 0.f, -20.f, 0.f), Vector4(1.f, 1.f, 1.f, 0.f)));
+    ASSERT_TRUE(GPUHizTest(constants, hiz, Vector4(0.f, 0.f, -8.f, 0.f), Vector4(1.f, 1.f, 1.f, 0.f)));
+
+    // the matrix of the current frame would move the wall behind the box.
+    constants.viewProject = project * view.Inverse();
+    ASSERT_TRUE(GPUHizTest(constants, hiz, Vector4(0.f, 0.f, -20.f, 0.f), Vector4(1.f, 1.f, 1.f, 0.f)));
+}
+
+TEST(GPUCullingTest, CullStatsTest)
+{
+    static constexpr uint32_t SIZE = 32;
+
+    auto constants = MakeConstants(static_cast<uint32_t>(GPUCullFlagBit::FRUSTUM) | static_cast<uint32_t>(GPUCullFlagBit::HIZ));
+    Vector4 wall = constants.viewProject * Vector4(0.f, 0.f, -10.f, 1.f);
+    std::vector<float> depth(SIZE * SIZE, wall.z / wall.w);
+
+    HizPyramid hiz;
+    hiz.Build(depth.data(), SIZE, SIZE);
+    constants.hizSize = Vector4(static_cast<float>(SIZE), static_cast<float>(SIZE), static_cast<float>(hiz.GetMipCount()), 0.f);
+
+    std::vector<GPUInstance> instances;
+    instances.emplace_back(MakeInstance(Vector3(0.f, 0.f, -5.f), 1.f, 0));
+    instances.emplace_back(MakeInstance(Vector3(0.f, 0.f, -20.f), 1.f, 1));
+    instances.emplace_back(MakeInstance(Vector3(0.f, 0.f, -30.f), 1.f, 2));
+    instances.emplace_back(MakeInstance(Vector3(0.f, 0.f, 10.f), 1.f, 3));
+    instances.emplace_back(MakeInstance(Vector3(0.f, 0.f, -5.f), 1.f, 4));
+    instances.back().flags = 0;
+    constants.instanceCount = static_cast<uint32_t>(instances.size());
+
+    GPUCullStats stats = {};
+    std::vector<GPUDrawCommand> commands(instances.size());
+    uint32_t visible = GPUCullInstances(constants, instances.data(), &hiz, commands.data(), &stats);
+
+    // invalid instances are neither visible nor counted as rejects.
+    ASSERT_EQ(visible, 1);
+    ASSERT_EQ(stats.visible, 1);
+    ASSERT_EQ(stats.frustumRejected, 1);
+    ASSERT_EQ(stats.occlusionRejected, 2);
+}
+
+TEST(GPUCullingTest, InstanceCommandTest)
+{
+    auto constants = MakeConstants(static_cast<uint32_t>(GPUCullFlagBit::FRUSTUM));
+
+    std::vector<GPUInstance> instances;
+    instances.emplace_back(MakeInstance(Vector3(0.f, 0.f, -10.f), 1.f, 3));
+    instances.emplace_back(MakeInstance(Vector3(0.f, 0.f, 10.f), 1.f, 2));
+    instances.emplace_back(MakeInstance(Vector3(1.f, 1.f, -20.f), 1.f, 1));
+    instances.emplace_back(MakeInstance(Vector3(1.f, 1.f, -20.f), 1.f, 0));
+    instances.back().flags = 0;
+    constants.instanceCount = static_cast<uint32_t>(instances.size());
+
+    std::vector<GPUDrawCommand> commands(instances.size());
+    uint32_t visible = GPUCullInstances(constants, instances.data(), nullptr, commands.data());
+    ASSERT_EQ(visible, 2);
+
+    ASSERT_EQ(commands[3].instanceCount, 1);
+    ASSERT_EQ(commands[2].instanceCount, 0);
+    ASSERT_EQ(commands[1].instanceCount, 1);
+    ASSERT_EQ(commands[0].instanceCount, 0);
+
+    for (const auto &instance : instances) {
+        const auto &cmd = commands[instance.commandIndex];
+        ASSERT_EQ(cmd.indexCount, instance.indexCount);
+        ASSERT_EQ(cmd.firstIndex, instance.firstIndex);
+        ASSERT_EQ(cmd.vertexOffset, instance.vertexOffset);
+        ASSERT_EQ(cmd.firstInstance, 0);
+    }
+}
+
+TEST(GPUCullingTest, MeshletTest)
+{
+    auto constants = MakeConstants(static_cast<uint32_t>(GPUCullFlagBit::FRUSTUM) | static_cast<uint32_t>(GPUCullFlagBit::CONE));
+
+    std::vector<Meshlet> meshlets(4);
+    meshlets[0].center   = Vector4(0.f, 0.f, -10.f, 1.f);
+    meshlets[0].coneApex = Vector4(0.f, 0.f, -10.f, 0.f);
+    meshlets[0].coneAxis = Vector4(0.f, 0.f, 1.f, 0.5f);
+    meshlets[1].center   = Vector4(0.f, 0.f, 10.f, 1.f);
+    meshlets[1].coneAxis = Vector4(0.f, 0.f, 1.f, 0.5f);
+    meshlets[2].center   = Vector4(0.f, 0.f, -10.f, 1.f);
+    meshlets[2].coneApex = Vector4(0.f, 0.f, -10.f, 0.f);
+    meshlets[2].coneAxis = Vector4(0.f, 0.f, -1.f, 0.5f);
+    meshlets[3].center   = Vector4(0.f, 0.f, -10.f, 1.f);
+    meshlets[3].coneAxis = Vector4(0.f, 0.f, -1.f, 1.f);
+
+    auto instance = MakeInstance(Vector3(0.f, 0.f, -10.f), 2.f, 0);
+    instance.meshletOffset = 0;
+    instance.meshletCount  = static_cast<uint32_t>(meshlets.size());
+    instance.flags |= static_cast<uint32_t>(GPUInstanceFlagBit::CONE_CULLING);
+
+    std::vector<uint32_t> visible(meshlets.size());
+    uint32_t count = GPUCullMeshlets(constants, instance, meshlets.data(), nullptr, visible.data());
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(visible[0], 0);
+    ASSERT_EQ(visible[1], 3);
+
+    // cone culling is opt in per instance.
+    instance.flags = static_cast<uint32_t>(GPUInstanceFlagBit::VALID);
+    count = GPUCullMeshlets(constants, instance, meshlets.data(), nullptr, visible.data());
+    ASSERT_EQ(count, 3);
+}
+
+TEST(GPUCullingTest, RandomInstanceTest)
+{
+    static constexpr uint32_t INSTANCE_COUNT = 1000;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> pos(-100.f, 100.f);
+
+    std::vector<GPUInstance> instances;
+    instances.reserve(INSTANCE_COUNT);
+    for (uint32_t i = 0; i < INSTANCE_COUNT; ++i) {
+        instances.emplace_back(MakeInstance(Vector3(pos(rng), pos(rng), pos(rng)), 1.f, i));
+    }
+
+    auto constants = MakeConstants(static_cast<uint32_t>(GPUCullFlagBit::FRUSTUM));
+    constants.instanceCount = INSTANCE_COUNT;
+
+    std::vector<GPUDrawCommand> commands(INSTANCE_COUNT);
+    uint32_t visible = GPUCullInstances(constants, instances.data(), nullptr, commands.data());
+
+    uint32_t drawn = 0;
+    for (uint32_t i = 0; i < INSTANCE_COUNT; ++i) {
+        drawn += commands[i].instanceCount;
+        ASSERT_EQ(commands[i].instanceCount != 0, GPUFrustumTest(constants, instances[i].boundCenter, instances[i].boundExtent));
+    }
+    ASSERT_EQ(visible, drawn);
+    ASSERT_GT(visible, 0);
+}
@@ -0,0 +1,234 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <gtest/gtest.h>
+#include <render/PipelineCompiler.h>
+#include <core/archive/FileArchive.h>
+#include <atomic>
+#include <filesystem>
+#include <future>
+
+using namespace sky;
+
+namespace {
+
+    class TestRenderPass : public rhi::RenderPass {
+    public:
+        explicit TestRenderPass(uint32_t hash) { compatibleHash = hash; }
+    };
+
+    PipelineRequest MakeRequest(const RDProgramPtr &program, const rhi::RenderPassPtr &pass)
+    {
+        PipelineRequest request = {};
+        request.program = program;
+        request.state.blendStates.emplace_back();
+        request.pass = pass;
+        return request;
+    }
+
+} // namespace
+
+TEST(PipelineCompilerTest, VertexLayoutHashTest)
+{
+    std::vector<rhi::VertexAttributeDesc> attributes = {
+        {0, 0, 0, rhi::Format::F_RGB32, "POSITION"},
+        {1, 1, 0, rhi::Format::F_RGB32, "NORMAL"},
+    };
+    std::vector<rhi::VertexBindingDesc> bindings = {
+        {0, 12, rhi::VertexInputRate::PER_VERTEX},
+        {1, 12, rhi::VertexInputRate::PER_VERTEX},
+    };
+
+    auto base = PipelineCompiler::HashVertexLayout(attributes, bindings);
+
+    // semantic names do not change the pipeline.
+    auto renamed = attributes;
+    renamed[1].sematic = "TEXCOORD";
+    ASSERT_EQ(base, PipelineCompiler::HashVertexLayout(renamed, bindings));
+
+    auto strided = bindings;
+    strided[1].stride = 16;
+    ASSERT_NE(base, PipelineCompiler::HashVertexLayout(attributes, strided));
+
+    auto formatted = attributes;
+    formatted[1].format = rhi::Format::F_RGBA32;
+    ASSERT_NE(base, PipelineCompiler::HashVertexLayout(formatted, bindings));
+}
+
+TEST(PipelineCompilerTest, PipelineStateHashTest)
+{
+    rhi::PipelineState state = {};
+    state.blendStates.emplace_back();
+
+    auto base = PipelineCompiler::HashPipelineState(state);
+    ASSERT_EQ(base, PipelineCompiler::HashPipelineState(state));
+
+    auto lines = state;
+    lines.inputAssembly.topology = rhi::PrimitiveTopology::LINE_LIST;
+    ASSERT_NE(base, PipelineCompiler::HashPipelineState(lines));
+
+    auto blend = state;
+    blend.blendStates[0].blendEn = true;
+    ASSERT_NE(base, PipelineCompiler::HashPipelineState(blend));
+}
+
+TEST(PipelineCompilerTest, DamagedVariantFileTest)
+{
+    auto path = FilePath(std::filesystem::temp_directory_path() / "sky_pipeline_variants_damaged.bin");
+    std::vector<PipelineVariant> variants(1);
+
+    // a count far beyond the file size.
+    {
+        OFileArchive archive(path);
+        archive << uint32_t(0x56505053) << uint32_t(1) << uint32_t(0xFFFFFFFF);
+    }
+    ASSERT_FALSE(PipelineCompiler::LoadVariants(path, variants));
+    ASSERT_EQ(variants.size(), 1);
+
+    // one record that stops inside its attribute list.
+    {
+        OFileArchive archive(path);
+        archive << uint32_t(0x56505053) << uint32_t(1) << uint32_t(1);
+        archive << std::string("tech");
+        for (uint32_t i = 0; i < ShaderVariantKey::U64L; ++i) {
+            archive << uint64_t(0);
+        }
+        archive << uint8_t(0) << rhi::PrimitiveTopology::TRIANGLE_LIST << rhi::PolygonMode::FILL;
+        archive << uint32_t(0) << uint32_t(0);
+        archive << uint32_t(2) << uint32_t(0);
+    }
+    ASSERT_FALSE(PipelineCompiler::LoadVariants(path, variants));
+    ASSERT_EQ(variants.size(), 1);
+
+    std::filesystem::remove(path.GetStr());
+}
+
+TEST(PipelineCompilerTest, AsyncCompileTest)
+{
+    std::promise<void> release;
+    auto gate = release.get_future().share();
+    std::atomic<uint32_t> builds = 0;
+
+    PipelineCompiler compiler;
+    compiler.SetBuilder([&gate, &builds](const PipelineRequest &) {
+        gate.wait();
+        ++builds;
+        return std::make_shared<rhi::GraphicsPipeline>();
+    });
+
+    auto request = MakeRequest(RDProgramPtr(new Program()), std::make_shared<TestRenderPass>(1));
+    ASSERT_EQ(compiler.RequestPso(request), nullptr);
+    ASSERT_EQ(compiler.GetPendingCount(), 1);
+
+    // the same key does not queue a second job while the first one runs.
+    ASSERT_EQ(compiler.RequestPso(request), nullptr);
+    ASSERT_EQ(compiler.GetPendingCount(), 1);
+
+    release.set_value();
+    compiler.WaitIdle();
+    ASSERT_EQ(compiler.GetPendingCount(), 0);
+    ASSERT_NE(compiler.RequestPso(request), nullptr);
+    ASSERT_EQ(builds.load(), 1);
+}
+
+TEST(PipelineCompilerTest, FallbackTest)
+{
+    std::promise<void> release;
+    auto gate = release.get_future().share();
+
+    RDProgramPtr slow(new Program());
+    RDProgramPtr fallback(new Program());
+
+    PipelineCompiler compiler;
+    compiler.SetBuilder([&gate, slowProgram = slow.Get()](const PipelineRequest &request) {
+        if (request.program.Get() == slowProgram) {
+            gate.wait();
+        }
+        return std::make_shared<rhi::GraphicsPipeline>();
+    });
+
+    auto pass = std::make_shared<TestRenderPass>(1);
+    ASSERT_EQ(compiler.RequestPso(MakeRequest(slow, pass)), nullptr);
+
+    // the fallback is built on the calling thread while the batch pipeline is still compiling.
+    auto fallbackPso = compiler.RequestPsoSync(MakeRequest(fallback, pass));
+    ASSERT_NE(fallbackPso, nullptr);
+    ASSERT_EQ(compiler.RequestPsoSync(MakeRequest(fallback, pass)), fallbackPso);
+    ASSERT_EQ(compiler.GetPendingCount(), 1);
+
+    release.set_value();
+    compiler.WaitIdle();
+    auto pso = compiler.RequestPso(MakeRequest(slow, pass));
+    ASSERT_NE(pso, nullptr);
+    ASSERT_NE(pso, fallbackPso);
+}
+
+TEST(PipelineCompilerTest, PrewarmTest)
+{
+    uint32_t builds = 0;
+
+    PipelineCompiler compiler;
+    compiler.SetAsync(false);
+    compiler.SetBuilder([&builds](const PipelineRequest &) {
+        ++builds;
+        return std::make_shared<rhi::GraphicsPipeline>();
+    });
+
+    RDProgramPtr warm(new Program());
+    RDProgramPtr other(new Program());
+    compiler.Defer(7, MakeRequest(warm, nullptr));
+    ASSERT_EQ(builds, 0);
+
+    // a pass with another hash leaves the deferred request alone.
+    ASSERT_NE(compiler.RequestPso(MakeRequest(other, std::make_shared<TestRenderPass>(3))), nullptr);
+    ASSERT_EQ(builds, 1);
+
+    // the first pass with a matching hash compiles it.
+    auto pass = std::make_shared<TestRenderPass>(7);
+    ASSERT_NE(compiler.RequestPso(MakeRequest(other, pass)), nullptr);
+    ASSERT_EQ(builds, 3);
+
+    // the pre-warmed pipeline is ready when it is requested.
+    ASSERT_NE(compiler.RequestPso(MakeRequest(warm, pass)), nullptr);
+    ASSERT_EQ(builds, 3);
+}
+
+TEST(PipelineCompilerTest, VariantFileTest)
+{
+    PipelineCompiler compiler;
+    compiler.SetAsync(false);
+    compiler.SetBuilder([](const PipelineRequest &) {
+        return std::make_shared<rhi::GraphicsPipeline>();
+    });
+
+    PipelineVariant variant = {};
+    variant.technique = Name("tech");
+    variant.key = ShaderVariantKey(5);
+    variant.meshShading = true;
+    variant.topo = rhi::PrimitiveTopology::LINE_LIST;
+    variant.passHash = 7;
+    variant.subPassID = 1;
+    variant.attributes = {{0, 0, 0, rhi::Format::F_RGB32}};
+    variant.bindings = {{0, 12, rhi::VertexInputRate::PER_VERTEX}};
+    compiler.RequestPso(MakeRequest(RDProgramPtr(new Program()), std::make_shared<TestRenderPass>(7)), &variant);
+
+    auto path = FilePath(std::filesystem::temp_directory_path() / "sky_pipeline_variants.bin");
+    ASSERT_TRUE(compiler.SaveVariants(path));
+
+    std::vector<PipelineVariant> variants;
+    ASSERT_TRUE(PipelineCompiler::LoadVariants(path, variants));
+    ASSERT_EQ(variants.size(), 1);
+    ASSERT_EQ(variants[0].technique, variant.technique);
+    ASSERT_EQ(variants[0].key, variant.key);
+    ASSERT_TRUE(variants[0].meshShading);
+    ASSERT_EQ(variants[0].topo, rhi::PrimitiveTopology::LINE_LIST);
+    ASSERT_EQ(variants[0].passHash, 7);
+    ASSERT_EQ(variants[0].subPassID, 1);
+    ASSERT_EQ(variants[0].attributes.size(), 1);
+    ASSERT_EQ(variants[0].attributes[0].format, rhi::Format::F_RGB32);
+    ASSERT_EQ(variants[0].bindings.size(), 1);
+    ASSERT_EQ(variants[0].bindings[0].stride, 12);
+
+    std::filesystem::remove(path.GetStr());
+}
@@ -0,0 +1,57 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <gtest/gtest.h>
+#include <render/SceneCulling.h>
+#include <render/RenderPrimitive.h>
+#include <core/shapes/Shapes.h>
+#include <core/math/MathUtil.h>
+#include <bit>
+#include <random>
+
+using namespace sky;
+
+TEST(RenderCullingTest, SoAMatchesAABBTest)
+{
+    static constexpr uint32_t PRIMITIVE_COUNT = 2000;
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> pos(-500.f, 500.f);
+    std::uniform_real_distribution<float> ext(0.5f, 8.f);
+
+    std::vector<RenderPrimitive> storage(PRIMITIVE_COUNT);
+    PmrUnSyncPoolRes resource;
+    PmrVector<RenderPrimitive *> primitives(&resource);
+    for (auto &prim : storage) {
+        Vector3 center(pos(rng), pos(rng), pos(rng));
+        Vector3 half(ext(rng), ext(rng), ext(rng));
+        prim.worldBound = AABB{center - half, center + half};
+        primitives.emplace_back(&prim);
+    }
+
+    Matrix4 view = Matrix4::Identity();
+    view.Translate(Vector3(0.f, 0.f, 200.f));
+    const Frustum frustum = CreateFrustumByViewProjectMatrix(MakePerspective(ToRadian(60.f), 1.f, 0.1f, 600.f) * view.Inverse());
+
+    SceneCulling culling(&resource);
+    culling.Update(primitives);
+    std::vector<uint64_t> visibility(culling.GetWordCount(), 0);
+    culling.Cull(&frustum, 1, visibility.data());
+
+    // every primitive gets the same answer as the per primitive test.
+    uint32_t visible = 0;
+    for (uint32_t i = 0; i < PRIMITIVE_COUNT; ++i) {
+        bool expected = Intersection(primitives[i]->worldBound, frustum);
+        bool soa      = (visibility[i / 64] >> (i % 64)) & 1;
+        ASSERT_EQ(soa, expected) << i;
+        visible += expected ? 1 : 0;
+    }
+    ASSERT_GT(visible, 0);
+
+    uint32_t counted = 0;
+    for (auto word : visibility) {
+        counted += static_cast<uint32_t>(std::popcount(word));
+    }
+    ASSERT_EQ(counted, visible);
+}
@@ -0,0 +1,109 @@
+//
+// Created by blues on 2026/10/16.
+//
+
+#include <gtest/gtest.h>
+#include <render/SceneCulling.h>
+#include <render/GPUCulling.h>
+#include <render/RenderPrimitive.h>
+#include <core/shapes/Shapes.h>
+#include <core/math/MathUtil.h>
+#include <bit>
+#include <chrono>
+#include <random>
+
+using namespace sky;
+
+namespace {
+
+    constexpr uint32_t PRIMITIVE_NUM = 100000;
+    constexpr uint32_t QUEUE_NUM     = 3; // depth, shadow, forward sharing the same view.
+
+    double ElapsedMs(std::chrono::steady_clock::time_point begin)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+} // namespace
+
+TEST(RenderBench, SoACulling)
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> pos(-500.f, 500.f);
+    std::uniform_real_distribution<float> ext(0.5f, 8.f);
+
+    std::vector<RenderPrimitive> storage(PRIMITIVE_NUM);
+    PmrUnSyncPoolRes resource;
+    PmrVector<RenderPrimitive *> primitives(&resource);
+    for (auto &prim : storage) {
+        Vector3 center(pos(rng), pos(rng), pos(rng));
+        Vector3 half(ext(rng), ext(rng), ext(rng));
+        prim.worldBound = AABB{center - half, center + half};
+        primitives.emplace_back(&prim);
+    }
+
+    Matrix4 view = Matrix4::Identity();
+    view.Translate(Vector3(0.f, 0.f, 200.f));
+    const Frustum frustum = CreateFrustumByViewProjectMatrix(MakePerspective(ToRadian(60.f), 1.f, 0.1f, 600.f) * view.Inverse());
+
+    auto begin = std::chrono::steady_clock::now();
+    uint32_t baseline = 0;
+    for (uint32_t q = 0; q < QUEUE_NUM; ++q) {
+        for (const auto *prim : primitives) {
+            baseline += Intersection(prim->worldBound, frustum) ? 1 : 0;
+        }
+    }
+    double perQueue = ElapsedMs(begin);
+
+    begin = std::chrono::steady_clock::now();
+    SceneCulling culling(&resource);
+    culling.Update(primitives);
+    double update = ElapsedMs(begin);
+
+    begin = std::chrono::steady_clock::now();
+    std::vector<uint64_t> visibility(culling.GetWordCount(), 0);
+    culling.Cull(&frustum, 1, visibility.data());
+    uint32_t soa = 0;
+    for (uint32_t q = 0; q < QUEUE_NUM; ++q) {
+        for (auto word : visibility) {
+            soa += static_cast<uint32_t>(std::popcount(word));
+        }
+    }
+    double shared = ElapsedMs(begin);
+
+    ASSERT_EQ(baseline, soa);
+    printf("[RenderBench] %u primitives, %u queues, %u visible\n", PRIMITIVE_NUM, QUEUE_NUM, soa / QUEUE_NUM);
+    printf("[RenderBench] per queue aabb culling %.3fms, soa bounds update %.3fms, soa shared culling %.3fms\n",
+        perQueue, update, shared);
+}
+
+TEST(RenderBench, GPUCullInstances)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> pos(-100.f, 100.f);
+
+    std::vector<GPUInstance> instances(PRIMITIVE_NUM);
+    for (uint32_t i = 0; i < PRIMITIVE_NUM; ++i) {
+        auto &instance = instances[i];
+        instance.worldMatrix  = Matrix4::Identity();
+        instance.boundCenter  = Vector4(pos(rng), pos(rng), pos(rng), 0.f);
+        instance.boundExtent  = Vector4(1.f, 1.f, 1.f, 0.f);
+        instance.indexCount   = 36;
+        instance.commandIndex = i;
+        instance.flags        = static_cast<uint32_t>(GPUInstanceFlagBit::VALID);
+    }
+
+    Matrix4 viewProject = MakePerspective(ToRadian(60.f), 1.f, 0.1f, 100.f);
+    GPUCullConstants constants = {};
+    FillCullConstants(constants, CreateFrustumByViewProjectMatrix(viewProject), viewProject, Vector3(0.f, 0.f, 0.f));
+    constants.flags = static_cast<uint32_t>(GPUCullFlagBit::FRUSTUM);
+    constants.instanceCount = PRIMITIVE_NUM;
+
+    std::vector<GPUDrawCommand> commands(PRIMITIVE_NUM);
+    auto begin = std::chrono::steady_clock::now();
+    uint32_t visible = GPUCullInstances(constants, instances.data(), nullptr, commands.data());
+    double cull = ElapsedMs(begin);
+
+    ASSERT_GT(visible, 0);
+    printf("[RenderBench] %u instances, %u visible, cpu reference gpu culling %.3fms\n", PRIMITIVE_NUM, visible, cull);
+}
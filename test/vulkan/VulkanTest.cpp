@@ -50,3 +50,48 @@ public:
 
 };
 
+
+TEST_F(VulkanTest, PipelineLibraryTest)
+{
+    ASSERT_NE(device, nullptr);
+    ASSERT_FALSE(device->GetPipelineLibraryKey().empty());
+
+    PipelineLibrary::Descriptor desc = {};
+    desc.externalSynchronized = false;
+    auto library = device->CreateDeviceObject<PipelineLibrary>(desc);
+    ASSERT_NE(library, nullptr);
+    ASSERT_FALSE(library->HasInitialData());
+
+    std::vector<uint8_t> data;
+    ASSERT_TRUE(library->Serialize(data));
+
+    // the blob of this device is accepted again.
+    desc.data = reinterpret_cast<const char *>(data.data());
+    desc.dataSize = static_cast<uint32_t>(data.size());
+    auto reloaded = device->CreateDeviceObject<PipelineLibrary>(desc);
+    ASSERT_NE(reloaded, nullptr);
+    ASSERT_TRUE(reloaded->HasInitialData());
+    ASSERT_TRUE(reloaded->Merge({library}));
+
+    std::vector<uint8_t> merged;
+    ASSERT_TRUE(reloaded->Serialize(merged));
+    ASSERT_FALSE(merged.empty());
+
+    // damaged data is dropped, the library still starts empty.
+    data.back() ^= 0xFF;
+    auto damaged = device->CreateDeviceObject<PipelineLibrary>(desc);
+    ASSERT_NE(damaged, nullptr);
+    ASSERT_FALSE(damaged->HasInitialData());
+
+    std::vector<uint8_t> empty;
+    std::vector<uint8_t> dropped;
+    ASSERT_TRUE(library->Serialize(empty));
+    ASSERT_TRUE(damaged->Serialize(dropped));
+    ASSERT_EQ(dropped.size(), empty.size());
+
+    device->SetPipelineLibrary(library);
+    ASSERT_EQ(device->GetPipelineLibrary(), library);
+    auto stats = device->GetPipelineLibraryStats();
+    ASSERT_LE(stats.libraryHit, stats.miss);
+    device->SetPipelineLibrary(nullptr);
+}